@@ -0,0 +1,126 @@
+// g++ -I../include --std=c++11 -O2 -o benchmark_pathological_splits benchmark_pathological_splits.cpp
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <random>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <stdexcept>
+
+
+#include "rfr/splits/binary_split_one_feature_rss_loss.hpp"
+
+
+typedef double num_type;
+typedef double response_type;
+typedef unsigned int index_type;
+typedef std::default_random_engine rng_type;
+
+typedef rfr::splits::binary_split_one_feature_rss_loss<num_type, response_type, index_type, rng_type> split_type;
+typedef rfr::splits::data_info_t<num_type, response_type, index_type> info_type;
+
+
+// the scan used before the prefix sums: the right child's statistic is popped point by point
+// and rebuilt from scratch whenever pop() throws; num_rebuilds counts how often that happens
+num_type old_best_split_continuous(std::vector<info_type>::iterator infos_begin, std::vector<info_type>::iterator infos_end,
+									rfr::util::weighted_running_statistics<num_type> right_stat, long &num_rebuilds){
+	std::sort(infos_begin, infos_end, [] (const info_type &a, const info_type &b) {return (a.feature < b.feature);});
+
+	rfr::util::weighted_running_statistics<num_type> left_stat;
+	num_type best_loss = std::numeric_limits<num_type>::infinity();
+
+	for (auto it = infos_begin;true;){
+		num_type psv = (*it).feature + 1e-6;
+		do {
+			left_stat.push((*it).response, (*it).weight);
+			try{
+				right_stat.pop((*it).response, (*it).weight);
+			}
+			catch (const std::runtime_error& e){
+				++num_rebuilds;
+				right_stat = rfr::util::weighted_running_statistics<num_type> ();
+				for (auto tmp_it = it+1; tmp_it != infos_end; tmp_it++)
+					right_stat.push((*tmp_it).response, (*tmp_it).weight);
+			}
+			++it;
+		} while ((it != infos_end) && ((*it).feature <= psv));
+
+		if (it == infos_end) break;
+
+		num_type loss = left_stat.squared_deviations_from_the_mean() + right_stat.squared_deviations_from_the_mean();
+		if (loss < best_loss)
+			best_loss = loss;
+	}
+	return(best_loss);
+}
+
+
+// seconds for one split of a single continuous feature with the old and the new scan, both including the sort
+std::array<double, 2> time_split(const std::vector<response_type> &responses, const std::vector<num_type> &weights, rng_type &rng, long &num_rebuilds){
+	// the feature is the position, so the heavy blocks of the decaying weights are removed one after another
+	std::vector<info_type> infos(responses.size());
+	for (auto i=0u; i < responses.size(); ++i){
+		infos[i].index = i;
+		infos[i].response = responses[i];
+		infos[i].weight = weights[i];
+		infos[i].feature = i;
+	}
+
+	rfr::util::weighted_running_statistics<num_type> total_stat;
+	for (auto &i: infos)
+		total_stat.push(i.response, i.weight);
+
+	std::array<double, 2> times;
+	auto old_infos = infos;
+	clock_t t = clock();
+	old_best_split_continuous(old_infos.begin(), old_infos.end(), total_stat, num_rebuilds);
+	times[0] = double(clock() - t)/CLOCKS_PER_SEC;
+
+	split_type split;
+	num_type split_value;
+	t = clock();
+	split.best_split_continuous(infos.begin(), infos.end(), split_value, total_stat, 1, 0, rng);
+	times[1] = double(clock() - t)/CLOCKS_PER_SEC;
+	return(times);
+}
+
+
+int main (int argc, char** argv){
+
+	if (argc != 2){
+		std::cout<<"need arguments: <max num datapoints>"<<std::endl;
+		exit(0);
+	}
+
+	index_type max_num_data_points = atoi(argv[1]);
+
+	rng_type rng;
+	std::normal_distribution<response_type> noise(0, 1);
+
+	// seconds of the old and the new scan, and how often the old one had to rebuild the right child's statistic
+	std::cout<<"num datapoints\trandom (old/new, rebuilds)\tnearly constant (old/new, rebuilds)\tconstant, decaying weights (old/new, rebuilds)"<<std::endl;
+	for (index_type n = 1000; n <= max_num_data_points; n *= 2){
+		std::vector<response_type> random(n), nearly_constant(n), constant(n, 7.1);
+		std::vector<num_type> unit_weights(n, 1), decaying_weights(n);
+		for (auto i=0u; i < n; ++i){
+			random[i] = noise(rng);
+			nearly_constant[i] = 1e8 + 1e-4*(i%2);
+			// the weights drop by three orders of magnitude in each of 25 blocks, so removing a heavy
+			// block leaves the statistics of the right child dominated by round off and pop() throws
+			decaying_weights[i] = std::pow(1e3, -double(i/((n+24)/25)));
+		}
+
+		long rebuilds_random = 0, rebuilds_nearly_constant = 0, rebuilds_constant = 0;
+		auto t_random = time_split(random, unit_weights, rng, rebuilds_random);
+		auto t_nearly_constant = time_split(nearly_constant, unit_weights, rng, rebuilds_nearly_constant);
+		auto t_constant = time_split(constant, decaying_weights, rng, rebuilds_constant);
+
+		std::cout<<n<<"\t"<<t_random[0]<<"/"<<t_random[1]<<", "<<rebuilds_random
+				<<"\t"<<t_nearly_constant[0]<<"/"<<t_nearly_constant[1]<<", "<<rebuilds_nearly_constant
+				<<"\t"<<t_constant[0]<<"/"<<t_constant[1]<<", "<<rebuilds_constant<<std::endl;
+	}
+    return(0);
+}
@@ -0,0 +1,99 @@
+// g++ -I../include --std=c++11 -O2 -o benchmark_presorted_fit benchmark_presorted_fit.cpp
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <ctime>
+#include <cstdlib>
+#include <limits>
+#include <algorithm>
+
+
+#include "rfr/data_containers/default_data_container.hpp"
+#include "rfr/splits/binary_split_one_feature_rss_loss.hpp"
+#include "rfr/nodes/k_ary_node.hpp"
+#include "rfr/trees/tree_options.hpp"
+#include "rfr/trees/k_ary_tree.hpp"
+
+
+typedef double num_type;
+typedef double response_type;
+typedef unsigned int index_type;
+typedef std::default_random_engine rng_type;
+
+typedef rfr::data_containers::default_container<num_type, response_type, index_type> data_container_type;
+typedef rfr::splits::binary_split_one_feature_rss_loss<num_type, response_type, index_type, rng_type> split_type;
+typedef rfr::nodes::k_ary_node_full<2, split_type, num_type, response_type, index_type, rng_type> node_type;
+typedef rfr::trees::k_ary_random_tree<2, node_type, num_type, response_type, index_type, rng_type> tree_type;
+
+
+// seconds to fit num_trees trees on the same data, all with the same workspace
+double time_fit(const data_container_type &data, rfr::trees::tree_options<num_type, response_type, index_type> tree_opts,
+				index_type num_trees, index_type &num_nodes){
+	std::vector<num_type> sample_weights(data.num_data_points(), 1);
+	tree_type::workspace_t workspace;
+	rng_type rng(1);
+
+	num_nodes = 0;
+	clock_t t = clock();
+	for (auto i = 0u; i < num_trees; ++i){
+		tree_type tree;
+		tree.fit(data, tree_opts, sample_weights, rng, nullptr, workspace);
+		num_nodes += tree.number_of_nodes();
+	}
+	return(double(clock() - t)/CLOCKS_PER_SEC);
+}
+
+
+int main (int argc, char** argv){
+
+	if (argc != 4){
+		std::cout<<"need arguments: <num features> <max num datapoints> <num trees>"<<std::endl;
+		exit(0);
+	}
+
+	index_type num_features = atoi(argv[1]);
+	index_type max_num_data_points = atoi(argv[2]);
+	index_type num_trees = atoi(argv[3]);
+
+	rng_type rng;
+	std::uniform_real_distribution<num_type> uniform(0, 1);
+	std::normal_distribution<response_type> noise(0, 0.1);
+
+	// one thread, all features at every node and no limit on the depth, so the presorted
+	// data is partitioned at every node and scanned for every feature
+	rfr::trees::tree_options<num_type, response_type, index_type> tree_opts;
+	tree_opts.max_features = num_features;
+	tree_opts.num_threads = 1;
+
+	std::cout<<"num datapoints\tnum nodes\tsorting at every node [s]\tpresorted [s]"<<std::endl;
+	for (index_type n = 10000; n <= max_num_data_points; n *= 2){
+		data_container_type data(num_features);
+		std::vector<num_type> features(num_features);
+		for (auto i = 0u; i < n; ++i){
+			for (auto &f: features)
+				f = uniform(rng);
+			// every tenth feature only takes a few values, so the scans have to handle ties
+			for (auto j = 0u; j < num_features; j += 10)
+				features[j] = std::floor(8*features[j]);
+			data.add_data_point(features, std::sin(6*features[1]) + features[2]*features[3] + noise(rng));
+		}
+
+		// the fastest of a few alternating runs, which is less sensitive to other processes
+		index_type num_nodes_sorting, num_nodes_presorted;
+		double t_sorting = std::numeric_limits<double>::infinity(), t_presorted = t_sorting;
+		for (auto r = 0u; r < 3; ++r){
+			tree_opts.presort_features = false;
+			t_sorting = std::min(t_sorting, time_fit(data, tree_opts, num_trees, num_nodes_sorting));
+			tree_opts.presort_features = true;
+			t_presorted = std::min(t_presorted, time_fit(data, tree_opts, num_trees, num_nodes_presorted));
+		}
+
+		if (num_nodes_sorting != num_nodes_presorted)
+			std::cout<<"the trees differ!"<<std::endl;
+
+		std::cout<<n<<"\t"<<num_nodes_presorted<<"\t"<<t_sorting<<"\t"<<t_presorted<<std::endl;
+	}
+    return(0);
+}
@@ -0,0 +1,103 @@
+// g++ -I../include --std=c++11 -O2 -o benchmark_quickscorer benchmark_quickscorer.cpp -pthread
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <algorithm>
+
+
+#include "rfr/data_containers/default_data_container.hpp"
+#include "rfr/splits/binary_split_one_feature_rss_loss.hpp"
+#include "rfr/nodes/k_ary_node.hpp"
+#include "rfr/trees/k_ary_tree.hpp"
+#include "rfr/forests/regression_forest.hpp"
+
+
+typedef double num_type;
+typedef double response_type;
+typedef unsigned int index_type;
+typedef std::default_random_engine rng_type;
+
+typedef rfr::data_containers::default_container<num_type, response_type, index_type> data_container_type;
+typedef rfr::splits::binary_split_one_feature_rss_loss<num_type, response_type, index_type, rng_type> split_type;
+typedef rfr::nodes::k_ary_node_full<2, split_type, num_type, response_type, index_type, rng_type> node_type;
+typedef rfr::trees::k_ary_random_tree<2, node_type, num_type, response_type, index_type, rng_type> tree_type;
+typedef rfr::forests::regression_forest<tree_type, num_type, response_type, index_type, rng_type> forest_type;
+typedef rfr::forests::quickscorer_forest<num_type, response_type, index_type> quickscorer_type;
+
+
+// the fastest of a few runs of f, in seconds
+template <typename function_t>
+double best_time(function_t f){
+	double best = std::numeric_limits<double>::infinity();
+	for (auto r = 0u; r < 5; ++r){
+		auto t = std::chrono::steady_clock::now();
+		f();
+		best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - t).count());
+	}
+	return(best);
+}
+
+
+int main (int argc, char** argv){
+
+	if (argc != 4){
+		std::cout<<"need arguments: <num features> <num queries> <num trees>"<<std::endl;
+		exit(0);
+	}
+
+	index_type num_features = atoi(argv[1]);
+	index_type num_queries = atoi(argv[2]);
+	index_type num_trees = atoi(argv[3]);
+
+	rng_type rng;
+	std::uniform_real_distribution<num_type> uniform(0, 1);
+	std::normal_distribution<response_type> noise(0, 0.1);
+
+	data_container_type data(num_features);
+	std::vector<num_type> features(num_features);
+	for (auto i = 0u; i < 10000; ++i){
+		for (auto &f: features)
+			f = uniform(rng);
+		data.add_data_point(features, std::sin(6*features[0]) + features[1]*features[2] + noise(rng));
+	}
+
+	std::vector<num_type> queries(static_cast<size_t>(num_queries)*num_features);
+	for (auto &q: queries)
+		q = uniform(rng);
+
+	std::cout<<"instruction sets: up to "<<quickscorer_type::num_lanes(quickscorer_type::best_instruction_set())<<" rows per pass"<<std::endl;
+	std::cout<<"max depth\tforest [s]\tquickscorer scalar [s]\tAVX2 [s]\tAVX-512 [s]"<<std::endl;
+	for (index_type depth = 2; depth <= 6; depth += 2){
+		rfr::trees::tree_options<num_type, response_type, index_type> tree_opts;
+		tree_opts.max_features = num_features;
+		tree_opts.max_depth = depth;
+		rfr::forests::forest_options<num_type, response_type, index_type> forest_opts(tree_opts);
+		forest_opts.num_trees = num_trees;
+		forest_opts.num_data_points_per_tree = data.num_data_points();
+		forest_opts.num_threads = 1;
+
+		forest_type forest(forest_opts);
+		forest.fit(data, rng);
+		auto qs = forest.make_quickscorer();
+
+		std::vector<response_type> forest_predictions(num_queries), predictions(num_queries);
+		std::cout<<depth<<"\t"<<best_time([&] (){forest.predict_batch(queries.data(), num_queries, num_features, forest_predictions.data());});
+
+		for (int set = quickscorer_type::scalar; set <= quickscorer_type::avx512; ++set){
+			if (set > quickscorer_type::best_instruction_set()){
+				std::cout<<"\t-";
+				continue;
+			}
+			std::cout<<"\t"<<best_time([&] (){qs.predict_batch(queries.data(), num_queries, num_features, predictions.data(), quickscorer_type::instruction_set_t(set));});
+			if (predictions != forest_predictions)
+				std::cout<<" (the predictions differ!)";
+		}
+		std::cout<<std::endl;
+	}
+    return(0);
+}
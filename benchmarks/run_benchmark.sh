@@ -20,3 +20,12 @@ g++ -I../include/ -O$O_level -Wall -pg -o benchmark_rss_v2 -std=c++11 benchmark_
 time ./benchmark_rss_v2 $num_feats $num_datapoints $num_samples $num_trees
 gprof benchmark_rss_v2 gmon.out > analysis_v2.txt
 gprof benchmark_rss_v2 | python /home/sfalkner/.local/lib/python3.5/site-packages/gprof2dot.py -s | dot -Tpng -o graph_v2.png
+
+g++ -I../include/ -O$O_level -Wall -o benchmark_pathological_splits -std=c++11 benchmark_pathological_splits.cpp
+./benchmark_pathological_splits $num_datapoints
+
+g++ -I../include/ -O$O_level -Wall -o benchmark_presorted_fit -std=c++11 benchmark_presorted_fit.cpp
+./benchmark_presorted_fit 20 $num_datapoints 2
+
+g++ -I../include/ -O$O_level -Wall -o benchmark_quickscorer -std=c++11 benchmark_quickscorer.cpp -pthread
+./benchmark_quickscorer 20 $num_datapoints 100
@@ -0,0 +1,16420 @@
+// generated by rfr::forests::cpp_code_generator
+// compile without -ffast-math to get exactly the predictions of the original forest
+
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace {
+
+typedef double num_t;
+typedef double response_t;
+
+struct leaf_t{ num_t mean, variance_frequency, variance_importance; };
+
+struct running_statistics{
+	long unsigned int N = 0;
+	num_t avg = 0, sdm = 0;
+	void push(num_t x){ ++N; num_t delta = x - avg; avg += delta/N; sdm += delta*(x-avg); }
+	num_t divide_sdm_by(num_t value) const { return(N>1 ? std::max<num_t>(0.,sdm/value) : NAN); }
+	num_t mean() const { return(N>0 ? avg : NAN); }
+	num_t variance_sample() const { return(divide_sdm_by(N-1)); }
+};
+
+inline void push_leaf(const leaf_t &leaf, int weighted_data, running_statistics &mean_stats, running_statistics &var_stats){
+	mean_stats.push(leaf.mean);
+	var_stats.push(weighted_data ? leaf.variance_importance : leaf.variance_frequency);
+}
+
+inline bool in_set(const unsigned char *set, std::size_t size, num_t value){
+	std::size_t v = std::size_t(int(value));
+	return((v < size) && set[v]);
+}
+
+static const leaf_t tree_0_leaves[] = {
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.56000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.54000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.89000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.26000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.67000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.84000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.12000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.86000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.93000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.88000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_0_find_leaf(const num_t *x){
+		if (x[2] > 1.36945626467564543e-02) goto n2;
+		goto n1;
+	n1:
+		if (x[7] > 3.28043829657528804e-02) goto n4;
+		goto n3;
+	n3:
+		if (x[8] > 2.48362235454076333e-02) goto n8;
+		goto n7;
+	n7:
+		if (x[6] > 2.13890053119024405e-02) goto n16;
+		goto n15;
+	n15:
+		if (x[7] > -8.09998424309389328e-03) goto n32;
+		goto n31;
+	n31:
+		if (x[3] > 4.19702032277050607e-02) goto n58;
+		goto n57;
+	n57:
+		if (x[0] > -8.55121841224512624e-02) goto n92;
+		goto n91;
+	n91:
+		if (x[9] > -5.35648605332263231e-02) goto n142;
+		goto n141;
+	n141:
+		if (x[4] > -6.23173151098844816e-02) goto n198;
+		goto n197;
+	n197:
+		return(tree_0_leaves[0]);
+	n198:
+		return(tree_0_leaves[1]);
+	n142:
+		if (x[8] > -6.75156725637559574e-02) goto n200;
+		goto n199;
+	n199:
+		return(tree_0_leaves[2]);
+	n200:
+		return(tree_0_leaves[3]);
+	n92:
+		if (x[8] > -4.82155458605976125e-02) goto n144;
+		goto n143;
+	n143:
+		if (x[4] > -3.92800776158519493e-02) goto n202;
+		goto n201;
+	n201:
+		if (x[5] > -3.53518163592615869e-02) goto n248;
+		goto n247;
+	n247:
+		if (x[9] > -3.37829417135989130e-02) goto n316;
+		goto n315;
+	n315:
+		if (x[6] > 6.81662145230127817e-04) goto n378;
+		goto n377;
+	n377:
+		if (x[9] > -7.18829078369130209e-02) goto n422;
+		goto n421;
+	n421:
+		return(tree_0_leaves[4]);
+	n422:
+		if (x[1] > 3.52175078033677147e-03) goto n458;
+		goto n457;
+	n457:
+		return(tree_0_leaves[5]);
+	n458:
+		return(tree_0_leaves[6]);
+	n378:
+		return(tree_0_leaves[7]);
+	n316:
+		return(tree_0_leaves[8]);
+	n248:
+		if (x[2] > -7.55533132293917664e-02) goto n318;
+		goto n317;
+	n317:
+		return(tree_0_leaves[9]);
+	n318:
+		return(tree_0_leaves[10]);
+	n202:
+		if (x[2] > -1.23353905269823674e-02) goto n250;
+		goto n249;
+	n249:
+		return(tree_0_leaves[11]);
+	n250:
+		return(tree_0_leaves[12]);
+	n144:
+		if (x[2] > -2.42949065738726523e-02) goto n204;
+		goto n203;
+	n203:
+		if (x[4] > -7.92652203917608017e-02) goto n252;
+		goto n251;
+	n251:
+		if (x[9] > -1.23674293119035057e-02) goto n320;
+		goto n319;
+	n319:
+		if (x[9] > -6.61111482739257517e-02) goto n380;
+		goto n379;
+	n379:
+		return(tree_0_leaves[13]);
+	n380:
+		return(tree_0_leaves[14]);
+	n320:
+		return(tree_0_leaves[15]);
+	n252:
+		if (x[3] > -3.41920279031455859e-02) goto n322;
+		goto n321;
+	n321:
+		if (x[2] > -5.76923813714975767e-02) goto n382;
+		goto n381;
+	n381:
+		return(tree_0_leaves[16]);
+	n382:
+		if (x[1] > -3.02032105423888919e-02) goto n424;
+		goto n423;
+	n423:
+		if (x[4] > -3.30150110055485169e-02) goto n460;
+		goto n459;
+	n459:
+		return(tree_0_leaves[17]);
+	n460:
+		return(tree_0_leaves[18]);
+	n424:
+		return(tree_0_leaves[19]);
+	n322:
+		if (x[0] > -1.78689126516192523e-02) goto n384;
+		goto n383;
+	n383:
+		if (x[6] > -3.89030269337325985e-03) goto n426;
+		goto n425;
+	n425:
+		return(tree_0_leaves[20]);
+	n426:
+		return(tree_0_leaves[21]);
+	n384:
+		return(tree_0_leaves[22]);
+	n204:
+		if (x[2] > -1.21755490549268555e-02) goto n254;
+		goto n253;
+	n253:
+		if (x[0] > 2.16446165351690673e-02) goto n324;
+		goto n323;
+	n323:
+		return(tree_0_leaves[23]);
+	n324:
+		if (x[5] > -1.54903816725010281e-02) goto n386;
+		goto n385;
+	n385:
+		return(tree_0_leaves[24]);
+	n386:
+		return(tree_0_leaves[25]);
+	n254:
+		if (x[3] > 7.19195271871051704e-03) goto n326;
+		goto n325;
+	n325:
+		if (x[3] > -2.77955707988042124e-02) goto n388;
+		goto n387;
+	n387:
+		if (x[9] > -9.01563180347000337e-02) goto n428;
+		goto n427;
+	n427:
+		return(tree_0_leaves[26]);
+	n428:
+		return(tree_0_leaves[27]);
+	n388:
+		if (x[2] > -9.69007801743505294e-03) goto n430;
+		goto n429;
+	n429:
+		return(tree_0_leaves[28]);
+	n430:
+		return(tree_0_leaves[29]);
+	n326:
+		return(tree_0_leaves[30]);
+	n58:
+		if (x[9] > -3.74466728904247412e-03) goto n94;
+		goto n93;
+	n93:
+		if (x[0] > 1.47435702841899434e-02) goto n146;
+		goto n145;
+	n145:
+		return(tree_0_leaves[31]);
+	n146:
+		return(tree_0_leaves[32]);
+	n94:
+		return(tree_0_leaves[33]);
+	n32:
+		if (x[2] > -8.52429213544529316e-04) goto n60;
+		goto n59;
+	n59:
+		if (x[0] > -6.35169316856749600e-02) goto n96;
+		goto n95;
+	n95:
+		if (x[8] > 9.93537485874404838e-03) goto n148;
+		goto n147;
+	n147:
+		if (x[6] > -3.77783301209001984e-02) goto n206;
+		goto n205;
+	n205:
+		return(tree_0_leaves[34]);
+	n206:
+		return(tree_0_leaves[35]);
+	n148:
+		return(tree_0_leaves[36]);
+	n96:
+		if (x[6] > -1.18897367983283979e-02) goto n150;
+		goto n149;
+	n149:
+		if (x[5] > -2.97560423282555095e-02) goto n208;
+		goto n207;
+	n207:
+		if (x[5] > -3.84886846698440296e-02) goto n256;
+		goto n255;
+	n255:
+		return(tree_0_leaves[37]);
+	n256:
+		return(tree_0_leaves[38]);
+	n208:
+		if (x[2] > -1.52921202206844960e-02) goto n258;
+		goto n257;
+	n257:
+		if (x[5] > 1.59709823867950004e-02) goto n328;
+		goto n327;
+	n327:
+		if (x[2] > -3.80172212303680132e-02) goto n390;
+		goto n389;
+	n389:
+		return(tree_0_leaves[39]);
+	n390:
+		if (x[2] > -2.77503498232491708e-02) goto n432;
+		goto n431;
+	n431:
+		if (x[0] > -8.95800723774342264e-03) goto n462;
+		goto n461;
+	n461:
+		return(tree_0_leaves[40]);
+	n462:
+		if (x[8] > -2.60967712758839558e-02) goto n484;
+		goto n483;
+	n483:
+		return(tree_0_leaves[41]);
+	n484:
+		return(tree_0_leaves[42]);
+	n432:
+		if (x[4] > -2.39531256616002663e-02) goto n464;
+		goto n463;
+	n463:
+		return(tree_0_leaves[43]);
+	n464:
+		if (x[2] > -2.36852570737626361e-02) goto n486;
+		goto n485;
+	n485:
+		return(tree_0_leaves[44]);
+	n486:
+		return(tree_0_leaves[45]);
+	n328:
+		if (x[2] > -3.63043387337842333e-02) goto n392;
+		goto n391;
+	n391:
+		return(tree_0_leaves[46]);
+	n392:
+		return(tree_0_leaves[47]);
+	n258:
+		if (x[4] > -4.83120827887899562e-02) goto n330;
+		goto n329;
+	n329:
+		return(tree_0_leaves[48]);
+	n330:
+		if (x[5] > -1.98932756750126935e-02) goto n394;
+		goto n393;
+	n393:
+		return(tree_0_leaves[49]);
+	n394:
+		if (x[8] > -3.29685749980286082e-03) goto n434;
+		goto n433;
+	n433:
+		return(tree_0_leaves[50]);
+	n434:
+		return(tree_0_leaves[51]);
+	n150:
+		if (x[2] > -3.13549715013912850e-02) goto n210;
+		goto n209;
+	n209:
+		if (x[1] > -7.09918752180408591e-03) goto n260;
+		goto n259;
+	n259:
+		if (x[4] > 3.44648680090690451e-03) goto n332;
+		goto n331;
+	n331:
+		return(tree_0_leaves[52]);
+	n332:
+		return(tree_0_leaves[53]);
+	n260:
+		if (x[8] > -2.45302686917699617e-02) goto n334;
+		goto n333;
+	n333:
+		return(tree_0_leaves[54]);
+	n334:
+		return(tree_0_leaves[55]);
+	n210:
+		if (x[3] > -7.26209185556664222e-02) goto n262;
+		goto n261;
+	n261:
+		return(tree_0_leaves[56]);
+	n262:
+		if (x[8] > -3.01280906239203353e-02) goto n336;
+		goto n335;
+	n335:
+		if (x[0] > -1.07752333280348306e-02) goto n396;
+		goto n395;
+	n395:
+		return(tree_0_leaves[57]);
+	n396:
+		return(tree_0_leaves[58]);
+	n336:
+		if (x[9] > 5.43882832293028119e-03) goto n398;
+		goto n397;
+	n397:
+		return(tree_0_leaves[59]);
+	n398:
+		return(tree_0_leaves[60]);
+	n60:
+		if (x[4] > -3.94411395404675874e-02) goto n98;
+		goto n97;
+	n97:
+		return(tree_0_leaves[61]);
+	n98:
+		return(tree_0_leaves[62]);
+	n16:
+		if (x[6] > 1.79689996521638834e-01) goto n34;
+		goto n33;
+	n33:
+		if (x[5] > -1.01941172895197635e-01) goto n62;
+		goto n61;
+	n61:
+		if (x[3] > -4.66344155220493189e-03) goto n100;
+		goto n99;
+	n99:
+		return(tree_0_leaves[63]);
+	n100:
+		return(tree_0_leaves[64]);
+	n62:
+		if (x[3] > -3.90788037431892832e-02) goto n102;
+		goto n101;
+	n101:
+		if (x[0] > -6.95273833661360155e-04) goto n152;
+		goto n151;
+	n151:
+		if (x[4] > -3.67377140050486745e-02) goto n212;
+		goto n211;
+	n211:
+		if (x[6] > 4.02309188728323455e-02) goto n264;
+		goto n263;
+	n263:
+		return(tree_0_leaves[65]);
+	n264:
+		if (x[4] > -4.71168202096093475e-02) goto n338;
+		goto n337;
+	n337:
+		return(tree_0_leaves[66]);
+	n338:
+		return(tree_0_leaves[67]);
+	n212:
+		if (x[5] > -2.61036027336786769e-02) goto n266;
+		goto n265;
+	n265:
+		return(tree_0_leaves[68]);
+	n266:
+		if (x[4] > 5.92591186882798354e-02) goto n340;
+		goto n339;
+	n339:
+		if (x[5] > -1.66547172196453326e-02) goto n400;
+		goto n399;
+	n399:
+		return(tree_0_leaves[69]);
+	n400:
+		return(tree_0_leaves[70]);
+	n340:
+		return(tree_0_leaves[71]);
+	n152:
+		if (x[9] > -4.49422252660523075e-03) goto n214;
+		goto n213;
+	n213:
+		if (x[6] > 1.30362204525314607e-01) goto n268;
+		goto n267;
+	n267:
+		if (x[4] > -9.23234638068728269e-03) goto n342;
+		goto n341;
+	n341:
+		return(tree_0_leaves[72]);
+	n342:
+		if (x[7] > -3.83173312220496526e-02) goto n402;
+		goto n401;
+	n401:
+		return(tree_0_leaves[73]);
+	n402:
+		return(tree_0_leaves[74]);
+	n268:
+		return(tree_0_leaves[75]);
+	n214:
+		if (x[0] > 5.58746227846428356e-02) goto n270;
+		goto n269;
+	n269:
+		if (x[3] > -5.40930966785980183e-02) goto n344;
+		goto n343;
+	n343:
+		if (x[9] > 4.94383217610914749e-02) goto n404;
+		goto n403;
+	n403:
+		return(tree_0_leaves[76]);
+	n404:
+		return(tree_0_leaves[77]);
+	n344:
+		if (x[9] > 1.39638602393823367e-02) goto n406;
+		goto n405;
+	n405:
+		if (x[5] > 7.29053670543717419e-03) goto n436;
+		goto n435;
+	n435:
+		return(tree_0_leaves[78]);
+	n436:
+		return(tree_0_leaves[79]);
+	n406:
+		return(tree_0_leaves[80]);
+	n270:
+		return(tree_0_leaves[81]);
+	n102:
+		if (x[2] > -6.12343201880904270e-02) goto n154;
+		goto n153;
+	n153:
+		if (x[8] > -2.58617116203499128e-02) goto n216;
+		goto n215;
+	n215:
+		if (x[4] > -3.38841513332767061e-02) goto n272;
+		goto n271;
+	n271:
+		return(tree_0_leaves[82]);
+	n272:
+		return(tree_0_leaves[83]);
+	n216:
+		return(tree_0_leaves[84]);
+	n154:
+		if (x[6] > 7.31500471080046011e-02) goto n218;
+		goto n217;
+	n217:
+		if (x[4] > -5.90610121673278976e-02) goto n274;
+		goto n273;
+	n273:
+		return(tree_0_leaves[85]);
+	n274:
+		if (x[2] > 3.54683824637936967e-03) goto n346;
+		goto n345;
+	n345:
+		if (x[6] > 3.78462362947676115e-02) goto n408;
+		goto n407;
+	n407:
+		if (x[8] > -1.13206089760418169e-01) goto n438;
+		goto n437;
+	n437:
+		return(tree_0_leaves[86]);
+	n438:
+		if (x[9] > -1.75488279852878543e-02) goto n466;
+		goto n465;
+	n465:
+		if (x[8] > -2.76793406174737529e-02) goto n488;
+		goto n487;
+	n487:
+		if (x[9] > -5.63856769541858996e-02) goto n502;
+		goto n501;
+	n501:
+		return(tree_0_leaves[87]);
+	n502:
+		if (x[2] > -3.84787980531998211e-02) goto n522;
+		goto n521;
+	n521:
+		return(tree_0_leaves[88]);
+	n522:
+		return(tree_0_leaves[89]);
+	n488:
+		if (x[9] > -2.79385531299109410e-02) goto n504;
+		goto n503;
+	n503:
+		return(tree_0_leaves[90]);
+	n504:
+		return(tree_0_leaves[91]);
+	n466:
+		if (x[8] > -3.86278909138265888e-02) goto n490;
+		goto n489;
+	n489:
+		if (x[1] > -1.55050972967813311e-02) goto n506;
+		goto n505;
+	n505:
+		return(tree_0_leaves[92]);
+	n506:
+		return(tree_0_leaves[93]);
+	n490:
+		if (x[9] > -6.30351818514331315e-03) goto n508;
+		goto n507;
+	n507:
+		return(tree_0_leaves[94]);
+	n508:
+		if (x[4] > 2.91375824539766085e-02) goto n524;
+		goto n523;
+	n523:
+		if (x[3] > 2.30743526176196249e-02) goto n532;
+		goto n531;
+	n531:
+		return(tree_0_leaves[95]);
+	n532:
+		return(tree_0_leaves[96]);
+	n524:
+		return(tree_0_leaves[97]);
+	n408:
+		if (x[3] > -2.93899827372786533e-02) goto n440;
+		goto n439;
+	n439:
+		if (x[5] > -9.79255628137390768e-03) goto n468;
+		goto n467;
+	n467:
+		return(tree_0_leaves[98]);
+	n468:
+		return(tree_0_leaves[99]);
+	n440:
+		if (x[0] > 8.70446621888353381e-03) goto n470;
+		goto n469;
+	n469:
+		if (x[2] > -4.01359084065410106e-03) goto n492;
+		goto n491;
+	n491:
+		if (x[3] > -5.52309031211937161e-03) goto n510;
+		goto n509;
+	n509:
+		if (x[2] > -3.03876729783837292e-02) goto n526;
+		goto n525;
+	n525:
+		if (x[5] > -4.16611810309299654e-02) goto n534;
+		goto n533;
+	n533:
+		return(tree_0_leaves[100]);
+	n534:
+		if (x[9] > -4.07358890713605190e-02) goto n538;
+		goto n537;
+	n537:
+		return(tree_0_leaves[101]);
+	n538:
+		return(tree_0_leaves[102]);
+	n526:
+		if (x[8] > -4.02941003054331920e-02) goto n536;
+		goto n535;
+	n535:
+		return(tree_0_leaves[103]);
+	n536:
+		return(tree_0_leaves[104]);
+	n510:
+		return(tree_0_leaves[105]);
+	n492:
+		if (x[3] > 1.85248926500892648e-02) goto n512;
+		goto n511;
+	n511:
+		return(tree_0_leaves[106]);
+	n512:
+		return(tree_0_leaves[107]);
+	n470:
+		if (x[4] > 1.89545321897925147e-02) goto n494;
+		goto n493;
+	n493:
+		if (x[1] > -1.23205799735603069e-02) goto n514;
+		goto n513;
+	n513:
+		return(tree_0_leaves[108]);
+	n514:
+		return(tree_0_leaves[109]);
+	n494:
+		if (x[8] > -2.90922127107203256e-02) goto n516;
+		goto n515;
+	n515:
+		return(tree_0_leaves[110]);
+	n516:
+		if (x[8] > -2.06031470169211334e-02) goto n528;
+		goto n527;
+	n527:
+		return(tree_0_leaves[111]);
+	n528:
+		return(tree_0_leaves[112]);
+	n346:
+		if (x[8] > -1.50691771971253937e-02) goto n410;
+		goto n409;
+	n409:
+		return(tree_0_leaves[113]);
+	n410:
+		return(tree_0_leaves[114]);
+	n218:
+		if (x[7] > -5.17606379926254453e-02) goto n276;
+		goto n275;
+	n275:
+		if (x[6] > 1.07834367711592272e-01) goto n348;
+		goto n347;
+	n347:
+		return(tree_0_leaves[115]);
+	n348:
+		if (x[9] > 3.96745531135027016e-03) goto n412;
+		goto n411;
+	n411:
+		return(tree_0_leaves[116]);
+	n412:
+		return(tree_0_leaves[117]);
+	n276:
+		if (x[2] > 5.26866285106703186e-04) goto n350;
+		goto n349;
+	n349:
+		if (x[0] > 3.14363270470485595e-02) goto n414;
+		goto n413;
+	n413:
+		if (x[3] > -2.44947421083042752e-02) goto n442;
+		goto n441;
+	n441:
+		return(tree_0_leaves[118]);
+	n442:
+		return(tree_0_leaves[119]);
+	n414:
+		if (x[6] > 7.98109268586311149e-02) goto n444;
+		goto n443;
+	n443:
+		if (x[6] > 7.71303726978594395e-02) goto n472;
+		goto n471;
+	n471:
+		return(tree_0_leaves[120]);
+	n472:
+		return(tree_0_leaves[121]);
+	n444:
+		return(tree_0_leaves[122]);
+	n350:
+		return(tree_0_leaves[123]);
+	n34:
+		return(tree_0_leaves[124]);
+	n8:
+		if (x[4] > 4.05658780337634847e-02) goto n18;
+		goto n17;
+	n17:
+		if (x[0] > -3.71574484300616209e-02) goto n36;
+		goto n35;
+	n35:
+		return(tree_0_leaves[125]);
+	n36:
+		if (x[3] > 5.92959176274421816e-03) goto n64;
+		goto n63;
+	n63:
+		if (x[5] > 2.88868728697957988e-03) goto n104;
+		goto n103;
+	n103:
+		if (x[4] > -3.10891051881644100e-02) goto n156;
+		goto n155;
+	n155:
+		return(tree_0_leaves[126]);
+	n156:
+		return(tree_0_leaves[127]);
+	n104:
+		return(tree_0_leaves[128]);
+	n64:
+		if (x[0] > 7.42591339681007278e-03) goto n106;
+		goto n105;
+	n105:
+		return(tree_0_leaves[129]);
+	n106:
+		if (x[2] > -2.73133121092214437e-03) goto n158;
+		goto n157;
+	n157:
+		return(tree_0_leaves[130]);
+	n158:
+		return(tree_0_leaves[131]);
+	n18:
+		if (x[1] > 2.39508397998051611e-02) goto n38;
+		goto n37;
+	n37:
+		if (x[4] > 7.93202037496739953e-02) goto n66;
+		goto n65;
+	n65:
+		if (x[4] > 7.39595092794154696e-02) goto n108;
+		goto n107;
+	n107:
+		return(tree_0_leaves[132]);
+	n108:
+		return(tree_0_leaves[133]);
+	n66:
+		return(tree_0_leaves[134]);
+	n38:
+		if (x[2] > -3.62249958591301683e-03) goto n68;
+		goto n67;
+	n67:
+		if (x[2] > -2.27397768000686881e-02) goto n110;
+		goto n109;
+	n109:
+		return(tree_0_leaves[135]);
+	n110:
+		return(tree_0_leaves[136]);
+	n68:
+		return(tree_0_leaves[137]);
+	n4:
+		if (x[3] > 6.05844115900606994e-02) goto n10;
+		goto n9;
+	n9:
+		if (x[0] > 1.50498804168568510e-02) goto n20;
+		goto n19;
+	n19:
+		if (x[0] > -6.50304175158295493e-03) goto n40;
+		goto n39;
+	n39:
+		if (x[6] > -4.58038035500879445e-02) goto n70;
+		goto n69;
+	n69:
+		if (x[3] > -1.99550294077716767e-03) goto n112;
+		goto n111;
+	n111:
+		if (x[6] > -6.46658320992510721e-02) goto n160;
+		goto n159;
+	n159:
+		if (x[9] > -9.73524573538507923e-03) goto n220;
+		goto n219;
+	n219:
+		if (x[5] > -9.37251087948905159e-04) goto n278;
+		goto n277;
+	n277:
+		return(tree_0_leaves[138]);
+	n278:
+		return(tree_0_leaves[139]);
+	n220:
+		if (x[8] > 1.88455760550988796e-02) goto n280;
+		goto n279;
+	n279:
+		return(tree_0_leaves[140]);
+	n280:
+		return(tree_0_leaves[141]);
+	n160:
+		return(tree_0_leaves[142]);
+	n112:
+		if (x[4] > -1.61933510346049768e-02) goto n162;
+		goto n161;
+	n161:
+		return(tree_0_leaves[143]);
+	n162:
+		return(tree_0_leaves[144]);
+	n70:
+		if (x[5] > 3.86288160122059201e-02) goto n114;
+		goto n113;
+	n113:
+		if (x[9] > -3.54939564834196170e-02) goto n164;
+		goto n163;
+	n163:
+		return(tree_0_leaves[145]);
+	n164:
+		return(tree_0_leaves[146]);
+	n114:
+		if (x[4] > 2.07123747341536775e-02) goto n166;
+		goto n165;
+	n165:
+		return(tree_0_leaves[147]);
+	n166:
+		if (x[4] > 4.38759815088337404e-02) goto n222;
+		goto n221;
+	n221:
+		if (x[6] > -3.57812670872306240e-02) goto n282;
+		goto n281;
+	n281:
+		return(tree_0_leaves[148]);
+	n282:
+		return(tree_0_leaves[149]);
+	n222:
+		return(tree_0_leaves[150]);
+	n40:
+		if (x[8] > 1.71521748653595887e-02) goto n72;
+		goto n71;
+	n71:
+		if (x[4] > 4.63170801685457711e-02) goto n116;
+		goto n115;
+	n115:
+		if (x[5] > 5.72385621758250557e-02) goto n168;
+		goto n167;
+	n167:
+		return(tree_0_leaves[151]);
+	n168:
+		return(tree_0_leaves[152]);
+	n116:
+		if (x[4] > 5.08151938924492341e-02) goto n170;
+		goto n169;
+	n169:
+		return(tree_0_leaves[153]);
+	n170:
+		return(tree_0_leaves[154]);
+	n72:
+		if (x[1] > 1.12029761137429698e-02) goto n118;
+		goto n117;
+	n117:
+		return(tree_0_leaves[155]);
+	n118:
+		if (x[3] > -3.73550485410892169e-02) goto n172;
+		goto n171;
+	n171:
+		return(tree_0_leaves[156]);
+	n172:
+		return(tree_0_leaves[157]);
+	n20:
+		if (x[3] > -3.16038867146906030e-02) goto n42;
+		goto n41;
+	n41:
+		if (x[3] > -5.64559474840063830e-02) goto n74;
+		goto n73;
+	n73:
+		if (x[8] > 1.63690815707672917e-02) goto n120;
+		goto n119;
+	n119:
+		return(tree_0_leaves[158]);
+	n120:
+		return(tree_0_leaves[159]);
+	n74:
+		return(tree_0_leaves[160]);
+	n42:
+		if (x[8] > 1.54364623755965952e-02) goto n76;
+		goto n75;
+	n75:
+		if (x[5] > 3.62151716791392006e-02) goto n122;
+		goto n121;
+	n121:
+		if (x[6] > -4.17232301270916289e-02) goto n174;
+		goto n173;
+	n173:
+		return(tree_0_leaves[161]);
+	n174:
+		return(tree_0_leaves[162]);
+	n122:
+		if (x[3] > 3.10513349595780627e-02) goto n176;
+		goto n175;
+	n175:
+		if (x[7] > 5.07060524153177747e-02) goto n224;
+		goto n223;
+	n223:
+		return(tree_0_leaves[163]);
+	n224:
+		return(tree_0_leaves[164]);
+	n176:
+		return(tree_0_leaves[165]);
+	n76:
+		if (x[8] > 9.87466101915662336e-02) goto n124;
+		goto n123;
+	n123:
+		if (x[6] > -1.92401527149081118e-02) goto n178;
+		goto n177;
+	n177:
+		if (x[2] > -5.63704372204066294e-03) goto n226;
+		goto n225;
+	n225:
+		if (x[2] > -2.13826463329812519e-02) goto n284;
+		goto n283;
+	n283:
+		if (x[7] > 3.78464573970051857e-02) goto n352;
+		goto n351;
+	n351:
+		return(tree_0_leaves[166]);
+	n352:
+		return(tree_0_leaves[167]);
+	n284:
+		return(tree_0_leaves[168]);
+	n226:
+		if (x[2] > 9.37357710728012328e-03) goto n286;
+		goto n285;
+	n285:
+		if (x[2] > 5.92542893199114740e-03) goto n354;
+		goto n353;
+	n353:
+		return(tree_0_leaves[169]);
+	n354:
+		return(tree_0_leaves[170]);
+	n286:
+		return(tree_0_leaves[171]);
+	n178:
+		if (x[3] > 7.82495500174746478e-04) goto n228;
+		goto n227;
+	n227:
+		return(tree_0_leaves[172]);
+	n228:
+		if (x[7] > 3.30728413216926226e-02) goto n288;
+		goto n287;
+	n287:
+		return(tree_0_leaves[173]);
+	n288:
+		return(tree_0_leaves[174]);
+	n124:
+		if (x[4] > 6.12273609699397481e-02) goto n180;
+		goto n179;
+	n179:
+		return(tree_0_leaves[175]);
+	n180:
+		return(tree_0_leaves[176]);
+	n10:
+		if (x[8] > 4.61612159916652276e-02) goto n22;
+		goto n21;
+	n21:
+		return(tree_0_leaves[177]);
+	n22:
+		return(tree_0_leaves[178]);
+	n2:
+		if (x[8] > -4.66389498847035247e-02) goto n6;
+		goto n5;
+	n5:
+		if (x[7] > -1.17390780147072025e-02) goto n12;
+		goto n11;
+	n11:
+		if (x[7] > -3.55628593672147747e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[4] > -1.04708516535039348e-02) goto n44;
+		goto n43;
+	n43:
+		if (x[8] > -5.75142263298729500e-02) goto n78;
+		goto n77;
+	n77:
+		return(tree_0_leaves[179]);
+	n78:
+		return(tree_0_leaves[180]);
+	n44:
+		return(tree_0_leaves[181]);
+	n24:
+		if (x[6] > -1.00956328349657738e-02) goto n46;
+		goto n45;
+	n45:
+		return(tree_0_leaves[182]);
+	n46:
+		return(tree_0_leaves[183]);
+	n12:
+		if (x[2] > 1.92376170576617871e-02) goto n26;
+		goto n25;
+	n25:
+		return(tree_0_leaves[184]);
+	n26:
+		if (x[2] > 8.42460491008950180e-02) goto n48;
+		goto n47;
+	n47:
+		if (x[5] > -5.60530271595978402e-05) goto n80;
+		goto n79;
+	n79:
+		return(tree_0_leaves[185]);
+	n80:
+		return(tree_0_leaves[186]);
+	n48:
+		return(tree_0_leaves[187]);
+	n6:
+		if (x[2] > 6.90295362199207507e-02) goto n14;
+		goto n13;
+	n13:
+		if (x[3] > 3.79294019815909003e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[6] > -4.59060374382233988e-02) goto n50;
+		goto n49;
+	n49:
+		if (x[0] > -3.13395126195950280e-02) goto n82;
+		goto n81;
+	n81:
+		if (x[9] > -2.38333518502458278e-02) goto n126;
+		goto n125;
+	n125:
+		return(tree_0_leaves[188]);
+	n126:
+		return(tree_0_leaves[189]);
+	n82:
+		if (x[6] > -7.68341405867953436e-02) goto n128;
+		goto n127;
+	n127:
+		return(tree_0_leaves[190]);
+	n128:
+		if (x[2] > 4.99592333078132111e-02) goto n182;
+		goto n181;
+	n181:
+		if (x[9] > 3.38751448040751149e-02) goto n230;
+		goto n229;
+	n229:
+		return(tree_0_leaves[191]);
+	n230:
+		return(tree_0_leaves[192]);
+	n182:
+		if (x[6] > -5.46256897034434613e-02) goto n232;
+		goto n231;
+	n231:
+		if (x[9] > 1.24967445765437231e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_0_leaves[193]);
+	n290:
+		if (x[0] > -1.77816153280620746e-03) goto n356;
+		goto n355;
+	n355:
+		return(tree_0_leaves[194]);
+	n356:
+		return(tree_0_leaves[195]);
+	n232:
+		return(tree_0_leaves[196]);
+	n50:
+		if (x[0] > -7.67581622267782121e-02) goto n84;
+		goto n83;
+	n83:
+		if (x[6] > 9.52667737644320028e-03) goto n130;
+		goto n129;
+	n129:
+		return(tree_0_leaves[197]);
+	n130:
+		return(tree_0_leaves[198]);
+	n84:
+		if (x[0] > -6.71298406959958682e-02) goto n132;
+		goto n131;
+	n131:
+		return(tree_0_leaves[199]);
+	n132:
+		if (x[2] > 6.03567522781929475e-02) goto n184;
+		goto n183;
+	n183:
+		if (x[8] > 4.23535099089230108e-02) goto n234;
+		goto n233;
+	n233:
+		if (x[3] > 2.28314829785267737e-02) goto n292;
+		goto n291;
+	n291:
+		if (x[0] > -8.26122293102099156e-03) goto n358;
+		goto n357;
+	n357:
+		if (x[3] > -3.12100883005557439e-02) goto n416;
+		goto n415;
+	n415:
+		if (x[0] > -2.19389628381954464e-02) goto n446;
+		goto n445;
+	n445:
+		return(tree_0_leaves[200]);
+	n446:
+		return(tree_0_leaves[201]);
+	n416:
+		if (x[1] > -3.00031361227321887e-02) goto n448;
+		goto n447;
+	n447:
+		if (x[5] > 6.59039338432052674e-03) goto n474;
+		goto n473;
+	n473:
+		return(tree_0_leaves[202]);
+	n474:
+		return(tree_0_leaves[203]);
+	n448:
+		return(tree_0_leaves[204]);
+	n358:
+		if (x[5] > 6.61434053348682136e-03) goto n418;
+		goto n417;
+	n417:
+		if (x[4] > -3.44727548526665636e-02) goto n450;
+		goto n449;
+	n449:
+		if (x[0] > 7.71642469807128362e-02) goto n476;
+		goto n475;
+	n475:
+		return(tree_0_leaves[205]);
+	n476:
+		return(tree_0_leaves[206]);
+	n450:
+		if (x[5] > -1.59600270440515488e-03) goto n478;
+		goto n477;
+	n477:
+		return(tree_0_leaves[207]);
+	n478:
+		return(tree_0_leaves[208]);
+	n418:
+		if (x[6] > -3.96432366646192400e-02) goto n452;
+		goto n451;
+	n451:
+		return(tree_0_leaves[209]);
+	n452:
+		if (x[8] > 2.51661290389498735e-02) goto n480;
+		goto n479;
+	n479:
+		if (x[7] > 3.49381357853144198e-02) goto n496;
+		goto n495;
+	n495:
+		if (x[5] > 4.09466834359166545e-02) goto n518;
+		goto n517;
+	n517:
+		if (x[8] > 9.18720150205828978e-03) goto n530;
+		goto n529;
+	n529:
+		return(tree_0_leaves[210]);
+	n530:
+		return(tree_0_leaves[211]);
+	n518:
+		return(tree_0_leaves[212]);
+	n496:
+		return(tree_0_leaves[213]);
+	n480:
+		if (x[9] > -3.44008461157432150e-04) goto n498;
+		goto n497;
+	n497:
+		return(tree_0_leaves[214]);
+	n498:
+		if (x[0] > 4.67786972584630159e-02) goto n520;
+		goto n519;
+	n519:
+		return(tree_0_leaves[215]);
+	n520:
+		return(tree_0_leaves[216]);
+	n292:
+		if (x[1] > -2.72167959893166479e-02) goto n360;
+		goto n359;
+	n359:
+		return(tree_0_leaves[217]);
+	n360:
+		return(tree_0_leaves[218]);
+	n234:
+		if (x[3] > 3.07069358684907458e-02) goto n294;
+		goto n293;
+	n293:
+		if (x[6] > 6.13480206053766131e-02) goto n362;
+		goto n361;
+	n361:
+		if (x[4] > 5.51207127960748958e-02) goto n420;
+		goto n419;
+	n419:
+		if (x[6] > 2.49973192004165415e-02) goto n454;
+		goto n453;
+	n453:
+		if (x[6] > -3.86994176061748255e-02) goto n482;
+		goto n481;
+	n481:
+		return(tree_0_leaves[219]);
+	n482:
+		if (x[7] > -2.11769267873511977e-03) goto n500;
+		goto n499;
+	n499:
+		return(tree_0_leaves[220]);
+	n500:
+		return(tree_0_leaves[221]);
+	n454:
+		return(tree_0_leaves[222]);
+	n420:
+		if (x[5] > 5.07261305966476769e-02) goto n456;
+		goto n455;
+	n455:
+		return(tree_0_leaves[223]);
+	n456:
+		return(tree_0_leaves[224]);
+	n362:
+		return(tree_0_leaves[225]);
+	n294:
+		return(tree_0_leaves[226]);
+	n184:
+		if (x[4] > -1.52886257074610066e-02) goto n236;
+		goto n235;
+	n235:
+		if (x[2] > 6.06987551576091272e-02) goto n296;
+		goto n295;
+	n295:
+		return(tree_0_leaves[227]);
+	n296:
+		return(tree_0_leaves[228]);
+	n236:
+		if (x[7] > 4.27109468263149814e-02) goto n298;
+		goto n297;
+	n297:
+		if (x[3] > 7.56230488357629432e-03) goto n364;
+		goto n363;
+	n363:
+		return(tree_0_leaves[229]);
+	n364:
+		return(tree_0_leaves[230]);
+	n298:
+		return(tree_0_leaves[231]);
+	n28:
+		if (x[8] > 1.04788766236807288e-01) goto n52;
+		goto n51;
+	n51:
+		if (x[6] > -8.54750949829402758e-03) goto n86;
+		goto n85;
+	n85:
+		if (x[9] > 7.50519371523631317e-03) goto n134;
+		goto n133;
+	n133:
+		if (x[2] > 6.13124814540422919e-02) goto n186;
+		goto n185;
+	n185:
+		if (x[0] > 3.75712797722146385e-02) goto n238;
+		goto n237;
+	n237:
+		if (x[8] > 5.91751470752049785e-02) goto n300;
+		goto n299;
+	n299:
+		return(tree_0_leaves[232]);
+	n300:
+		if (x[3] > 5.17854681327317296e-02) goto n366;
+		goto n365;
+	n365:
+		return(tree_0_leaves[233]);
+	n366:
+		return(tree_0_leaves[234]);
+	n238:
+		if (x[6] > -1.55653930899335245e-02) goto n302;
+		goto n301;
+	n301:
+		return(tree_0_leaves[235]);
+	n302:
+		return(tree_0_leaves[236]);
+	n186:
+		return(tree_0_leaves[237]);
+	n134:
+		if (x[9] > 9.47417426219400727e-02) goto n188;
+		goto n187;
+	n187:
+		if (x[4] > 1.54453053517686015e-02) goto n240;
+		goto n239;
+	n239:
+		if (x[6] > -3.43522874216878049e-02) goto n304;
+		goto n303;
+	n303:
+		return(tree_0_leaves[238]);
+	n304:
+		return(tree_0_leaves[239]);
+	n240:
+		if (x[3] > 6.06762793380447377e-02) goto n306;
+		goto n305;
+	n305:
+		if (x[9] > 2.04087646973650193e-02) goto n368;
+		goto n367;
+	n367:
+		return(tree_0_leaves[240]);
+	n368:
+		return(tree_0_leaves[241]);
+	n306:
+		if (x[7] > 1.22347173807290516e-01) goto n370;
+		goto n369;
+	n369:
+		return(tree_0_leaves[242]);
+	n370:
+		return(tree_0_leaves[243]);
+	n188:
+		return(tree_0_leaves[244]);
+	n86:
+		if (x[0] > -1.88524185246551901e-02) goto n136;
+		goto n135;
+	n135:
+		if (x[8] > 4.40162300763812242e-02) goto n190;
+		goto n189;
+	n189:
+		if (x[5] > 4.64138493818808395e-02) goto n242;
+		goto n241;
+	n241:
+		return(tree_0_leaves[245]);
+	n242:
+		return(tree_0_leaves[246]);
+	n190:
+		return(tree_0_leaves[247]);
+	n136:
+		if (x[4] > -3.69112734312322319e-02) goto n192;
+		goto n191;
+	n191:
+		return(tree_0_leaves[248]);
+	n192:
+		if (x[3] > 5.97658896616767785e-02) goto n244;
+		goto n243;
+	n243:
+		if (x[0] > 4.29566047415174193e-02) goto n308;
+		goto n307;
+	n307:
+		return(tree_0_leaves[249]);
+	n308:
+		if (x[2] > 3.17733925463308531e-02) goto n372;
+		goto n371;
+	n371:
+		return(tree_0_leaves[250]);
+	n372:
+		return(tree_0_leaves[251]);
+	n244:
+		if (x[9] > -1.19788401941339495e-02) goto n310;
+		goto n309;
+	n309:
+		return(tree_0_leaves[252]);
+	n310:
+		if (x[4] > -2.37975422473685888e-02) goto n374;
+		goto n373;
+	n373:
+		return(tree_0_leaves[253]);
+	n374:
+		return(tree_0_leaves[254]);
+	n52:
+		return(tree_0_leaves[255]);
+	n14:
+		if (x[3] > -2.86470142168404121e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[7] > 5.80825445282200994e-02) goto n54;
+		goto n53;
+	n53:
+		return(tree_0_leaves[256]);
+	n54:
+		return(tree_0_leaves[257]);
+	n30:
+		if (x[0] > 6.53325529263194676e-02) goto n56;
+		goto n55;
+	n55:
+		if (x[5] > -3.06572762849004685e-02) goto n88;
+		goto n87;
+	n87:
+		if (x[0] > -3.35292702633999337e-02) goto n138;
+		goto n137;
+	n137:
+		return(tree_0_leaves[258]);
+	n138:
+		return(tree_0_leaves[259]);
+	n88:
+		if (x[2] > 9.74039776443481747e-02) goto n140;
+		goto n139;
+	n139:
+		if (x[9] > 9.03719911497688766e-02) goto n194;
+		goto n193;
+	n193:
+		if (x[3] > 6.91177289866299754e-02) goto n246;
+		goto n245;
+	n245:
+		if (x[4] > 4.12362959843209226e-03) goto n312;
+		goto n311;
+	n311:
+		return(tree_0_leaves[260]);
+	n312:
+		if (x[5] > 3.71327271763647465e-02) goto n376;
+		goto n375;
+	n375:
+		return(tree_0_leaves[261]);
+	n376:
+		return(tree_0_leaves[262]);
+	n246:
+		if (x[6] > -4.38920612187226333e-02) goto n314;
+		goto n313;
+	n313:
+		return(tree_0_leaves[263]);
+	n314:
+		return(tree_0_leaves[264]);
+	n194:
+		return(tree_0_leaves[265]);
+	n140:
+		if (x[4] > -3.31361883925062467e-02) goto n196;
+		goto n195;
+	n195:
+		return(tree_0_leaves[266]);
+	n196:
+		return(tree_0_leaves[267]);
+	n56:
+		if (x[2] > 7.45025769921971309e-02) goto n90;
+		goto n89;
+	n89:
+		return(tree_0_leaves[268]);
+	n90:
+		return(tree_0_leaves[269]);
+}
+
+static const leaf_t tree_1_leaves[] = {
+	{1.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.54000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.99000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.26000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.71000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.49000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.88000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.84000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.47000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.76000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.66000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.86000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_1_find_leaf(const num_t *x){
+		if (x[2] > 8.64050967180955178e-03) goto n2;
+		goto n1;
+	n1:
+		if (x[8] > 1.36406802766256673e-02) goto n4;
+		goto n3;
+	n3:
+		if (x[0] > 6.93428158978102727e-02) goto n8;
+		goto n7;
+	n7:
+		if (x[7] > 3.89599790757733655e-02) goto n16;
+		goto n15;
+	n15:
+		if (x[8] > -4.05606052260463756e-02) goto n32;
+		goto n31;
+	n31:
+		if (x[4] > -3.78146447329607283e-02) goto n60;
+		goto n59;
+	n59:
+		if (x[4] > -4.75040279803551901e-02) goto n100;
+		goto n99;
+	n99:
+		if (x[9] > -7.51189334996086172e-02) goto n158;
+		goto n157;
+	n157:
+		if (x[8] > -5.48028702824308253e-02) goto n222;
+		goto n221;
+	n221:
+		return(tree_1_leaves[0]);
+	n222:
+		return(tree_1_leaves[1]);
+	n158:
+		if (x[5] > -7.18560972651386826e-02) goto n224;
+		goto n223;
+	n223:
+		if (x[4] > -8.74952054047544725e-02) goto n278;
+		goto n277;
+	n277:
+		if (x[2] > -5.49687214360901483e-02) goto n344;
+		goto n343;
+	n343:
+		return(tree_1_leaves[2]);
+	n344:
+		return(tree_1_leaves[3]);
+	n278:
+		if (x[6] > 1.97827281456580129e-02) goto n346;
+		goto n345;
+	n345:
+		return(tree_1_leaves[4]);
+	n346:
+		return(tree_1_leaves[5]);
+	n224:
+		if (x[9] > 1.65033333685826525e-02) goto n280;
+		goto n279;
+	n279:
+		if (x[6] > 1.51824319202544800e-02) goto n348;
+		goto n347;
+	n347:
+		if (x[9] > -2.95979423295327192e-02) goto n404;
+		goto n403;
+	n403:
+		if (x[2] > -6.83637719648569342e-02) goto n452;
+		goto n451;
+	n451:
+		return(tree_1_leaves[6]);
+	n452:
+		if (x[2] > -5.33173738677982373e-02) goto n472;
+		goto n471;
+	n471:
+		if (x[3] > -4.20657043536753691e-02) goto n490;
+		goto n489;
+	n489:
+		return(tree_1_leaves[7]);
+	n490:
+		return(tree_1_leaves[8]);
+	n472:
+		if (x[3] > -7.26360406317110192e-03) goto n492;
+		goto n491;
+	n491:
+		if (x[9] > -4.82015381771251916e-02) goto n508;
+		goto n507;
+	n507:
+		if (x[5] > -5.93078940102818031e-02) goto n518;
+		goto n517;
+	n517:
+		return(tree_1_leaves[9]);
+	n518:
+		return(tree_1_leaves[10]);
+	n508:
+		return(tree_1_leaves[11]);
+	n492:
+		return(tree_1_leaves[12]);
+	n404:
+		return(tree_1_leaves[13]);
+	n348:
+		if (x[5] > -5.22787152419927556e-02) goto n406;
+		goto n405;
+	n405:
+		return(tree_1_leaves[14]);
+	n406:
+		return(tree_1_leaves[15]);
+	n280:
+		return(tree_1_leaves[16]);
+	n100:
+		if (x[0] > -2.49786406588674258e-02) goto n160;
+		goto n159;
+	n159:
+		if (x[2] > -7.63753303568454195e-02) goto n226;
+		goto n225;
+	n225:
+		return(tree_1_leaves[17]);
+	n226:
+		if (x[8] > -6.01761087483158735e-02) goto n282;
+		goto n281;
+	n281:
+		return(tree_1_leaves[18]);
+	n282:
+		return(tree_1_leaves[19]);
+	n160:
+		return(tree_1_leaves[20]);
+	n60:
+		if (x[0] > -8.89303234211388516e-02) goto n102;
+		goto n101;
+	n101:
+		return(tree_1_leaves[21]);
+	n102:
+		if (x[0] > 1.91689933463088172e-02) goto n162;
+		goto n161;
+	n161:
+		if (x[9] > -8.86179164907705819e-02) goto n228;
+		goto n227;
+	n227:
+		if (x[2] > -3.54745318433396656e-02) goto n284;
+		goto n283;
+	n283:
+		if (x[2] > -5.01936246777437076e-02) goto n350;
+		goto n349;
+	n349:
+		if (x[3] > -4.95710466208520995e-02) goto n408;
+		goto n407;
+	n407:
+		return(tree_1_leaves[22]);
+	n408:
+		return(tree_1_leaves[23]);
+	n350:
+		return(tree_1_leaves[24]);
+	n284:
+		return(tree_1_leaves[25]);
+	n228:
+		if (x[3] > 7.34932649501101112e-04) goto n286;
+		goto n285;
+	n285:
+		if (x[0] > -1.74124727403145640e-04) goto n352;
+		goto n351;
+	n351:
+		if (x[9] > -4.64883237728679899e-02) goto n410;
+		goto n409;
+	n409:
+		if (x[9] > -4.73358970596693823e-02) goto n454;
+		goto n453;
+	n453:
+		if (x[0] > -1.61020969181920569e-02) goto n474;
+		goto n473;
+	n473:
+		return(tree_1_leaves[26]);
+	n474:
+		return(tree_1_leaves[27]);
+	n454:
+		return(tree_1_leaves[28]);
+	n410:
+		if (x[5] > 7.42714609977199354e-03) goto n456;
+		goto n455;
+	n455:
+		if (x[0] > -2.81494898698090822e-02) goto n476;
+		goto n475;
+	n475:
+		if (x[3] > -1.65324312814051425e-02) goto n494;
+		goto n493;
+	n493:
+		return(tree_1_leaves[29]);
+	n494:
+		return(tree_1_leaves[30]);
+	n476:
+		if (x[8] > -6.64333428993049285e-02) goto n496;
+		goto n495;
+	n495:
+		return(tree_1_leaves[31]);
+	n496:
+		return(tree_1_leaves[32]);
+	n456:
+		if (x[9] > -1.29861314506622815e-02) goto n478;
+		goto n477;
+	n477:
+		return(tree_1_leaves[33]);
+	n478:
+		return(tree_1_leaves[34]);
+	n352:
+		return(tree_1_leaves[35]);
+	n286:
+		if (x[2] > -4.07480265621345816e-02) goto n354;
+		goto n353;
+	n353:
+		if (x[5] > -2.91592827301555349e-02) goto n412;
+		goto n411;
+	n411:
+		return(tree_1_leaves[36]);
+	n412:
+		return(tree_1_leaves[37]);
+	n354:
+		if (x[8] > -4.40599050295510733e-02) goto n414;
+		goto n413;
+	n413:
+		return(tree_1_leaves[38]);
+	n414:
+		return(tree_1_leaves[39]);
+	n162:
+		if (x[3] > 1.39648722498567288e-02) goto n230;
+		goto n229;
+	n229:
+		if (x[8] > -5.94013416415567763e-02) goto n288;
+		goto n287;
+	n287:
+		if (x[9] > -2.52071840921948009e-02) goto n356;
+		goto n355;
+	n355:
+		if (x[1] > 3.28526501036896859e-02) goto n416;
+		goto n415;
+	n415:
+		return(tree_1_leaves[40]);
+	n416:
+		return(tree_1_leaves[41]);
+	n356:
+		return(tree_1_leaves[42]);
+	n288:
+		if (x[3] > -5.54290438533427479e-02) goto n358;
+		goto n357;
+	n357:
+		return(tree_1_leaves[43]);
+	n358:
+		return(tree_1_leaves[44]);
+	n230:
+		return(tree_1_leaves[45]);
+	n32:
+		if (x[5] > -2.62200322956934427e-02) goto n62;
+		goto n61;
+	n61:
+		if (x[2] > -5.90055817329123572e-02) goto n104;
+		goto n103;
+	n103:
+		if (x[6] > 1.61833821233193814e-01) goto n164;
+		goto n163;
+	n163:
+		if (x[0] > -4.96043188421515790e-02) goto n232;
+		goto n231;
+	n231:
+		if (x[8] > -1.25214692262426222e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_1_leaves[46]);
+	n290:
+		return(tree_1_leaves[47]);
+	n232:
+		if (x[2] > -6.61163192448005615e-02) goto n292;
+		goto n291;
+	n291:
+		return(tree_1_leaves[48]);
+	n292:
+		if (x[9] > 1.28646671802342752e-02) goto n360;
+		goto n359;
+	n359:
+		return(tree_1_leaves[49]);
+	n360:
+		return(tree_1_leaves[50]);
+	n164:
+		return(tree_1_leaves[51]);
+	n104:
+		if (x[9] > -5.34397298235812866e-03) goto n166;
+		goto n165;
+	n165:
+		if (x[2] > -2.46275025020481313e-02) goto n234;
+		goto n233;
+	n233:
+		if (x[2] > -4.12597677088041848e-02) goto n294;
+		goto n293;
+	n293:
+		return(tree_1_leaves[52]);
+	n294:
+		if (x[5] > -1.11246161799505264e-01) goto n362;
+		goto n361;
+	n361:
+		return(tree_1_leaves[53]);
+	n362:
+		if (x[1] > 4.34657630577626533e-02) goto n418;
+		goto n417;
+	n417:
+		return(tree_1_leaves[54]);
+	n418:
+		return(tree_1_leaves[55]);
+	n234:
+		if (x[9] > -1.48719140095745928e-02) goto n296;
+		goto n295;
+	n295:
+		if (x[8] > -1.69851423655479790e-02) goto n364;
+		goto n363;
+	n363:
+		return(tree_1_leaves[56]);
+	n364:
+		return(tree_1_leaves[57]);
+	n296:
+		return(tree_1_leaves[58]);
+	n166:
+		if (x[5] > -5.12103922919983634e-02) goto n236;
+		goto n235;
+	n235:
+		if (x[3] > -1.81316553621943474e-02) goto n298;
+		goto n297;
+	n297:
+		if (x[1] > -1.10721156760308428e-02) goto n366;
+		goto n365;
+	n365:
+		return(tree_1_leaves[59]);
+	n366:
+		return(tree_1_leaves[60]);
+	n298:
+		return(tree_1_leaves[61]);
+	n236:
+		if (x[1] > 2.69073806518170880e-02) goto n300;
+		goto n299;
+	n299:
+		if (x[6] > 1.37250411735662277e-03) goto n368;
+		goto n367;
+	n367:
+		if (x[5] > -2.99658208296612778e-02) goto n420;
+		goto n419;
+	n419:
+		return(tree_1_leaves[62]);
+	n420:
+		return(tree_1_leaves[63]);
+	n368:
+		return(tree_1_leaves[64]);
+	n300:
+		if (x[3] > -4.10833036625212009e-03) goto n370;
+		goto n369;
+	n369:
+		return(tree_1_leaves[65]);
+	n370:
+		if (x[2] > -4.99027515488574616e-02) goto n422;
+		goto n421;
+	n421:
+		return(tree_1_leaves[66]);
+	n422:
+		return(tree_1_leaves[67]);
+	n62:
+		if (x[3] > 1.26057909115404432e-01) goto n106;
+		goto n105;
+	n105:
+		if (x[5] > -2.05429275346820858e-02) goto n168;
+		goto n167;
+	n167:
+		if (x[2] > -3.81120276186837619e-03) goto n238;
+		goto n237;
+	n237:
+		if (x[1] > 3.52204180030741207e-02) goto n302;
+		goto n301;
+	n301:
+		if (x[2] > -2.25081722758447150e-02) goto n372;
+		goto n371;
+	n371:
+		return(tree_1_leaves[68]);
+	n372:
+		return(tree_1_leaves[69]);
+	n302:
+		if (x[8] > -2.06505485570471353e-02) goto n374;
+		goto n373;
+	n373:
+		if (x[5] > -2.27836192433589595e-02) goto n424;
+		goto n423;
+	n423:
+		return(tree_1_leaves[70]);
+	n424:
+		return(tree_1_leaves[71]);
+	n374:
+		if (x[9] > 1.03351295124823536e-02) goto n426;
+		goto n425;
+	n425:
+		if (x[4] > -1.42458701582453204e-02) goto n458;
+		goto n457;
+	n457:
+		return(tree_1_leaves[72]);
+	n458:
+		return(tree_1_leaves[73]);
+	n426:
+		return(tree_1_leaves[74]);
+	n238:
+		if (x[1] > 1.90289620200283227e-04) goto n304;
+		goto n303;
+	n303:
+		return(tree_1_leaves[75]);
+	n304:
+		return(tree_1_leaves[76]);
+	n168:
+		if (x[8] > -3.86702173318440243e-02) goto n240;
+		goto n239;
+	n239:
+		return(tree_1_leaves[77]);
+	n240:
+		if (x[9] > 3.22020116919792959e-02) goto n306;
+		goto n305;
+	n305:
+		if (x[4] > 2.25602444319324136e-02) goto n376;
+		goto n375;
+	n375:
+		if (x[5] > 4.35078212812245527e-02) goto n428;
+		goto n427;
+	n427:
+		if (x[9] > -3.86808787091494008e-02) goto n460;
+		goto n459;
+	n459:
+		if (x[9] > -6.61240809613998504e-02) goto n480;
+		goto n479;
+	n479:
+		if (x[4] > 1.13856830735043872e-02) goto n498;
+		goto n497;
+	n497:
+		if (x[9] > -6.76765044424661177e-02) goto n510;
+		goto n509;
+	n509:
+		if (x[8] > -2.21243685320931041e-02) goto n520;
+		goto n519;
+	n519:
+		return(tree_1_leaves[78]);
+	n520:
+		return(tree_1_leaves[79]);
+	n510:
+		return(tree_1_leaves[80]);
+	n498:
+		if (x[2] > -3.16794210082833108e-02) goto n512;
+		goto n511;
+	n511:
+		return(tree_1_leaves[81]);
+	n512:
+		return(tree_1_leaves[82]);
+	n480:
+		if (x[9] > -4.33054953784858671e-02) goto n500;
+		goto n499;
+	n499:
+		if (x[9] > -5.33167844341724748e-02) goto n514;
+		goto n513;
+	n513:
+		return(tree_1_leaves[83]);
+	n514:
+		return(tree_1_leaves[84]);
+	n500:
+		return(tree_1_leaves[85]);
+	n460:
+		if (x[8] > 7.63146864333826523e-03) goto n482;
+		goto n481;
+	n481:
+		if (x[8] > 5.38581523447911534e-03) goto n502;
+		goto n501;
+	n501:
+		if (x[2] > -7.07966497093222152e-02) goto n516;
+		goto n515;
+	n515:
+		return(tree_1_leaves[86]);
+	n516:
+		if (x[4] > 1.71542659597300352e-03) goto n522;
+		goto n521;
+	n521:
+		if (x[9] > -2.02686766469433594e-02) goto n524;
+		goto n523;
+	n523:
+		if (x[5] > 4.54132648682268464e-03) goto n526;
+		goto n525;
+	n525:
+		if (x[8] > -1.64262344410473181e-02) goto n530;
+		goto n529;
+	n529:
+		return(tree_1_leaves[87]);
+	n530:
+		if (x[6] > -1.42722478311047389e-02) goto n536;
+		goto n535;
+	n535:
+		return(tree_1_leaves[88]);
+	n536:
+		return(tree_1_leaves[89]);
+	n526:
+		return(tree_1_leaves[90]);
+	n524:
+		if (x[4] > -3.70308049548720604e-03) goto n528;
+		goto n527;
+	n527:
+		if (x[6] > -5.22356495217909528e-02) goto n532;
+		goto n531;
+	n531:
+		return(tree_1_leaves[91]);
+	n532:
+		if (x[3] > 2.76999779675229790e-02) goto n538;
+		goto n537;
+	n537:
+		return(tree_1_leaves[92]);
+	n538:
+		return(tree_1_leaves[93]);
+	n528:
+		if (x[9] > 1.87124494989050275e-02) goto n534;
+		goto n533;
+	n533:
+		return(tree_1_leaves[94]);
+	n534:
+		return(tree_1_leaves[95]);
+	n522:
+		return(tree_1_leaves[96]);
+	n502:
+		return(tree_1_leaves[97]);
+	n482:
+		return(tree_1_leaves[98]);
+	n428:
+		return(tree_1_leaves[99]);
+	n376:
+		if (x[8] > -1.35343427249531301e-02) goto n430;
+		goto n429;
+	n429:
+		if (x[9] > 6.25677996092611870e-03) goto n462;
+		goto n461;
+	n461:
+		if (x[4] > 4.47250071212633785e-02) goto n484;
+		goto n483;
+	n483:
+		return(tree_1_leaves[100]);
+	n484:
+		if (x[4] > 7.83739740134949958e-02) goto n504;
+		goto n503;
+	n503:
+		return(tree_1_leaves[101]);
+	n504:
+		return(tree_1_leaves[102]);
+	n462:
+		return(tree_1_leaves[103]);
+	n430:
+		if (x[3] > 3.14311841479601173e-02) goto n464;
+		goto n463;
+	n463:
+		if (x[7] > -3.58544672119448238e-02) goto n486;
+		goto n485;
+	n485:
+		return(tree_1_leaves[104]);
+	n486:
+		if (x[4] > 3.13786728133923914e-02) goto n506;
+		goto n505;
+	n505:
+		return(tree_1_leaves[105]);
+	n506:
+		return(tree_1_leaves[106]);
+	n464:
+		return(tree_1_leaves[107]);
+	n306:
+		if (x[3] > 2.08935291018332754e-02) goto n378;
+		goto n377;
+	n377:
+		return(tree_1_leaves[108]);
+	n378:
+		if (x[6] > -3.07110225372391223e-02) goto n432;
+		goto n431;
+	n431:
+		return(tree_1_leaves[109]);
+	n432:
+		if (x[0] > 2.24062944387832044e-03) goto n466;
+		goto n465;
+	n465:
+		return(tree_1_leaves[110]);
+	n466:
+		if (x[2] > -1.30605535525609578e-02) goto n488;
+		goto n487;
+	n487:
+		return(tree_1_leaves[111]);
+	n488:
+		return(tree_1_leaves[112]);
+	n106:
+		return(tree_1_leaves[113]);
+	n16:
+		if (x[0] > -9.74655310692519941e-04) goto n34;
+		goto n33;
+	n33:
+		return(tree_1_leaves[114]);
+	n34:
+		if (x[3] > 5.97333691352005813e-02) goto n64;
+		goto n63;
+	n63:
+		return(tree_1_leaves[115]);
+	n64:
+		return(tree_1_leaves[116]);
+	n8:
+		if (x[6] > -3.99227445018085422e-02) goto n18;
+		goto n17;
+	n17:
+		return(tree_1_leaves[117]);
+	n18:
+		if (x[7] > 2.66828572658402048e-02) goto n36;
+		goto n35;
+	n35:
+		return(tree_1_leaves[118]);
+	n36:
+		return(tree_1_leaves[119]);
+	n4:
+		if (x[3] > -3.30005723700014519e-02) goto n10;
+		goto n9;
+	n9:
+		if (x[8] > 2.28997165605272848e-02) goto n20;
+		goto n19;
+	n19:
+		return(tree_1_leaves[120]);
+	n20:
+		if (x[7] > 3.30248284039651799e-02) goto n38;
+		goto n37;
+	n37:
+		if (x[3] > -5.88462938838303223e-02) goto n66;
+		goto n65;
+	n65:
+		return(tree_1_leaves[121]);
+	n66:
+		if (x[2] > -7.42809992488822068e-02) goto n108;
+		goto n107;
+	n107:
+		return(tree_1_leaves[122]);
+	n108:
+		return(tree_1_leaves[123]);
+	n38:
+		if (x[4] > 2.58509605912425403e-02) goto n68;
+		goto n67;
+	n67:
+		if (x[5] > -2.55597146000919317e-02) goto n110;
+		goto n109;
+	n109:
+		return(tree_1_leaves[124]);
+	n110:
+		if (x[3] > -4.42925340325927841e-02) goto n170;
+		goto n169;
+	n169:
+		return(tree_1_leaves[125]);
+	n170:
+		return(tree_1_leaves[126]);
+	n68:
+		if (x[2] > -2.40344537229441116e-02) goto n112;
+		goto n111;
+	n111:
+		return(tree_1_leaves[127]);
+	n112:
+		return(tree_1_leaves[128]);
+	n10:
+		if (x[5] > 6.75555336313348465e-02) goto n22;
+		goto n21;
+	n21:
+		if (x[9] > 6.07259021123947446e-02) goto n40;
+		goto n39;
+	n39:
+		if (x[2] > -1.48525502718499409e-02) goto n70;
+		goto n69;
+	n69:
+		if (x[0] > -2.96146814660266308e-02) goto n114;
+		goto n113;
+	n113:
+		if (x[3] > 3.80846083051579812e-02) goto n172;
+		goto n171;
+	n171:
+		if (x[7] > -3.05285272391019914e-03) goto n242;
+		goto n241;
+	n241:
+		return(tree_1_leaves[129]);
+	n242:
+		return(tree_1_leaves[130]);
+	n172:
+		return(tree_1_leaves[131]);
+	n114:
+		if (x[6] > -3.17002700724053135e-02) goto n174;
+		goto n173;
+	n173:
+		if (x[8] > 4.11913817767555340e-02) goto n244;
+		goto n243;
+	n243:
+		if (x[4] > 8.18948579628598315e-03) goto n308;
+		goto n307;
+	n307:
+		return(tree_1_leaves[132]);
+	n308:
+		return(tree_1_leaves[133]);
+	n244:
+		if (x[3] > -2.27158251886317095e-02) goto n310;
+		goto n309;
+	n309:
+		return(tree_1_leaves[134]);
+	n310:
+		if (x[1] > -3.31773994792588650e-02) goto n380;
+		goto n379;
+	n379:
+		return(tree_1_leaves[135]);
+	n380:
+		return(tree_1_leaves[136]);
+	n174:
+		if (x[0] > 4.30753210409839313e-02) goto n246;
+		goto n245;
+	n245:
+		if (x[7] > -1.43975116514195225e-02) goto n312;
+		goto n311;
+	n311:
+		return(tree_1_leaves[137]);
+	n312:
+		return(tree_1_leaves[138]);
+	n246:
+		if (x[6] > -1.65876751253888413e-02) goto n314;
+		goto n313;
+	n313:
+		return(tree_1_leaves[139]);
+	n314:
+		if (x[2] > -2.10789351038247891e-02) goto n382;
+		goto n381;
+	n381:
+		if (x[4] > 4.18528651744713015e-02) goto n434;
+		goto n433;
+	n433:
+		return(tree_1_leaves[140]);
+	n434:
+		return(tree_1_leaves[141]);
+	n382:
+		return(tree_1_leaves[142]);
+	n70:
+		if (x[8] > 2.60489076367001159e-02) goto n116;
+		goto n115;
+	n115:
+		if (x[2] > -6.07084175980101941e-03) goto n176;
+		goto n175;
+	n175:
+		return(tree_1_leaves[143]);
+	n176:
+		if (x[3] > -6.03511383026178374e-03) goto n248;
+		goto n247;
+	n247:
+		return(tree_1_leaves[144]);
+	n248:
+		return(tree_1_leaves[145]);
+	n116:
+		if (x[4] > -1.33426760630787448e-02) goto n178;
+		goto n177;
+	n177:
+		if (x[4] > -4.45674004804391399e-02) goto n250;
+		goto n249;
+	n249:
+		return(tree_1_leaves[146]);
+	n250:
+		if (x[4] > -2.77423769982204950e-02) goto n316;
+		goto n315;
+	n315:
+		return(tree_1_leaves[147]);
+	n316:
+		return(tree_1_leaves[148]);
+	n178:
+		if (x[5] > 1.38592467675997949e-02) goto n252;
+		goto n251;
+	n251:
+		if (x[8] > 1.21751702571028686e-01) goto n318;
+		goto n317;
+	n317:
+		return(tree_1_leaves[149]);
+	n318:
+		return(tree_1_leaves[150]);
+	n252:
+		if (x[0] > 5.39807223837966074e-02) goto n320;
+		goto n319;
+	n319:
+		return(tree_1_leaves[151]);
+	n320:
+		return(tree_1_leaves[152]);
+	n40:
+		if (x[6] > -9.71526541981686254e-03) goto n72;
+		goto n71;
+	n71:
+		if (x[2] > 2.20270107628390329e-03) goto n118;
+		goto n117;
+	n117:
+		if (x[9] > 8.94716940285659040e-02) goto n180;
+		goto n179;
+	n179:
+		return(tree_1_leaves[153]);
+	n180:
+		return(tree_1_leaves[154]);
+	n118:
+		return(tree_1_leaves[155]);
+	n72:
+		if (x[9] > 8.82140211305611488e-02) goto n120;
+		goto n119;
+	n119:
+		return(tree_1_leaves[156]);
+	n120:
+		return(tree_1_leaves[157]);
+	n22:
+		if (x[8] > 6.22353171150168416e-02) goto n42;
+		goto n41;
+	n41:
+		if (x[0] > -8.28641838243613857e-03) goto n74;
+		goto n73;
+	n73:
+		if (x[8] > 2.86260049965250812e-02) goto n122;
+		goto n121;
+	n121:
+		return(tree_1_leaves[158]);
+	n122:
+		if (x[7] > 7.15655487786187733e-02) goto n182;
+		goto n181;
+	n181:
+		return(tree_1_leaves[159]);
+	n182:
+		return(tree_1_leaves[160]);
+	n74:
+		if (x[3] > 3.86708245884614388e-02) goto n124;
+		goto n123;
+	n123:
+		if (x[7] > 7.69546246879237450e-02) goto n184;
+		goto n183;
+	n183:
+		if (x[3] > 1.83327302609321910e-02) goto n254;
+		goto n253;
+	n253:
+		return(tree_1_leaves[161]);
+	n254:
+		return(tree_1_leaves[162]);
+	n184:
+		return(tree_1_leaves[163]);
+	n124:
+		if (x[4] > 6.00771997142076422e-02) goto n186;
+		goto n185;
+	n185:
+		return(tree_1_leaves[164]);
+	n186:
+		return(tree_1_leaves[165]);
+	n42:
+		return(tree_1_leaves[166]);
+	n2:
+		if (x[8] > -1.31278915358619169e-03) goto n6;
+		goto n5;
+	n5:
+		if (x[6] > -1.58317202817617707e-02) goto n12;
+		goto n11;
+	n11:
+		if (x[3] > -2.47873734158411754e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[4] > -4.69425374743811311e-02) goto n44;
+		goto n43;
+	n43:
+		return(tree_1_leaves[167]);
+	n44:
+		if (x[8] > -3.29294787480319470e-02) goto n76;
+		goto n75;
+	n75:
+		if (x[6] > -2.91849261460505882e-02) goto n126;
+		goto n125;
+	n125:
+		if (x[8] > -5.39535235330717705e-02) goto n188;
+		goto n187;
+	n187:
+		return(tree_1_leaves[168]);
+	n188:
+		return(tree_1_leaves[169]);
+	n126:
+		return(tree_1_leaves[170]);
+	n76:
+		if (x[6] > -3.44145334157610477e-02) goto n128;
+		goto n127;
+	n127:
+		return(tree_1_leaves[171]);
+	n128:
+		return(tree_1_leaves[172]);
+	n24:
+		if (x[2] > 2.96936635330051629e-02) goto n46;
+		goto n45;
+	n45:
+		if (x[8] > -3.24526923664928205e-02) goto n78;
+		goto n77;
+	n77:
+		return(tree_1_leaves[173]);
+	n78:
+		if (x[0] > 5.91460128855477163e-02) goto n130;
+		goto n129;
+	n129:
+		if (x[6] > -5.00651307772059309e-02) goto n190;
+		goto n189;
+	n189:
+		return(tree_1_leaves[174]);
+	n190:
+		return(tree_1_leaves[175]);
+	n130:
+		return(tree_1_leaves[176]);
+	n46:
+		if (x[4] > 3.82049611646482282e-02) goto n80;
+		goto n79;
+	n79:
+		if (x[4] > -2.57510543193697761e-02) goto n132;
+		goto n131;
+	n131:
+		return(tree_1_leaves[177]);
+	n132:
+		if (x[8] > -2.40093322970292428e-02) goto n192;
+		goto n191;
+	n191:
+		if (x[9] > 1.77614958385006981e-02) goto n256;
+		goto n255;
+	n255:
+		return(tree_1_leaves[178]);
+	n256:
+		return(tree_1_leaves[179]);
+	n192:
+		return(tree_1_leaves[180]);
+	n80:
+		return(tree_1_leaves[181]);
+	n12:
+		if (x[0] > -8.22044029128829873e-02) goto n26;
+		goto n25;
+	n25:
+		if (x[0] > -9.06989885237104027e-02) goto n48;
+		goto n47;
+	n47:
+		return(tree_1_leaves[182]);
+	n48:
+		return(tree_1_leaves[183]);
+	n26:
+		if (x[2] > 8.51728536768892042e-02) goto n50;
+		goto n49;
+	n49:
+		if (x[4] > -6.06725796762731875e-02) goto n82;
+		goto n81;
+	n81:
+		if (x[2] > 4.27913232303549773e-02) goto n134;
+		goto n133;
+	n133:
+		return(tree_1_leaves[184]);
+	n134:
+		return(tree_1_leaves[185]);
+	n82:
+		if (x[2] > 3.62184128930179081e-02) goto n136;
+		goto n135;
+	n135:
+		if (x[5] > 4.74216069538839144e-02) goto n194;
+		goto n193;
+	n193:
+		if (x[0] > -7.40733992439070871e-03) goto n258;
+		goto n257;
+	n257:
+		if (x[5] > -3.72887056200799510e-02) goto n322;
+		goto n321;
+	n321:
+		return(tree_1_leaves[186]);
+	n322:
+		if (x[3] > -2.38677391639235542e-02) goto n384;
+		goto n383;
+	n383:
+		return(tree_1_leaves[187]);
+	n384:
+		if (x[8] > -3.57360927725506802e-02) goto n436;
+		goto n435;
+	n435:
+		return(tree_1_leaves[188]);
+	n436:
+		return(tree_1_leaves[189]);
+	n258:
+		if (x[5] > 3.55073762745696797e-02) goto n324;
+		goto n323;
+	n323:
+		return(tree_1_leaves[190]);
+	n324:
+		return(tree_1_leaves[191]);
+	n194:
+		return(tree_1_leaves[192]);
+	n136:
+		if (x[3] > -3.23699606187706074e-02) goto n196;
+		goto n195;
+	n195:
+		if (x[6] > 5.40135531365438862e-02) goto n260;
+		goto n259;
+	n259:
+		if (x[2] > 6.24951687039704690e-02) goto n326;
+		goto n325;
+	n325:
+		if (x[6] > 2.06912362585856616e-02) goto n386;
+		goto n385;
+	n385:
+		return(tree_1_leaves[193]);
+	n386:
+		return(tree_1_leaves[194]);
+	n326:
+		return(tree_1_leaves[195]);
+	n260:
+		return(tree_1_leaves[196]);
+	n196:
+		if (x[5] > 1.22391513675588273e-02) goto n262;
+		goto n261;
+	n261:
+		if (x[2] > 7.22637823619047270e-02) goto n328;
+		goto n327;
+	n327:
+		if (x[7] > -3.37589927038608115e-02) goto n388;
+		goto n387;
+	n387:
+		if (x[2] > 5.55108013233623215e-02) goto n438;
+		goto n437;
+	n437:
+		return(tree_1_leaves[197]);
+	n438:
+		return(tree_1_leaves[198]);
+	n388:
+		return(tree_1_leaves[199]);
+	n328:
+		return(tree_1_leaves[200]);
+	n262:
+		return(tree_1_leaves[201]);
+	n50:
+		return(tree_1_leaves[202]);
+	n6:
+		if (x[2] > 6.95542588640400972e-02) goto n14;
+		goto n13;
+	n13:
+		if (x[3] > 6.18721570488622169e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[9] > 3.90924745049214470e-02) goto n52;
+		goto n51;
+	n51:
+		if (x[3] > -5.66297198468404955e-02) goto n84;
+		goto n83;
+	n83:
+		return(tree_1_leaves[203]);
+	n84:
+		if (x[8] > 2.97249866702640440e-02) goto n138;
+		goto n137;
+	n137:
+		if (x[0] > -3.17607784126090059e-02) goto n198;
+		goto n197;
+	n197:
+		return(tree_1_leaves[204]);
+	n198:
+		if (x[0] > 1.45004307835597552e-02) goto n264;
+		goto n263;
+	n263:
+		if (x[3] > 3.50990705823939556e-02) goto n330;
+		goto n329;
+	n329:
+		if (x[0] > -2.57946797208779451e-02) goto n390;
+		goto n389;
+	n389:
+		return(tree_1_leaves[205]);
+	n390:
+		return(tree_1_leaves[206]);
+	n330:
+		if (x[9] > -8.05868060313782650e-03) goto n392;
+		goto n391;
+	n391:
+		return(tree_1_leaves[207]);
+	n392:
+		return(tree_1_leaves[208]);
+	n264:
+		if (x[9] > 2.11354634465019293e-02) goto n332;
+		goto n331;
+	n331:
+		if (x[7] > 1.77403817569652192e-02) goto n394;
+		goto n393;
+	n393:
+		if (x[6] > -3.66456493463777205e-02) goto n440;
+		goto n439;
+	n439:
+		return(tree_1_leaves[209]);
+	n440:
+		if (x[8] > 1.05100430296615217e-02) goto n468;
+		goto n467;
+	n467:
+		return(tree_1_leaves[210]);
+	n468:
+		return(tree_1_leaves[211]);
+	n394:
+		if (x[3] > 3.71628535585111913e-03) goto n442;
+		goto n441;
+	n441:
+		return(tree_1_leaves[212]);
+	n442:
+		return(tree_1_leaves[213]);
+	n332:
+		return(tree_1_leaves[214]);
+	n138:
+		if (x[2] > 4.22379314717443027e-02) goto n200;
+		goto n199;
+	n199:
+		if (x[6] > -3.07740973268283216e-02) goto n266;
+		goto n265;
+	n265:
+		if (x[4] > -7.06903748799427283e-03) goto n334;
+		goto n333;
+	n333:
+		return(tree_1_leaves[215]);
+	n334:
+		return(tree_1_leaves[216]);
+	n266:
+		if (x[0] > -6.87028062561887698e-02) goto n336;
+		goto n335;
+	n335:
+		return(tree_1_leaves[217]);
+	n336:
+		if (x[6] > 1.74312141792333126e-02) goto n396;
+		goto n395;
+	n395:
+		if (x[2] > 2.09754486618884406e-02) goto n444;
+		goto n443;
+	n443:
+		return(tree_1_leaves[218]);
+	n444:
+		if (x[1] > 2.30803785818276055e-02) goto n470;
+		goto n469;
+	n469:
+		return(tree_1_leaves[219]);
+	n470:
+		return(tree_1_leaves[220]);
+	n396:
+		return(tree_1_leaves[221]);
+	n200:
+		if (x[6] > -1.26852576053017429e-02) goto n268;
+		goto n267;
+	n267:
+		if (x[3] > -1.04748141751059582e-03) goto n338;
+		goto n337;
+	n337:
+		if (x[4] > 1.05450896759176974e-01) goto n398;
+		goto n397;
+	n397:
+		return(tree_1_leaves[222]);
+	n398:
+		return(tree_1_leaves[223]);
+	n338:
+		if (x[0] > 2.07174496893647066e-02) goto n400;
+		goto n399;
+	n399:
+		if (x[9] > -2.01104843049466214e-03) goto n446;
+		goto n445;
+	n445:
+		return(tree_1_leaves[224]);
+	n446:
+		return(tree_1_leaves[225]);
+	n400:
+		if (x[6] > -5.58667319302563886e-02) goto n448;
+		goto n447;
+	n447:
+		return(tree_1_leaves[226]);
+	n448:
+		return(tree_1_leaves[227]);
+	n268:
+		if (x[4] > 1.16913704233383917e-02) goto n340;
+		goto n339;
+	n339:
+		return(tree_1_leaves[228]);
+	n340:
+		if (x[9] > 2.71909019009154984e-02) goto n402;
+		goto n401;
+	n401:
+		if (x[1] > -3.63695012878253801e-02) goto n450;
+		goto n449;
+	n449:
+		return(tree_1_leaves[229]);
+	n450:
+		return(tree_1_leaves[230]);
+	n402:
+		return(tree_1_leaves[231]);
+	n52:
+		if (x[4] > 5.58629812869991735e-02) goto n86;
+		goto n85;
+	n85:
+		if (x[3] > 2.95776400439300355e-02) goto n140;
+		goto n139;
+	n139:
+		if (x[0] > 4.20061196641215509e-03) goto n202;
+		goto n201;
+	n201:
+		return(tree_1_leaves[232]);
+	n202:
+		return(tree_1_leaves[233]);
+	n140:
+		if (x[3] > 4.09892607691558358e-02) goto n204;
+		goto n203;
+	n203:
+		if (x[3] > 3.70957137522629904e-02) goto n270;
+		goto n269;
+	n269:
+		return(tree_1_leaves[234]);
+	n270:
+		return(tree_1_leaves[235]);
+	n204:
+		if (x[0] > 2.55063968430041116e-02) goto n272;
+		goto n271;
+	n271:
+		return(tree_1_leaves[236]);
+	n272:
+		return(tree_1_leaves[237]);
+	n86:
+		if (x[6] > -2.37525318719625147e-03) goto n142;
+		goto n141;
+	n141:
+		if (x[4] > 1.13957302784669409e-01) goto n206;
+		goto n205;
+	n205:
+		if (x[0] > 2.40317290213697566e-03) goto n274;
+		goto n273;
+	n273:
+		if (x[0] > -6.03771584005398029e-03) goto n342;
+		goto n341;
+	n341:
+		return(tree_1_leaves[238]);
+	n342:
+		return(tree_1_leaves[239]);
+	n274:
+		return(tree_1_leaves[240]);
+	n206:
+		return(tree_1_leaves[241]);
+	n142:
+		if (x[6] > 5.07099500953845789e-02) goto n208;
+		goto n207;
+	n207:
+		return(tree_1_leaves[242]);
+	n208:
+		return(tree_1_leaves[243]);
+	n28:
+		if (x[0] > 2.01166128058121868e-02) goto n54;
+		goto n53;
+	n53:
+		if (x[3] > 8.74993953581544026e-02) goto n88;
+		goto n87;
+	n87:
+		if (x[9] > 4.38888275332541128e-02) goto n144;
+		goto n143;
+	n143:
+		return(tree_1_leaves[244]);
+	n144:
+		return(tree_1_leaves[245]);
+	n88:
+		if (x[2] > 5.27898497825739013e-02) goto n146;
+		goto n145;
+	n145:
+		return(tree_1_leaves[246]);
+	n146:
+		return(tree_1_leaves[247]);
+	n54:
+		if (x[6] > 1.76350259097712431e-02) goto n90;
+		goto n89;
+	n89:
+		if (x[9] > 3.26112418007254920e-02) goto n148;
+		goto n147;
+	n147:
+		return(tree_1_leaves[248]);
+	n148:
+		if (x[8] > 6.23257867273156047e-02) goto n210;
+		goto n209;
+	n209:
+		return(tree_1_leaves[249]);
+	n210:
+		if (x[3] > 7.58870375504912542e-02) goto n276;
+		goto n275;
+	n275:
+		return(tree_1_leaves[250]);
+	n276:
+		return(tree_1_leaves[251]);
+	n90:
+		return(tree_1_leaves[252]);
+	n14:
+		if (x[5] > 2.36124725473507401e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[8] > 3.09709091753492850e-02) goto n56;
+		goto n55;
+	n55:
+		if (x[0] > -6.34626424348574414e-02) goto n92;
+		goto n91;
+	n91:
+		return(tree_1_leaves[253]);
+	n92:
+		if (x[9] > 3.06720865274687469e-02) goto n150;
+		goto n149;
+	n149:
+		if (x[0] > -4.22277714269298915e-02) goto n212;
+		goto n211;
+	n211:
+		return(tree_1_leaves[254]);
+	n212:
+		return(tree_1_leaves[255]);
+	n150:
+		return(tree_1_leaves[256]);
+	n56:
+		if (x[5] > 8.52847697658491721e-03) goto n94;
+		goto n93;
+	n93:
+		if (x[5] > -2.65193379219870254e-02) goto n152;
+		goto n151;
+	n151:
+		if (x[4] > -2.38413974154828845e-02) goto n214;
+		goto n213;
+	n213:
+		return(tree_1_leaves[257]);
+	n214:
+		return(tree_1_leaves[258]);
+	n152:
+		if (x[3] > 7.62416756251123873e-02) goto n216;
+		goto n215;
+	n215:
+		return(tree_1_leaves[259]);
+	n216:
+		return(tree_1_leaves[260]);
+	n94:
+		if (x[2] > 8.59902867747614069e-02) goto n154;
+		goto n153;
+	n153:
+		return(tree_1_leaves[261]);
+	n154:
+		if (x[0] > 2.91263555819213649e-02) goto n218;
+		goto n217;
+	n217:
+		return(tree_1_leaves[262]);
+	n218:
+		return(tree_1_leaves[263]);
+	n30:
+		if (x[4] > 2.40334825814617764e-02) goto n58;
+		goto n57;
+	n57:
+		if (x[3] > -1.12105091526367006e-02) goto n96;
+		goto n95;
+	n95:
+		return(tree_1_leaves[264]);
+	n96:
+		return(tree_1_leaves[265]);
+	n58:
+		if (x[3] > 8.97416844662821400e-02) goto n98;
+		goto n97;
+	n97:
+		if (x[6] > -4.86081635246149030e-02) goto n156;
+		goto n155;
+	n155:
+		return(tree_1_leaves[266]);
+	n156:
+		if (x[0] > 7.18493172443087913e-02) goto n220;
+		goto n219;
+	n219:
+		return(tree_1_leaves[267]);
+	n220:
+		return(tree_1_leaves[268]);
+	n98:
+		return(tree_1_leaves[269]);
+}
+
+static const leaf_t tree_2_leaves[] = {
+	{1.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.99000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.56000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.47000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.87000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.67000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.88000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.93000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.26000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.23000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.66000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.71000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.54000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.89000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.49000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.86000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_2_find_leaf(const num_t *x){
+		if (x[8] > 5.78134539425669176e-03) goto n2;
+		goto n1;
+	n1:
+		if (x[2] > 4.35174604754094262e-03) goto n4;
+		goto n3;
+	n3:
+		if (x[0] > 2.32150651596400512e-02) goto n8;
+		goto n7;
+	n7:
+		if (x[8] > -4.67366646045959747e-03) goto n16;
+		goto n15;
+	n15:
+		if (x[0] > -2.89205704986322115e-02) goto n32;
+		goto n31;
+	n31:
+		if (x[9] > -5.92437797759281098e-02) goto n62;
+		goto n61;
+	n61:
+		if (x[3] > -2.28086930835227283e-02) goto n116;
+		goto n115;
+	n115:
+		if (x[1] > 4.23306817064484850e-02) goto n192;
+		goto n191;
+	n191:
+		if (x[0] > -5.60239171169869821e-02) goto n278;
+		goto n277;
+	n277:
+		if (x[2] > -6.85134504409286166e-02) goto n354;
+		goto n353;
+	n353:
+		return(tree_2_leaves[0]);
+	n354:
+		return(tree_2_leaves[1]);
+	n278:
+		if (x[6] > 2.13866605418162395e-02) goto n356;
+		goto n355;
+	n355:
+		return(tree_2_leaves[2]);
+	n356:
+		return(tree_2_leaves[3]);
+	n192:
+		return(tree_2_leaves[4]);
+	n116:
+		if (x[9] > -9.62982136520944554e-02) goto n194;
+		goto n193;
+	n193:
+		return(tree_2_leaves[5]);
+	n194:
+		return(tree_2_leaves[6]);
+	n62:
+		if (x[5] > -3.57365554439221522e-02) goto n118;
+		goto n117;
+	n117:
+		if (x[5] > -9.07409590020430701e-02) goto n196;
+		goto n195;
+	n195:
+		return(tree_2_leaves[7]);
+	n196:
+		if (x[3] > -1.81350672990451510e-02) goto n280;
+		goto n279;
+	n279:
+		if (x[8] > -5.15242898763047241e-02) goto n358;
+		goto n357;
+	n357:
+		if (x[0] > -8.81258838369912006e-02) goto n420;
+		goto n419;
+	n419:
+		if (x[3] > -4.30787177523348289e-02) goto n464;
+		goto n463;
+	n463:
+		return(tree_2_leaves[8]);
+	n464:
+		return(tree_2_leaves[9]);
+	n420:
+		if (x[8] > -9.42812959080366608e-02) goto n466;
+		goto n465;
+	n465:
+		return(tree_2_leaves[10]);
+	n466:
+		if (x[4] > -7.66512641346819845e-02) goto n498;
+		goto n497;
+	n497:
+		return(tree_2_leaves[11]);
+	n498:
+		return(tree_2_leaves[12]);
+	n358:
+		if (x[1] > 3.90078820744706803e-02) goto n422;
+		goto n421;
+	n421:
+		if (x[8] > -1.69514681559316226e-02) goto n468;
+		goto n467;
+	n467:
+		if (x[5] > -7.29563997284299326e-02) goto n500;
+		goto n499;
+	n499:
+		if (x[4] > -5.18806896019375838e-02) goto n518;
+		goto n517;
+	n517:
+		return(tree_2_leaves[13]);
+	n518:
+		return(tree_2_leaves[14]);
+	n500:
+		return(tree_2_leaves[15]);
+	n468:
+		return(tree_2_leaves[16]);
+	n422:
+		return(tree_2_leaves[17]);
+	n280:
+		if (x[2] > -2.08418544686639826e-02) goto n360;
+		goto n359;
+	n359:
+		if (x[3] > -3.18226590939732750e-03) goto n424;
+		goto n423;
+	n423:
+		return(tree_2_leaves[18]);
+	n424:
+		return(tree_2_leaves[19]);
+	n360:
+		return(tree_2_leaves[20]);
+	n118:
+		if (x[2] > -1.18584056445814288e-02) goto n198;
+		goto n197;
+	n197:
+		if (x[4] > -4.75256712292683112e-02) goto n282;
+		goto n281;
+	n281:
+		return(tree_2_leaves[21]);
+	n282:
+		if (x[8] > -7.34094188703673239e-02) goto n362;
+		goto n361;
+	n361:
+		return(tree_2_leaves[22]);
+	n362:
+		if (x[8] > -2.63359699084723814e-02) goto n426;
+		goto n425;
+	n425:
+		if (x[8] > -3.13010636409918816e-02) goto n470;
+		goto n469;
+	n469:
+		if (x[0] > -4.69004637129018312e-02) goto n502;
+		goto n501;
+	n501:
+		if (x[6] > 6.28395742330015855e-02) goto n520;
+		goto n519;
+	n519:
+		if (x[2] > -7.00328963297576351e-02) goto n532;
+		goto n531;
+	n531:
+		return(tree_2_leaves[23]);
+	n532:
+		return(tree_2_leaves[24]);
+	n520:
+		return(tree_2_leaves[25]);
+	n502:
+		if (x[9] > -1.88920189519569057e-02) goto n522;
+		goto n521;
+	n521:
+		return(tree_2_leaves[26]);
+	n522:
+		if (x[5] > 2.24356329740013523e-02) goto n534;
+		goto n533;
+	n533:
+		return(tree_2_leaves[27]);
+	n534:
+		return(tree_2_leaves[28]);
+	n470:
+		return(tree_2_leaves[29]);
+	n426:
+		if (x[4] > 3.71207950244468107e-02) goto n472;
+		goto n471;
+	n471:
+		if (x[2] > -7.33303006876184216e-02) goto n504;
+		goto n503;
+	n503:
+		return(tree_2_leaves[30]);
+	n504:
+		return(tree_2_leaves[31]);
+	n472:
+		return(tree_2_leaves[32]);
+	n198:
+		if (x[3] > -2.33942598300687886e-02) goto n284;
+		goto n283;
+	n283:
+		if (x[2] > -6.32877221365266314e-03) goto n364;
+		goto n363;
+	n363:
+		return(tree_2_leaves[33]);
+	n364:
+		return(tree_2_leaves[34]);
+	n284:
+		if (x[4] > -4.93967233656501664e-02) goto n366;
+		goto n365;
+	n365:
+		return(tree_2_leaves[35]);
+	n366:
+		if (x[6] > 9.71625168052344876e-03) goto n428;
+		goto n427;
+	n427:
+		return(tree_2_leaves[36]);
+	n428:
+		return(tree_2_leaves[37]);
+	n32:
+		if (x[0] > -1.79028679497777350e-02) goto n64;
+		goto n63;
+	n63:
+		if (x[9] > -1.14016589237863175e-01) goto n120;
+		goto n119;
+	n119:
+		return(tree_2_leaves[38]);
+	n120:
+		if (x[5] > -5.50381758319912692e-02) goto n200;
+		goto n199;
+	n199:
+		if (x[4] > -8.00149271726775524e-02) goto n286;
+		goto n285;
+	n285:
+		return(tree_2_leaves[39]);
+	n286:
+		return(tree_2_leaves[40]);
+	n200:
+		if (x[6] > 6.47006835407971416e-03) goto n288;
+		goto n287;
+	n287:
+		return(tree_2_leaves[41]);
+	n288:
+		if (x[9] > 4.47827041489747002e-03) goto n368;
+		goto n367;
+	n367:
+		if (x[9] > -3.31195326809626198e-02) goto n430;
+		goto n429;
+	n429:
+		if (x[9] > -4.74477902551228153e-02) goto n474;
+		goto n473;
+	n473:
+		return(tree_2_leaves[42]);
+	n474:
+		return(tree_2_leaves[43]);
+	n430:
+		if (x[4] > 3.96125743330598065e-02) goto n476;
+		goto n475;
+	n475:
+		return(tree_2_leaves[44]);
+	n476:
+		return(tree_2_leaves[45]);
+	n368:
+		return(tree_2_leaves[46]);
+	n64:
+		if (x[5] > -2.48115866727395412e-02) goto n122;
+		goto n121;
+	n121:
+		if (x[0] > -5.54490233238076353e-03) goto n202;
+		goto n201;
+	n201:
+		if (x[2] > -5.41242284840045204e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_2_leaves[47]);
+	n290:
+		return(tree_2_leaves[48]);
+	n202:
+		if (x[3] > -1.55713301006077387e-03) goto n292;
+		goto n291;
+	n291:
+		if (x[2] > -6.11357146741890942e-02) goto n370;
+		goto n369;
+	n369:
+		return(tree_2_leaves[49]);
+	n370:
+		if (x[3] > -3.88034213678406376e-02) goto n432;
+		goto n431;
+	n431:
+		if (x[1] > 2.39431826781938417e-03) goto n478;
+		goto n477;
+	n477:
+		return(tree_2_leaves[50]);
+	n478:
+		return(tree_2_leaves[51]);
+	n432:
+		return(tree_2_leaves[52]);
+	n292:
+		return(tree_2_leaves[53]);
+	n122:
+		if (x[0] > -1.79727478334345755e-03) goto n204;
+		goto n203;
+	n203:
+		if (x[9] > 4.45300585578147640e-02) goto n294;
+		goto n293;
+	n293:
+		if (x[6] > 7.13712226585128291e-04) goto n372;
+		goto n371;
+	n371:
+		if (x[2] > -3.13773382725749950e-02) goto n434;
+		goto n433;
+	n433:
+		return(tree_2_leaves[54]);
+	n434:
+		return(tree_2_leaves[55]);
+	n372:
+		if (x[5] > -1.72240608094317744e-02) goto n436;
+		goto n435;
+	n435:
+		return(tree_2_leaves[56]);
+	n436:
+		if (x[3] > 1.55713229120873139e-02) goto n480;
+		goto n479;
+	n479:
+		if (x[9] > -5.80372197122107913e-02) goto n506;
+		goto n505;
+	n505:
+		if (x[7] > -8.36146227537090669e-03) goto n524;
+		goto n523;
+	n523:
+		if (x[2] > -1.59769436395764894e-02) goto n536;
+		goto n535;
+	n535:
+		return(tree_2_leaves[57]);
+	n536:
+		return(tree_2_leaves[58]);
+	n524:
+		return(tree_2_leaves[59]);
+	n506:
+		return(tree_2_leaves[60]);
+	n480:
+		return(tree_2_leaves[61]);
+	n294:
+		return(tree_2_leaves[62]);
+	n204:
+		if (x[3] > 1.07066604513819438e-02) goto n296;
+		goto n295;
+	n295:
+		if (x[3] > -4.98627658315955666e-03) goto n374;
+		goto n373;
+	n373:
+		if (x[9] > -6.79440067048901891e-02) goto n438;
+		goto n437;
+	n437:
+		return(tree_2_leaves[63]);
+	n438:
+		if (x[5] > -1.01510290079958182e-02) goto n482;
+		goto n481;
+	n481:
+		if (x[2] > -3.80992069366594341e-02) goto n508;
+		goto n507;
+	n507:
+		return(tree_2_leaves[64]);
+	n508:
+		if (x[1] > -1.71894925438616092e-02) goto n526;
+		goto n525;
+	n525:
+		if (x[0] > 5.76355380095290755e-03) goto n538;
+		goto n537;
+	n537:
+		return(tree_2_leaves[65]);
+	n538:
+		return(tree_2_leaves[66]);
+	n526:
+		return(tree_2_leaves[67]);
+	n482:
+		if (x[6] > 6.56281713585433607e-02) goto n510;
+		goto n509;
+	n509:
+		if (x[7] > -3.88355352199948808e-02) goto n528;
+		goto n527;
+	n527:
+		if (x[6] > 6.22684889833881872e-02) goto n540;
+		goto n539;
+	n539:
+		return(tree_2_leaves[68]);
+	n540:
+		return(tree_2_leaves[69]);
+	n528:
+		return(tree_2_leaves[70]);
+	n510:
+		if (x[9] > 7.08947852840846049e-02) goto n530;
+		goto n529;
+	n529:
+		return(tree_2_leaves[71]);
+	n530:
+		return(tree_2_leaves[72]);
+	n374:
+		return(tree_2_leaves[73]);
+	n296:
+		if (x[4] > 6.60708533145574865e-03) goto n376;
+		goto n375;
+	n375:
+		return(tree_2_leaves[74]);
+	n376:
+		return(tree_2_leaves[75]);
+	n16:
+		if (x[3] > 2.00812989306250744e-02) goto n34;
+		goto n33;
+	n33:
+		if (x[9] > -3.34109876513391801e-02) goto n66;
+		goto n65;
+	n65:
+		if (x[5] > -6.07975442693275137e-02) goto n124;
+		goto n123;
+	n123:
+		return(tree_2_leaves[76]);
+	n124:
+		return(tree_2_leaves[77]);
+	n66:
+		if (x[0] > -7.54912597536729485e-02) goto n126;
+		goto n125;
+	n125:
+		return(tree_2_leaves[78]);
+	n126:
+		if (x[9] > -3.83752874709118166e-03) goto n206;
+		goto n205;
+	n205:
+		return(tree_2_leaves[79]);
+	n206:
+		if (x[5] > 9.69350073631109269e-03) goto n298;
+		goto n297;
+	n297:
+		return(tree_2_leaves[80]);
+	n298:
+		return(tree_2_leaves[81]);
+	n34:
+		if (x[8] > 4.72775711117759314e-03) goto n68;
+		goto n67;
+	n67:
+		if (x[8] > 2.10564086517386765e-03) goto n128;
+		goto n127;
+	n127:
+		return(tree_2_leaves[82]);
+	n128:
+		return(tree_2_leaves[83]);
+	n68:
+		return(tree_2_leaves[84]);
+	n8:
+		if (x[4] > -4.25324083810024733e-02) goto n18;
+		goto n17;
+	n17:
+		if (x[2] > -2.66489008996569077e-02) goto n36;
+		goto n35;
+	n35:
+		if (x[4] > -4.98660889601401577e-02) goto n70;
+		goto n69;
+	n69:
+		return(tree_2_leaves[85]);
+	n70:
+		return(tree_2_leaves[86]);
+	n36:
+		if (x[5] > -4.55073988945036770e-02) goto n72;
+		goto n71;
+	n71:
+		if (x[3] > 3.13849821227886044e-02) goto n130;
+		goto n129;
+	n129:
+		if (x[0] > 7.05006900246231971e-02) goto n208;
+		goto n207;
+	n207:
+		return(tree_2_leaves[87]);
+	n208:
+		return(tree_2_leaves[88]);
+	n130:
+		return(tree_2_leaves[89]);
+	n72:
+		if (x[7] > 8.61786913137951166e-03) goto n132;
+		goto n131;
+	n131:
+		if (x[5] > -4.38045034944793202e-02) goto n210;
+		goto n209;
+	n209:
+		return(tree_2_leaves[90]);
+	n210:
+		return(tree_2_leaves[91]);
+	n132:
+		return(tree_2_leaves[92]);
+	n18:
+		if (x[8] > -3.33277886235878312e-02) goto n38;
+		goto n37;
+	n37:
+		if (x[4] > -3.01526093707502503e-02) goto n74;
+		goto n73;
+	n73:
+		return(tree_2_leaves[93]);
+	n74:
+		if (x[8] > -7.18650826342217830e-02) goto n134;
+		goto n133;
+	n133:
+		if (x[6] > 6.58503379235994973e-02) goto n212;
+		goto n211;
+	n211:
+		return(tree_2_leaves[94]);
+	n212:
+		return(tree_2_leaves[95]);
+	n134:
+		if (x[5] > -1.21706518529258092e-02) goto n214;
+		goto n213;
+	n213:
+		if (x[7] > -4.22505811485196503e-02) goto n300;
+		goto n299;
+	n299:
+		return(tree_2_leaves[96]);
+	n300:
+		return(tree_2_leaves[97]);
+	n214:
+		if (x[4] > 8.24252888041085430e-02) goto n302;
+		goto n301;
+	n301:
+		if (x[2] > -3.46446384824659059e-02) goto n378;
+		goto n377;
+	n377:
+		if (x[8] > -5.08863664481398748e-02) goto n440;
+		goto n439;
+	n439:
+		return(tree_2_leaves[98]);
+	n440:
+		if (x[7] > -3.01831451223470680e-02) goto n484;
+		goto n483;
+	n483:
+		return(tree_2_leaves[99]);
+	n484:
+		return(tree_2_leaves[100]);
+	n378:
+		if (x[4] > 1.52919572135296160e-02) goto n442;
+		goto n441;
+	n441:
+		return(tree_2_leaves[101]);
+	n442:
+		if (x[0] > 6.91123181003622800e-02) goto n486;
+		goto n485;
+	n485:
+		return(tree_2_leaves[102]);
+	n486:
+		return(tree_2_leaves[103]);
+	n302:
+		return(tree_2_leaves[104]);
+	n38:
+		if (x[4] > 4.66269014207121163e-02) goto n76;
+		goto n75;
+	n75:
+		if (x[0] > 4.64328314558993954e-02) goto n136;
+		goto n135;
+	n135:
+		if (x[5] > -2.25022587725808437e-02) goto n216;
+		goto n215;
+	n215:
+		if (x[8] > -1.47576713351147727e-02) goto n304;
+		goto n303;
+	n303:
+		return(tree_2_leaves[105]);
+	n304:
+		if (x[2] > -2.37477594038226943e-02) goto n380;
+		goto n379;
+	n379:
+		if (x[8] > -4.06157240675720371e-03) goto n444;
+		goto n443;
+	n443:
+		return(tree_2_leaves[106]);
+	n444:
+		return(tree_2_leaves[107]);
+	n380:
+		return(tree_2_leaves[108]);
+	n216:
+		if (x[4] > -3.66361889784854334e-03) goto n306;
+		goto n305;
+	n305:
+		if (x[0] > 3.56802662098993639e-02) goto n382;
+		goto n381;
+	n381:
+		return(tree_2_leaves[109]);
+	n382:
+		if (x[5] > -1.15344857904885120e-02) goto n446;
+		goto n445;
+	n445:
+		if (x[4] > -3.05077526001881899e-02) goto n488;
+		goto n487;
+	n487:
+		return(tree_2_leaves[110]);
+	n488:
+		return(tree_2_leaves[111]);
+	n446:
+		return(tree_2_leaves[112]);
+	n306:
+		if (x[5] > 1.49388502777084309e-02) goto n384;
+		goto n383;
+	n383:
+		if (x[0] > 4.21502143787137323e-02) goto n448;
+		goto n447;
+	n447:
+		return(tree_2_leaves[113]);
+	n448:
+		return(tree_2_leaves[114]);
+	n384:
+		return(tree_2_leaves[115]);
+	n136:
+		if (x[8] > -1.46348499848954084e-02) goto n218;
+		goto n217;
+	n217:
+		if (x[7] > -8.28933924926047311e-03) goto n308;
+		goto n307;
+	n307:
+		return(tree_2_leaves[116]);
+	n308:
+		return(tree_2_leaves[117]);
+	n218:
+		if (x[4] > 3.99255745231796785e-02) goto n310;
+		goto n309;
+	n309:
+		if (x[5] > 6.97738972394471371e-03) goto n386;
+		goto n385;
+	n385:
+		return(tree_2_leaves[118]);
+	n386:
+		return(tree_2_leaves[119]);
+	n310:
+		return(tree_2_leaves[120]);
+	n76:
+		if (x[2] > -1.14831404428919447e-02) goto n138;
+		goto n137;
+	n137:
+		return(tree_2_leaves[121]);
+	n138:
+		return(tree_2_leaves[122]);
+	n4:
+		if (x[2] > 7.24514368843077045e-02) goto n10;
+		goto n9;
+	n9:
+		if (x[8] > -4.51981705412015100e-02) goto n20;
+		goto n19;
+	n19:
+		if (x[9] > -6.40990741865896385e-02) goto n40;
+		goto n39;
+	n39:
+		return(tree_2_leaves[123]);
+	n40:
+		if (x[8] > -6.10822271033227907e-02) goto n78;
+		goto n77;
+	n77:
+		if (x[6] > -6.51193428388064793e-02) goto n140;
+		goto n139;
+	n139:
+		return(tree_2_leaves[124]);
+	n140:
+		return(tree_2_leaves[125]);
+	n78:
+		if (x[2] > 6.24737391549459644e-03) goto n142;
+		goto n141;
+	n141:
+		return(tree_2_leaves[126]);
+	n142:
+		if (x[0] > -4.21427093101316846e-03) goto n220;
+		goto n219;
+	n219:
+		return(tree_2_leaves[127]);
+	n220:
+		return(tree_2_leaves[128]);
+	n20:
+		if (x[3] > 9.11059593114389200e-03) goto n42;
+		goto n41;
+	n41:
+		if (x[4] > 2.26741289947009865e-02) goto n80;
+		goto n79;
+	n79:
+		if (x[2] > 2.21648593819589526e-02) goto n144;
+		goto n143;
+	n143:
+		if (x[0] > -4.02742351847555149e-02) goto n222;
+		goto n221;
+	n221:
+		return(tree_2_leaves[129]);
+	n222:
+		if (x[6] > -1.23267278085021637e-02) goto n312;
+		goto n311;
+	n311:
+		return(tree_2_leaves[130]);
+	n312:
+		return(tree_2_leaves[131]);
+	n144:
+		if (x[3] > -4.54233198698914681e-02) goto n224;
+		goto n223;
+	n223:
+		if (x[6] > 1.72669798153493280e-02) goto n314;
+		goto n313;
+	n313:
+		return(tree_2_leaves[132]);
+	n314:
+		return(tree_2_leaves[133]);
+	n224:
+		if (x[0] > -8.76536211268840772e-03) goto n316;
+		goto n315;
+	n315:
+		if (x[9] > -2.41775646454461812e-02) goto n388;
+		goto n387;
+	n387:
+		return(tree_2_leaves[134]);
+	n388:
+		if (x[0] > -4.66593645127517803e-02) goto n450;
+		goto n449;
+	n449:
+		if (x[1] > -6.45316806871018556e-03) goto n490;
+		goto n489;
+	n489:
+		return(tree_2_leaves[135]);
+	n490:
+		return(tree_2_leaves[136]);
+	n450:
+		return(tree_2_leaves[137]);
+	n316:
+		if (x[9] > -1.59666732782694776e-02) goto n390;
+		goto n389;
+	n389:
+		return(tree_2_leaves[138]);
+	n390:
+		if (x[7] > -3.08488023685627513e-02) goto n452;
+		goto n451;
+	n451:
+		return(tree_2_leaves[139]);
+	n452:
+		return(tree_2_leaves[140]);
+	n80:
+		if (x[7] > -3.08427640346105453e-02) goto n146;
+		goto n145;
+	n145:
+		return(tree_2_leaves[141]);
+	n146:
+		if (x[2] > 4.13480644181842272e-02) goto n226;
+		goto n225;
+	n225:
+		return(tree_2_leaves[142]);
+	n226:
+		return(tree_2_leaves[143]);
+	n42:
+		if (x[2] > 1.62046566137422736e-02) goto n82;
+		goto n81;
+	n81:
+		if (x[6] > -3.84526666560869659e-02) goto n148;
+		goto n147;
+	n147:
+		if (x[8] > -2.29327250301217186e-02) goto n228;
+		goto n227;
+	n227:
+		return(tree_2_leaves[144]);
+	n228:
+		return(tree_2_leaves[145]);
+	n148:
+		if (x[9] > -5.89035392314458464e-02) goto n230;
+		goto n229;
+	n229:
+		return(tree_2_leaves[146]);
+	n230:
+		return(tree_2_leaves[147]);
+	n82:
+		if (x[4] > -2.95970860168567260e-02) goto n150;
+		goto n149;
+	n149:
+		if (x[3] > 3.32234231851584599e-02) goto n232;
+		goto n231;
+	n231:
+		return(tree_2_leaves[148]);
+	n232:
+		return(tree_2_leaves[149]);
+	n150:
+		if (x[9] > -6.50829277037517570e-03) goto n234;
+		goto n233;
+	n233:
+		if (x[7] > -2.39482054144168829e-02) goto n318;
+		goto n317;
+	n317:
+		return(tree_2_leaves[150]);
+	n318:
+		return(tree_2_leaves[151]);
+	n234:
+		if (x[9] > 1.70208006201768049e-02) goto n320;
+		goto n319;
+	n319:
+		return(tree_2_leaves[152]);
+	n320:
+		return(tree_2_leaves[153]);
+	n10:
+		if (x[8] > -3.96697772913047336e-02) goto n22;
+		goto n21;
+	n21:
+		return(tree_2_leaves[154]);
+	n22:
+		if (x[1] > -4.38605536596475207e-02) goto n44;
+		goto n43;
+	n43:
+		if (x[3] > 1.13762696988950161e-02) goto n84;
+		goto n83;
+	n83:
+		return(tree_2_leaves[155]);
+	n84:
+		if (x[4] > 1.59969105571686129e-02) goto n152;
+		goto n151;
+	n151:
+		if (x[0] > -2.95054213367392619e-02) goto n236;
+		goto n235;
+	n235:
+		return(tree_2_leaves[156]);
+	n236:
+		return(tree_2_leaves[157]);
+	n152:
+		return(tree_2_leaves[158]);
+	n44:
+		return(tree_2_leaves[159]);
+	n2:
+		if (x[2] > 4.68008343772091245e-02) goto n6;
+		goto n5;
+	n5:
+		if (x[0] > 7.89497301453659373e-03) goto n12;
+		goto n11;
+	n11:
+		if (x[3] > 1.67240107348514029e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[3] > -3.31352281327285322e-02) goto n46;
+		goto n45;
+	n45:
+		if (x[2] > 4.39111933626551258e-03) goto n86;
+		goto n85;
+	n85:
+		if (x[9] > -3.66476422787090639e-02) goto n154;
+		goto n153;
+	n153:
+		if (x[2] > -3.76556111730476442e-02) goto n238;
+		goto n237;
+	n237:
+		return(tree_2_leaves[160]);
+	n238:
+		return(tree_2_leaves[161]);
+	n154:
+		if (x[3] > -4.10036622990009939e-02) goto n240;
+		goto n239;
+	n239:
+		return(tree_2_leaves[162]);
+	n240:
+		if (x[6] > -4.17319101869220235e-02) goto n322;
+		goto n321;
+	n321:
+		return(tree_2_leaves[163]);
+	n322:
+		if (x[0] > -9.30220308135761148e-02) goto n392;
+		goto n391;
+	n391:
+		return(tree_2_leaves[164]);
+	n392:
+		return(tree_2_leaves[165]);
+	n86:
+		return(tree_2_leaves[166]);
+	n46:
+		if (x[4] > -2.53643504095009062e-02) goto n88;
+		goto n87;
+	n87:
+		if (x[0] > -4.28258489044706162e-02) goto n156;
+		goto n155;
+	n155:
+		return(tree_2_leaves[167]);
+	n156:
+		return(tree_2_leaves[168]);
+	n88:
+		if (x[8] > 9.76382974713593636e-03) goto n158;
+		goto n157;
+	n157:
+		return(tree_2_leaves[169]);
+	n158:
+		if (x[8] > 2.34848531638002442e-02) goto n242;
+		goto n241;
+	n241:
+		if (x[6] > 4.09232284948387107e-03) goto n324;
+		goto n323;
+	n323:
+		if (x[2] > 2.94764307698339029e-02) goto n394;
+		goto n393;
+	n393:
+		return(tree_2_leaves[170]);
+	n394:
+		return(tree_2_leaves[171]);
+	n324:
+		return(tree_2_leaves[172]);
+	n242:
+		if (x[1] > -4.08749941329231634e-02) goto n326;
+		goto n325;
+	n325:
+		if (x[2] > 3.06384376981746788e-02) goto n396;
+		goto n395;
+	n395:
+		return(tree_2_leaves[173]);
+	n396:
+		return(tree_2_leaves[174]);
+	n326:
+		if (x[8] > 4.77478519132720908e-02) goto n398;
+		goto n397;
+	n397:
+		if (x[3] > -1.36251837538588147e-02) goto n454;
+		goto n453;
+	n453:
+		return(tree_2_leaves[175]);
+	n454:
+		return(tree_2_leaves[176]);
+	n398:
+		return(tree_2_leaves[177]);
+	n24:
+		if (x[9] > 5.96122264466290436e-02) goto n48;
+		goto n47;
+	n47:
+		if (x[3] > 3.90290680037777490e-02) goto n90;
+		goto n89;
+	n89:
+		if (x[3] > 2.86561039145299609e-02) goto n160;
+		goto n159;
+	n159:
+		return(tree_2_leaves[178]);
+	n160:
+		if (x[2] > 9.09981844769187052e-03) goto n244;
+		goto n243;
+	n243:
+		return(tree_2_leaves[179]);
+	n244:
+		return(tree_2_leaves[180]);
+	n90:
+		if (x[0] > -3.62125556853636283e-03) goto n162;
+		goto n161;
+	n161:
+		if (x[3] > 8.28348262462074575e-02) goto n246;
+		goto n245;
+	n245:
+		if (x[8] > 3.48689004778785089e-02) goto n328;
+		goto n327;
+	n327:
+		return(tree_2_leaves[181]);
+	n328:
+		if (x[7] > 1.01368184325934127e-01) goto n400;
+		goto n399;
+	n399:
+		if (x[3] > 5.84617693945661057e-02) goto n456;
+		goto n455;
+	n455:
+		return(tree_2_leaves[182]);
+	n456:
+		return(tree_2_leaves[183]);
+	n400:
+		return(tree_2_leaves[184]);
+	n246:
+		return(tree_2_leaves[185]);
+	n162:
+		if (x[0] > 4.48780488264432977e-03) goto n248;
+		goto n247;
+	n247:
+		return(tree_2_leaves[186]);
+	n248:
+		return(tree_2_leaves[187]);
+	n48:
+		if (x[2] > 3.85016908278218647e-02) goto n92;
+		goto n91;
+	n91:
+		return(tree_2_leaves[188]);
+	n92:
+		return(tree_2_leaves[189]);
+	n12:
+		if (x[2] > 1.38595364290352817e-02) goto n26;
+		goto n25;
+	n25:
+		if (x[2] > -2.37257443570333473e-02) goto n50;
+		goto n49;
+	n49:
+		if (x[9] > 1.71269795528183923e-02) goto n94;
+		goto n93;
+	n93:
+		if (x[0] > 1.33212471177778392e-02) goto n164;
+		goto n163;
+	n163:
+		return(tree_2_leaves[190]);
+	n164:
+		if (x[0] > 1.78527902584528081e-02) goto n250;
+		goto n249;
+	n249:
+		return(tree_2_leaves[191]);
+	n250:
+		if (x[4] > 2.95234789658233507e-02) goto n330;
+		goto n329;
+	n329:
+		return(tree_2_leaves[192]);
+	n330:
+		return(tree_2_leaves[193]);
+	n94:
+		if (x[9] > 7.09958676059512378e-02) goto n166;
+		goto n165;
+	n165:
+		if (x[6] > -3.17152061437392108e-02) goto n252;
+		goto n251;
+	n251:
+		return(tree_2_leaves[194]);
+	n252:
+		if (x[6] > 2.78655778000782839e-02) goto n332;
+		goto n331;
+	n331:
+		if (x[2] > -4.72947390452800112e-02) goto n402;
+		goto n401;
+	n401:
+		return(tree_2_leaves[195]);
+	n402:
+		return(tree_2_leaves[196]);
+	n332:
+		return(tree_2_leaves[197]);
+	n166:
+		return(tree_2_leaves[198]);
+	n50:
+		if (x[2] > 6.01389315545497200e-03) goto n96;
+		goto n95;
+	n95:
+		if (x[8] > 1.54858381752882041e-02) goto n168;
+		goto n167;
+	n167:
+		if (x[7] > 7.05816208057636896e-02) goto n254;
+		goto n253;
+	n253:
+		return(tree_2_leaves[199]);
+	n254:
+		return(tree_2_leaves[200]);
+	n168:
+		if (x[3] > -2.34246337200426612e-02) goto n256;
+		goto n255;
+	n255:
+		if (x[9] > 2.06430150145590317e-02) goto n334;
+		goto n333;
+	n333:
+		return(tree_2_leaves[201]);
+	n334:
+		return(tree_2_leaves[202]);
+	n256:
+		if (x[0] > 1.64360408788567711e-02) goto n336;
+		goto n335;
+	n335:
+		if (x[3] > -5.49721196847356795e-03) goto n404;
+		goto n403;
+	n403:
+		if (x[3] > -9.85902495512722306e-03) goto n458;
+		goto n457;
+	n457:
+		return(tree_2_leaves[203]);
+	n458:
+		return(tree_2_leaves[204]);
+	n404:
+		return(tree_2_leaves[205]);
+	n336:
+		if (x[8] > 5.29808867882459525e-02) goto n406;
+		goto n405;
+	n405:
+		if (x[9] > -7.26409865827317824e-03) goto n460;
+		goto n459;
+	n459:
+		if (x[1] > -4.23855602642993559e-02) goto n492;
+		goto n491;
+	n491:
+		return(tree_2_leaves[206]);
+	n492:
+		return(tree_2_leaves[207]);
+	n460:
+		if (x[0] > 3.57364858803191909e-02) goto n494;
+		goto n493;
+	n493:
+		if (x[6] > 2.63113375389715520e-02) goto n512;
+		goto n511;
+	n511:
+		return(tree_2_leaves[208]);
+	n512:
+		return(tree_2_leaves[209]);
+	n494:
+		if (x[6] > 1.94620833095063422e-02) goto n514;
+		goto n513;
+	n513:
+		return(tree_2_leaves[210]);
+	n514:
+		return(tree_2_leaves[211]);
+	n406:
+		if (x[3] > 1.09838499398063755e-02) goto n462;
+		goto n461;
+	n461:
+		return(tree_2_leaves[212]);
+	n462:
+		if (x[4] > 2.89945634624356532e-02) goto n496;
+		goto n495;
+	n495:
+		return(tree_2_leaves[213]);
+	n496:
+		if (x[4] > 7.53592198954034231e-02) goto n516;
+		goto n515;
+	n515:
+		return(tree_2_leaves[214]);
+	n516:
+		return(tree_2_leaves[215]);
+	n96:
+		if (x[0] > 4.60916731973797372e-02) goto n170;
+		goto n169;
+	n169:
+		return(tree_2_leaves[216]);
+	n170:
+		if (x[6] > -2.13695900365134181e-02) goto n258;
+		goto n257;
+	n257:
+		if (x[7] > 6.61464499811237061e-02) goto n338;
+		goto n337;
+	n337:
+		if (x[6] > -4.01325489396383780e-02) goto n408;
+		goto n407;
+	n407:
+		return(tree_2_leaves[217]);
+	n408:
+		return(tree_2_leaves[218]);
+	n338:
+		return(tree_2_leaves[219]);
+	n258:
+		return(tree_2_leaves[220]);
+	n26:
+		if (x[8] > 9.10296047731460820e-03) goto n52;
+		goto n51;
+	n51:
+		if (x[4] > 2.38880111512713884e-02) goto n98;
+		goto n97;
+	n97:
+		if (x[3] > -6.50664131381489472e-03) goto n172;
+		goto n171;
+	n171:
+		return(tree_2_leaves[221]);
+	n172:
+		return(tree_2_leaves[222]);
+	n98:
+		return(tree_2_leaves[223]);
+	n52:
+		if (x[3] > 6.24264852942270632e-02) goto n100;
+		goto n99;
+	n99:
+		if (x[3] > 2.58831359306966047e-02) goto n174;
+		goto n173;
+	n173:
+		if (x[8] > 4.27087363046482482e-02) goto n260;
+		goto n259;
+	n259:
+		if (x[3] > 2.02589534154840947e-02) goto n340;
+		goto n339;
+	n339:
+		if (x[7] > 5.74227612709691387e-03) goto n410;
+		goto n409;
+	n409:
+		return(tree_2_leaves[224]);
+	n410:
+		return(tree_2_leaves[225]);
+	n340:
+		return(tree_2_leaves[226]);
+	n260:
+		if (x[5] > 1.98173267509987316e-02) goto n342;
+		goto n341;
+	n341:
+		if (x[5] > 9.76611357464827329e-03) goto n412;
+		goto n411;
+	n411:
+		return(tree_2_leaves[227]);
+	n412:
+		return(tree_2_leaves[228]);
+	n342:
+		if (x[4] > 4.77656902480743800e-02) goto n414;
+		goto n413;
+	n413:
+		return(tree_2_leaves[229]);
+	n414:
+		return(tree_2_leaves[230]);
+	n174:
+		if (x[6] > 7.57140448464532333e-04) goto n262;
+		goto n261;
+	n261:
+		if (x[0] > 3.94332178325009913e-02) goto n344;
+		goto n343;
+	n343:
+		if (x[1] > -1.74598662314298485e-02) goto n416;
+		goto n415;
+	n415:
+		return(tree_2_leaves[231]);
+	n416:
+		return(tree_2_leaves[232]);
+	n344:
+		return(tree_2_leaves[233]);
+	n262:
+		if (x[2] > 4.03432500271112826e-02) goto n346;
+		goto n345;
+	n345:
+		if (x[1] > 3.81920515910220484e-02) goto n418;
+		goto n417;
+	n417:
+		return(tree_2_leaves[234]);
+	n418:
+		return(tree_2_leaves[235]);
+	n346:
+		return(tree_2_leaves[236]);
+	n100:
+		if (x[9] > -4.39672960225136605e-02) goto n176;
+		goto n175;
+	n175:
+		return(tree_2_leaves[237]);
+	n176:
+		if (x[0] > 1.81732245587395876e-02) goto n264;
+		goto n263;
+	n263:
+		return(tree_2_leaves[238]);
+	n264:
+		if (x[0] > 2.60118404887648216e-02) goto n348;
+		goto n347;
+	n347:
+		return(tree_2_leaves[239]);
+	n348:
+		return(tree_2_leaves[240]);
+	n6:
+		if (x[4] > 4.06521890708292644e-02) goto n14;
+		goto n13;
+	n13:
+		if (x[6] > -4.44587697572769794e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[5] > -2.02797282179314337e-02) goto n54;
+		goto n53;
+	n53:
+		if (x[9] > 5.95304247351028590e-02) goto n102;
+		goto n101;
+	n101:
+		return(tree_2_leaves[241]);
+	n102:
+		return(tree_2_leaves[242]);
+	n54:
+		if (x[7] > 5.59216713371544633e-02) goto n104;
+		goto n103;
+	n103:
+		if (x[6] > -5.16746987405674735e-02) goto n178;
+		goto n177;
+	n177:
+		return(tree_2_leaves[243]);
+	n178:
+		return(tree_2_leaves[244]);
+	n104:
+		return(tree_2_leaves[245]);
+	n28:
+		if (x[3] > 3.97699553650044182e-02) goto n56;
+		goto n55;
+	n55:
+		if (x[6] > -2.81835815333813418e-02) goto n106;
+		goto n105;
+	n105:
+		if (x[7] > 3.29373472643179205e-02) goto n180;
+		goto n179;
+	n179:
+		if (x[6] > -3.91353027875613740e-02) goto n266;
+		goto n265;
+	n265:
+		return(tree_2_leaves[246]);
+	n266:
+		return(tree_2_leaves[247]);
+	n180:
+		if (x[8] > 6.99972903918286565e-02) goto n268;
+		goto n267;
+	n267:
+		return(tree_2_leaves[248]);
+	n268:
+		return(tree_2_leaves[249]);
+	n106:
+		if (x[3] > 1.34370577965712210e-02) goto n182;
+		goto n181;
+	n181:
+		if (x[1] > 4.97164024039285293e-02) goto n270;
+		goto n269;
+	n269:
+		return(tree_2_leaves[250]);
+	n270:
+		return(tree_2_leaves[251]);
+	n182:
+		if (x[3] > 1.70892640590711228e-02) goto n272;
+		goto n271;
+	n271:
+		return(tree_2_leaves[252]);
+	n272:
+		return(tree_2_leaves[253]);
+	n56:
+		if (x[4] > 1.52668954506583066e-02) goto n108;
+		goto n107;
+	n107:
+		if (x[4] > 2.65333347541294373e-03) goto n184;
+		goto n183;
+	n183:
+		if (x[5] > -1.28978208394308867e-02) goto n274;
+		goto n273;
+	n273:
+		return(tree_2_leaves[254]);
+	n274:
+		if (x[0] > -3.47783140902312576e-02) goto n350;
+		goto n349;
+	n349:
+		return(tree_2_leaves[255]);
+	n350:
+		return(tree_2_leaves[256]);
+	n184:
+		if (x[1] > 3.95079930601250975e-02) goto n276;
+		goto n275;
+	n275:
+		if (x[9] > 7.44015721719521461e-02) goto n352;
+		goto n351;
+	n351:
+		return(tree_2_leaves[257]);
+	n352:
+		return(tree_2_leaves[258]);
+	n276:
+		return(tree_2_leaves[259]);
+	n108:
+		if (x[2] > 9.81374164629723322e-02) goto n186;
+		goto n185;
+	n185:
+		return(tree_2_leaves[260]);
+	n186:
+		return(tree_2_leaves[261]);
+	n14:
+		if (x[8] > 4.89593348817238191e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[1] > -1.33677079288742132e-02) goto n58;
+		goto n57;
+	n57:
+		if (x[4] > 1.12047414673722506e-01) goto n110;
+		goto n109;
+	n109:
+		return(tree_2_leaves[262]);
+	n110:
+		return(tree_2_leaves[263]);
+	n58:
+		if (x[7] > 1.06317866571704125e-02) goto n112;
+		goto n111;
+	n111:
+		return(tree_2_leaves[264]);
+	n112:
+		if (x[3] > 4.53521777167672363e-02) goto n188;
+		goto n187;
+	n187:
+		return(tree_2_leaves[265]);
+	n188:
+		return(tree_2_leaves[266]);
+	n30:
+		if (x[2] > 8.14426966258127855e-02) goto n60;
+		goto n59;
+	n59:
+		if (x[9] > 4.69539479300684626e-02) goto n114;
+		goto n113;
+	n113:
+		return(tree_2_leaves[267]);
+	n114:
+		if (x[7] > 8.06565472256603327e-02) goto n190;
+		goto n189;
+	n189:
+		return(tree_2_leaves[268]);
+	n190:
+		return(tree_2_leaves[269]);
+	n60:
+		return(tree_2_leaves[270]);
+}
+
+static const leaf_t tree_3_leaves[] = {
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.99000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.56000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.54000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.89000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.71000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.84000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.93000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.87000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.67000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.76000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.66000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.12000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_3_find_leaf(const num_t *x){
+		if (x[2] > 1.22662500273515050e-05) goto n2;
+		goto n1;
+	n1:
+		if (x[8] > -9.91067336664699927e-03) goto n4;
+		goto n3;
+	n3:
+		if (x[0] > 2.06786087164829505e-02) goto n8;
+		goto n7;
+	n7:
+		if (x[3] > 7.24546505956186471e-02) goto n16;
+		goto n15;
+	n15:
+		if (x[3] > 9.52176606739206944e-04) goto n32;
+		goto n31;
+	n31:
+		if (x[3] > -9.77364474759290919e-03) goto n62;
+		goto n61;
+	n61:
+		if (x[2] > -7.28544007862259868e-02) goto n110;
+		goto n109;
+	n109:
+		if (x[5] > -2.55637557681270347e-02) goto n184;
+		goto n183;
+	n183:
+		if (x[5] > -3.45872206857868042e-02) goto n270;
+		goto n269;
+	n269:
+		if (x[6] > -2.08286660842794021e-02) goto n346;
+		goto n345;
+	n345:
+		return(tree_3_leaves[0]);
+	n346:
+		if (x[3] > -2.97242109532146158e-02) goto n410;
+		goto n409;
+	n409:
+		return(tree_3_leaves[1]);
+	n410:
+		return(tree_3_leaves[2]);
+	n270:
+		if (x[4] > -4.50902165805997790e-02) goto n348;
+		goto n347;
+	n347:
+		return(tree_3_leaves[3]);
+	n348:
+		if (x[2] > -8.71049685243281691e-02) goto n412;
+		goto n411;
+	n411:
+		return(tree_3_leaves[4]);
+	n412:
+		return(tree_3_leaves[5]);
+	n184:
+		if (x[8] > -2.60420668820385282e-02) goto n272;
+		goto n271;
+	n271:
+		return(tree_3_leaves[6]);
+	n272:
+		return(tree_3_leaves[7]);
+	n110:
+		if (x[2] > -6.32902841056098425e-02) goto n186;
+		goto n185;
+	n185:
+		if (x[3] > -5.68361360380900196e-02) goto n274;
+		goto n273;
+	n273:
+		if (x[8] > -3.59357866223175559e-02) goto n350;
+		goto n349;
+	n349:
+		if (x[5] > -5.04693709698792806e-02) goto n414;
+		goto n413;
+	n413:
+		if (x[6] > 5.23247937434776628e-02) goto n466;
+		goto n465;
+	n465:
+		return(tree_3_leaves[8]);
+	n466:
+		return(tree_3_leaves[9]);
+	n414:
+		return(tree_3_leaves[10]);
+	n350:
+		if (x[6] > 8.78036175227437277e-04) goto n416;
+		goto n415;
+	n415:
+		return(tree_3_leaves[11]);
+	n416:
+		return(tree_3_leaves[12]);
+	n274:
+		if (x[6] > 9.96584185139580830e-02) goto n352;
+		goto n351;
+	n351:
+		if (x[0] > -3.28546302592211403e-03) goto n418;
+		goto n417;
+	n417:
+		return(tree_3_leaves[13]);
+	n418:
+		if (x[3] > -1.52811734612306495e-02) goto n468;
+		goto n467;
+	n467:
+		return(tree_3_leaves[14]);
+	n468:
+		return(tree_3_leaves[15]);
+	n352:
+		return(tree_3_leaves[16]);
+	n186:
+		if (x[1] > -1.01394808824202612e-02) goto n276;
+		goto n275;
+	n275:
+		if (x[0] > -2.65237652384069135e-02) goto n354;
+		goto n353;
+	n353:
+		if (x[9] > -4.00170957624556012e-02) goto n420;
+		goto n419;
+	n419:
+		if (x[3] > -1.50637447936631877e-02) goto n470;
+		goto n469;
+	n469:
+		if (x[9] > -5.44195487739019268e-02) goto n496;
+		goto n495;
+	n495:
+		if (x[6] > 3.25560808756004960e-02) goto n522;
+		goto n521;
+	n521:
+		if (x[3] > -2.80654954873405665e-02) goto n536;
+		goto n535;
+	n535:
+		if (x[5] > -6.63829022768222532e-04) goto n546;
+		goto n545;
+	n545:
+		return(tree_3_leaves[17]);
+	n546:
+		return(tree_3_leaves[18]);
+	n536:
+		return(tree_3_leaves[19]);
+	n522:
+		return(tree_3_leaves[20]);
+	n496:
+		return(tree_3_leaves[21]);
+	n470:
+		return(tree_3_leaves[22]);
+	n420:
+		if (x[3] > -3.93288130766129493e-02) goto n472;
+		goto n471;
+	n471:
+		if (x[9] > -2.75453277147035686e-02) goto n498;
+		goto n497;
+	n497:
+		return(tree_3_leaves[23]);
+	n498:
+		if (x[2] > -4.71213528122173958e-02) goto n524;
+		goto n523;
+	n523:
+		return(tree_3_leaves[24]);
+	n524:
+		return(tree_3_leaves[25]);
+	n472:
+		if (x[5] > 3.27274360413866983e-02) goto n500;
+		goto n499;
+	n499:
+		if (x[4] > -8.23888630583192484e-04) goto n526;
+		goto n525;
+	n525:
+		return(tree_3_leaves[26]);
+	n526:
+		if (x[5] > 5.56884598459440883e-03) goto n538;
+		goto n537;
+	n537:
+		return(tree_3_leaves[27]);
+	n538:
+		return(tree_3_leaves[28]);
+	n500:
+		return(tree_3_leaves[29]);
+	n354:
+		if (x[6] > 1.30987729638771359e-02) goto n422;
+		goto n421;
+	n421:
+		if (x[5] > -1.85929179750769467e-02) goto n474;
+		goto n473;
+	n473:
+		if (x[2] > -2.37547244765763874e-02) goto n502;
+		goto n501;
+	n501:
+		return(tree_3_leaves[30]);
+	n502:
+		return(tree_3_leaves[31]);
+	n474:
+		if (x[2] > -4.91375079931411080e-02) goto n504;
+		goto n503;
+	n503:
+		return(tree_3_leaves[32]);
+	n504:
+		return(tree_3_leaves[33]);
+	n422:
+		if (x[6] > 2.77669397472408812e-02) goto n476;
+		goto n475;
+	n475:
+		return(tree_3_leaves[34]);
+	n476:
+		if (x[4] > -2.97404961135274322e-02) goto n506;
+		goto n505;
+	n505:
+		if (x[6] > 6.07765408281078362e-02) goto n528;
+		goto n527;
+	n527:
+		return(tree_3_leaves[35]);
+	n528:
+		if (x[5] > -5.13698269510122971e-02) goto n540;
+		goto n539;
+	n539:
+		return(tree_3_leaves[36]);
+	n540:
+		return(tree_3_leaves[37]);
+	n506:
+		if (x[9] > -2.85838238735283690e-03) goto n530;
+		goto n529;
+	n529:
+		if (x[8] > -6.98320093479993381e-02) goto n542;
+		goto n541;
+	n541:
+		return(tree_3_leaves[38]);
+	n542:
+		if (x[3] > -9.57735877542899294e-02) goto n548;
+		goto n547;
+	n547:
+		return(tree_3_leaves[39]);
+	n548:
+		return(tree_3_leaves[40]);
+	n530:
+		if (x[4] > 6.40677254602912277e-02) goto n544;
+		goto n543;
+	n543:
+		return(tree_3_leaves[41]);
+	n544:
+		return(tree_3_leaves[42]);
+	n276:
+		if (x[6] > 9.75959539287610863e-04) goto n356;
+		goto n355;
+	n355:
+		if (x[3] > -3.20727085862977726e-02) goto n424;
+		goto n423;
+	n423:
+		if (x[4] > -4.94251968483023982e-02) goto n478;
+		goto n477;
+	n477:
+		if (x[4] > -9.53187760941928142e-02) goto n508;
+		goto n507;
+	n507:
+		return(tree_3_leaves[43]);
+	n508:
+		return(tree_3_leaves[44]);
+	n478:
+		return(tree_3_leaves[45]);
+	n424:
+		if (x[0] > -7.09793909427046399e-02) goto n480;
+		goto n479;
+	n479:
+		return(tree_3_leaves[46]);
+	n480:
+		return(tree_3_leaves[47]);
+	n356:
+		if (x[2] > -4.11813528861205633e-02) goto n426;
+		goto n425;
+	n425:
+		return(tree_3_leaves[48]);
+	n426:
+		if (x[5] > -9.17230110552659170e-03) goto n482;
+		goto n481;
+	n481:
+		if (x[4] > -4.88905008957032372e-02) goto n510;
+		goto n509;
+	n509:
+		return(tree_3_leaves[49]);
+	n510:
+		return(tree_3_leaves[50]);
+	n482:
+		if (x[5] > 1.54705410677940976e-02) goto n512;
+		goto n511;
+	n511:
+		return(tree_3_leaves[51]);
+	n512:
+		return(tree_3_leaves[52]);
+	n62:
+		if (x[0] > 9.53042008238197923e-03) goto n112;
+		goto n111;
+	n111:
+		if (x[6] > 1.98712292072067177e-02) goto n188;
+		goto n187;
+	n187:
+		if (x[8] > -4.19387843496305604e-02) goto n278;
+		goto n277;
+	n277:
+		return(tree_3_leaves[53]);
+	n278:
+		if (x[4] > -3.14893905130545909e-02) goto n358;
+		goto n357;
+	n357:
+		if (x[5] > -5.73825963484153323e-02) goto n428;
+		goto n427;
+	n427:
+		return(tree_3_leaves[54]);
+	n428:
+		return(tree_3_leaves[55]);
+	n358:
+		if (x[6] > 1.89894482344105421e-02) goto n430;
+		goto n429;
+	n429:
+		return(tree_3_leaves[56]);
+	n430:
+		return(tree_3_leaves[57]);
+	n188:
+		if (x[2] > -7.77698490190246918e-03) goto n280;
+		goto n279;
+	n279:
+		return(tree_3_leaves[58]);
+	n280:
+		return(tree_3_leaves[59]);
+	n112:
+		if (x[7] > -1.54894950493008887e-02) goto n190;
+		goto n189;
+	n189:
+		if (x[9] > -1.86740359421944252e-02) goto n282;
+		goto n281;
+	n281:
+		return(tree_3_leaves[60]);
+	n282:
+		return(tree_3_leaves[61]);
+	n190:
+		return(tree_3_leaves[62]);
+	n32:
+		if (x[5] > -3.02336549457450469e-02) goto n64;
+		goto n63;
+	n63:
+		if (x[5] > -9.74267999353046615e-02) goto n114;
+		goto n113;
+	n113:
+		return(tree_3_leaves[63]);
+	n114:
+		return(tree_3_leaves[64]);
+	n64:
+		if (x[8] > -3.79242520865327101e-02) goto n116;
+		goto n115;
+	n115:
+		if (x[2] > -9.67468986303330995e-03) goto n192;
+		goto n191;
+	n191:
+		if (x[9] > -2.40677235108858537e-02) goto n284;
+		goto n283;
+	n283:
+		return(tree_3_leaves[65]);
+	n284:
+		if (x[7] > -1.81110084378701720e-02) goto n360;
+		goto n359;
+	n359:
+		return(tree_3_leaves[66]);
+	n360:
+		return(tree_3_leaves[67]);
+	n192:
+		return(tree_3_leaves[68]);
+	n116:
+		if (x[0] > -5.59785179626363302e-02) goto n194;
+		goto n193;
+	n193:
+		return(tree_3_leaves[69]);
+	n194:
+		return(tree_3_leaves[70]);
+	n16:
+		return(tree_3_leaves[71]);
+	n8:
+		if (x[5] > -2.62677745589436386e-02) goto n18;
+		goto n17;
+	n17:
+		if (x[2] > -2.99887553683914967e-02) goto n34;
+		goto n33;
+	n33:
+		if (x[3] > -2.52228721197483956e-02) goto n66;
+		goto n65;
+	n65:
+		if (x[5] > -3.81027466751086216e-02) goto n118;
+		goto n117;
+	n117:
+		return(tree_3_leaves[72]);
+	n118:
+		return(tree_3_leaves[73]);
+	n66:
+		if (x[9] > -2.97964021496001964e-02) goto n120;
+		goto n119;
+	n119:
+		return(tree_3_leaves[74]);
+	n120:
+		if (x[6] > 1.07626985464436414e-01) goto n196;
+		goto n195;
+	n195:
+		return(tree_3_leaves[75]);
+	n196:
+		return(tree_3_leaves[76]);
+	n34:
+		if (x[9] > -1.57957863860109377e-03) goto n68;
+		goto n67;
+	n67:
+		if (x[0] > 2.93090188570538507e-02) goto n122;
+		goto n121;
+	n121:
+		return(tree_3_leaves[77]);
+	n122:
+		if (x[5] > -3.61826647484098998e-02) goto n198;
+		goto n197;
+	n197:
+		return(tree_3_leaves[78]);
+	n198:
+		return(tree_3_leaves[79]);
+	n68:
+		if (x[5] > -4.49693243478988050e-02) goto n124;
+		goto n123;
+	n123:
+		return(tree_3_leaves[80]);
+	n124:
+		if (x[6] > 3.30397143962641096e-02) goto n200;
+		goto n199;
+	n199:
+		return(tree_3_leaves[81]);
+	n200:
+		return(tree_3_leaves[82]);
+	n18:
+		if (x[9] > 3.23070674118682427e-02) goto n36;
+		goto n35;
+	n35:
+		if (x[6] > 6.63430059454813009e-02) goto n70;
+		goto n69;
+	n69:
+		if (x[8] > -6.92457591287312518e-02) goto n126;
+		goto n125;
+	n125:
+		if (x[8] > -9.19540039123220021e-02) goto n202;
+		goto n201;
+	n201:
+		return(tree_3_leaves[83]);
+	n202:
+		return(tree_3_leaves[84]);
+	n126:
+		if (x[5] > 4.74371983675145881e-02) goto n204;
+		goto n203;
+	n203:
+		if (x[3] > 9.68967737218336123e-03) goto n286;
+		goto n285;
+	n285:
+		if (x[6] > 3.69011554396937932e-02) goto n362;
+		goto n361;
+	n361:
+		if (x[0] > 4.04829569082303803e-02) goto n432;
+		goto n431;
+	n431:
+		return(tree_3_leaves[85]);
+	n432:
+		if (x[0] > 4.59062263046383229e-02) goto n484;
+		goto n483;
+	n483:
+		return(tree_3_leaves[86]);
+	n484:
+		if (x[0] > 6.38042371715135670e-02) goto n514;
+		goto n513;
+	n513:
+		return(tree_3_leaves[87]);
+	n514:
+		return(tree_3_leaves[88]);
+	n362:
+		return(tree_3_leaves[89]);
+	n286:
+		if (x[2] > -4.39029420051431571e-02) goto n364;
+		goto n363;
+	n363:
+		return(tree_3_leaves[90]);
+	n364:
+		if (x[6] > -2.21732830372197501e-02) goto n434;
+		goto n433;
+	n433:
+		return(tree_3_leaves[91]);
+	n434:
+		return(tree_3_leaves[92]);
+	n204:
+		if (x[4] > 5.09497371050076642e-02) goto n288;
+		goto n287;
+	n287:
+		return(tree_3_leaves[93]);
+	n288:
+		return(tree_3_leaves[94]);
+	n70:
+		if (x[9] > -7.10258203560073520e-02) goto n128;
+		goto n127;
+	n127:
+		return(tree_3_leaves[95]);
+	n128:
+		if (x[0] > 6.34225142486871951e-02) goto n206;
+		goto n205;
+	n205:
+		return(tree_3_leaves[96]);
+	n206:
+		return(tree_3_leaves[97]);
+	n36:
+		if (x[7] > 4.43909582728930843e-02) goto n72;
+		goto n71;
+	n71:
+		if (x[1] > 3.14234979396655831e-02) goto n130;
+		goto n129;
+	n129:
+		if (x[3] > -4.25102485654017381e-03) goto n208;
+		goto n207;
+	n207:
+		return(tree_3_leaves[98]);
+	n208:
+		return(tree_3_leaves[99]);
+	n130:
+		return(tree_3_leaves[100]);
+	n72:
+		if (x[6] > -6.06041856730641787e-02) goto n132;
+		goto n131;
+	n131:
+		return(tree_3_leaves[101]);
+	n132:
+		return(tree_3_leaves[102]);
+	n4:
+		if (x[7] > 2.33205785815602321e-02) goto n10;
+		goto n9;
+	n9:
+		if (x[5] > -1.84232199325666812e-02) goto n20;
+		goto n19;
+	n19:
+		if (x[3] > 3.88394933966583963e-02) goto n38;
+		goto n37;
+	n37:
+		if (x[9] > -6.19870480301683360e-02) goto n74;
+		goto n73;
+	n73:
+		if (x[7] > -7.37163635540647594e-03) goto n134;
+		goto n133;
+	n133:
+		return(tree_3_leaves[103]);
+	n134:
+		return(tree_3_leaves[104]);
+	n74:
+		if (x[6] > 5.22318046713742164e-03) goto n136;
+		goto n135;
+	n135:
+		if (x[6] > -3.00436608125705350e-02) goto n210;
+		goto n209;
+	n209:
+		if (x[5] > -6.79313328680874601e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_3_leaves[105]);
+	n290:
+		if (x[4] > -6.02458080060514628e-02) goto n366;
+		goto n365;
+	n365:
+		return(tree_3_leaves[106]);
+	n366:
+		if (x[5] > -3.91444827111919122e-02) goto n436;
+		goto n435;
+	n435:
+		return(tree_3_leaves[107]);
+	n436:
+		return(tree_3_leaves[108]);
+	n210:
+		if (x[2] > -5.23731818610741751e-02) goto n292;
+		goto n291;
+	n291:
+		return(tree_3_leaves[109]);
+	n292:
+		return(tree_3_leaves[110]);
+	n136:
+		if (x[4] > -1.64838094277470967e-02) goto n212;
+		goto n211;
+	n211:
+		if (x[5] > -7.22162469819889880e-02) goto n294;
+		goto n293;
+	n293:
+		return(tree_3_leaves[111]);
+	n294:
+		return(tree_3_leaves[112]);
+	n212:
+		if (x[8] > -1.42634628344563545e-03) goto n296;
+		goto n295;
+	n295:
+		return(tree_3_leaves[113]);
+	n296:
+		return(tree_3_leaves[114]);
+	n38:
+		return(tree_3_leaves[115]);
+	n20:
+		if (x[0] > 4.20501348656495758e-02) goto n40;
+		goto n39;
+	n39:
+		if (x[8] > -8.51670291898889466e-03) goto n76;
+		goto n75;
+	n75:
+		return(tree_3_leaves[116]);
+	n76:
+		if (x[0] > -8.74016680080717985e-03) goto n138;
+		goto n137;
+	n137:
+		if (x[8] > 1.20776833374245246e-02) goto n214;
+		goto n213;
+	n213:
+		if (x[7] > -2.58636236863009038e-02) goto n298;
+		goto n297;
+	n297:
+		return(tree_3_leaves[117]);
+	n298:
+		return(tree_3_leaves[118]);
+	n214:
+		return(tree_3_leaves[119]);
+	n138:
+		if (x[8] > 9.54670332043477433e-03) goto n216;
+		goto n215;
+	n215:
+		if (x[3] > 1.18295832888122739e-03) goto n300;
+		goto n299;
+	n299:
+		if (x[4] > 2.03861311150720440e-02) goto n368;
+		goto n367;
+	n367:
+		if (x[3] > -2.65686003820203923e-02) goto n438;
+		goto n437;
+	n437:
+		return(tree_3_leaves[120]);
+	n438:
+		return(tree_3_leaves[121]);
+	n368:
+		return(tree_3_leaves[122]);
+	n300:
+		return(tree_3_leaves[123]);
+	n216:
+		if (x[3] > -8.41163399534549175e-03) goto n302;
+		goto n301;
+	n301:
+		if (x[5] > 5.17427963691364581e-02) goto n370;
+		goto n369;
+	n369:
+		if (x[9] > -1.77862794412257316e-02) goto n440;
+		goto n439;
+	n439:
+		return(tree_3_leaves[124]);
+	n440:
+		return(tree_3_leaves[125]);
+	n370:
+		return(tree_3_leaves[126]);
+	n302:
+		if (x[0] > 3.10693503806481995e-02) goto n372;
+		goto n371;
+	n371:
+		return(tree_3_leaves[127]);
+	n372:
+		return(tree_3_leaves[128]);
+	n40:
+		if (x[6] > 3.01728759945393901e-02) goto n78;
+		goto n77;
+	n77:
+		return(tree_3_leaves[129]);
+	n78:
+		return(tree_3_leaves[130]);
+	n10:
+		if (x[3] > 2.33445326580163752e-02) goto n22;
+		goto n21;
+	n21:
+		if (x[9] > -1.90710834097278063e-02) goto n42;
+		goto n41;
+	n41:
+		if (x[6] > -7.09012222432991168e-02) goto n80;
+		goto n79;
+	n79:
+		return(tree_3_leaves[131]);
+	n80:
+		if (x[8] > 6.04113073823214011e-02) goto n140;
+		goto n139;
+	n139:
+		return(tree_3_leaves[132]);
+	n140:
+		return(tree_3_leaves[133]);
+	n42:
+		if (x[8] > -7.59271409686795764e-03) goto n82;
+		goto n81;
+	n81:
+		return(tree_3_leaves[134]);
+	n82:
+		if (x[0] > 6.34203387648779593e-02) goto n142;
+		goto n141;
+	n141:
+		if (x[4] > -2.06360957376747409e-02) goto n218;
+		goto n217;
+	n217:
+		return(tree_3_leaves[135]);
+	n218:
+		if (x[3] > 7.81380077091993475e-03) goto n304;
+		goto n303;
+	n303:
+		if (x[4] > 2.43941388210687088e-02) goto n374;
+		goto n373;
+	n373:
+		return(tree_3_leaves[136]);
+	n374:
+		if (x[5] > 6.93841989216036209e-02) goto n442;
+		goto n441;
+	n441:
+		if (x[0] > -4.47195995074250521e-02) goto n486;
+		goto n485;
+	n485:
+		return(tree_3_leaves[137]);
+	n486:
+		return(tree_3_leaves[138]);
+	n442:
+		if (x[2] > -3.92548373840538936e-03) goto n488;
+		goto n487;
+	n487:
+		return(tree_3_leaves[139]);
+	n488:
+		return(tree_3_leaves[140]);
+	n304:
+		if (x[0] > -2.01971147925035233e-02) goto n376;
+		goto n375;
+	n375:
+		return(tree_3_leaves[141]);
+	n376:
+		return(tree_3_leaves[142]);
+	n142:
+		if (x[8] > 4.86006934852157083e-03) goto n220;
+		goto n219;
+	n219:
+		if (x[0] > 7.39718527172103096e-02) goto n306;
+		goto n305;
+	n305:
+		return(tree_3_leaves[143]);
+	n306:
+		return(tree_3_leaves[144]);
+	n220:
+		if (x[2] > -3.16990976550945158e-02) goto n308;
+		goto n307;
+	n307:
+		return(tree_3_leaves[145]);
+	n308:
+		return(tree_3_leaves[146]);
+	n22:
+		if (x[6] > -4.69122512233906899e-02) goto n44;
+		goto n43;
+	n43:
+		if (x[4] > 2.85579898355874801e-02) goto n84;
+		goto n83;
+	n83:
+		return(tree_3_leaves[147]);
+	n84:
+		return(tree_3_leaves[148]);
+	n44:
+		if (x[8] > 1.08668760544378268e-02) goto n86;
+		goto n85;
+	n85:
+		return(tree_3_leaves[149]);
+	n86:
+		if (x[3] > 4.82326046889586732e-02) goto n144;
+		goto n143;
+	n143:
+		return(tree_3_leaves[150]);
+	n144:
+		if (x[5] > 8.45096101460492688e-02) goto n222;
+		goto n221;
+	n221:
+		if (x[2] > -2.47713078887958453e-02) goto n310;
+		goto n309;
+	n309:
+		if (x[8] > 4.45462230974803114e-02) goto n378;
+		goto n377;
+	n377:
+		return(tree_3_leaves[151]);
+	n378:
+		return(tree_3_leaves[152]);
+	n310:
+		return(tree_3_leaves[153]);
+	n222:
+		return(tree_3_leaves[154]);
+	n2:
+		if (x[2] > 7.03624545313854544e-02) goto n6;
+		goto n5;
+	n5:
+		if (x[8] > 1.66767192314609888e-02) goto n12;
+		goto n11;
+	n11:
+		if (x[0] > 2.79356510179457861e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[4] > -2.99828297110135283e-02) goto n46;
+		goto n45;
+	n45:
+		if (x[6] > 1.83598623459153426e-02) goto n88;
+		goto n87;
+	n87:
+		if (x[2] > 5.23723441971350179e-02) goto n146;
+		goto n145;
+	n145:
+		if (x[6] > -2.04152926759335052e-02) goto n224;
+		goto n223;
+	n223:
+		if (x[4] > -9.49502374346102573e-02) goto n312;
+		goto n311;
+	n311:
+		return(tree_3_leaves[155]);
+	n312:
+		return(tree_3_leaves[156]);
+	n224:
+		if (x[9] > -4.47774138454951273e-02) goto n314;
+		goto n313;
+	n313:
+		return(tree_3_leaves[157]);
+	n314:
+		if (x[9] > -2.21861674006004622e-02) goto n380;
+		goto n379;
+	n379:
+		return(tree_3_leaves[158]);
+	n380:
+		if (x[3] > 4.61745788297258375e-02) goto n444;
+		goto n443;
+	n443:
+		return(tree_3_leaves[159]);
+	n444:
+		return(tree_3_leaves[160]);
+	n146:
+		return(tree_3_leaves[161]);
+	n88:
+		if (x[9] > -7.21027714721611101e-03) goto n148;
+		goto n147;
+	n147:
+		if (x[2] > 4.88615064579812353e-02) goto n226;
+		goto n225;
+	n225:
+		return(tree_3_leaves[162]);
+	n226:
+		return(tree_3_leaves[163]);
+	n148:
+		return(tree_3_leaves[164]);
+	n46:
+		if (x[0] > 9.02722409744079191e-03) goto n90;
+		goto n89;
+	n89:
+		if (x[5] > 1.57772652971294031e-02) goto n150;
+		goto n149;
+	n149:
+		if (x[8] > -1.81879928461211194e-03) goto n228;
+		goto n227;
+	n227:
+		if (x[4] > -1.34551151774924965e-02) goto n316;
+		goto n315;
+	n315:
+		if (x[9] > 1.59174776370163661e-02) goto n382;
+		goto n381;
+	n381:
+		if (x[2] > 4.26282905085002134e-02) goto n446;
+		goto n445;
+	n445:
+		return(tree_3_leaves[165]);
+	n446:
+		return(tree_3_leaves[166]);
+	n382:
+		return(tree_3_leaves[167]);
+	n316:
+		if (x[5] > -2.02867294378733694e-03) goto n384;
+		goto n383;
+	n383:
+		return(tree_3_leaves[168]);
+	n384:
+		if (x[4] > -5.42933406320804911e-04) goto n448;
+		goto n447;
+	n447:
+		return(tree_3_leaves[169]);
+	n448:
+		return(tree_3_leaves[170]);
+	n228:
+		if (x[5] > -1.09251027820108700e-02) goto n318;
+		goto n317;
+	n317:
+		if (x[4] > -2.63361372253567046e-02) goto n386;
+		goto n385;
+	n385:
+		return(tree_3_leaves[171]);
+	n386:
+		return(tree_3_leaves[172]);
+	n318:
+		return(tree_3_leaves[173]);
+	n150:
+		if (x[5] > 5.13363076152955691e-02) goto n230;
+		goto n229;
+	n229:
+		if (x[4] > 1.00592906517978104e-02) goto n320;
+		goto n319;
+	n319:
+		return(tree_3_leaves[174]);
+	n320:
+		if (x[6] > -4.28361114760001938e-02) goto n388;
+		goto n387;
+	n387:
+		if (x[7] > 6.48631517346649755e-02) goto n450;
+		goto n449;
+	n449:
+		return(tree_3_leaves[175]);
+	n450:
+		return(tree_3_leaves[176]);
+	n388:
+		if (x[7] > -2.17084408264830650e-02) goto n452;
+		goto n451;
+	n451:
+		return(tree_3_leaves[177]);
+	n452:
+		return(tree_3_leaves[178]);
+	n230:
+		return(tree_3_leaves[179]);
+	n90:
+		if (x[2] > 2.69104835841938519e-02) goto n152;
+		goto n151;
+	n151:
+		if (x[9] > 4.45844569006849378e-02) goto n232;
+		goto n231;
+	n231:
+		if (x[3] > -9.93337117513236334e-03) goto n322;
+		goto n321;
+	n321:
+		return(tree_3_leaves[180]);
+	n322:
+		return(tree_3_leaves[181]);
+	n232:
+		return(tree_3_leaves[182]);
+	n152:
+		return(tree_3_leaves[183]);
+	n24:
+		if (x[5] > -8.88802657971497594e-03) goto n48;
+		goto n47;
+	n47:
+		if (x[4] > -3.39760557995654536e-02) goto n92;
+		goto n91;
+	n91:
+		if (x[2] > 1.50721309262984715e-02) goto n154;
+		goto n153;
+	n153:
+		return(tree_3_leaves[184]);
+	n154:
+		if (x[8] > -5.34893487902239201e-02) goto n234;
+		goto n233;
+	n233:
+		return(tree_3_leaves[185]);
+	n234:
+		return(tree_3_leaves[186]);
+	n92:
+		return(tree_3_leaves[187]);
+	n48:
+		if (x[5] > 2.61569723362883345e-02) goto n94;
+		goto n93;
+	n93:
+		if (x[3] > 2.45833552512266587e-02) goto n156;
+		goto n155;
+	n155:
+		return(tree_3_leaves[188]);
+	n156:
+		if (x[8] > 1.01097553900527728e-02) goto n236;
+		goto n235;
+	n235:
+		if (x[6] > -7.79088605994363720e-03) goto n324;
+		goto n323;
+	n323:
+		if (x[0] > 6.67061894200887406e-02) goto n390;
+		goto n389;
+	n389:
+		return(tree_3_leaves[189]);
+	n390:
+		return(tree_3_leaves[190]);
+	n324:
+		return(tree_3_leaves[191]);
+	n236:
+		return(tree_3_leaves[192]);
+	n94:
+		if (x[0] > 5.48184254146483821e-02) goto n158;
+		goto n157;
+	n157:
+		if (x[2] > 9.50274288527857246e-03) goto n238;
+		goto n237;
+	n237:
+		return(tree_3_leaves[193]);
+	n238:
+		return(tree_3_leaves[194]);
+	n158:
+		if (x[1] > -3.27665052605849993e-02) goto n240;
+		goto n239;
+	n239:
+		return(tree_3_leaves[195]);
+	n240:
+		if (x[6] > -2.03168646940283873e-02) goto n326;
+		goto n325;
+	n325:
+		return(tree_3_leaves[196]);
+	n326:
+		return(tree_3_leaves[197]);
+	n12:
+		if (x[3] > 5.71957969156485710e-02) goto n26;
+		goto n25;
+	n25:
+		if (x[4] > 5.03207575546259084e-02) goto n50;
+		goto n49;
+	n49:
+		if (x[0] > 4.76069289014073721e-02) goto n96;
+		goto n95;
+	n95:
+		if (x[3] > -2.10590762440906673e-02) goto n160;
+		goto n159;
+	n159:
+		if (x[2] > 3.88006416175389335e-02) goto n242;
+		goto n241;
+	n241:
+		if (x[9] > -5.95855982533326015e-02) goto n328;
+		goto n327;
+	n327:
+		return(tree_3_leaves[198]);
+	n328:
+		if (x[7] > -2.93399466996217897e-02) goto n392;
+		goto n391;
+	n391:
+		return(tree_3_leaves[199]);
+	n392:
+		if (x[0] > -3.86512765519674770e-02) goto n454;
+		goto n453;
+	n453:
+		return(tree_3_leaves[200]);
+	n454:
+		return(tree_3_leaves[201]);
+	n242:
+		return(tree_3_leaves[202]);
+	n160:
+		if (x[0] > 1.21099395884410859e-02) goto n244;
+		goto n243;
+	n243:
+		if (x[6] > -4.62729832437169392e-02) goto n330;
+		goto n329;
+	n329:
+		if (x[5] > 4.67383485390254934e-03) goto n394;
+		goto n393;
+	n393:
+		return(tree_3_leaves[203]);
+	n394:
+		return(tree_3_leaves[204]);
+	n330:
+		if (x[6] > 5.51195750981231455e-02) goto n396;
+		goto n395;
+	n395:
+		if (x[0] > -3.96851852035910290e-04) goto n456;
+		goto n455;
+	n455:
+		if (x[8] > 6.25655683688675912e-02) goto n490;
+		goto n489;
+	n489:
+		if (x[8] > 3.43397658358458105e-02) goto n516;
+		goto n515;
+	n515:
+		return(tree_3_leaves[205]);
+	n516:
+		if (x[3] > 1.57841638475149093e-02) goto n532;
+		goto n531;
+	n531:
+		return(tree_3_leaves[206]);
+	n532:
+		return(tree_3_leaves[207]);
+	n490:
+		return(tree_3_leaves[208]);
+	n456:
+		return(tree_3_leaves[209]);
+	n396:
+		return(tree_3_leaves[210]);
+	n244:
+		if (x[3] > 5.20842242764204197e-02) goto n332;
+		goto n331;
+	n331:
+		if (x[2] > 3.39069791899536226e-03) goto n398;
+		goto n397;
+	n397:
+		if (x[3] > -1.05328764946524007e-02) goto n458;
+		goto n457;
+	n457:
+		return(tree_3_leaves[211]);
+	n458:
+		return(tree_3_leaves[212]);
+	n398:
+		if (x[2] > 3.63012694904068164e-02) goto n460;
+		goto n459;
+	n459:
+		if (x[9] > 5.80888244046952884e-02) goto n492;
+		goto n491;
+	n491:
+		if (x[0] > 2.02565033759438441e-02) goto n518;
+		goto n517;
+	n517:
+		return(tree_3_leaves[213]);
+	n518:
+		if (x[4] > -3.16248480024078349e-03) goto n534;
+		goto n533;
+	n533:
+		return(tree_3_leaves[214]);
+	n534:
+		return(tree_3_leaves[215]);
+	n492:
+		return(tree_3_leaves[216]);
+	n460:
+		if (x[5] > -2.62931894273819335e-02) goto n494;
+		goto n493;
+	n493:
+		return(tree_3_leaves[217]);
+	n494:
+		if (x[9] > 1.38158693194834307e-02) goto n520;
+		goto n519;
+	n519:
+		return(tree_3_leaves[218]);
+	n520:
+		return(tree_3_leaves[219]);
+	n332:
+		if (x[0] > 2.31382163355551423e-02) goto n400;
+		goto n399;
+	n399:
+		return(tree_3_leaves[220]);
+	n400:
+		if (x[0] > 3.24386648255071963e-02) goto n462;
+		goto n461;
+	n461:
+		return(tree_3_leaves[221]);
+	n462:
+		return(tree_3_leaves[222]);
+	n96:
+		if (x[7] > 3.46318527299426665e-02) goto n162;
+		goto n161;
+	n161:
+		if (x[6] > -3.32811994823429408e-02) goto n246;
+		goto n245;
+	n245:
+		if (x[4] > -1.52839534092573809e-02) goto n334;
+		goto n333;
+	n333:
+		return(tree_3_leaves[223]);
+	n334:
+		if (x[9] > 3.07154940134873149e-02) goto n402;
+		goto n401;
+	n401:
+		return(tree_3_leaves[224]);
+	n402:
+		return(tree_3_leaves[225]);
+	n246:
+		return(tree_3_leaves[226]);
+	n162:
+		return(tree_3_leaves[227]);
+	n50:
+		if (x[6] > -4.63207572132900633e-02) goto n98;
+		goto n97;
+	n97:
+		if (x[0] > -3.79861491846491400e-03) goto n164;
+		goto n163;
+	n163:
+		return(tree_3_leaves[228]);
+	n164:
+		return(tree_3_leaves[229]);
+	n98:
+		if (x[8] > 7.21155325209187487e-02) goto n166;
+		goto n165;
+	n165:
+		if (x[9] > 1.25182300289531194e-02) goto n248;
+		goto n247;
+	n247:
+		if (x[5] > 9.29148613974825344e-02) goto n336;
+		goto n335;
+	n335:
+		if (x[1] > 6.84458627667462044e-03) goto n404;
+		goto n403;
+	n403:
+		return(tree_3_leaves[230]);
+	n404:
+		return(tree_3_leaves[231]);
+	n336:
+		return(tree_3_leaves[232]);
+	n248:
+		if (x[2] > 4.25728491016955438e-02) goto n338;
+		goto n337;
+	n337:
+		if (x[1] > 5.12476876486853139e-05) goto n406;
+		goto n405;
+	n405:
+		return(tree_3_leaves[233]);
+	n406:
+		if (x[0] > -3.64383224281000263e-03) goto n464;
+		goto n463;
+	n463:
+		return(tree_3_leaves[234]);
+	n464:
+		return(tree_3_leaves[235]);
+	n338:
+		return(tree_3_leaves[236]);
+	n166:
+		if (x[8] > 7.45163187820876566e-02) goto n250;
+		goto n249;
+	n249:
+		return(tree_3_leaves[237]);
+	n250:
+		return(tree_3_leaves[238]);
+	n26:
+		if (x[8] > 5.80184798358066578e-02) goto n52;
+		goto n51;
+	n51:
+		if (x[0] > 4.99778310196863709e-02) goto n100;
+		goto n99;
+	n99:
+		if (x[9] > 1.54399863827958880e-02) goto n168;
+		goto n167;
+	n167:
+		if (x[0] > 6.03184952750528396e-03) goto n252;
+		goto n251;
+	n251:
+		return(tree_3_leaves[239]);
+	n252:
+		return(tree_3_leaves[240]);
+	n168:
+		if (x[4] > 1.76132333670596317e-02) goto n254;
+		goto n253;
+	n253:
+		return(tree_3_leaves[241]);
+	n254:
+		return(tree_3_leaves[242]);
+	n100:
+		return(tree_3_leaves[243]);
+	n52:
+		if (x[4] > -1.29354283823877314e-02) goto n102;
+		goto n101;
+	n101:
+		return(tree_3_leaves[244]);
+	n102:
+		if (x[4] > 5.94250223279388159e-02) goto n170;
+		goto n169;
+	n169:
+		if (x[2] > 5.39290787417336659e-02) goto n256;
+		goto n255;
+	n255:
+		return(tree_3_leaves[245]);
+	n256:
+		return(tree_3_leaves[246]);
+	n170:
+		if (x[5] > 1.18994526705991505e-01) goto n258;
+		goto n257;
+	n257:
+		return(tree_3_leaves[247]);
+	n258:
+		return(tree_3_leaves[248]);
+	n6:
+		if (x[5] > 2.19164873499208268e-02) goto n14;
+		goto n13;
+	n13:
+		if (x[8] > -2.30632527971443499e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[2] > 7.38705665792721705e-02) goto n54;
+		goto n53;
+	n53:
+		return(tree_3_leaves[249]);
+	n54:
+		return(tree_3_leaves[250]);
+	n28:
+		if (x[6] > -1.41595711890483283e-02) goto n56;
+		goto n55;
+	n55:
+		if (x[8] > 3.10329308837364176e-02) goto n104;
+		goto n103;
+	n103:
+		if (x[3] > -2.47429395933177164e-02) goto n172;
+		goto n171;
+	n171:
+		return(tree_3_leaves[251]);
+	n172:
+		if (x[2] > 9.61243880666688977e-02) goto n260;
+		goto n259;
+	n259:
+		return(tree_3_leaves[252]);
+	n260:
+		return(tree_3_leaves[253]);
+	n104:
+		if (x[4] > 3.40408657461303572e-03) goto n174;
+		goto n173;
+	n173:
+		if (x[9] > 3.32184414544657095e-02) goto n262;
+		goto n261;
+	n261:
+		if (x[2] > 9.36331987897138229e-02) goto n340;
+		goto n339;
+	n339:
+		return(tree_3_leaves[254]);
+	n340:
+		return(tree_3_leaves[255]);
+	n262:
+		if (x[5] > -2.86492381342987323e-02) goto n342;
+		goto n341;
+	n341:
+		return(tree_3_leaves[256]);
+	n342:
+		if (x[5] > -1.81984476041866412e-02) goto n408;
+		goto n407;
+	n407:
+		return(tree_3_leaves[257]);
+	n408:
+		return(tree_3_leaves[258]);
+	n174:
+		if (x[3] > 8.14908110759057641e-02) goto n264;
+		goto n263;
+	n263:
+		return(tree_3_leaves[259]);
+	n264:
+		if (x[4] > 1.74531180926903104e-02) goto n344;
+		goto n343;
+	n343:
+		return(tree_3_leaves[260]);
+	n344:
+		return(tree_3_leaves[261]);
+	n56:
+		if (x[6] > 6.25571653254038650e-03) goto n106;
+		goto n105;
+	n105:
+		if (x[5] > -6.82209051758847409e-03) goto n176;
+		goto n175;
+	n175:
+		return(tree_3_leaves[262]);
+	n176:
+		return(tree_3_leaves[263]);
+	n106:
+		if (x[4] > 1.38305169944146766e-02) goto n178;
+		goto n177;
+	n177:
+		return(tree_3_leaves[264]);
+	n178:
+		return(tree_3_leaves[265]);
+	n14:
+		if (x[4] > 1.50025195384423278e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[3] > -2.50726709684116165e-02) goto n58;
+		goto n57;
+	n57:
+		return(tree_3_leaves[266]);
+	n58:
+		return(tree_3_leaves[267]);
+	n30:
+		if (x[6] > -5.08992475765996100e-02) goto n60;
+		goto n59;
+	n59:
+		return(tree_3_leaves[268]);
+	n60:
+		if (x[0] > -3.79980780471143031e-02) goto n108;
+		goto n107;
+	n107:
+		if (x[9] > 6.61421858653188782e-02) goto n180;
+		goto n179;
+	n179:
+		return(tree_3_leaves[269]);
+	n180:
+		return(tree_3_leaves[270]);
+	n108:
+		if (x[6] > -3.00428099993642755e-02) goto n182;
+		goto n181;
+	n181:
+		if (x[1] > -1.49751608089460052e-02) goto n266;
+		goto n265;
+	n265:
+		return(tree_3_leaves[271]);
+	n266:
+		return(tree_3_leaves[272]);
+	n182:
+		if (x[7] > 5.08267401945473041e-02) goto n268;
+		goto n267;
+	n267:
+		return(tree_3_leaves[273]);
+	n268:
+		return(tree_3_leaves[274]);
+}
+
+static const leaf_t tree_4_leaves[] = {
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.56000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.89000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.71000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.26000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.49000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.23000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.84000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.47000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.76000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.67000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_4_find_leaf(const num_t *x){
+		if (x[2] > 9.31946800639183587e-03) goto n2;
+		goto n1;
+	n1:
+		if (x[8] > -4.91180346091123991e-04) goto n4;
+		goto n3;
+	n3:
+		if (x[6] > 1.95276328259750415e-02) goto n8;
+		goto n7;
+	n7:
+		if (x[9] > -7.90459318337407568e-02) goto n16;
+		goto n15;
+	n15:
+		if (x[2] > -3.40930923997834895e-02) goto n32;
+		goto n31;
+	n31:
+		if (x[6] > 1.39775170386046976e-02) goto n64;
+		goto n63;
+	n63:
+		return(tree_4_leaves[0]);
+	n64:
+		return(tree_4_leaves[1]);
+	n32:
+		if (x[2] > -4.60461543475562587e-03) goto n66;
+		goto n65;
+	n65:
+		return(tree_4_leaves[2]);
+	n66:
+		return(tree_4_leaves[3]);
+	n16:
+		if (x[9] > -3.15324051662751181e-02) goto n34;
+		goto n33;
+	n33:
+		if (x[0] > -2.51087358400494086e-02) goto n68;
+		goto n67;
+	n67:
+		if (x[9] > -3.58589405974555075e-02) goto n118;
+		goto n117;
+	n117:
+		if (x[3] > -6.13356874079797262e-02) goto n186;
+		goto n185;
+	n185:
+		return(tree_4_leaves[4]);
+	n186:
+		if (x[8] > -6.28820271188835489e-02) goto n272;
+		goto n271;
+	n271:
+		return(tree_4_leaves[5]);
+	n272:
+		return(tree_4_leaves[6]);
+	n118:
+		if (x[7] > -1.16396122501511018e-02) goto n188;
+		goto n187;
+	n187:
+		return(tree_4_leaves[7]);
+	n188:
+		return(tree_4_leaves[8]);
+	n68:
+		if (x[3] > -5.24606340333307487e-03) goto n120;
+		goto n119;
+	n119:
+		if (x[7] > -4.38306554433029981e-03) goto n190;
+		goto n189;
+	n189:
+		if (x[5] > -2.63034780227976057e-02) goto n274;
+		goto n273;
+	n273:
+		if (x[1] > -3.82165245912685567e-02) goto n356;
+		goto n355;
+	n355:
+		return(tree_4_leaves[9]);
+	n356:
+		return(tree_4_leaves[10]);
+	n274:
+		if (x[5] > -1.30029448621527509e-03) goto n358;
+		goto n357;
+	n357:
+		return(tree_4_leaves[11]);
+	n358:
+		return(tree_4_leaves[12]);
+	n190:
+		if (x[0] > -9.51665409502580953e-03) goto n276;
+		goto n275;
+	n275:
+		return(tree_4_leaves[13]);
+	n276:
+		if (x[5] > 1.74417731523535784e-02) goto n360;
+		goto n359;
+	n359:
+		return(tree_4_leaves[14]);
+	n360:
+		return(tree_4_leaves[15]);
+	n120:
+		if (x[0] > -6.91946134438431101e-03) goto n192;
+		goto n191;
+	n191:
+		return(tree_4_leaves[16]);
+	n192:
+		return(tree_4_leaves[17]);
+	n34:
+		if (x[2] > -1.44628495864543433e-02) goto n70;
+		goto n69;
+	n69:
+		if (x[5] > -6.10386553452037031e-02) goto n122;
+		goto n121;
+	n121:
+		return(tree_4_leaves[18]);
+	n122:
+		if (x[8] > -1.73041541351926544e-02) goto n194;
+		goto n193;
+	n193:
+		if (x[9] > -2.67848187634159018e-02) goto n278;
+		goto n277;
+	n277:
+		return(tree_4_leaves[19]);
+	n278:
+		if (x[9] > 1.34163353589301249e-02) goto n362;
+		goto n361;
+	n361:
+		if (x[2] > -3.65465982149685495e-02) goto n420;
+		goto n419;
+	n419:
+		if (x[5] > -2.41941179536303771e-02) goto n466;
+		goto n465;
+	n465:
+		if (x[1] > -9.25701022663272949e-03) goto n508;
+		goto n507;
+	n507:
+		return(tree_4_leaves[20]);
+	n508:
+		return(tree_4_leaves[21]);
+	n466:
+		if (x[8] > -5.85609799503367182e-02) goto n510;
+		goto n509;
+	n509:
+		return(tree_4_leaves[22]);
+	n510:
+		if (x[9] > -2.54312103236321654e-02) goto n534;
+		goto n533;
+	n533:
+		return(tree_4_leaves[23]);
+	n534:
+		if (x[4] > -1.68780894010592403e-02) goto n540;
+		goto n539;
+	n539:
+		return(tree_4_leaves[24]);
+	n540:
+		return(tree_4_leaves[25]);
+	n420:
+		if (x[5] > -4.15544633342454506e-02) goto n468;
+		goto n467;
+	n467:
+		return(tree_4_leaves[26]);
+	n468:
+		if (x[7] > -1.53656027963145238e-02) goto n512;
+		goto n511;
+	n511:
+		return(tree_4_leaves[27]);
+	n512:
+		return(tree_4_leaves[28]);
+	n362:
+		if (x[4] > 5.08092533060457933e-03) goto n422;
+		goto n421;
+	n421:
+		if (x[1] > 3.41036947422077921e-02) goto n470;
+		goto n469;
+	n469:
+		return(tree_4_leaves[29]);
+	n470:
+		return(tree_4_leaves[30]);
+	n422:
+		if (x[8] > -3.59716431630346667e-02) goto n472;
+		goto n471;
+	n471:
+		return(tree_4_leaves[31]);
+	n472:
+		return(tree_4_leaves[32]);
+	n194:
+		if (x[2] > -2.24136440900619301e-02) goto n280;
+		goto n279;
+	n279:
+		if (x[0] > -1.93093900601123344e-02) goto n364;
+		goto n363;
+	n363:
+		return(tree_4_leaves[33]);
+	n364:
+		if (x[9] > -1.01224847670613669e-03) goto n424;
+		goto n423;
+	n423:
+		if (x[0] > -3.90243832115578712e-03) goto n474;
+		goto n473;
+	n473:
+		return(tree_4_leaves[34]);
+	n474:
+		return(tree_4_leaves[35]);
+	n424:
+		if (x[2] > -3.26680846122829327e-02) goto n476;
+		goto n475;
+	n475:
+		return(tree_4_leaves[36]);
+	n476:
+		return(tree_4_leaves[37]);
+	n280:
+		if (x[5] > 4.50649006637835053e-02) goto n366;
+		goto n365;
+	n365:
+		if (x[3] > 6.15805395385433108e-02) goto n426;
+		goto n425;
+	n425:
+		return(tree_4_leaves[38]);
+	n426:
+		return(tree_4_leaves[39]);
+	n366:
+		return(tree_4_leaves[40]);
+	n70:
+		if (x[8] > -2.88190144997882286e-02) goto n124;
+		goto n123;
+	n123:
+		if (x[9] > -9.34551546331769366e-03) goto n196;
+		goto n195;
+	n195:
+		if (x[3] > 1.30155020885863223e-02) goto n282;
+		goto n281;
+	n281:
+		return(tree_4_leaves[41]);
+	n282:
+		return(tree_4_leaves[42]);
+	n196:
+		if (x[2] > -8.81596021509265665e-03) goto n284;
+		goto n283;
+	n283:
+		return(tree_4_leaves[43]);
+	n284:
+		return(tree_4_leaves[44]);
+	n124:
+		if (x[3] > -3.54095694457293858e-02) goto n198;
+		goto n197;
+	n197:
+		return(tree_4_leaves[45]);
+	n198:
+		if (x[2] > 5.97127190762545765e-03) goto n286;
+		goto n285;
+	n285:
+		return(tree_4_leaves[46]);
+	n286:
+		return(tree_4_leaves[47]);
+	n8:
+		if (x[1] > -4.18474955823666603e-02) goto n18;
+		goto n17;
+	n17:
+		if (x[4] > 2.38973012006335993e-03) goto n36;
+		goto n35;
+	n35:
+		if (x[2] > -3.68130281498676437e-02) goto n72;
+		goto n71;
+	n71:
+		if (x[0] > -4.49179279116835029e-02) goto n126;
+		goto n125;
+	n125:
+		if (x[5] > -7.26916808517069496e-02) goto n200;
+		goto n199;
+	n199:
+		if (x[8] > -3.74086246390423066e-02) goto n288;
+		goto n287;
+	n287:
+		if (x[4] > -8.24980393835543363e-02) goto n368;
+		goto n367;
+	n367:
+		return(tree_4_leaves[48]);
+	n368:
+		return(tree_4_leaves[49]);
+	n288:
+		return(tree_4_leaves[50]);
+	n200:
+		if (x[8] > -4.73000057756432640e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_4_leaves[51]);
+	n290:
+		if (x[3] > -2.18141719668942108e-02) goto n370;
+		goto n369;
+	n369:
+		return(tree_4_leaves[52]);
+	n370:
+		return(tree_4_leaves[53]);
+	n126:
+		if (x[8] > -1.44733014781395931e-02) goto n202;
+		goto n201;
+	n201:
+		if (x[0] > 2.39940281664989801e-03) goto n292;
+		goto n291;
+	n291:
+		if (x[8] > -7.57726420971032016e-02) goto n372;
+		goto n371;
+	n371:
+		return(tree_4_leaves[54]);
+	n372:
+		if (x[2] > -3.92050731816445466e-02) goto n428;
+		goto n427;
+	n427:
+		if (x[5] > -2.80606023686142403e-02) goto n478;
+		goto n477;
+	n477:
+		if (x[2] > -6.51613685140337295e-02) goto n514;
+		goto n513;
+	n513:
+		return(tree_4_leaves[55]);
+	n514:
+		if (x[2] > -4.04854941907615701e-02) goto n536;
+		goto n535;
+	n535:
+		return(tree_4_leaves[56]);
+	n536:
+		return(tree_4_leaves[57]);
+	n478:
+		return(tree_4_leaves[58]);
+	n428:
+		return(tree_4_leaves[59]);
+	n292:
+		if (x[8] > -5.68445491997647198e-02) goto n374;
+		goto n373;
+	n373:
+		return(tree_4_leaves[60]);
+	n374:
+		if (x[2] > -4.35781546094470007e-02) goto n430;
+		goto n429;
+	n429:
+		if (x[0] > 1.70285523145967954e-02) goto n480;
+		goto n479;
+	n479:
+		if (x[0] > 1.31042533208594898e-02) goto n516;
+		goto n515;
+	n515:
+		return(tree_4_leaves[61]);
+	n516:
+		return(tree_4_leaves[62]);
+	n480:
+		if (x[0] > 5.73805434473008066e-02) goto n518;
+		goto n517;
+	n517:
+		return(tree_4_leaves[63]);
+	n518:
+		return(tree_4_leaves[64]);
+	n430:
+		return(tree_4_leaves[65]);
+	n202:
+		return(tree_4_leaves[66]);
+	n72:
+		if (x[0] > 1.36322893953725044e-02) goto n128;
+		goto n127;
+	n127:
+		if (x[3] > -2.33400844911470715e-02) goto n204;
+		goto n203;
+	n203:
+		if (x[8] > -1.57110956858267994e-02) goto n294;
+		goto n293;
+	n293:
+		if (x[3] > -3.26784217425433177e-02) goto n376;
+		goto n375;
+	n375:
+		return(tree_4_leaves[67]);
+	n376:
+		return(tree_4_leaves[68]);
+	n294:
+		return(tree_4_leaves[69]);
+	n204:
+		if (x[5] > 4.60639089409091602e-03) goto n296;
+		goto n295;
+	n295:
+		if (x[0] > -6.62687407268501838e-02) goto n378;
+		goto n377;
+	n377:
+		return(tree_4_leaves[70]);
+	n378:
+		return(tree_4_leaves[71]);
+	n296:
+		return(tree_4_leaves[72]);
+	n128:
+		if (x[9] > -3.00661740439352315e-02) goto n206;
+		goto n205;
+	n205:
+		return(tree_4_leaves[73]);
+	n206:
+		return(tree_4_leaves[74]);
+	n36:
+		if (x[3] > 3.93888470689095910e-02) goto n74;
+		goto n73;
+	n73:
+		if (x[5] > -6.93346266577228067e-03) goto n130;
+		goto n129;
+	n129:
+		if (x[5] > -2.01808178023121232e-02) goto n208;
+		goto n207;
+	n207:
+		return(tree_4_leaves[75]);
+	n208:
+		return(tree_4_leaves[76]);
+	n130:
+		if (x[9] > -6.99406430769865944e-02) goto n210;
+		goto n209;
+	n209:
+		return(tree_4_leaves[77]);
+	n210:
+		if (x[9] > -1.32462748597826866e-02) goto n298;
+		goto n297;
+	n297:
+		if (x[8] > -4.74866093362485836e-02) goto n380;
+		goto n379;
+	n379:
+		return(tree_4_leaves[78]);
+	n380:
+		if (x[0] > 3.45528291442735724e-02) goto n432;
+		goto n431;
+	n431:
+		if (x[5] > 9.25829879359755213e-03) goto n482;
+		goto n481;
+	n481:
+		return(tree_4_leaves[79]);
+	n482:
+		return(tree_4_leaves[80]);
+	n432:
+		return(tree_4_leaves[81]);
+	n298:
+		if (x[5] > 2.64283070574041004e-02) goto n382;
+		goto n381;
+	n381:
+		return(tree_4_leaves[82]);
+	n382:
+		if (x[9] > 7.41662243479284181e-03) goto n434;
+		goto n433;
+	n433:
+		return(tree_4_leaves[83]);
+	n434:
+		if (x[4] > 3.56549424246889110e-02) goto n484;
+		goto n483;
+	n483:
+		return(tree_4_leaves[84]);
+	n484:
+		return(tree_4_leaves[85]);
+	n74:
+		return(tree_4_leaves[86]);
+	n18:
+		if (x[4] > -4.11861918374537873e-03) goto n38;
+		goto n37;
+	n37:
+		if (x[0] > -3.33397246700570596e-02) goto n76;
+		goto n75;
+	n75:
+		if (x[8] > -5.63852132988375485e-02) goto n132;
+		goto n131;
+	n131:
+		return(tree_4_leaves[87]);
+	n132:
+		if (x[3] > -2.18336656500091042e-02) goto n212;
+		goto n211;
+	n211:
+		return(tree_4_leaves[88]);
+	n212:
+		return(tree_4_leaves[89]);
+	n76:
+		if (x[9] > -2.35226644901398753e-02) goto n134;
+		goto n133;
+	n133:
+		if (x[5] > -1.45305098716228282e-02) goto n214;
+		goto n213;
+	n213:
+		return(tree_4_leaves[90]);
+	n214:
+		return(tree_4_leaves[91]);
+	n134:
+		return(tree_4_leaves[92]);
+	n38:
+		if (x[5] > 4.22759659343269548e-03) goto n78;
+		goto n77;
+	n77:
+		if (x[0] > 6.63463138776280714e-02) goto n136;
+		goto n135;
+	n135:
+		return(tree_4_leaves[93]);
+	n136:
+		return(tree_4_leaves[94]);
+	n78:
+		if (x[9] > -1.18728897078615551e-02) goto n138;
+		goto n137;
+	n137:
+		if (x[9] > -1.93403007719384623e-02) goto n216;
+		goto n215;
+	n215:
+		if (x[8] > -1.72017820964525739e-02) goto n300;
+		goto n299;
+	n299:
+		return(tree_4_leaves[95]);
+	n300:
+		return(tree_4_leaves[96]);
+	n216:
+		return(tree_4_leaves[97]);
+	n138:
+		if (x[4] > 2.82133447788787683e-02) goto n218;
+		goto n217;
+	n217:
+		return(tree_4_leaves[98]);
+	n218:
+		return(tree_4_leaves[99]);
+	n4:
+		if (x[7] > 3.05753797646217476e-02) goto n10;
+		goto n9;
+	n9:
+		if (x[3] > 4.03439668172124594e-02) goto n20;
+		goto n19;
+	n19:
+		if (x[8] > 2.57586020155261761e-02) goto n40;
+		goto n39;
+	n39:
+		if (x[4] > -6.53971679122416077e-02) goto n80;
+		goto n79;
+	n79:
+		if (x[3] > 2.28549659813531147e-02) goto n140;
+		goto n139;
+	n139:
+		return(tree_4_leaves[100]);
+	n140:
+		return(tree_4_leaves[101]);
+	n80:
+		if (x[6] > 8.29849821507592095e-02) goto n142;
+		goto n141;
+	n141:
+		if (x[2] > -1.67998861687226678e-02) goto n220;
+		goto n219;
+	n219:
+		if (x[8] > 4.86002817416126241e-03) goto n302;
+		goto n301;
+	n301:
+		if (x[5] > -1.07427902772564074e-02) goto n384;
+		goto n383;
+	n383:
+		if (x[1] > 1.73228403774409873e-02) goto n436;
+		goto n435;
+	n435:
+		return(tree_4_leaves[102]);
+	n436:
+		return(tree_4_leaves[103]);
+	n384:
+		return(tree_4_leaves[104]);
+	n302:
+		if (x[4] > -1.06378737227166998e-02) goto n386;
+		goto n385;
+	n385:
+		if (x[9] > 1.89941497799203281e-02) goto n438;
+		goto n437;
+	n437:
+		return(tree_4_leaves[105]);
+	n438:
+		return(tree_4_leaves[106]);
+	n386:
+		if (x[8] > 1.38869995906099313e-02) goto n440;
+		goto n439;
+	n439:
+		return(tree_4_leaves[107]);
+	n440:
+		if (x[7] > -1.29247002884676464e-02) goto n486;
+		goto n485;
+	n485:
+		return(tree_4_leaves[108]);
+	n486:
+		if (x[6] > 2.01414003042386519e-02) goto n520;
+		goto n519;
+	n519:
+		return(tree_4_leaves[109]);
+	n520:
+		return(tree_4_leaves[110]);
+	n220:
+		if (x[5] > 6.29411044385600610e-03) goto n304;
+		goto n303;
+	n303:
+		return(tree_4_leaves[111]);
+	n304:
+		return(tree_4_leaves[112]);
+	n142:
+		return(tree_4_leaves[113]);
+	n40:
+		if (x[6] > 3.36369126012388969e-02) goto n82;
+		goto n81;
+	n81:
+		if (x[9] > -4.28539161903338378e-02) goto n144;
+		goto n143;
+	n143:
+		return(tree_4_leaves[114]);
+	n144:
+		if (x[8] > 3.75142036389095601e-02) goto n222;
+		goto n221;
+	n221:
+		if (x[7] > -3.52253008488143463e-03) goto n306;
+		goto n305;
+	n305:
+		return(tree_4_leaves[115]);
+	n306:
+		return(tree_4_leaves[116]);
+	n222:
+		if (x[9] > 4.35938149490321808e-03) goto n308;
+		goto n307;
+	n307:
+		return(tree_4_leaves[117]);
+	n308:
+		return(tree_4_leaves[118]);
+	n82:
+		if (x[8] > 4.30031557731171479e-02) goto n146;
+		goto n145;
+	n145:
+		if (x[0] > 2.38567088226016820e-02) goto n224;
+		goto n223;
+	n223:
+		return(tree_4_leaves[119]);
+	n224:
+		return(tree_4_leaves[120]);
+	n146:
+		if (x[2] > -1.60657116537621207e-02) goto n226;
+		goto n225;
+	n225:
+		return(tree_4_leaves[121]);
+	n226:
+		return(tree_4_leaves[122]);
+	n20:
+		if (x[9] > 1.59056607717079149e-02) goto n42;
+		goto n41;
+	n41:
+		if (x[8] > 2.49776342014443528e-02) goto n84;
+		goto n83;
+	n83:
+		return(tree_4_leaves[123]);
+	n84:
+		return(tree_4_leaves[124]);
+	n42:
+		if (x[6] > -1.89529981347831070e-02) goto n86;
+		goto n85;
+	n85:
+		return(tree_4_leaves[125]);
+	n86:
+		if (x[4] > 3.28881692183943877e-02) goto n148;
+		goto n147;
+	n147:
+		if (x[1] > -5.74069652760248600e-03) goto n228;
+		goto n227;
+	n227:
+		if (x[5] > -1.44804952262235359e-02) goto n310;
+		goto n309;
+	n309:
+		return(tree_4_leaves[126]);
+	n310:
+		return(tree_4_leaves[127]);
+	n228:
+		return(tree_4_leaves[128]);
+	n148:
+		return(tree_4_leaves[129]);
+	n10:
+		if (x[9] > 5.97486540955334197e-02) goto n22;
+		goto n21;
+	n21:
+		if (x[9] > -1.22831171607652896e-03) goto n44;
+		goto n43;
+	n43:
+		if (x[9] > -4.42266858167713467e-02) goto n88;
+		goto n87;
+	n87:
+		if (x[0] > -3.21236802432231430e-03) goto n150;
+		goto n149;
+	n149:
+		return(tree_4_leaves[130]);
+	n150:
+		if (x[5] > 4.07365669692144119e-02) goto n230;
+		goto n229;
+	n229:
+		return(tree_4_leaves[131]);
+	n230:
+		return(tree_4_leaves[132]);
+	n88:
+		if (x[7] > 4.22917828483714148e-02) goto n152;
+		goto n151;
+	n151:
+		if (x[4] > -1.60228643097146024e-02) goto n232;
+		goto n231;
+	n231:
+		return(tree_4_leaves[133]);
+	n232:
+		if (x[2] > 1.84232566005287099e-03) goto n312;
+		goto n311;
+	n311:
+		if (x[9] > -1.63056423116100073e-02) goto n388;
+		goto n387;
+	n387:
+		if (x[2] > -2.46482916404968284e-02) goto n442;
+		goto n441;
+	n441:
+		return(tree_4_leaves[134]);
+	n442:
+		if (x[8] > 6.47217349484099647e-02) goto n488;
+		goto n487;
+	n487:
+		if (x[2] > -1.23014395418414649e-02) goto n522;
+		goto n521;
+	n521:
+		return(tree_4_leaves[135]);
+	n522:
+		return(tree_4_leaves[136]);
+	n488:
+		if (x[6] > 5.04445176101720946e-03) goto n524;
+		goto n523;
+	n523:
+		return(tree_4_leaves[137]);
+	n524:
+		return(tree_4_leaves[138]);
+	n388:
+		if (x[0] > -6.32526651700935361e-02) goto n444;
+		goto n443;
+	n443:
+		return(tree_4_leaves[139]);
+	n444:
+		if (x[4] > 3.59289645429744300e-02) goto n490;
+		goto n489;
+	n489:
+		return(tree_4_leaves[140]);
+	n490:
+		return(tree_4_leaves[141]);
+	n312:
+		return(tree_4_leaves[142]);
+	n152:
+		if (x[2] > -5.52202224975503492e-03) goto n234;
+		goto n233;
+	n233:
+		if (x[0] > 9.58425735296416365e-03) goto n314;
+		goto n313;
+	n313:
+		if (x[4] > 6.14096364389150745e-02) goto n390;
+		goto n389;
+	n389:
+		return(tree_4_leaves[143]);
+	n390:
+		return(tree_4_leaves[144]);
+	n314:
+		return(tree_4_leaves[145]);
+	n234:
+		if (x[4] > -1.59019253664477965e-02) goto n316;
+		goto n315;
+	n315:
+		return(tree_4_leaves[146]);
+	n316:
+		return(tree_4_leaves[147]);
+	n44:
+		if (x[7] > 1.02067972044699445e-01) goto n90;
+		goto n89;
+	n89:
+		if (x[6] > -5.51028818564177000e-02) goto n154;
+		goto n153;
+	n153:
+		if (x[4] > -1.86569423097018780e-02) goto n236;
+		goto n235;
+	n235:
+		if (x[4] > -4.21396094839983082e-02) goto n318;
+		goto n317;
+	n317:
+		return(tree_4_leaves[148]);
+	n318:
+		return(tree_4_leaves[149]);
+	n236:
+		if (x[2] > -1.84300217965184324e-02) goto n320;
+		goto n319;
+	n319:
+		return(tree_4_leaves[150]);
+	n320:
+		return(tree_4_leaves[151]);
+	n154:
+		if (x[0] > -5.45985110355390393e-02) goto n238;
+		goto n237;
+	n237:
+		return(tree_4_leaves[152]);
+	n238:
+		if (x[3] > -3.46620341542689114e-02) goto n322;
+		goto n321;
+	n321:
+		if (x[2] > -3.19739684569619945e-02) goto n392;
+		goto n391;
+	n391:
+		if (x[8] > 1.34890427654056604e-02) goto n446;
+		goto n445;
+	n445:
+		return(tree_4_leaves[153]);
+	n446:
+		return(tree_4_leaves[154]);
+	n392:
+		if (x[8] > 2.94234157340101908e-02) goto n448;
+		goto n447;
+	n447:
+		return(tree_4_leaves[155]);
+	n448:
+		return(tree_4_leaves[156]);
+	n322:
+		if (x[2] > -2.37566148615055150e-02) goto n394;
+		goto n393;
+	n393:
+		return(tree_4_leaves[157]);
+	n394:
+		if (x[9] > 6.27830211389513847e-03) goto n450;
+		goto n449;
+	n449:
+		return(tree_4_leaves[158]);
+	n450:
+		if (x[3] > 2.46272160800988134e-03) goto n492;
+		goto n491;
+	n491:
+		return(tree_4_leaves[159]);
+	n492:
+		return(tree_4_leaves[160]);
+	n90:
+		return(tree_4_leaves[161]);
+	n22:
+		if (x[7] > 5.97707926895962097e-02) goto n46;
+		goto n45;
+	n45:
+		if (x[2] > 3.00561530371139295e-03) goto n92;
+		goto n91;
+	n91:
+		if (x[9] > 7.51184699113741777e-02) goto n156;
+		goto n155;
+	n155:
+		return(tree_4_leaves[162]);
+	n156:
+		if (x[8] > 4.07679917335406414e-02) goto n240;
+		goto n239;
+	n239:
+		return(tree_4_leaves[163]);
+	n240:
+		return(tree_4_leaves[164]);
+	n92:
+		return(tree_4_leaves[165]);
+	n46:
+		if (x[9] > 1.25944039653880291e-01) goto n94;
+		goto n93;
+	n93:
+		return(tree_4_leaves[166]);
+	n94:
+		return(tree_4_leaves[167]);
+	n2:
+		if (x[8] > -1.13065944162041056e-02) goto n6;
+		goto n5;
+	n5:
+		if (x[6] > -1.83657897654431889e-03) goto n12;
+		goto n11;
+	n11:
+		if (x[0] > -2.47846305956584342e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[9] > -1.26597983888261274e-02) goto n48;
+		goto n47;
+	n47:
+		if (x[2] > 4.62719141803245720e-02) goto n96;
+		goto n95;
+	n95:
+		if (x[6] > -7.58042821459030403e-03) goto n158;
+		goto n157;
+	n157:
+		if (x[3] > -4.70758809340641460e-02) goto n242;
+		goto n241;
+	n241:
+		return(tree_4_leaves[168]);
+	n242:
+		return(tree_4_leaves[169]);
+	n158:
+		return(tree_4_leaves[170]);
+	n96:
+		return(tree_4_leaves[171]);
+	n48:
+		if (x[8] > -2.40220328871125731e-02) goto n98;
+		goto n97;
+	n97:
+		return(tree_4_leaves[172]);
+	n98:
+		return(tree_4_leaves[173]);
+	n24:
+		if (x[3] > 5.79006220612085301e-02) goto n50;
+		goto n49;
+	n49:
+		if (x[3] > 5.21040173314035876e-02) goto n100;
+		goto n99;
+	n99:
+		if (x[0] > 3.79044147837040504e-02) goto n160;
+		goto n159;
+	n159:
+		if (x[2] > 7.06413014434217473e-02) goto n244;
+		goto n243;
+	n243:
+		if (x[6] > -3.73859089365694980e-02) goto n324;
+		goto n323;
+	n323:
+		if (x[9] > -8.88895673110366713e-03) goto n396;
+		goto n395;
+	n395:
+		return(tree_4_leaves[174]);
+	n396:
+		return(tree_4_leaves[175]);
+	n324:
+		return(tree_4_leaves[176]);
+	n244:
+		return(tree_4_leaves[177]);
+	n160:
+		if (x[5] > 3.72300039270514593e-03) goto n246;
+		goto n245;
+	n245:
+		return(tree_4_leaves[178]);
+	n246:
+		return(tree_4_leaves[179]);
+	n100:
+		if (x[0] > 5.17333144635048134e-02) goto n162;
+		goto n161;
+	n161:
+		return(tree_4_leaves[180]);
+	n162:
+		return(tree_4_leaves[181]);
+	n50:
+		return(tree_4_leaves[182]);
+	n12:
+		if (x[0] > 4.50273043225525062e-03) goto n26;
+		goto n25;
+	n25:
+		if (x[6] > 2.24230972039301014e-02) goto n52;
+		goto n51;
+	n51:
+		if (x[2] > 6.91623408472872570e-02) goto n102;
+		goto n101;
+	n101:
+		if (x[8] > -2.68318658000392604e-02) goto n164;
+		goto n163;
+	n163:
+		return(tree_4_leaves[183]);
+	n164:
+		return(tree_4_leaves[184]);
+	n102:
+		return(tree_4_leaves[185]);
+	n52:
+		if (x[6] > 4.35750796926244327e-02) goto n104;
+		goto n103;
+	n103:
+		if (x[5] > -3.32850013156325217e-02) goto n166;
+		goto n165;
+	n165:
+		return(tree_4_leaves[186]);
+	n166:
+		return(tree_4_leaves[187]);
+	n104:
+		return(tree_4_leaves[188]);
+	n26:
+		if (x[2] > 3.41131545772220129e-02) goto n54;
+		goto n53;
+	n53:
+		return(tree_4_leaves[189]);
+	n54:
+		return(tree_4_leaves[190]);
+	n6:
+		if (x[2] > 9.30755266895622324e-02) goto n14;
+		goto n13;
+	n13:
+		if (x[9] > 4.10258838481780200e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[3] > 1.77024210580319563e-03) goto n56;
+		goto n55;
+	n55:
+		if (x[2] > 2.90416467851176592e-02) goto n106;
+		goto n105;
+	n105:
+		if (x[1] > -8.65901099526839718e-03) goto n168;
+		goto n167;
+	n167:
+		if (x[4] > 4.52011894647431703e-02) goto n248;
+		goto n247;
+	n247:
+		if (x[8] > 4.42754627342911780e-02) goto n326;
+		goto n325;
+	n325:
+		if (x[4] > -1.72950782454486113e-02) goto n398;
+		goto n397;
+	n397:
+		if (x[9] > 6.29154915847614411e-03) goto n452;
+		goto n451;
+	n451:
+		return(tree_4_leaves[191]);
+	n452:
+		return(tree_4_leaves[192]);
+	n398:
+		return(tree_4_leaves[193]);
+	n326:
+		if (x[8] > 7.00930642966869910e-02) goto n400;
+		goto n399;
+	n399:
+		return(tree_4_leaves[194]);
+	n400:
+		return(tree_4_leaves[195]);
+	n248:
+		return(tree_4_leaves[196]);
+	n168:
+		if (x[4] > 6.99714156450435311e-03) goto n250;
+		goto n249;
+	n249:
+		if (x[0] > -4.06107585261181875e-02) goto n328;
+		goto n327;
+	n327:
+		return(tree_4_leaves[197]);
+	n328:
+		return(tree_4_leaves[198]);
+	n250:
+		if (x[0] > 3.39032172498928697e-02) goto n330;
+		goto n329;
+	n329:
+		return(tree_4_leaves[199]);
+	n330:
+		return(tree_4_leaves[200]);
+	n106:
+		if (x[7] > 9.50290846405557783e-03) goto n170;
+		goto n169;
+	n169:
+		if (x[9] > 3.19785903822366047e-02) goto n252;
+		goto n251;
+	n251:
+		if (x[3] > -3.81240329480503348e-02) goto n332;
+		goto n331;
+	n331:
+		return(tree_4_leaves[201]);
+	n332:
+		return(tree_4_leaves[202]);
+	n252:
+		return(tree_4_leaves[203]);
+	n170:
+		if (x[0] > -4.93901296383571081e-02) goto n254;
+		goto n253;
+	n253:
+		if (x[9] > -9.40828407785803192e-03) goto n334;
+		goto n333;
+	n333:
+		return(tree_4_leaves[204]);
+	n334:
+		return(tree_4_leaves[205]);
+	n254:
+		if (x[4] > 6.64300114110391582e-02) goto n336;
+		goto n335;
+	n335:
+		if (x[8] > 3.78298501618245589e-02) goto n402;
+		goto n401;
+	n401:
+		if (x[8] > 1.71565167285728272e-02) goto n454;
+		goto n453;
+	n453:
+		if (x[5] > 2.08307827895300793e-02) goto n494;
+		goto n493;
+	n493:
+		return(tree_4_leaves[206]);
+	n494:
+		if (x[5] > 4.33746345497698985e-02) goto n526;
+		goto n525;
+	n525:
+		return(tree_4_leaves[207]);
+	n526:
+		return(tree_4_leaves[208]);
+	n454:
+		return(tree_4_leaves[209]);
+	n402:
+		return(tree_4_leaves[210]);
+	n336:
+		return(tree_4_leaves[211]);
+	n56:
+		if (x[2] > 1.84863846404471725e-02) goto n108;
+		goto n107;
+	n107:
+		if (x[8] > 8.09049351934511794e-03) goto n172;
+		goto n171;
+	n171:
+		return(tree_4_leaves[212]);
+	n172:
+		if (x[6] > -4.10359466075867624e-02) goto n256;
+		goto n255;
+	n255:
+		return(tree_4_leaves[213]);
+	n256:
+		if (x[0] > 1.34371140030414768e-02) goto n338;
+		goto n337;
+	n337:
+		return(tree_4_leaves[214]);
+	n338:
+		return(tree_4_leaves[215]);
+	n108:
+		if (x[2] > 1.93532182643223090e-02) goto n174;
+		goto n173;
+	n173:
+		if (x[0] > 4.16545029160736921e-02) goto n258;
+		goto n257;
+	n257:
+		if (x[5] > -4.74225651300327761e-02) goto n340;
+		goto n339;
+	n339:
+		return(tree_4_leaves[216]);
+	n340:
+		return(tree_4_leaves[217]);
+	n258:
+		return(tree_4_leaves[218]);
+	n174:
+		if (x[2] > 5.34488025034587644e-02) goto n260;
+		goto n259;
+	n259:
+		if (x[4] > 8.04396701908371980e-02) goto n342;
+		goto n341;
+	n341:
+		if (x[3] > 5.68010214223134829e-02) goto n404;
+		goto n403;
+	n403:
+		if (x[2] > 2.80948521468366574e-02) goto n456;
+		goto n455;
+	n455:
+		if (x[0] > 3.14995944697522082e-02) goto n496;
+		goto n495;
+	n495:
+		if (x[2] > 2.16472167406180881e-02) goto n528;
+		goto n527;
+	n527:
+		return(tree_4_leaves[219]);
+	n528:
+		return(tree_4_leaves[220]);
+	n496:
+		return(tree_4_leaves[221]);
+	n456:
+		if (x[2] > 5.13655229991963405e-02) goto n498;
+		goto n497;
+	n497:
+		if (x[9] > 3.73144652339947661e-02) goto n530;
+		goto n529;
+	n529:
+		if (x[0] > 3.07655692771908150e-03) goto n538;
+		goto n537;
+	n537:
+		if (x[7] > 1.90670016158584338e-02) goto n542;
+		goto n541;
+	n541:
+		return(tree_4_leaves[222]);
+	n542:
+		return(tree_4_leaves[223]);
+	n538:
+		if (x[2] > 3.29270946727733202e-02) goto n544;
+		goto n543;
+	n543:
+		return(tree_4_leaves[224]);
+	n544:
+		if (x[8] > 3.57134197140251339e-02) goto n546;
+		goto n545;
+	n545:
+		return(tree_4_leaves[225]);
+	n546:
+		return(tree_4_leaves[226]);
+	n530:
+		return(tree_4_leaves[227]);
+	n498:
+		return(tree_4_leaves[228]);
+	n404:
+		if (x[0] > 2.48822369420673463e-02) goto n458;
+		goto n457;
+	n457:
+		if (x[7] > -8.57024289902063793e-03) goto n500;
+		goto n499;
+	n499:
+		return(tree_4_leaves[229]);
+	n500:
+		return(tree_4_leaves[230]);
+	n458:
+		return(tree_4_leaves[231]);
+	n342:
+		if (x[9] > 1.92180026162837997e-03) goto n406;
+		goto n405;
+	n405:
+		return(tree_4_leaves[232]);
+	n406:
+		return(tree_4_leaves[233]);
+	n260:
+		if (x[5] > -3.52679303481347253e-02) goto n344;
+		goto n343;
+	n343:
+		if (x[4] > -1.73000310668042639e-02) goto n408;
+		goto n407;
+	n407:
+		return(tree_4_leaves[234]);
+	n408:
+		return(tree_4_leaves[235]);
+	n344:
+		if (x[2] > 7.45752901446846139e-02) goto n410;
+		goto n409;
+	n409:
+		if (x[2] > 6.91110860522214793e-02) goto n460;
+		goto n459;
+	n459:
+		return(tree_4_leaves[236]);
+	n460:
+		return(tree_4_leaves[237]);
+	n410:
+		return(tree_4_leaves[238]);
+	n28:
+		if (x[8] > 7.86749939549739223e-04) goto n58;
+		goto n57;
+	n57:
+		return(tree_4_leaves[239]);
+	n58:
+		if (x[7] > 3.86478395975847488e-02) goto n110;
+		goto n109;
+	n109:
+		if (x[5] > 1.32675216829921741e-02) goto n176;
+		goto n175;
+	n175:
+		if (x[8] > 6.25161500209304999e-02) goto n262;
+		goto n261;
+	n261:
+		if (x[8] > 4.13607492994906012e-02) goto n346;
+		goto n345;
+	n345:
+		return(tree_4_leaves[240]);
+	n346:
+		if (x[0] > -6.83240545785691704e-04) goto n412;
+		goto n411;
+	n411:
+		return(tree_4_leaves[241]);
+	n412:
+		return(tree_4_leaves[242]);
+	n262:
+		return(tree_4_leaves[243]);
+	n176:
+		if (x[4] > 6.93477411543639427e-03) goto n264;
+		goto n263;
+	n263:
+		return(tree_4_leaves[244]);
+	n264:
+		if (x[8] > 4.80346621718299917e-03) goto n348;
+		goto n347;
+	n347:
+		return(tree_4_leaves[245]);
+	n348:
+		if (x[2] > 7.37425578944055915e-02) goto n414;
+		goto n413;
+	n413:
+		if (x[3] > 1.60536449435278450e-02) goto n462;
+		goto n461;
+	n461:
+		return(tree_4_leaves[246]);
+	n462:
+		if (x[0] > 3.66877809024638568e-02) goto n502;
+		goto n501;
+	n501:
+		return(tree_4_leaves[247]);
+	n502:
+		return(tree_4_leaves[248]);
+	n414:
+		return(tree_4_leaves[249]);
+	n110:
+		if (x[9] > 5.09856721194799634e-02) goto n178;
+		goto n177;
+	n177:
+		if (x[2] > 3.81037619926017299e-02) goto n266;
+		goto n265;
+	n265:
+		return(tree_4_leaves[250]);
+	n266:
+		if (x[5] > 6.15064871154357637e-02) goto n350;
+		goto n349;
+	n349:
+		return(tree_4_leaves[251]);
+	n350:
+		return(tree_4_leaves[252]);
+	n178:
+		if (x[3] > -2.03866911547141809e-02) goto n268;
+		goto n267;
+	n267:
+		if (x[0] > -2.64277938770336937e-02) goto n352;
+		goto n351;
+	n351:
+		return(tree_4_leaves[253]);
+	n352:
+		return(tree_4_leaves[254]);
+	n268:
+		if (x[0] > 6.71350973207845980e-02) goto n354;
+		goto n353;
+	n353:
+		if (x[6] > -3.95776786419448773e-02) goto n416;
+		goto n415;
+	n415:
+		if (x[8] > 7.12893419543478707e-02) goto n464;
+		goto n463;
+	n463:
+		if (x[4] > 2.26990288123892353e-02) goto n504;
+		goto n503;
+	n503:
+		return(tree_4_leaves[255]);
+	n504:
+		return(tree_4_leaves[256]);
+	n464:
+		if (x[6] > -4.70387642560595315e-02) goto n506;
+		goto n505;
+	n505:
+		if (x[8] > 1.33422493163968342e-01) goto n532;
+		goto n531;
+	n531:
+		return(tree_4_leaves[257]);
+	n532:
+		return(tree_4_leaves[258]);
+	n506:
+		return(tree_4_leaves[259]);
+	n416:
+		return(tree_4_leaves[260]);
+	n354:
+		if (x[5] > 8.33374403955585395e-03) goto n418;
+		goto n417;
+	n417:
+		return(tree_4_leaves[261]);
+	n418:
+		return(tree_4_leaves[262]);
+	n14:
+		if (x[5] > 1.98197990015778203e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[2] > 9.90479563182862927e-02) goto n60;
+		goto n59;
+	n59:
+		if (x[5] > -2.39023527363995646e-02) goto n112;
+		goto n111;
+	n111:
+		return(tree_4_leaves[263]);
+	n112:
+		if (x[0] > -4.44316726298757680e-02) goto n180;
+		goto n179;
+	n179:
+		return(tree_4_leaves[264]);
+	n180:
+		return(tree_4_leaves[265]);
+	n60:
+		if (x[3] > 4.75029289172864411e-02) goto n114;
+		goto n113;
+	n113:
+		if (x[3] > 5.14108293506150560e-03) goto n182;
+		goto n181;
+	n181:
+		return(tree_4_leaves[266]);
+	n182:
+		return(tree_4_leaves[267]);
+	n114:
+		if (x[0] > 3.36051763315485044e-02) goto n184;
+		goto n183;
+	n183:
+		if (x[2] > 1.07793199227232295e-01) goto n270;
+		goto n269;
+	n269:
+		return(tree_4_leaves[268]);
+	n270:
+		return(tree_4_leaves[269]);
+	n184:
+		return(tree_4_leaves[270]);
+	n30:
+		if (x[7] > 1.06497789409145199e-01) goto n62;
+		goto n61;
+	n61:
+		if (x[0] > -4.14059144464665185e-02) goto n116;
+		goto n115;
+	n115:
+		return(tree_4_leaves[271]);
+	n116:
+		return(tree_4_leaves[272]);
+	n62:
+		return(tree_4_leaves[273]);
+}
+
+static const leaf_t tree_5_leaves[] = {
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.99000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.26000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.54000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.89000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.67000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.84000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.93000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.47000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.76000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.66000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.49000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.12000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.86000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_5_find_leaf(const num_t *x){
+		if (x[2] > 5.62984109719995469e-03) goto n2;
+		goto n1;
+	n1:
+		if (x[8] > -1.06530976722851046e-02) goto n4;
+		goto n3;
+	n3:
+		if (x[5] > 1.11866098490709068e-01) goto n8;
+		goto n7;
+	n7:
+		if (x[3] > -3.90078851529884543e-02) goto n16;
+		goto n15;
+	n15:
+		if (x[0] > -4.51504579280434803e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[2] > -3.94697984442221525e-02) goto n54;
+		goto n53;
+	n53:
+		if (x[6] > 1.39873264820135033e-02) goto n94;
+		goto n93;
+	n93:
+		if (x[2] > -7.70523974825828711e-02) goto n150;
+		goto n149;
+	n149:
+		return(tree_5_leaves[0]);
+	n150:
+		return(tree_5_leaves[1]);
+	n94:
+		if (x[4] > -7.75588665640394581e-02) goto n152;
+		goto n151;
+	n151:
+		return(tree_5_leaves[2]);
+	n152:
+		if (x[0] > -5.20909481929193174e-02) goto n222;
+		goto n221;
+	n221:
+		if (x[9] > -1.31318397974000994e-01) goto n308;
+		goto n307;
+	n307:
+		return(tree_5_leaves[3]);
+	n308:
+		if (x[0] > -6.48246672307646876e-02) goto n386;
+		goto n385;
+	n385:
+		if (x[4] > -3.51875021394656221e-02) goto n430;
+		goto n429;
+	n429:
+		return(tree_5_leaves[4]);
+	n430:
+		return(tree_5_leaves[5]);
+	n386:
+		if (x[6] > 6.82205155086730991e-02) goto n432;
+		goto n431;
+	n431:
+		return(tree_5_leaves[6]);
+	n432:
+		return(tree_5_leaves[7]);
+	n222:
+		return(tree_5_leaves[8]);
+	n54:
+		if (x[2] > -3.09626626551867852e-02) goto n96;
+		goto n95;
+	n95:
+		return(tree_5_leaves[9]);
+	n96:
+		if (x[2] > -2.31470420395710891e-02) goto n154;
+		goto n153;
+	n153:
+		return(tree_5_leaves[10]);
+	n154:
+		return(tree_5_leaves[11]);
+	n30:
+		if (x[9] > -4.54737157227611769e-03) goto n56;
+		goto n55;
+	n55:
+		if (x[6] > -2.45985718087143737e-03) goto n98;
+		goto n97;
+	n97:
+		if (x[2] > -5.09714478805477766e-02) goto n156;
+		goto n155;
+	n155:
+		if (x[6] > -5.13847801859318651e-02) goto n224;
+		goto n223;
+	n223:
+		return(tree_5_leaves[12]);
+	n224:
+		return(tree_5_leaves[13]);
+	n156:
+		if (x[0] > -1.53700025505314336e-02) goto n226;
+		goto n225;
+	n225:
+		return(tree_5_leaves[14]);
+	n226:
+		return(tree_5_leaves[15]);
+	n98:
+		if (x[8] > -5.95836804161017780e-02) goto n158;
+		goto n157;
+	n157:
+		if (x[8] > -8.14288978137892444e-02) goto n228;
+		goto n227;
+	n227:
+		if (x[8] > -8.72251751709778589e-02) goto n310;
+		goto n309;
+	n309:
+		return(tree_5_leaves[16]);
+	n310:
+		return(tree_5_leaves[17]);
+	n228:
+		if (x[8] > -7.16140900122986812e-02) goto n312;
+		goto n311;
+	n311:
+		if (x[2] > -4.53240807229064943e-02) goto n388;
+		goto n387;
+	n387:
+		return(tree_5_leaves[18]);
+	n388:
+		return(tree_5_leaves[19]);
+	n312:
+		return(tree_5_leaves[20]);
+	n158:
+		if (x[5] > -8.73737184010527773e-02) goto n230;
+		goto n229;
+	n229:
+		return(tree_5_leaves[21]);
+	n230:
+		if (x[0] > 6.08807111278327762e-02) goto n314;
+		goto n313;
+	n313:
+		if (x[1] > -4.34819564630906513e-02) goto n390;
+		goto n389;
+	n389:
+		if (x[0] > 8.93084964358108885e-03) goto n434;
+		goto n433;
+	n433:
+		if (x[0] > -9.71438680835039030e-03) goto n474;
+		goto n473;
+	n473:
+		if (x[5] > -8.42607410293435416e-02) goto n510;
+		goto n509;
+	n509:
+		return(tree_5_leaves[22]);
+	n510:
+		return(tree_5_leaves[23]);
+	n474:
+		return(tree_5_leaves[24]);
+	n434:
+		if (x[3] > -5.67073169663233553e-02) goto n476;
+		goto n475;
+	n475:
+		return(tree_5_leaves[25]);
+	n476:
+		return(tree_5_leaves[26]);
+	n390:
+		return(tree_5_leaves[27]);
+	n314:
+		return(tree_5_leaves[28]);
+	n56:
+		if (x[4] > -5.10708164667455361e-02) goto n100;
+		goto n99;
+	n99:
+		return(tree_5_leaves[29]);
+	n100:
+		if (x[2] > -1.94203074162424723e-02) goto n160;
+		goto n159;
+	n159:
+		if (x[3] > -6.45452822345709137e-02) goto n232;
+		goto n231;
+	n231:
+		return(tree_5_leaves[30]);
+	n232:
+		if (x[9] > 5.09478336807156051e-03) goto n316;
+		goto n315;
+	n315:
+		return(tree_5_leaves[31]);
+	n316:
+		return(tree_5_leaves[32]);
+	n160:
+		return(tree_5_leaves[33]);
+	n16:
+		if (x[4] > -3.91675222073901916e-02) goto n32;
+		goto n31;
+	n31:
+		if (x[0] > 4.09519286767895119e-02) goto n58;
+		goto n57;
+	n57:
+		if (x[6] > -4.25578197450225855e-03) goto n102;
+		goto n101;
+	n101:
+		if (x[2] > -4.76148778461916652e-02) goto n162;
+		goto n161;
+	n161:
+		return(tree_5_leaves[34]);
+	n162:
+		if (x[6] > -4.95305286221937660e-02) goto n234;
+		goto n233;
+	n233:
+		return(tree_5_leaves[35]);
+	n234:
+		if (x[4] > -8.03585500098278893e-02) goto n318;
+		goto n317;
+	n317:
+		return(tree_5_leaves[36]);
+	n318:
+		return(tree_5_leaves[37]);
+	n102:
+		if (x[2] > -3.41995604736131664e-02) goto n164;
+		goto n163;
+	n163:
+		if (x[0] > -7.07545832616917128e-03) goto n236;
+		goto n235;
+	n235:
+		if (x[8] > -9.24596968477196385e-02) goto n320;
+		goto n319;
+	n319:
+		return(tree_5_leaves[38]);
+	n320:
+		if (x[3] > -3.11825876876889278e-02) goto n392;
+		goto n391;
+	n391:
+		return(tree_5_leaves[39]);
+	n392:
+		if (x[3] > -2.90929753910988340e-02) goto n436;
+		goto n435;
+	n435:
+		return(tree_5_leaves[40]);
+	n436:
+		if (x[8] > -7.44045599263753743e-02) goto n478;
+		goto n477;
+	n477:
+		return(tree_5_leaves[41]);
+	n478:
+		if (x[4] > -5.31836169898506628e-02) goto n512;
+		goto n511;
+	n511:
+		return(tree_5_leaves[42]);
+	n512:
+		return(tree_5_leaves[43]);
+	n236:
+		if (x[2] > -3.86891600337508634e-02) goto n322;
+		goto n321;
+	n321:
+		return(tree_5_leaves[44]);
+	n322:
+		return(tree_5_leaves[45]);
+	n164:
+		if (x[9] > -1.26453198454781791e-02) goto n238;
+		goto n237;
+	n237:
+		return(tree_5_leaves[46]);
+	n238:
+		if (x[5] > -4.62508957620361635e-02) goto n324;
+		goto n323;
+	n323:
+		return(tree_5_leaves[47]);
+	n324:
+		return(tree_5_leaves[48]);
+	n58:
+		if (x[6] > 4.67255824466776340e-02) goto n104;
+		goto n103;
+	n103:
+		return(tree_5_leaves[49]);
+	n104:
+		return(tree_5_leaves[50]);
+	n32:
+		if (x[3] > 1.20813220824037698e-01) goto n60;
+		goto n59;
+	n59:
+		if (x[9] > 3.99751886735974504e-02) goto n106;
+		goto n105;
+	n105:
+		if (x[1] > -2.18289731639250903e-02) goto n166;
+		goto n165;
+	n165:
+		if (x[5] > -1.83948734489667934e-02) goto n240;
+		goto n239;
+	n239:
+		if (x[0] > -4.31891334752884312e-02) goto n326;
+		goto n325;
+	n325:
+		return(tree_5_leaves[51]);
+	n326:
+		if (x[5] > -2.76951855522803297e-02) goto n394;
+		goto n393;
+	n393:
+		return(tree_5_leaves[52]);
+	n394:
+		if (x[0] > -4.00108421223339672e-02) goto n438;
+		goto n437;
+	n437:
+		return(tree_5_leaves[53]);
+	n438:
+		if (x[9] > -7.43968022542144114e-02) goto n480;
+		goto n479;
+	n479:
+		return(tree_5_leaves[54]);
+	n480:
+		if (x[7] > -2.67998665786068208e-02) goto n514;
+		goto n513;
+	n513:
+		return(tree_5_leaves[55]);
+	n514:
+		return(tree_5_leaves[56]);
+	n240:
+		if (x[9] > -2.27414257887732889e-02) goto n328;
+		goto n327;
+	n327:
+		if (x[8] > -2.46177894065760551e-02) goto n396;
+		goto n395;
+	n395:
+		if (x[5] > -6.42866790623062515e-03) goto n440;
+		goto n439;
+	n439:
+		return(tree_5_leaves[57]);
+	n440:
+		if (x[4] > 4.14685051893907766e-02) goto n482;
+		goto n481;
+	n481:
+		if (x[5] > 5.08565464493169767e-03) goto n516;
+		goto n515;
+	n515:
+		if (x[3] > -1.27184316265325243e-02) goto n530;
+		goto n529;
+	n529:
+		return(tree_5_leaves[58]);
+	n530:
+		return(tree_5_leaves[59]);
+	n516:
+		return(tree_5_leaves[60]);
+	n482:
+		return(tree_5_leaves[61]);
+	n396:
+		if (x[2] > -2.53347781669598232e-02) goto n442;
+		goto n441;
+	n441:
+		if (x[6] > 1.36946425514351239e-01) goto n484;
+		goto n483;
+	n483:
+		return(tree_5_leaves[62]);
+	n484:
+		return(tree_5_leaves[63]);
+	n442:
+		return(tree_5_leaves[64]);
+	n328:
+		if (x[6] > 4.59887812402525742e-02) goto n398;
+		goto n397;
+	n397:
+		if (x[9] > 4.86215394461356198e-03) goto n444;
+		goto n443;
+	n443:
+		if (x[8] > -2.57722945726579153e-02) goto n486;
+		goto n485;
+	n485:
+		return(tree_5_leaves[65]);
+	n486:
+		return(tree_5_leaves[66]);
+	n444:
+		if (x[4] > -1.29150651704982803e-02) goto n488;
+		goto n487;
+	n487:
+		return(tree_5_leaves[67]);
+	n488:
+		return(tree_5_leaves[68]);
+	n398:
+		if (x[9] > 8.11411644207303204e-03) goto n446;
+		goto n445;
+	n445:
+		if (x[7] > -2.42778610511132191e-02) goto n490;
+		goto n489;
+	n489:
+		return(tree_5_leaves[69]);
+	n490:
+		return(tree_5_leaves[70]);
+	n446:
+		if (x[0] > -4.75239513316181514e-02) goto n492;
+		goto n491;
+	n491:
+		return(tree_5_leaves[71]);
+	n492:
+		return(tree_5_leaves[72]);
+	n166:
+		if (x[9] > 1.24562445612786416e-02) goto n242;
+		goto n241;
+	n241:
+		if (x[8] > -1.39367480676750657e-02) goto n330;
+		goto n329;
+	n329:
+		if (x[0] > -8.19277485318180426e-02) goto n400;
+		goto n399;
+	n399:
+		return(tree_5_leaves[73]);
+	n400:
+		if (x[0] > 3.38836119813296227e-02) goto n448;
+		goto n447;
+	n447:
+		if (x[8] > -2.32622131302415505e-02) goto n494;
+		goto n493;
+	n493:
+		if (x[8] > -3.49760973498905448e-02) goto n518;
+		goto n517;
+	n517:
+		if (x[6] > -8.92850778297519208e-03) goto n532;
+		goto n531;
+	n531:
+		return(tree_5_leaves[74]);
+	n532:
+		if (x[3] > 1.30670654295010034e-02) goto n538;
+		goto n537;
+	n537:
+		return(tree_5_leaves[75]);
+	n538:
+		return(tree_5_leaves[76]);
+	n518:
+		if (x[3] > 1.01654426466281367e-02) goto n534;
+		goto n533;
+	n533:
+		if (x[4] > 5.07623258630712781e-03) goto n540;
+		goto n539;
+	n539:
+		return(tree_5_leaves[77]);
+	n540:
+		return(tree_5_leaves[78]);
+	n534:
+		return(tree_5_leaves[79]);
+	n494:
+		if (x[0] > 1.04720642187477730e-02) goto n520;
+		goto n519;
+	n519:
+		return(tree_5_leaves[80]);
+	n520:
+		return(tree_5_leaves[81]);
+	n448:
+		if (x[2] > -3.39722506654127204e-02) goto n496;
+		goto n495;
+	n495:
+		if (x[7] > -5.60763898960483370e-03) goto n522;
+		goto n521;
+	n521:
+		return(tree_5_leaves[82]);
+	n522:
+		return(tree_5_leaves[83]);
+	n496:
+		if (x[0] > 6.70360451813503122e-02) goto n524;
+		goto n523;
+	n523:
+		return(tree_5_leaves[84]);
+	n524:
+		return(tree_5_leaves[85]);
+	n330:
+		return(tree_5_leaves[86]);
+	n242:
+		if (x[0] > 8.62830208134328716e-03) goto n332;
+		goto n331;
+	n331:
+		return(tree_5_leaves[87]);
+	n332:
+		if (x[8] > -4.68249952487629975e-02) goto n402;
+		goto n401;
+	n401:
+		return(tree_5_leaves[88]);
+	n402:
+		if (x[7] > -3.34959879419086948e-02) goto n450;
+		goto n449;
+	n449:
+		return(tree_5_leaves[89]);
+	n450:
+		return(tree_5_leaves[90]);
+	n106:
+		if (x[2] > -3.43436949094212615e-02) goto n168;
+		goto n167;
+	n167:
+		if (x[5] > 4.22907868069603218e-02) goto n244;
+		goto n243;
+	n243:
+		return(tree_5_leaves[91]);
+	n244:
+		return(tree_5_leaves[92]);
+	n168:
+		if (x[1] > -3.94935856396080448e-02) goto n246;
+		goto n245;
+	n245:
+		return(tree_5_leaves[93]);
+	n246:
+		return(tree_5_leaves[94]);
+	n60:
+		return(tree_5_leaves[95]);
+	n8:
+		return(tree_5_leaves[96]);
+	n4:
+		if (x[9] > 9.79287470554018880e-02) goto n10;
+		goto n9;
+	n9:
+		if (x[9] > -2.53309115132923941e-03) goto n18;
+		goto n17;
+	n17:
+		if (x[8] > 6.83977889865903729e-03) goto n34;
+		goto n33;
+	n33:
+		if (x[8] > 4.88337175021583201e-04) goto n62;
+		goto n61;
+	n61:
+		if (x[2] > -4.74267741498231310e-03) goto n108;
+		goto n107;
+	n107:
+		if (x[4] > -4.87254570071358473e-02) goto n170;
+		goto n169;
+	n169:
+		return(tree_5_leaves[97]);
+	n170:
+		if (x[6] > 2.99382380639900587e-02) goto n248;
+		goto n247;
+	n247:
+		if (x[3] > -4.06465872993002561e-02) goto n334;
+		goto n333;
+	n333:
+		return(tree_5_leaves[98]);
+	n334:
+		return(tree_5_leaves[99]);
+	n248:
+		if (x[8] > -3.20940220895082721e-03) goto n336;
+		goto n335;
+	n335:
+		return(tree_5_leaves[100]);
+	n336:
+		return(tree_5_leaves[101]);
+	n108:
+		if (x[9] > -1.04253524303130757e-02) goto n172;
+		goto n171;
+	n171:
+		return(tree_5_leaves[102]);
+	n172:
+		return(tree_5_leaves[103]);
+	n62:
+		if (x[8] > 3.78177304345341447e-03) goto n110;
+		goto n109;
+	n109:
+		if (x[1] > 8.18594149354455458e-03) goto n174;
+		goto n173;
+	n173:
+		return(tree_5_leaves[104]);
+	n174:
+		return(tree_5_leaves[105]);
+	n110:
+		return(tree_5_leaves[106]);
+	n34:
+		if (x[8] > 6.65166736606107450e-02) goto n64;
+		goto n63;
+	n63:
+		if (x[2] > -6.14788728788493027e-02) goto n112;
+		goto n111;
+	n111:
+		return(tree_5_leaves[107]);
+	n112:
+		if (x[9] > -4.29655618432681005e-02) goto n176;
+		goto n175;
+	n175:
+		if (x[9] > -7.56687128496038447e-02) goto n250;
+		goto n249;
+	n249:
+		return(tree_5_leaves[108]);
+	n250:
+		return(tree_5_leaves[109]);
+	n176:
+		if (x[0] > 8.38510307155973696e-03) goto n252;
+		goto n251;
+	n251:
+		if (x[3] > -4.61523395912100329e-02) goto n338;
+		goto n337;
+	n337:
+		return(tree_5_leaves[110]);
+	n338:
+		if (x[0] > -6.07242223101661927e-02) goto n404;
+		goto n403;
+	n403:
+		if (x[9] > -2.72372262691322926e-02) goto n452;
+		goto n451;
+	n451:
+		if (x[0] > -7.50505877721223402e-02) goto n498;
+		goto n497;
+	n497:
+		return(tree_5_leaves[111]);
+	n498:
+		return(tree_5_leaves[112]);
+	n452:
+		return(tree_5_leaves[113]);
+	n404:
+		if (x[1] > 4.94777107404165487e-02) goto n454;
+		goto n453;
+	n453:
+		return(tree_5_leaves[114]);
+	n454:
+		if (x[8] > 5.30174627144308838e-02) goto n500;
+		goto n499;
+	n499:
+		if (x[9] > -1.07110723806630916e-02) goto n526;
+		goto n525;
+	n525:
+		return(tree_5_leaves[115]);
+	n526:
+		if (x[3] > -4.72068185981527194e-03) goto n536;
+		goto n535;
+	n535:
+		return(tree_5_leaves[116]);
+	n536:
+		return(tree_5_leaves[117]);
+	n500:
+		return(tree_5_leaves[118]);
+	n252:
+		if (x[4] > 1.91638333753338316e-02) goto n340;
+		goto n339;
+	n339:
+		if (x[9] > -1.88170183819213743e-02) goto n406;
+		goto n405;
+	n405:
+		if (x[5] > 9.82583282391153411e-03) goto n456;
+		goto n455;
+	n455:
+		return(tree_5_leaves[119]);
+	n456:
+		return(tree_5_leaves[120]);
+	n406:
+		return(tree_5_leaves[121]);
+	n340:
+		return(tree_5_leaves[122]);
+	n64:
+		return(tree_5_leaves[123]);
+	n18:
+		if (x[3] > 3.57428162190132764e-02) goto n36;
+		goto n35;
+	n35:
+		if (x[9] > 4.34930792088348006e-02) goto n66;
+		goto n65;
+	n65:
+		if (x[2] > -2.01706097497516071e-02) goto n114;
+		goto n113;
+	n113:
+		if (x[0] > -7.52863884154985393e-03) goto n178;
+		goto n177;
+	n177:
+		if (x[0] > -5.25355258055767715e-02) goto n254;
+		goto n253;
+	n253:
+		if (x[0] > -5.72267681097775177e-02) goto n342;
+		goto n341;
+	n341:
+		return(tree_5_leaves[124]);
+	n342:
+		return(tree_5_leaves[125]);
+	n254:
+		if (x[9] > 3.23656679310700551e-02) goto n344;
+		goto n343;
+	n343:
+		if (x[9] > 1.35770952960273389e-02) goto n408;
+		goto n407;
+	n407:
+		if (x[9] > 3.40547012228077737e-03) goto n458;
+		goto n457;
+	n457:
+		return(tree_5_leaves[126]);
+	n458:
+		return(tree_5_leaves[127]);
+	n408:
+		return(tree_5_leaves[128]);
+	n344:
+		return(tree_5_leaves[129]);
+	n178:
+		if (x[2] > -4.56131964931303299e-02) goto n256;
+		goto n255;
+	n255:
+		return(tree_5_leaves[130]);
+	n256:
+		if (x[0] > 9.28676991432155451e-03) goto n346;
+		goto n345;
+	n345:
+		return(tree_5_leaves[131]);
+	n346:
+		if (x[0] > 2.66993589464024142e-02) goto n410;
+		goto n409;
+	n409:
+		return(tree_5_leaves[132]);
+	n410:
+		if (x[2] > -4.00851237004080860e-02) goto n460;
+		goto n459;
+	n459:
+		return(tree_5_leaves[133]);
+	n460:
+		return(tree_5_leaves[134]);
+	n114:
+		if (x[4] > -1.48181806044613736e-02) goto n180;
+		goto n179;
+	n179:
+		if (x[6] > -4.70880207281584862e-02) goto n258;
+		goto n257;
+	n257:
+		if (x[4] > -2.81066075254466502e-02) goto n348;
+		goto n347;
+	n347:
+		return(tree_5_leaves[135]);
+	n348:
+		return(tree_5_leaves[136]);
+	n258:
+		return(tree_5_leaves[137]);
+	n180:
+		if (x[0] > 4.00159317760281560e-02) goto n260;
+		goto n259;
+	n259:
+		if (x[3] > -3.81253382836035451e-02) goto n350;
+		goto n349;
+	n349:
+		return(tree_5_leaves[138]);
+	n350:
+		return(tree_5_leaves[139]);
+	n260:
+		if (x[6] > -1.77708969102233182e-02) goto n352;
+		goto n351;
+	n351:
+		return(tree_5_leaves[140]);
+	n352:
+		return(tree_5_leaves[141]);
+	n66:
+		if (x[5] > 5.82649513216800669e-03) goto n116;
+		goto n115;
+	n115:
+		return(tree_5_leaves[142]);
+	n116:
+		if (x[5] > 4.65658099368899542e-02) goto n182;
+		goto n181;
+	n181:
+		if (x[3] > 2.35803189644333312e-02) goto n262;
+		goto n261;
+	n261:
+		if (x[7] > 4.50227113381631988e-02) goto n354;
+		goto n353;
+	n353:
+		return(tree_5_leaves[143]);
+	n354:
+		return(tree_5_leaves[144]);
+	n262:
+		return(tree_5_leaves[145]);
+	n182:
+		return(tree_5_leaves[146]);
+	n36:
+		if (x[9] > 1.44238082084431930e-02) goto n68;
+		goto n67;
+	n67:
+		if (x[3] > 8.34472593909604266e-02) goto n118;
+		goto n117;
+	n117:
+		return(tree_5_leaves[147]);
+	n118:
+		return(tree_5_leaves[148]);
+	n68:
+		if (x[2] > -2.58275835338359350e-02) goto n120;
+		goto n119;
+	n119:
+		if (x[7] > 4.03668847190467861e-02) goto n184;
+		goto n183;
+	n183:
+		if (x[0] > 4.96976700842437016e-02) goto n264;
+		goto n263;
+	n263:
+		return(tree_5_leaves[149]);
+	n264:
+		return(tree_5_leaves[150]);
+	n184:
+		if (x[7] > 6.55102403198678379e-02) goto n266;
+		goto n265;
+	n265:
+		return(tree_5_leaves[151]);
+	n266:
+		return(tree_5_leaves[152]);
+	n120:
+		if (x[6] > -1.17407133569062561e-02) goto n186;
+		goto n185;
+	n185:
+		if (x[5] > 5.51188175516454104e-02) goto n268;
+		goto n267;
+	n267:
+		if (x[5] > 3.12532555677427597e-04) goto n356;
+		goto n355;
+	n355:
+		if (x[0] > 4.56942660407874957e-02) goto n412;
+		goto n411;
+	n411:
+		return(tree_5_leaves[153]);
+	n412:
+		return(tree_5_leaves[154]);
+	n356:
+		return(tree_5_leaves[155]);
+	n268:
+		return(tree_5_leaves[156]);
+	n186:
+		if (x[3] > 8.41631231485457793e-02) goto n270;
+		goto n269;
+	n269:
+		return(tree_5_leaves[157]);
+	n270:
+		return(tree_5_leaves[158]);
+	n10:
+		if (x[1] > 2.36568681944094514e-02) goto n20;
+		goto n19;
+	n19:
+		return(tree_5_leaves[159]);
+	n20:
+		return(tree_5_leaves[160]);
+	n2:
+		if (x[8] > -1.19035305134454375e-03) goto n6;
+		goto n5;
+	n5:
+		if (x[3] > -2.83538785005209917e-02) goto n12;
+		goto n11;
+	n11:
+		if (x[8] > -4.56757157820913973e-03) goto n22;
+		goto n21;
+	n21:
+		if (x[3] > -5.61193854538437967e-02) goto n38;
+		goto n37;
+	n37:
+		if (x[4] > -5.36207307747030570e-02) goto n70;
+		goto n69;
+	n69:
+		return(tree_5_leaves[161]);
+	n70:
+		return(tree_5_leaves[162]);
+	n38:
+		if (x[9] > -2.70393918681663542e-02) goto n72;
+		goto n71;
+	n71:
+		if (x[1] > -2.51382423405408159e-02) goto n122;
+		goto n121;
+	n121:
+		return(tree_5_leaves[163]);
+	n122:
+		return(tree_5_leaves[164]);
+	n72:
+		if (x[7] > 1.30346768555327560e-02) goto n124;
+		goto n123;
+	n123:
+		if (x[6] > 1.52708271123921224e-02) goto n188;
+		goto n187;
+	n187:
+		if (x[8] > -1.54451258946847157e-02) goto n272;
+		goto n271;
+	n271:
+		return(tree_5_leaves[165]);
+	n272:
+		return(tree_5_leaves[166]);
+	n188:
+		return(tree_5_leaves[167]);
+	n124:
+		if (x[4] > -1.74902125944204900e-02) goto n190;
+		goto n189;
+	n189:
+		return(tree_5_leaves[168]);
+	n190:
+		if (x[8] > -4.92904484636812121e-02) goto n274;
+		goto n273;
+	n273:
+		return(tree_5_leaves[169]);
+	n274:
+		return(tree_5_leaves[170]);
+	n22:
+		if (x[7] > 2.68597567976729817e-02) goto n40;
+		goto n39;
+	n39:
+		return(tree_5_leaves[171]);
+	n40:
+		return(tree_5_leaves[172]);
+	n12:
+		if (x[0] > -7.97098978771028227e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[9] > 2.98696625270991178e-03) goto n42;
+		goto n41;
+	n41:
+		return(tree_5_leaves[173]);
+	n42:
+		return(tree_5_leaves[174]);
+	n24:
+		if (x[5] > 8.03900416509092811e-04) goto n44;
+		goto n43;
+	n43:
+		if (x[5] > -1.75889763042591796e-02) goto n74;
+		goto n73;
+	n73:
+		if (x[5] > -2.95218685513439667e-02) goto n126;
+		goto n125;
+	n125:
+		if (x[9] > -9.37819505082157501e-03) goto n192;
+		goto n191;
+	n191:
+		if (x[9] > -5.55742869806556544e-02) goto n276;
+		goto n275;
+	n275:
+		return(tree_5_leaves[175]);
+	n276:
+		return(tree_5_leaves[176]);
+	n192:
+		if (x[0] > -2.83263667813681459e-02) goto n278;
+		goto n277;
+	n277:
+		return(tree_5_leaves[177]);
+	n278:
+		return(tree_5_leaves[178]);
+	n126:
+		if (x[3] > 5.35988514904932184e-02) goto n194;
+		goto n193;
+	n193:
+		if (x[4] > -3.88045065170360068e-02) goto n280;
+		goto n279;
+	n279:
+		return(tree_5_leaves[179]);
+	n280:
+		return(tree_5_leaves[180]);
+	n194:
+		return(tree_5_leaves[181]);
+	n74:
+		if (x[5] > -1.27348227203575338e-02) goto n128;
+		goto n127;
+	n127:
+		if (x[9] > -5.75478364625294642e-02) goto n196;
+		goto n195;
+	n195:
+		return(tree_5_leaves[182]);
+	n196:
+		return(tree_5_leaves[183]);
+	n128:
+		if (x[5] > -1.18083629017932826e-03) goto n198;
+		goto n197;
+	n197:
+		if (x[5] > -5.45702279201995977e-03) goto n282;
+		goto n281;
+	n281:
+		return(tree_5_leaves[184]);
+	n282:
+		return(tree_5_leaves[185]);
+	n198:
+		return(tree_5_leaves[186]);
+	n44:
+		if (x[4] > -2.60016200728366807e-03) goto n76;
+		goto n75;
+	n75:
+		if (x[6] > -5.57504896742875775e-02) goto n130;
+		goto n129;
+	n129:
+		return(tree_5_leaves[187]);
+	n130:
+		if (x[5] > 6.83857966529511068e-03) goto n200;
+		goto n199;
+	n199:
+		return(tree_5_leaves[188]);
+	n200:
+		return(tree_5_leaves[189]);
+	n76:
+		if (x[4] > 1.98716004406616943e-02) goto n132;
+		goto n131;
+	n131:
+		if (x[2] > 6.21347354084396952e-02) goto n202;
+		goto n201;
+	n201:
+		return(tree_5_leaves[190]);
+	n202:
+		return(tree_5_leaves[191]);
+	n132:
+		if (x[5] > 3.32208546696626805e-02) goto n204;
+		goto n203;
+	n203:
+		return(tree_5_leaves[192]);
+	n204:
+		if (x[6] > 5.75880054986656204e-02) goto n284;
+		goto n283;
+	n283:
+		if (x[3] > 1.18796324317898081e-02) goto n358;
+		goto n357;
+	n357:
+		return(tree_5_leaves[193]);
+	n358:
+		return(tree_5_leaves[194]);
+	n284:
+		return(tree_5_leaves[195]);
+	n6:
+		if (x[2] > 9.38387387754996000e-02) goto n14;
+		goto n13;
+	n13:
+		if (x[0] > -3.03435642552910834e-02) goto n26;
+		goto n25;
+	n25:
+		if (x[2] > 4.74352018790153915e-02) goto n46;
+		goto n45;
+	n45:
+		if (x[7] > -2.10090711646039683e-03) goto n78;
+		goto n77;
+	n77:
+		if (x[0] > -4.98170121943295324e-02) goto n134;
+		goto n133;
+	n133:
+		return(tree_5_leaves[196]);
+	n134:
+		return(tree_5_leaves[197]);
+	n78:
+		return(tree_5_leaves[198]);
+	n46:
+		if (x[2] > 8.52127244225271141e-02) goto n80;
+		goto n79;
+	n79:
+		if (x[1] > -4.64147321354415471e-03) goto n136;
+		goto n135;
+	n135:
+		return(tree_5_leaves[199]);
+	n136:
+		if (x[8] > 6.79636124307102935e-02) goto n206;
+		goto n205;
+	n205:
+		if (x[0] > -4.73708489350040812e-02) goto n286;
+		goto n285;
+	n285:
+		return(tree_5_leaves[200]);
+	n286:
+		return(tree_5_leaves[201]);
+	n206:
+		return(tree_5_leaves[202]);
+	n80:
+		return(tree_5_leaves[203]);
+	n26:
+		if (x[9] > 3.68149141468786800e-02) goto n48;
+		goto n47;
+	n47:
+		if (x[9] > -1.66579061008571708e-03) goto n82;
+		goto n81;
+	n81:
+		if (x[0] > 3.76624136493895756e-02) goto n138;
+		goto n137;
+	n137:
+		if (x[9] > -2.93827602692351628e-02) goto n208;
+		goto n207;
+	n207:
+		return(tree_5_leaves[204]);
+	n208:
+		if (x[2] > 2.35958978688554782e-02) goto n288;
+		goto n287;
+	n287:
+		if (x[2] > 1.36836141301974155e-02) goto n360;
+		goto n359;
+	n359:
+		return(tree_5_leaves[205]);
+	n360:
+		return(tree_5_leaves[206]);
+	n288:
+		if (x[8] > 5.48806812943759478e-02) goto n362;
+		goto n361;
+	n361:
+		if (x[9] > -1.22232990649132588e-02) goto n414;
+		goto n413;
+	n413:
+		return(tree_5_leaves[207]);
+	n414:
+		return(tree_5_leaves[208]);
+	n362:
+		return(tree_5_leaves[209]);
+	n138:
+		if (x[8] > 2.62150123620505104e-02) goto n210;
+		goto n209;
+	n209:
+		if (x[1] > -2.56967271460532415e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_5_leaves[210]);
+	n290:
+		return(tree_5_leaves[211]);
+	n210:
+		if (x[3] > 6.76447860615728563e-02) goto n292;
+		goto n291;
+	n291:
+		if (x[2] > 4.90161340577605353e-02) goto n364;
+		goto n363;
+	n363:
+		return(tree_5_leaves[212]);
+	n364:
+		return(tree_5_leaves[213]);
+	n292:
+		return(tree_5_leaves[214]);
+	n82:
+		if (x[3] > 5.41404014446418003e-02) goto n140;
+		goto n139;
+	n139:
+		if (x[7] > 4.07460485609797973e-02) goto n212;
+		goto n211;
+	n211:
+		if (x[2] > 2.51582296329359821e-02) goto n294;
+		goto n293;
+	n293:
+		if (x[0] > 3.86027653491773509e-02) goto n366;
+		goto n365;
+	n365:
+		if (x[2] > 7.26232408763393365e-03) goto n416;
+		goto n415;
+	n415:
+		return(tree_5_leaves[215]);
+	n416:
+		if (x[0] > 1.14963421267085565e-02) goto n462;
+		goto n461;
+	n461:
+		if (x[2] > 1.26106119148532234e-02) goto n502;
+		goto n501;
+	n501:
+		return(tree_5_leaves[216]);
+	n502:
+		return(tree_5_leaves[217]);
+	n462:
+		if (x[5] > -1.74555233331119414e-02) goto n504;
+		goto n503;
+	n503:
+		return(tree_5_leaves[218]);
+	n504:
+		if (x[4] > 5.75784743516750130e-02) goto n528;
+		goto n527;
+	n527:
+		return(tree_5_leaves[219]);
+	n528:
+		return(tree_5_leaves[220]);
+	n366:
+		if (x[1] > 4.02246125050738160e-02) goto n418;
+		goto n417;
+	n417:
+		return(tree_5_leaves[221]);
+	n418:
+		return(tree_5_leaves[222]);
+	n294:
+		if (x[5] > 2.64033642263491464e-02) goto n368;
+		goto n367;
+	n367:
+		if (x[2] > 5.81982130889441771e-02) goto n420;
+		goto n419;
+	n419:
+		if (x[3] > 5.23960763891599193e-02) goto n464;
+		goto n463;
+	n463:
+		return(tree_5_leaves[223]);
+	n464:
+		return(tree_5_leaves[224]);
+	n420:
+		return(tree_5_leaves[225]);
+	n368:
+		if (x[8] > 4.98461244485495225e-02) goto n422;
+		goto n421;
+	n421:
+		if (x[4] > 3.68716873079269342e-02) goto n466;
+		goto n465;
+	n465:
+		if (x[4] > 2.97066532325480394e-02) goto n506;
+		goto n505;
+	n505:
+		return(tree_5_leaves[226]);
+	n506:
+		return(tree_5_leaves[227]);
+	n466:
+		return(tree_5_leaves[228]);
+	n422:
+		return(tree_5_leaves[229]);
+	n212:
+		if (x[9] > 1.07356269837691250e-02) goto n296;
+		goto n295;
+	n295:
+		return(tree_5_leaves[230]);
+	n296:
+		if (x[2] > 1.09049276806253963e-02) goto n370;
+		goto n369;
+	n369:
+		return(tree_5_leaves[231]);
+	n370:
+		if (x[9] > 1.86068239574386680e-02) goto n424;
+		goto n423;
+	n423:
+		return(tree_5_leaves[232]);
+	n424:
+		if (x[4] > 2.48310535739540150e-02) goto n468;
+		goto n467;
+	n467:
+		return(tree_5_leaves[233]);
+	n468:
+		return(tree_5_leaves[234]);
+	n140:
+		if (x[6] > 1.49418717514892795e-02) goto n214;
+		goto n213;
+	n213:
+		if (x[9] > 2.47512529905654748e-02) goto n298;
+		goto n297;
+	n297:
+		if (x[5] > -4.97576793503614195e-02) goto n372;
+		goto n371;
+	n371:
+		return(tree_5_leaves[235]);
+	n372:
+		return(tree_5_leaves[236]);
+	n298:
+		return(tree_5_leaves[237]);
+	n214:
+		return(tree_5_leaves[238]);
+	n48:
+		if (x[0] > 8.06702290267474337e-02) goto n84;
+		goto n83;
+	n83:
+		if (x[8] > 3.65615888176441667e-02) goto n142;
+		goto n141;
+	n141:
+		if (x[9] > 6.32186158675749343e-02) goto n216;
+		goto n215;
+	n215:
+		if (x[1] > 3.14497791661699014e-02) goto n300;
+		goto n299;
+	n299:
+		if (x[8] > 2.80819045300346945e-02) goto n374;
+		goto n373;
+	n373:
+		return(tree_5_leaves[239]);
+	n374:
+		return(tree_5_leaves[240]);
+	n300:
+		if (x[3] > 3.00046145585659910e-02) goto n376;
+		goto n375;
+	n375:
+		return(tree_5_leaves[241]);
+	n376:
+		return(tree_5_leaves[242]);
+	n216:
+		if (x[4] > 2.16857595492909692e-02) goto n302;
+		goto n301;
+	n301:
+		if (x[2] > 8.70321824085322771e-02) goto n378;
+		goto n377;
+	n377:
+		return(tree_5_leaves[243]);
+	n378:
+		return(tree_5_leaves[244]);
+	n302:
+		return(tree_5_leaves[245]);
+	n142:
+		if (x[2] > 5.97610339256813700e-02) goto n218;
+		goto n217;
+	n217:
+		if (x[9] > 5.65042213151183068e-02) goto n304;
+		goto n303;
+	n303:
+		if (x[2] > 3.73058991465304440e-02) goto n380;
+		goto n379;
+	n379:
+		if (x[3] > -3.51963391198174651e-03) goto n426;
+		goto n425;
+	n425:
+		return(tree_5_leaves[246]);
+	n426:
+		return(tree_5_leaves[247]);
+	n380:
+		return(tree_5_leaves[248]);
+	n304:
+		if (x[7] > 1.13340972156347641e-01) goto n382;
+		goto n381;
+	n381:
+		if (x[3] > 5.17945567802328352e-02) goto n428;
+		goto n427;
+	n427:
+		if (x[7] > 6.24072747596252086e-06) goto n470;
+		goto n469;
+	n469:
+		return(tree_5_leaves[249]);
+	n470:
+		if (x[0] > -3.62039699862577941e-03) goto n508;
+		goto n507;
+	n507:
+		return(tree_5_leaves[250]);
+	n508:
+		return(tree_5_leaves[251]);
+	n428:
+		if (x[3] > 6.35854377685513700e-02) goto n472;
+		goto n471;
+	n471:
+		return(tree_5_leaves[252]);
+	n472:
+		return(tree_5_leaves[253]);
+	n382:
+		return(tree_5_leaves[254]);
+	n218:
+		if (x[9] > 6.41472083407222671e-02) goto n306;
+		goto n305;
+	n305:
+		return(tree_5_leaves[255]);
+	n306:
+		if (x[9] > 8.76528364064491639e-02) goto n384;
+		goto n383;
+	n383:
+		return(tree_5_leaves[256]);
+	n384:
+		return(tree_5_leaves[257]);
+	n84:
+		if (x[9] > 6.81167594978281388e-02) goto n144;
+		goto n143;
+	n143:
+		return(tree_5_leaves[258]);
+	n144:
+		return(tree_5_leaves[259]);
+	n14:
+		if (x[4] > -2.39018688376001313e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[8] > 3.20268255044239974e-02) goto n50;
+		goto n49;
+	n49:
+		if (x[2] > 1.05117308488314382e-01) goto n86;
+		goto n85;
+	n85:
+		return(tree_5_leaves[260]);
+	n86:
+		if (x[2] > 1.19541132879585704e-01) goto n146;
+		goto n145;
+	n145:
+		return(tree_5_leaves[261]);
+	n146:
+		if (x[0] > 7.72331040180442019e-03) goto n220;
+		goto n219;
+	n219:
+		return(tree_5_leaves[262]);
+	n220:
+		return(tree_5_leaves[263]);
+	n50:
+		if (x[0] > 4.12141058572635388e-02) goto n88;
+		goto n87;
+	n87:
+		return(tree_5_leaves[264]);
+	n88:
+		return(tree_5_leaves[265]);
+	n28:
+		if (x[2] > 1.04957987493584620e-01) goto n52;
+		goto n51;
+	n51:
+		if (x[4] > -1.09918446392553090e-02) goto n90;
+		goto n89;
+	n89:
+		return(tree_5_leaves[266]);
+	n90:
+		if (x[3] > 2.38264170534191640e-02) goto n148;
+		goto n147;
+	n147:
+		return(tree_5_leaves[267]);
+	n148:
+		return(tree_5_leaves[268]);
+	n52:
+		if (x[0] > -5.13105221752115787e-03) goto n92;
+		goto n91;
+	n91:
+		return(tree_5_leaves[269]);
+	n92:
+		return(tree_5_leaves[270]);
+}
+
+static const leaf_t tree_6_leaves[] = {
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.99000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.87000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.84000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.47000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.67000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.88000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.93000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.54000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.56000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.89000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.76000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.26000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.12000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.49000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.86000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.66000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.71000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_6_find_leaf(const num_t *x){
+		if (x[8] > -4.20444469313070810e-03) goto n2;
+		goto n1;
+	n1:
+		if (x[2] > 2.74418730791169563e-03) goto n4;
+		goto n3;
+	n3:
+		if (x[8] > -4.34369251999710132e-02) goto n8;
+		goto n7;
+	n7:
+		if (x[0] > -8.87182581267669385e-02) goto n16;
+		goto n15;
+	n15:
+		if (x[5] > -5.87302581383700867e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[9] > -1.94258968632628273e-02) goto n58;
+		goto n57;
+	n57:
+		if (x[0] > -9.66703208315532192e-02) goto n106;
+		goto n105;
+	n105:
+		return(tree_6_leaves[0]);
+	n106:
+		return(tree_6_leaves[1]);
+	n58:
+		return(tree_6_leaves[2]);
+	n30:
+		if (x[3] > -3.78420532195699877e-02) goto n60;
+		goto n59;
+	n59:
+		return(tree_6_leaves[3]);
+	n60:
+		if (x[6] > 2.86658838702149241e-02) goto n108;
+		goto n107;
+	n107:
+		return(tree_6_leaves[4]);
+	n108:
+		return(tree_6_leaves[5]);
+	n16:
+		if (x[0] > 3.78477958065198267e-02) goto n32;
+		goto n31;
+	n31:
+		if (x[8] > -5.65852156261326747e-02) goto n62;
+		goto n61;
+	n61:
+		if (x[5] > -7.82811472605818154e-02) goto n110;
+		goto n109;
+	n109:
+		return(tree_6_leaves[6]);
+	n110:
+		if (x[3] > -1.40887063292904867e-02) goto n170;
+		goto n169;
+	n169:
+		if (x[3] > -1.94640266332864326e-02) goto n248;
+		goto n247;
+	n247:
+		if (x[9] > -1.63601481943251720e-02) goto n314;
+		goto n313;
+	n313:
+		if (x[5] > -2.51432085325520235e-02) goto n386;
+		goto n385;
+	n385:
+		if (x[3] > -5.00289379442387383e-02) goto n436;
+		goto n435;
+	n435:
+		if (x[2] > -7.23293546995859155e-02) goto n474;
+		goto n473;
+	n473:
+		return(tree_6_leaves[7]);
+	n474:
+		if (x[2] > -6.63409540983367074e-02) goto n506;
+		goto n505;
+	n505:
+		return(tree_6_leaves[8]);
+	n506:
+		return(tree_6_leaves[9]);
+	n436:
+		if (x[0] > -4.55857927159401405e-02) goto n476;
+		goto n475;
+	n475:
+		if (x[4] > -8.28324556781083882e-02) goto n508;
+		goto n507;
+	n507:
+		return(tree_6_leaves[10]);
+	n508:
+		return(tree_6_leaves[11]);
+	n476:
+		if (x[5] > -6.77850326752060528e-02) goto n510;
+		goto n509;
+	n509:
+		return(tree_6_leaves[12]);
+	n510:
+		if (x[7] > -3.03655794764421741e-02) goto n530;
+		goto n529;
+	n529:
+		return(tree_6_leaves[13]);
+	n530:
+		return(tree_6_leaves[14]);
+	n386:
+		if (x[5] > -2.39395403346871552e-02) goto n438;
+		goto n437;
+	n437:
+		return(tree_6_leaves[15]);
+	n438:
+		if (x[0] > -1.62431197322403381e-02) goto n478;
+		goto n477;
+	n477:
+		return(tree_6_leaves[16]);
+	n478:
+		return(tree_6_leaves[17]);
+	n314:
+		if (x[5] > -2.93028714783448996e-02) goto n388;
+		goto n387;
+	n387:
+		return(tree_6_leaves[18]);
+	n388:
+		return(tree_6_leaves[19]);
+	n248:
+		return(tree_6_leaves[20]);
+	n170:
+		if (x[8] > -6.15840063777553584e-02) goto n250;
+		goto n249;
+	n249:
+		if (x[9] > -2.52022444588833605e-02) goto n316;
+		goto n315;
+	n315:
+		return(tree_6_leaves[21]);
+	n316:
+		if (x[6] > 1.12377244939810245e-01) goto n390;
+		goto n389;
+	n389:
+		if (x[0] > -3.58166749075613036e-02) goto n440;
+		goto n439;
+	n439:
+		return(tree_6_leaves[22]);
+	n440:
+		return(tree_6_leaves[23]);
+	n390:
+		return(tree_6_leaves[24]);
+	n250:
+		return(tree_6_leaves[25]);
+	n62:
+		if (x[6] > 5.30917961312782558e-02) goto n112;
+		goto n111;
+	n111:
+		if (x[3] > -9.44305742572316004e-02) goto n172;
+		goto n171;
+	n171:
+		return(tree_6_leaves[26]);
+	n172:
+		if (x[2] > -5.51280188906751456e-02) goto n252;
+		goto n251;
+	n251:
+		if (x[3] > -4.40493864144398672e-02) goto n318;
+		goto n317;
+	n317:
+		return(tree_6_leaves[27]);
+	n318:
+		return(tree_6_leaves[28]);
+	n252:
+		if (x[6] > 4.35051462006702319e-02) goto n320;
+		goto n319;
+	n319:
+		if (x[0] > 6.97302292694505343e-03) goto n392;
+		goto n391;
+	n391:
+		return(tree_6_leaves[29]);
+	n392:
+		if (x[5] > -6.70664819562895309e-03) goto n442;
+		goto n441;
+	n441:
+		return(tree_6_leaves[30]);
+	n442:
+		if (x[6] > -2.20114758401840013e-02) goto n480;
+		goto n479;
+	n479:
+		return(tree_6_leaves[31]);
+	n480:
+		return(tree_6_leaves[32]);
+	n320:
+		return(tree_6_leaves[33]);
+	n112:
+		if (x[6] > 1.08403586252730499e-01) goto n174;
+		goto n173;
+	n173:
+		return(tree_6_leaves[34]);
+	n174:
+		return(tree_6_leaves[35]);
+	n32:
+		if (x[6] > -4.60860007698962390e-03) goto n64;
+		goto n63;
+	n63:
+		return(tree_6_leaves[36]);
+	n64:
+		if (x[8] > -7.06254084920321934e-02) goto n114;
+		goto n113;
+	n113:
+		return(tree_6_leaves[37]);
+	n114:
+		if (x[4] > 1.17646422530453282e-02) goto n176;
+		goto n175;
+	n175:
+		if (x[5] > 2.40872423504554433e-03) goto n254;
+		goto n253;
+	n253:
+		return(tree_6_leaves[38]);
+	n254:
+		return(tree_6_leaves[39]);
+	n176:
+		return(tree_6_leaves[40]);
+	n8:
+		if (x[6] > -2.32713007665119702e-02) goto n18;
+		goto n17;
+	n17:
+		if (x[6] > -2.97709395796469795e-02) goto n34;
+		goto n33;
+	n33:
+		if (x[0] > 7.82728889546732004e-02) goto n66;
+		goto n65;
+	n65:
+		if (x[7] > 4.44200991077051410e-02) goto n116;
+		goto n115;
+	n115:
+		if (x[0] > 1.06538372674337689e-02) goto n178;
+		goto n177;
+	n177:
+		return(tree_6_leaves[41]);
+	n178:
+		if (x[9] > 5.69451754403899682e-02) goto n256;
+		goto n255;
+	n255:
+		if (x[3] > 1.59625526423609679e-02) goto n322;
+		goto n321;
+	n321:
+		return(tree_6_leaves[42]);
+	n322:
+		return(tree_6_leaves[43]);
+	n256:
+		return(tree_6_leaves[44]);
+	n116:
+		if (x[6] > -6.76689632408622593e-02) goto n180;
+		goto n179;
+	n179:
+		return(tree_6_leaves[45]);
+	n180:
+		return(tree_6_leaves[46]);
+	n66:
+		return(tree_6_leaves[47]);
+	n34:
+		if (x[3] > -5.25072124473147522e-02) goto n68;
+		goto n67;
+	n67:
+		return(tree_6_leaves[48]);
+	n68:
+		if (x[8] > -2.07019036545479582e-02) goto n118;
+		goto n117;
+	n117:
+		return(tree_6_leaves[49]);
+	n118:
+		return(tree_6_leaves[50]);
+	n18:
+		if (x[4] > -5.17710214119609241e-02) goto n36;
+		goto n35;
+	n35:
+		if (x[2] > -2.05856347870434463e-02) goto n70;
+		goto n69;
+	n69:
+		if (x[1] > 3.88324361283460331e-02) goto n120;
+		goto n119;
+	n119:
+		if (x[3] > -2.56223464142941379e-02) goto n182;
+		goto n181;
+	n181:
+		if (x[8] > -2.88568310671683745e-02) goto n258;
+		goto n257;
+	n257:
+		return(tree_6_leaves[51]);
+	n258:
+		if (x[0] > -8.98992875722015999e-02) goto n324;
+		goto n323;
+	n323:
+		return(tree_6_leaves[52]);
+	n324:
+		return(tree_6_leaves[53]);
+	n182:
+		return(tree_6_leaves[54]);
+	n120:
+		if (x[0] > -1.86244713018518665e-02) goto n184;
+		goto n183;
+	n183:
+		return(tree_6_leaves[55]);
+	n184:
+		return(tree_6_leaves[56]);
+	n70:
+		return(tree_6_leaves[57]);
+	n36:
+		if (x[4] > -6.82650893815568878e-03) goto n72;
+		goto n71;
+	n71:
+		if (x[9] > 9.80827456270577181e-04) goto n122;
+		goto n121;
+	n121:
+		if (x[3] > -1.10886906402516121e-03) goto n186;
+		goto n185;
+	n185:
+		if (x[3] > -8.54896095097974068e-03) goto n260;
+		goto n259;
+	n259:
+		if (x[1] > 4.11638690053182307e-02) goto n326;
+		goto n325;
+	n325:
+		if (x[6] > 1.92240194304350021e-02) goto n394;
+		goto n393;
+	n393:
+		if (x[9] > -1.00121742256540566e-02) goto n444;
+		goto n443;
+	n443:
+		if (x[6] > -9.82394095527380773e-03) goto n482;
+		goto n481;
+	n481:
+		return(tree_6_leaves[58]);
+	n482:
+		return(tree_6_leaves[59]);
+	n444:
+		return(tree_6_leaves[60]);
+	n394:
+		if (x[3] > -7.87635796083067108e-02) goto n446;
+		goto n445;
+	n445:
+		return(tree_6_leaves[61]);
+	n446:
+		return(tree_6_leaves[62]);
+	n326:
+		if (x[5] > -2.47322176101959744e-02) goto n396;
+		goto n395;
+	n395:
+		return(tree_6_leaves[63]);
+	n396:
+		return(tree_6_leaves[64]);
+	n260:
+		return(tree_6_leaves[65]);
+	n186:
+		if (x[8] > -1.84374185971448133e-02) goto n262;
+		goto n261;
+	n261:
+		if (x[1] > 3.86079098179113941e-02) goto n328;
+		goto n327;
+	n327:
+		return(tree_6_leaves[66]);
+	n328:
+		return(tree_6_leaves[67]);
+	n262:
+		if (x[3] > 3.20927506317099168e-02) goto n330;
+		goto n329;
+	n329:
+		if (x[3] > 2.36688180678812886e-02) goto n398;
+		goto n397;
+	n397:
+		return(tree_6_leaves[68]);
+	n398:
+		return(tree_6_leaves[69]);
+	n330:
+		return(tree_6_leaves[70]);
+	n122:
+		if (x[0] > 2.58640867953246721e-02) goto n188;
+		goto n187;
+	n187:
+		if (x[4] > -3.32788797408145390e-02) goto n264;
+		goto n263;
+	n263:
+		return(tree_6_leaves[71]);
+	n264:
+		return(tree_6_leaves[72]);
+	n188:
+		if (x[0] > 6.54334427653245065e-02) goto n266;
+		goto n265;
+	n265:
+		if (x[0] > 3.64131906687712170e-02) goto n332;
+		goto n331;
+	n331:
+		return(tree_6_leaves[73]);
+	n332:
+		return(tree_6_leaves[74]);
+	n266:
+		return(tree_6_leaves[75]);
+	n72:
+		if (x[4] > -1.94047661782277689e-03) goto n124;
+		goto n123;
+	n123:
+		if (x[0] > -3.56837933468881485e-02) goto n190;
+		goto n189;
+	n189:
+		return(tree_6_leaves[76]);
+	n190:
+		if (x[5] > -2.07647099429081189e-02) goto n268;
+		goto n267;
+	n267:
+		return(tree_6_leaves[77]);
+	n268:
+		if (x[4] > -3.32804018206485277e-03) goto n334;
+		goto n333;
+	n333:
+		return(tree_6_leaves[78]);
+	n334:
+		return(tree_6_leaves[79]);
+	n124:
+		if (x[8] > -2.36888640673174333e-02) goto n192;
+		goto n191;
+	n191:
+		if (x[2] > -1.39191593134332589e-02) goto n270;
+		goto n269;
+	n269:
+		if (x[5] > 3.63827474930831854e-02) goto n336;
+		goto n335;
+	n335:
+		if (x[4] > 1.82737258638762182e-02) goto n400;
+		goto n399;
+	n399:
+		if (x[8] > -3.95118753425047278e-02) goto n448;
+		goto n447;
+	n447:
+		return(tree_6_leaves[80]);
+	n448:
+		if (x[6] > 3.28178624798976457e-02) goto n484;
+		goto n483;
+	n483:
+		if (x[7] > -6.58534963900140897e-03) goto n512;
+		goto n511;
+	n511:
+		return(tree_6_leaves[81]);
+	n512:
+		return(tree_6_leaves[82]);
+	n484:
+		if (x[6] > 7.96545432624102823e-02) goto n514;
+		goto n513;
+	n513:
+		if (x[8] > -3.00767594315389866e-02) goto n532;
+		goto n531;
+	n531:
+		return(tree_6_leaves[83]);
+	n532:
+		return(tree_6_leaves[84]);
+	n514:
+		return(tree_6_leaves[85]);
+	n400:
+		if (x[0] > -6.88225558623105360e-03) goto n450;
+		goto n449;
+	n449:
+		return(tree_6_leaves[86]);
+	n450:
+		if (x[0] > 4.79715434160901816e-02) goto n486;
+		goto n485;
+	n485:
+		return(tree_6_leaves[87]);
+	n486:
+		return(tree_6_leaves[88]);
+	n336:
+		if (x[1] > -1.56413081485342297e-02) goto n402;
+		goto n401;
+	n401:
+		return(tree_6_leaves[89]);
+	n402:
+		return(tree_6_leaves[90]);
+	n270:
+		if (x[6] > 2.11072200343198277e-02) goto n338;
+		goto n337;
+	n337:
+		if (x[6] > 8.63422865320823303e-03) goto n404;
+		goto n403;
+	n403:
+		return(tree_6_leaves[91]);
+	n404:
+		return(tree_6_leaves[92]);
+	n338:
+		return(tree_6_leaves[93]);
+	n192:
+		if (x[5] > 5.11397555132610121e-02) goto n272;
+		goto n271;
+	n271:
+		if (x[7] > -5.24797842644963639e-02) goto n340;
+		goto n339;
+	n339:
+		return(tree_6_leaves[94]);
+	n340:
+		if (x[0] > 1.36433059316319388e-03) goto n406;
+		goto n405;
+	n405:
+		if (x[8] > -1.85262030353359683e-02) goto n452;
+		goto n451;
+	n451:
+		return(tree_6_leaves[95]);
+	n452:
+		if (x[9] > -1.19010850064181061e-02) goto n488;
+		goto n487;
+	n487:
+		return(tree_6_leaves[96]);
+	n488:
+		return(tree_6_leaves[97]);
+	n406:
+		if (x[7] > 2.27696189200010876e-02) goto n454;
+		goto n453;
+	n453:
+		return(tree_6_leaves[98]);
+	n454:
+		return(tree_6_leaves[99]);
+	n272:
+		if (x[0] > 1.26228062163151016e-02) goto n342;
+		goto n341;
+	n341:
+		return(tree_6_leaves[100]);
+	n342:
+		return(tree_6_leaves[101]);
+	n4:
+		if (x[0] > -8.21083589870844344e-02) goto n10;
+		goto n9;
+	n9:
+		return(tree_6_leaves[102]);
+	n10:
+		if (x[3] > 6.89659055590930992e-02) goto n20;
+		goto n19;
+	n19:
+		if (x[7] > -2.05156360769549531e-02) goto n38;
+		goto n37;
+	n37:
+		if (x[3] > 1.87393290244876054e-02) goto n74;
+		goto n73;
+	n73:
+		if (x[5] > -4.78254655707114132e-02) goto n126;
+		goto n125;
+	n125:
+		if (x[2] > 5.71962104645687142e-02) goto n194;
+		goto n193;
+	n193:
+		if (x[8] > -1.61163070610775422e-02) goto n274;
+		goto n273;
+	n273:
+		if (x[7] > -3.76689249659188513e-02) goto n344;
+		goto n343;
+	n343:
+		return(tree_6_leaves[103]);
+	n344:
+		return(tree_6_leaves[104]);
+	n274:
+		return(tree_6_leaves[105]);
+	n194:
+		return(tree_6_leaves[106]);
+	n126:
+		if (x[3] > -2.31064484553234646e-02) goto n196;
+		goto n195;
+	n195:
+		if (x[4] > -5.47102305721148957e-02) goto n276;
+		goto n275;
+	n275:
+		return(tree_6_leaves[107]);
+	n276:
+		if (x[5] > -2.43205729158361972e-03) goto n346;
+		goto n345;
+	n345:
+		return(tree_6_leaves[108]);
+	n346:
+		if (x[2] > 6.67031076994239053e-02) goto n408;
+		goto n407;
+	n407:
+		return(tree_6_leaves[109]);
+	n408:
+		return(tree_6_leaves[110]);
+	n196:
+		if (x[2] > 4.29017780784609060e-02) goto n278;
+		goto n277;
+	n277:
+		return(tree_6_leaves[111]);
+	n278:
+		if (x[8] > -4.88955747530872981e-02) goto n348;
+		goto n347;
+	n347:
+		return(tree_6_leaves[112]);
+	n348:
+		if (x[6] > 2.01920476528576649e-02) goto n410;
+		goto n409;
+	n409:
+		return(tree_6_leaves[113]);
+	n410:
+		return(tree_6_leaves[114]);
+	n74:
+		if (x[7] > -3.57957782253079046e-02) goto n128;
+		goto n127;
+	n127:
+		return(tree_6_leaves[115]);
+	n128:
+		return(tree_6_leaves[116]);
+	n38:
+		if (x[2] > 6.05728322244862491e-02) goto n76;
+		goto n75;
+	n75:
+		if (x[3] > 4.60436668983007572e-02) goto n130;
+		goto n129;
+	n129:
+		if (x[0] > -4.27793350664231117e-02) goto n198;
+		goto n197;
+	n197:
+		if (x[6] > -9.62552351740751828e-03) goto n280;
+		goto n279;
+	n279:
+		if (x[6] > -1.82830631527616388e-02) goto n350;
+		goto n349;
+	n349:
+		return(tree_6_leaves[117]);
+	n350:
+		return(tree_6_leaves[118]);
+	n280:
+		if (x[0] > -6.05712887895058852e-02) goto n352;
+		goto n351;
+	n351:
+		return(tree_6_leaves[119]);
+	n352:
+		return(tree_6_leaves[120]);
+	n198:
+		if (x[2] > 4.89818970058088984e-02) goto n282;
+		goto n281;
+	n281:
+		if (x[0] > 3.71363337765304724e-02) goto n354;
+		goto n353;
+	n353:
+		if (x[8] > -5.72331187270104947e-03) goto n412;
+		goto n411;
+	n411:
+		if (x[9] > -2.42566407110530180e-02) goto n456;
+		goto n455;
+	n455:
+		return(tree_6_leaves[121]);
+	n456:
+		return(tree_6_leaves[122]);
+	n412:
+		return(tree_6_leaves[123]);
+	n354:
+		if (x[0] > 4.14810906183615477e-02) goto n414;
+		goto n413;
+	n413:
+		return(tree_6_leaves[124]);
+	n414:
+		return(tree_6_leaves[125]);
+	n282:
+		return(tree_6_leaves[126]);
+	n130:
+		return(tree_6_leaves[127]);
+	n76:
+		return(tree_6_leaves[128]);
+	n20:
+		if (x[0] > -1.72018891596008826e-02) goto n40;
+		goto n39;
+	n39:
+		return(tree_6_leaves[129]);
+	n40:
+		return(tree_6_leaves[130]);
+	n2:
+		if (x[2] > -2.20682363766165970e-02) goto n6;
+		goto n5;
+	n5:
+		if (x[3] > -2.33586050835950070e-02) goto n12;
+		goto n11;
+	n11:
+		if (x[6] > -3.50219357537284864e-02) goto n22;
+		goto n21;
+	n21:
+		if (x[3] > -8.23336532893863965e-02) goto n42;
+		goto n41;
+	n41:
+		return(tree_6_leaves[131]);
+	n42:
+		if (x[2] > -5.82222289719987116e-02) goto n78;
+		goto n77;
+	n77:
+		return(tree_6_leaves[132]);
+	n78:
+		return(tree_6_leaves[133]);
+	n22:
+		if (x[9] > 2.35696278917731789e-02) goto n44;
+		goto n43;
+	n43:
+		if (x[3] > -5.94166735240532901e-02) goto n80;
+		goto n79;
+	n79:
+		if (x[8] > 2.57860458041262418e-02) goto n132;
+		goto n131;
+	n131:
+		return(tree_6_leaves[134]);
+	n132:
+		return(tree_6_leaves[135]);
+	n80:
+		if (x[4] > 3.97501611214845438e-02) goto n134;
+		goto n133;
+	n133:
+		if (x[3] > -5.16860480884297133e-02) goto n200;
+		goto n199;
+	n199:
+		return(tree_6_leaves[136]);
+	n200:
+		return(tree_6_leaves[137]);
+	n134:
+		if (x[0] > -2.79041021278741523e-02) goto n202;
+		goto n201;
+	n201:
+		return(tree_6_leaves[138]);
+	n202:
+		return(tree_6_leaves[139]);
+	n44:
+		return(tree_6_leaves[140]);
+	n12:
+		if (x[8] > 2.69204475024543421e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[8] > 1.76721941826437582e-03) goto n46;
+		goto n45;
+	n45:
+		if (x[3] > 4.07974464542022741e-02) goto n82;
+		goto n81;
+	n81:
+		if (x[9] > -2.37734298456373193e-02) goto n136;
+		goto n135;
+	n135:
+		if (x[3] > 1.51891421096332323e-02) goto n204;
+		goto n203;
+	n203:
+		return(tree_6_leaves[141]);
+	n204:
+		return(tree_6_leaves[142]);
+	n136:
+		return(tree_6_leaves[143]);
+	n82:
+		return(tree_6_leaves[144]);
+	n46:
+		if (x[9] > 4.34950708706720868e-02) goto n84;
+		goto n83;
+	n83:
+		if (x[8] > 9.64839027884249224e-03) goto n138;
+		goto n137;
+	n137:
+		if (x[5] > -4.84254318514348511e-02) goto n206;
+		goto n205;
+	n205:
+		return(tree_6_leaves[145]);
+	n206:
+		if (x[2] > -2.42893138126407428e-02) goto n284;
+		goto n283;
+	n283:
+		return(tree_6_leaves[146]);
+	n284:
+		return(tree_6_leaves[147]);
+	n138:
+		if (x[6] > -1.72812546714187013e-02) goto n208;
+		goto n207;
+	n207:
+		return(tree_6_leaves[148]);
+	n208:
+		if (x[7] > 4.84858632963566100e-03) goto n286;
+		goto n285;
+	n285:
+		if (x[3] > -9.51926025101033912e-03) goto n356;
+		goto n355;
+	n355:
+		return(tree_6_leaves[149]);
+	n356:
+		if (x[9] > -2.34433139931955262e-02) goto n416;
+		goto n415;
+	n415:
+		return(tree_6_leaves[150]);
+	n416:
+		return(tree_6_leaves[151]);
+	n286:
+		return(tree_6_leaves[152]);
+	n84:
+		if (x[6] > -1.23570930535909299e-02) goto n140;
+		goto n139;
+	n139:
+		if (x[4] > 1.09486911726471084e-02) goto n210;
+		goto n209;
+	n209:
+		return(tree_6_leaves[153]);
+	n210:
+		return(tree_6_leaves[154]);
+	n140:
+		if (x[4] > 2.33593464169916352e-02) goto n212;
+		goto n211;
+	n211:
+		return(tree_6_leaves[155]);
+	n212:
+		return(tree_6_leaves[156]);
+	n24:
+		if (x[6] > -3.17991291169723994e-02) goto n48;
+		goto n47;
+	n47:
+		if (x[7] > 6.97241902957621285e-02) goto n86;
+		goto n85;
+	n85:
+		return(tree_6_leaves[157]);
+	n86:
+		if (x[9] > 1.85817582596758367e-02) goto n142;
+		goto n141;
+	n141:
+		return(tree_6_leaves[158]);
+	n142:
+		return(tree_6_leaves[159]);
+	n48:
+		if (x[2] > -4.92310935235269198e-02) goto n88;
+		goto n87;
+	n87:
+		return(tree_6_leaves[160]);
+	n88:
+		if (x[4] > -1.89865525348171214e-02) goto n144;
+		goto n143;
+	n143:
+		return(tree_6_leaves[161]);
+	n144:
+		if (x[8] > 6.28175731029925466e-02) goto n214;
+		goto n213;
+	n213:
+		return(tree_6_leaves[162]);
+	n214:
+		return(tree_6_leaves[163]);
+	n6:
+		if (x[3] > 2.87015155074633425e-02) goto n14;
+		goto n13;
+	n13:
+		if (x[8] > 6.35151447942180203e-02) goto n26;
+		goto n25;
+	n25:
+		if (x[2] > 9.52559341931006470e-02) goto n50;
+		goto n49;
+	n49:
+		if (x[9] > 9.51547401005462951e-02) goto n90;
+		goto n89;
+	n89:
+		if (x[3] > -5.91550018122609933e-02) goto n146;
+		goto n145;
+	n145:
+		if (x[2] > 1.36700124241578326e-02) goto n216;
+		goto n215;
+	n215:
+		if (x[7] > -1.17942614353781228e-02) goto n288;
+		goto n287;
+	n287:
+		return(tree_6_leaves[164]);
+	n288:
+		if (x[8] > 3.37590967266067354e-02) goto n358;
+		goto n357;
+	n357:
+		return(tree_6_leaves[165]);
+	n358:
+		return(tree_6_leaves[166]);
+	n216:
+		if (x[6] > -1.24597327395249008e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_6_leaves[167]);
+	n290:
+		return(tree_6_leaves[168]);
+	n146:
+		if (x[0] > 7.55374851279442053e-03) goto n218;
+		goto n217;
+	n217:
+		if (x[3] > -5.66019656221573228e-02) goto n292;
+		goto n291;
+	n291:
+		if (x[2] > 5.07623488007023158e-02) goto n360;
+		goto n359;
+	n359:
+		return(tree_6_leaves[169]);
+	n360:
+		return(tree_6_leaves[170]);
+	n292:
+		if (x[4] > -4.63606999119186014e-02) goto n362;
+		goto n361;
+	n361:
+		return(tree_6_leaves[171]);
+	n362:
+		if (x[2] > -1.01447371499964033e-02) goto n418;
+		goto n417;
+	n417:
+		if (x[8] > 1.51059964014176908e-02) goto n458;
+		goto n457;
+	n457:
+		if (x[9] > 5.99725951569387780e-02) goto n490;
+		goto n489;
+	n489:
+		if (x[5] > 2.29140522490970805e-02) goto n516;
+		goto n515;
+	n515:
+		return(tree_6_leaves[172]);
+	n516:
+		return(tree_6_leaves[173]);
+	n490:
+		return(tree_6_leaves[174]);
+	n458:
+		if (x[2] > -1.15459294975700701e-02) goto n492;
+		goto n491;
+	n491:
+		if (x[8] > 2.00623775787883742e-02) goto n518;
+		goto n517;
+	n517:
+		return(tree_6_leaves[175]);
+	n518:
+		return(tree_6_leaves[176]);
+	n492:
+		return(tree_6_leaves[177]);
+	n418:
+		if (x[9] > -5.14827512911606444e-02) goto n460;
+		goto n459;
+	n459:
+		return(tree_6_leaves[178]);
+	n460:
+		if (x[5] > -2.87758165052685519e-02) goto n494;
+		goto n493;
+	n493:
+		if (x[7] > 2.26520021345569559e-03) goto n520;
+		goto n519;
+	n519:
+		return(tree_6_leaves[179]);
+	n520:
+		return(tree_6_leaves[180]);
+	n494:
+		if (x[8] > 1.76379527772154987e-02) goto n522;
+		goto n521;
+	n521:
+		if (x[2] > 7.58609541872654926e-03) goto n534;
+		goto n533;
+	n533:
+		return(tree_6_leaves[181]);
+	n534:
+		return(tree_6_leaves[182]);
+	n522:
+		if (x[2] > 5.15163203097128500e-02) goto n536;
+		goto n535;
+	n535:
+		if (x[8] > 2.40827149494066452e-02) goto n542;
+		goto n541;
+	n541:
+		return(tree_6_leaves[183]);
+	n542:
+		if (x[9] > 1.92969609215361201e-02) goto n550;
+		goto n549;
+	n549:
+		if (x[0] > -7.59936412881292572e-02) goto n558;
+		goto n557;
+	n557:
+		return(tree_6_leaves[184]);
+	n558:
+		if (x[5] > 1.78185153510315476e-02) goto n562;
+		goto n561;
+	n561:
+		return(tree_6_leaves[185]);
+	n562:
+		return(tree_6_leaves[186]);
+	n550:
+		if (x[3] > -5.28452190277082789e-02) goto n560;
+		goto n559;
+	n559:
+		return(tree_6_leaves[187]);
+	n560:
+		return(tree_6_leaves[188]);
+	n536:
+		if (x[3] > -2.15185693783740972e-02) goto n544;
+		goto n543;
+	n543:
+		return(tree_6_leaves[189]);
+	n544:
+		if (x[2] > 9.00850717576205801e-02) goto n552;
+		goto n551;
+	n551:
+		return(tree_6_leaves[190]);
+	n552:
+		return(tree_6_leaves[191]);
+	n218:
+		if (x[7] > 3.77632276577884174e-02) goto n294;
+		goto n293;
+	n293:
+		if (x[9] > 3.21519325225720076e-02) goto n364;
+		goto n363;
+	n363:
+		if (x[6] > -4.92092394924446772e-02) goto n420;
+		goto n419;
+	n419:
+		return(tree_6_leaves[192]);
+	n420:
+		if (x[9] > -2.35973049845170264e-02) goto n462;
+		goto n461;
+	n461:
+		if (x[1] > -2.48174751816070682e-02) goto n496;
+		goto n495;
+	n495:
+		return(tree_6_leaves[193]);
+	n496:
+		return(tree_6_leaves[194]);
+	n462:
+		if (x[0] > 3.82516038432395705e-02) goto n498;
+		goto n497;
+	n497:
+		if (x[4] > -2.72235889952002069e-02) goto n524;
+		goto n523;
+	n523:
+		return(tree_6_leaves[195]);
+	n524:
+		if (x[0] > 1.84192693772510935e-02) goto n538;
+		goto n537;
+	n537:
+		return(tree_6_leaves[196]);
+	n538:
+		return(tree_6_leaves[197]);
+	n498:
+		if (x[3] > 2.27277926960826535e-02) goto n526;
+		goto n525;
+	n525:
+		if (x[7] > -2.06263959246625857e-03) goto n540;
+		goto n539;
+	n539:
+		if (x[3] > -5.53542086729650815e-03) goto n546;
+		goto n545;
+	n545:
+		if (x[2] > 1.54380659367845535e-02) goto n554;
+		goto n553;
+	n553:
+		return(tree_6_leaves[198]);
+	n554:
+		return(tree_6_leaves[199]);
+	n546:
+		return(tree_6_leaves[200]);
+	n540:
+		if (x[0] > 4.63366014928071890e-02) goto n548;
+		goto n547;
+	n547:
+		return(tree_6_leaves[201]);
+	n548:
+		if (x[7] > 3.43759194946989186e-02) goto n556;
+		goto n555;
+	n555:
+		return(tree_6_leaves[202]);
+	n556:
+		return(tree_6_leaves[203]);
+	n526:
+		return(tree_6_leaves[204]);
+	n364:
+		return(tree_6_leaves[205]);
+	n294:
+		if (x[2] > 1.60989677908705102e-02) goto n366;
+		goto n365;
+	n365:
+		if (x[6] > -4.91510840376024327e-02) goto n422;
+		goto n421;
+	n421:
+		return(tree_6_leaves[206]);
+	n422:
+		return(tree_6_leaves[207]);
+	n366:
+		if (x[6] > -5.89310755528903926e-02) goto n424;
+		goto n423;
+	n423:
+		return(tree_6_leaves[208]);
+	n424:
+		if (x[6] > -4.35613929027501498e-02) goto n464;
+		goto n463;
+	n463:
+		if (x[5] > 5.70212899461750716e-02) goto n500;
+		goto n499;
+	n499:
+		return(tree_6_leaves[209]);
+	n500:
+		return(tree_6_leaves[210]);
+	n464:
+		return(tree_6_leaves[211]);
+	n90:
+		if (x[5] > 3.46409988714348679e-02) goto n148;
+		goto n147;
+	n147:
+		return(tree_6_leaves[212]);
+	n148:
+		return(tree_6_leaves[213]);
+	n50:
+		if (x[9] > 2.00295784862757967e-02) goto n92;
+		goto n91;
+	n91:
+		return(tree_6_leaves[214]);
+	n92:
+		return(tree_6_leaves[215]);
+	n26:
+		if (x[8] > 8.21047383394998553e-02) goto n52;
+		goto n51;
+	n51:
+		if (x[2] > 3.24410612479661478e-02) goto n94;
+		goto n93;
+	n93:
+		if (x[8] > 7.04833170607711001e-02) goto n150;
+		goto n149;
+	n149:
+		if (x[7] > 5.00455967776917074e-02) goto n220;
+		goto n219;
+	n219:
+		return(tree_6_leaves[216]);
+	n220:
+		return(tree_6_leaves[217]);
+	n150:
+		if (x[4] > 8.28013011162670801e-03) goto n222;
+		goto n221;
+	n221:
+		return(tree_6_leaves[218]);
+	n222:
+		return(tree_6_leaves[219]);
+	n94:
+		if (x[3] > -9.86481835407448243e-03) goto n152;
+		goto n151;
+	n151:
+		if (x[0] > -6.63680208189493387e-02) goto n224;
+		goto n223;
+	n223:
+		return(tree_6_leaves[220]);
+	n224:
+		return(tree_6_leaves[221]);
+	n152:
+		if (x[0] > 6.50278305469536265e-03) goto n226;
+		goto n225;
+	n225:
+		if (x[4] > 9.47425752653255904e-02) goto n296;
+		goto n295;
+	n295:
+		return(tree_6_leaves[222]);
+	n296:
+		return(tree_6_leaves[223]);
+	n226:
+		return(tree_6_leaves[224]);
+	n52:
+		if (x[8] > 9.43651507041184806e-02) goto n96;
+		goto n95;
+	n95:
+		if (x[0] > 3.56162696822420119e-02) goto n154;
+		goto n153;
+	n153:
+		return(tree_6_leaves[225]);
+	n154:
+		return(tree_6_leaves[226]);
+	n96:
+		return(tree_6_leaves[227]);
+	n14:
+		if (x[8] > 1.58415108654756942e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[4] > -2.58427891079492517e-02) goto n54;
+		goto n53;
+	n53:
+		if (x[2] > 9.26468421512243595e-02) goto n98;
+		goto n97;
+	n97:
+		if (x[5] > -1.78290705962298630e-02) goto n156;
+		goto n155;
+	n155:
+		if (x[0] > 3.32048731780552817e-02) goto n228;
+		goto n227;
+	n227:
+		return(tree_6_leaves[228]);
+	n228:
+		return(tree_6_leaves[229]);
+	n156:
+		if (x[5] > -7.54404246661145514e-03) goto n230;
+		goto n229;
+	n229:
+		return(tree_6_leaves[230]);
+	n230:
+		return(tree_6_leaves[231]);
+	n98:
+		if (x[8] > 8.78078408336117541e-04) goto n158;
+		goto n157;
+	n157:
+		return(tree_6_leaves[232]);
+	n158:
+		return(tree_6_leaves[233]);
+	n54:
+		if (x[3] > 4.48619259912733589e-02) goto n100;
+		goto n99;
+	n99:
+		return(tree_6_leaves[234]);
+	n100:
+		if (x[5] > 1.24011657596053929e-02) goto n160;
+		goto n159;
+	n159:
+		if (x[5] > -1.35860824313160777e-02) goto n232;
+		goto n231;
+	n231:
+		return(tree_6_leaves[235]);
+	n232:
+		return(tree_6_leaves[236]);
+	n160:
+		if (x[3] > 7.49819669242105663e-02) goto n234;
+		goto n233;
+	n233:
+		if (x[6] > -4.76670557963337418e-02) goto n298;
+		goto n297;
+	n297:
+		return(tree_6_leaves[237]);
+	n298:
+		if (x[2] > -9.65287151463177073e-04) goto n368;
+		goto n367;
+	n367:
+		return(tree_6_leaves[238]);
+	n368:
+		return(tree_6_leaves[239]);
+	n234:
+		return(tree_6_leaves[240]);
+	n28:
+		if (x[3] > 5.06547113762378029e-02) goto n56;
+		goto n55;
+	n55:
+		if (x[9] > -5.15922150059659052e-03) goto n102;
+		goto n101;
+	n101:
+		if (x[4] > 4.73508825678328749e-03) goto n162;
+		goto n161;
+	n161:
+		return(tree_6_leaves[241]);
+	n162:
+		return(tree_6_leaves[242]);
+	n102:
+		if (x[8] > 6.33937066161091994e-02) goto n164;
+		goto n163;
+	n163:
+		if (x[8] > 5.06298213069532044e-02) goto n236;
+		goto n235;
+	n235:
+		if (x[8] > 4.30946207416970997e-02) goto n300;
+		goto n299;
+	n299:
+		if (x[9] > 3.26515577000178747e-02) goto n370;
+		goto n369;
+	n369:
+		return(tree_6_leaves[243]);
+	n370:
+		if (x[1] > -3.56106582389457138e-02) goto n426;
+		goto n425;
+	n425:
+		return(tree_6_leaves[244]);
+	n426:
+		return(tree_6_leaves[245]);
+	n300:
+		if (x[3] > 4.24448281200662525e-02) goto n372;
+		goto n371;
+	n371:
+		if (x[7] > 1.57790854735615424e-02) goto n428;
+		goto n427;
+	n427:
+		return(tree_6_leaves[246]);
+	n428:
+		return(tree_6_leaves[247]);
+	n372:
+		return(tree_6_leaves[248]);
+	n236:
+		if (x[8] > 6.29752486933901068e-02) goto n302;
+		goto n301;
+	n301:
+		if (x[2] > 2.66181526696225405e-02) goto n374;
+		goto n373;
+	n373:
+		if (x[3] > 3.54004933042529127e-02) goto n430;
+		goto n429;
+	n429:
+		return(tree_6_leaves[249]);
+	n430:
+		return(tree_6_leaves[250]);
+	n374:
+		return(tree_6_leaves[251]);
+	n302:
+		return(tree_6_leaves[252]);
+	n164:
+		if (x[0] > 7.38862226940344147e-02) goto n238;
+		goto n237;
+	n237:
+		if (x[7] > 9.93257640758541949e-02) goto n304;
+		goto n303;
+	n303:
+		if (x[3] > 3.54181508712807097e-02) goto n376;
+		goto n375;
+	n375:
+		return(tree_6_leaves[253]);
+	n376:
+		return(tree_6_leaves[254]);
+	n304:
+		return(tree_6_leaves[255]);
+	n238:
+		return(tree_6_leaves[256]);
+	n56:
+		if (x[0] > -4.42614276905711063e-02) goto n104;
+		goto n103;
+	n103:
+		if (x[2] > 4.90933383761235492e-02) goto n166;
+		goto n165;
+	n165:
+		if (x[8] > 3.37974835115640859e-02) goto n240;
+		goto n239;
+	n239:
+		return(tree_6_leaves[257]);
+	n240:
+		return(tree_6_leaves[258]);
+	n166:
+		if (x[5] > 7.99645980748620588e-02) goto n242;
+		goto n241;
+	n241:
+		return(tree_6_leaves[259]);
+	n242:
+		return(tree_6_leaves[260]);
+	n104:
+		if (x[0] > 4.01509787272565696e-04) goto n168;
+		goto n167;
+	n167:
+		if (x[3] > 5.40210293590781959e-02) goto n244;
+		goto n243;
+	n243:
+		if (x[8] > 5.13713543487012217e-02) goto n306;
+		goto n305;
+	n305:
+		return(tree_6_leaves[261]);
+	n306:
+		return(tree_6_leaves[262]);
+	n244:
+		if (x[8] > 6.99054128289035848e-02) goto n308;
+		goto n307;
+	n307:
+		if (x[5] > 4.63016095526054342e-02) goto n378;
+		goto n377;
+	n377:
+		return(tree_6_leaves[263]);
+	n378:
+		return(tree_6_leaves[264]);
+	n308:
+		if (x[8] > 7.03689858028253845e-02) goto n380;
+		goto n379;
+	n379:
+		return(tree_6_leaves[265]);
+	n380:
+		return(tree_6_leaves[266]);
+	n168:
+		if (x[0] > 7.32702731051069062e-02) goto n246;
+		goto n245;
+	n245:
+		if (x[3] > 1.01994934304608459e-01) goto n310;
+		goto n309;
+	n309:
+		if (x[8] > 5.72283078935441197e-02) goto n382;
+		goto n381;
+	n381:
+		if (x[4] > -1.24765798345903203e-02) goto n432;
+		goto n431;
+	n431:
+		if (x[3] > 6.48155512677063284e-02) goto n466;
+		goto n465;
+	n465:
+		return(tree_6_leaves[267]);
+	n466:
+		return(tree_6_leaves[268]);
+	n432:
+		if (x[0] > 5.29120696686059544e-02) goto n468;
+		goto n467;
+	n467:
+		if (x[0] > 3.85769170143841975e-02) goto n502;
+		goto n501;
+	n501:
+		if (x[8] > 5.66927357625676559e-02) goto n528;
+		goto n527;
+	n527:
+		return(tree_6_leaves[269]);
+	n528:
+		return(tree_6_leaves[270]);
+	n502:
+		return(tree_6_leaves[271]);
+	n468:
+		return(tree_6_leaves[272]);
+	n382:
+		if (x[2] > 4.21157366156093421e-02) goto n434;
+		goto n433;
+	n433:
+		if (x[8] > 1.02027810176500713e-01) goto n470;
+		goto n469;
+	n469:
+		if (x[8] > 6.76385079755558033e-02) goto n504;
+		goto n503;
+	n503:
+		return(tree_6_leaves[273]);
+	n504:
+		return(tree_6_leaves[274]);
+	n470:
+		return(tree_6_leaves[275]);
+	n434:
+		if (x[9] > 4.14368466554506515e-02) goto n472;
+		goto n471;
+	n471:
+		return(tree_6_leaves[276]);
+	n472:
+		return(tree_6_leaves[277]);
+	n310:
+		return(tree_6_leaves[278]);
+	n246:
+		if (x[9] > 1.34325965538602231e-02) goto n312;
+		goto n311;
+	n311:
+		if (x[4] > 6.03307162283736181e-02) goto n384;
+		goto n383;
+	n383:
+		return(tree_6_leaves[279]);
+	n384:
+		return(tree_6_leaves[280]);
+	n312:
+		return(tree_6_leaves[281]);
+}
+
+static const leaf_t tree_7_leaves[] = {
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.99000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.54000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.88000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.47000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.76000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.27000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.23000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.49000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.71000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.86000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.66000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_7_find_leaf(const num_t *x){
+		if (x[8] > 2.16662116403672257e-02) goto n2;
+		goto n1;
+	n1:
+		if (x[2] > 4.87949558036673663e-03) goto n4;
+		goto n3;
+	n3:
+		if (x[3] > -1.09008174584734711e-02) goto n8;
+		goto n7;
+	n7:
+		if (x[8] > 6.21463945871163475e-03) goto n16;
+		goto n15;
+	n15:
+		if (x[5] > -7.31936299321175182e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[8] > 1.01036229880349659e-04) goto n56;
+		goto n55;
+	n55:
+		if (x[2] > -5.26026729119947120e-02) goto n98;
+		goto n97;
+	n97:
+		if (x[5] > -8.47608837997610165e-02) goto n156;
+		goto n155;
+	n155:
+		return(tree_7_leaves[0]);
+	n156:
+		if (x[2] > -5.60879612687334994e-02) goto n234;
+		goto n233;
+	n233:
+		return(tree_7_leaves[1]);
+	n234:
+		return(tree_7_leaves[2]);
+	n98:
+		if (x[7] > -7.03537196765375017e-02) goto n158;
+		goto n157;
+	n157:
+		return(tree_7_leaves[3]);
+	n158:
+		return(tree_7_leaves[4]);
+	n56:
+		return(tree_7_leaves[5]);
+	n30:
+		if (x[6] > 1.61537701791854074e-02) goto n58;
+		goto n57;
+	n57:
+		if (x[0] > -5.10556786363951381e-02) goto n100;
+		goto n99;
+	n99:
+		if (x[5] > -2.22697939081204152e-02) goto n160;
+		goto n159;
+	n159:
+		if (x[8] > -1.03093966383959856e-02) goto n236;
+		goto n235;
+	n235:
+		if (x[2] > -7.20074439751190593e-02) goto n312;
+		goto n311;
+	n311:
+		if (x[2] > -7.72744720253758233e-02) goto n376;
+		goto n375;
+	n375:
+		if (x[8] > -2.20803682760876557e-02) goto n430;
+		goto n429;
+	n429:
+		return(tree_7_leaves[6]);
+	n430:
+		return(tree_7_leaves[7]);
+	n376:
+		return(tree_7_leaves[8]);
+	n312:
+		if (x[3] > -2.69566103787898907e-02) goto n378;
+		goto n377;
+	n377:
+		if (x[5] > -5.05548995999740847e-02) goto n432;
+		goto n431;
+	n431:
+		return(tree_7_leaves[9]);
+	n432:
+		return(tree_7_leaves[10]);
+	n378:
+		if (x[8] > -6.78097019548386248e-02) goto n434;
+		goto n433;
+	n433:
+		return(tree_7_leaves[11]);
+	n434:
+		return(tree_7_leaves[12]);
+	n236:
+		if (x[6] > 6.06432269736700662e-03) goto n314;
+		goto n313;
+	n313:
+		return(tree_7_leaves[13]);
+	n314:
+		return(tree_7_leaves[14]);
+	n160:
+		if (x[5] > 2.15400733322310065e-02) goto n238;
+		goto n237;
+	n237:
+		if (x[4] > 1.32728386009170712e-03) goto n316;
+		goto n315;
+	n315:
+		if (x[2] > -3.44469510251807290e-02) goto n380;
+		goto n379;
+	n379:
+		return(tree_7_leaves[15]);
+	n380:
+		return(tree_7_leaves[16]);
+	n316:
+		return(tree_7_leaves[17]);
+	n238:
+		return(tree_7_leaves[18]);
+	n100:
+		if (x[0] > 8.05476011957195898e-02) goto n162;
+		goto n161;
+	n161:
+		if (x[0] > 3.86521281559285904e-02) goto n240;
+		goto n239;
+	n239:
+		if (x[0] > -3.45713458164741277e-02) goto n318;
+		goto n317;
+	n317:
+		if (x[4] > -4.40845371049555373e-02) goto n382;
+		goto n381;
+	n381:
+		if (x[4] > -5.03199094959217441e-02) goto n436;
+		goto n435;
+	n435:
+		return(tree_7_leaves[19]);
+	n436:
+		return(tree_7_leaves[20]);
+	n382:
+		if (x[6] > -2.44493470800027438e-02) goto n438;
+		goto n437;
+	n437:
+		if (x[6] > -3.18621619166660694e-02) goto n462;
+		goto n461;
+	n461:
+		return(tree_7_leaves[21]);
+	n462:
+		return(tree_7_leaves[22]);
+	n438:
+		if (x[3] > -2.11923175857712601e-02) goto n464;
+		goto n463;
+	n463:
+		return(tree_7_leaves[23]);
+	n464:
+		return(tree_7_leaves[24]);
+	n318:
+		if (x[8] > -5.71365822635872614e-02) goto n384;
+		goto n383;
+	n383:
+		return(tree_7_leaves[25]);
+	n384:
+		if (x[2] > -1.89269506243571126e-02) goto n440;
+		goto n439;
+	n439:
+		if (x[9] > -2.00830163439149820e-03) goto n466;
+		goto n465;
+	n465:
+		if (x[9] > -3.61068389486201777e-02) goto n486;
+		goto n485;
+	n485:
+		if (x[8] > -3.77079192968791874e-02) goto n506;
+		goto n505;
+	n505:
+		if (x[9] > -4.01278453542395358e-02) goto n522;
+		goto n521;
+	n521:
+		return(tree_7_leaves[26]);
+	n522:
+		return(tree_7_leaves[27]);
+	n506:
+		return(tree_7_leaves[28]);
+	n486:
+		if (x[5] > -2.75730236509685797e-02) goto n508;
+		goto n507;
+	n507:
+		return(tree_7_leaves[29]);
+	n508:
+		return(tree_7_leaves[30]);
+	n466:
+		if (x[0] > 1.82512874249943745e-03) goto n488;
+		goto n487;
+	n487:
+		return(tree_7_leaves[31]);
+	n488:
+		if (x[2] > -3.18827398236296577e-02) goto n510;
+		goto n509;
+	n509:
+		return(tree_7_leaves[32]);
+	n510:
+		return(tree_7_leaves[33]);
+	n440:
+		if (x[9] > 1.43745657417854306e-02) goto n468;
+		goto n467;
+	n467:
+		if (x[6] > -1.26524593497256629e-02) goto n490;
+		goto n489;
+	n489:
+		return(tree_7_leaves[34]);
+	n490:
+		return(tree_7_leaves[35]);
+	n468:
+		return(tree_7_leaves[36]);
+	n240:
+		if (x[4] > -2.65602423844093875e-02) goto n320;
+		goto n319;
+	n319:
+		if (x[5] > -3.17919567961148369e-02) goto n386;
+		goto n385;
+	n385:
+		return(tree_7_leaves[37]);
+	n386:
+		return(tree_7_leaves[38]);
+	n320:
+		if (x[4] > -4.01773140898097937e-03) goto n388;
+		goto n387;
+	n387:
+		if (x[3] > -4.31218860227814138e-02) goto n442;
+		goto n441;
+	n441:
+		return(tree_7_leaves[39]);
+	n442:
+		return(tree_7_leaves[40]);
+	n388:
+		return(tree_7_leaves[41]);
+	n162:
+		return(tree_7_leaves[42]);
+	n58:
+		if (x[5] > -5.43255971014407410e-02) goto n102;
+		goto n101;
+	n101:
+		if (x[9] > -9.77401000870225384e-02) goto n164;
+		goto n163;
+	n163:
+		return(tree_7_leaves[43]);
+	n164:
+		if (x[3] > -3.04551765172013447e-02) goto n242;
+		goto n241;
+	n241:
+		if (x[8] > -6.48807529564520147e-02) goto n322;
+		goto n321;
+	n321:
+		return(tree_7_leaves[44]);
+	n322:
+		return(tree_7_leaves[45]);
+	n242:
+		return(tree_7_leaves[46]);
+	n102:
+		if (x[0] > 4.33968558412985358e-02) goto n166;
+		goto n165;
+	n165:
+		if (x[8] > -1.04697317315101485e-01) goto n244;
+		goto n243;
+	n243:
+		return(tree_7_leaves[47]);
+	n244:
+		if (x[8] > -5.28906007889096558e-02) goto n324;
+		goto n323;
+	n323:
+		if (x[9] > -4.19087714959770763e-02) goto n390;
+		goto n389;
+	n389:
+		if (x[6] > 8.16609393555678686e-02) goto n444;
+		goto n443;
+	n443:
+		if (x[7] > -5.14227045937719757e-02) goto n470;
+		goto n469;
+	n469:
+		return(tree_7_leaves[48]);
+	n470:
+		if (x[0] > -1.76874845049097666e-03) goto n492;
+		goto n491;
+	n491:
+		if (x[4] > -1.33966632822500181e-02) goto n512;
+		goto n511;
+	n511:
+		return(tree_7_leaves[49]);
+	n512:
+		return(tree_7_leaves[50]);
+	n492:
+		if (x[0] > 1.84335017428322138e-02) goto n514;
+		goto n513;
+	n513:
+		return(tree_7_leaves[51]);
+	n514:
+		return(tree_7_leaves[52]);
+	n444:
+		if (x[8] > -6.95474955504806619e-02) goto n472;
+		goto n471;
+	n471:
+		return(tree_7_leaves[53]);
+	n472:
+		return(tree_7_leaves[54]);
+	n390:
+		if (x[2] > -5.71026671546241357e-02) goto n446;
+		goto n445;
+	n445:
+		if (x[0] > -3.51458496117148730e-02) goto n474;
+		goto n473;
+	n473:
+		return(tree_7_leaves[55]);
+	n474:
+		return(tree_7_leaves[56]);
+	n446:
+		if (x[2] > -7.91742329910292454e-03) goto n476;
+		goto n475;
+	n475:
+		if (x[0] > -4.98153294337224592e-02) goto n494;
+		goto n493;
+	n493:
+		return(tree_7_leaves[57]);
+	n494:
+		return(tree_7_leaves[58]);
+	n476:
+		return(tree_7_leaves[59]);
+	n324:
+		if (x[4] > -2.95453624477224931e-02) goto n392;
+		goto n391;
+	n391:
+		return(tree_7_leaves[60]);
+	n392:
+		if (x[9] > 1.55151060672819672e-02) goto n448;
+		goto n447;
+	n447:
+		if (x[2] > -6.89960357851646389e-02) goto n478;
+		goto n477;
+	n477:
+		if (x[2] > -7.33756524392295828e-02) goto n496;
+		goto n495;
+	n495:
+		return(tree_7_leaves[61]);
+	n496:
+		return(tree_7_leaves[62]);
+	n478:
+		if (x[2] > -7.01627846200855720e-03) goto n498;
+		goto n497;
+	n497:
+		if (x[7] > -4.54244387977162586e-02) goto n516;
+		goto n515;
+	n515:
+		if (x[4] > -2.46691962609175367e-03) goto n524;
+		goto n523;
+	n523:
+		return(tree_7_leaves[63]);
+	n524:
+		return(tree_7_leaves[64]);
+	n516:
+		if (x[5] > 8.22532948608483139e-02) goto n526;
+		goto n525;
+	n525:
+		if (x[9] > -2.44501055415748542e-02) goto n528;
+		goto n527;
+	n527:
+		if (x[1] > 4.96918265480232671e-02) goto n530;
+		goto n529;
+	n529:
+		return(tree_7_leaves[65]);
+	n530:
+		return(tree_7_leaves[66]);
+	n528:
+		if (x[1] > -2.24934719212304055e-02) goto n532;
+		goto n531;
+	n531:
+		return(tree_7_leaves[67]);
+	n532:
+		return(tree_7_leaves[68]);
+	n526:
+		return(tree_7_leaves[69]);
+	n498:
+		return(tree_7_leaves[70]);
+	n448:
+		if (x[9] > 2.97923851698567582e-02) goto n480;
+		goto n479;
+	n479:
+		if (x[6] > 5.04458035323097700e-02) goto n500;
+		goto n499;
+	n499:
+		return(tree_7_leaves[71]);
+	n500:
+		return(tree_7_leaves[72]);
+	n480:
+		return(tree_7_leaves[73]);
+	n166:
+		return(tree_7_leaves[74]);
+	n16:
+		if (x[9] > -3.20949871197808920e-03) goto n32;
+		goto n31;
+	n31:
+		if (x[6] > -5.86265103472998830e-02) goto n60;
+		goto n59;
+	n59:
+		return(tree_7_leaves[75]);
+	n60:
+		if (x[4] > -1.66036307135199596e-02) goto n104;
+		goto n103;
+	n103:
+		return(tree_7_leaves[76]);
+	n104:
+		if (x[9] > -3.00662059135187246e-02) goto n168;
+		goto n167;
+	n167:
+		if (x[6] > -3.58859762361649626e-02) goto n246;
+		goto n245;
+	n245:
+		return(tree_7_leaves[77]);
+	n246:
+		return(tree_7_leaves[78]);
+	n168:
+		return(tree_7_leaves[79]);
+	n32:
+		if (x[7] > 3.57739268516118203e-02) goto n62;
+		goto n61;
+	n61:
+		if (x[7] > -2.22136562530014167e-02) goto n106;
+		goto n105;
+	n105:
+		return(tree_7_leaves[80]);
+	n106:
+		if (x[5] > 2.61373626973742078e-02) goto n170;
+		goto n169;
+	n169:
+		return(tree_7_leaves[81]);
+	n170:
+		return(tree_7_leaves[82]);
+	n62:
+		return(tree_7_leaves[83]);
+	n8:
+		if (x[5] > -4.74794204686150786e-02) goto n18;
+		goto n17;
+	n17:
+		if (x[5] > -6.30115046139326368e-02) goto n34;
+		goto n33;
+	n33:
+		if (x[1] > 2.00882689302235087e-02) goto n64;
+		goto n63;
+	n63:
+		return(tree_7_leaves[84]);
+	n64:
+		return(tree_7_leaves[85]);
+	n34:
+		if (x[1] > -1.65593803509820371e-02) goto n66;
+		goto n65;
+	n65:
+		if (x[9] > 1.79724343753663932e-02) goto n108;
+		goto n107;
+	n107:
+		if (x[8] > -1.63366293093321971e-02) goto n172;
+		goto n171;
+	n171:
+		return(tree_7_leaves[86]);
+	n172:
+		return(tree_7_leaves[87]);
+	n108:
+		if (x[8] > -7.10261567541488753e-02) goto n174;
+		goto n173;
+	n173:
+		return(tree_7_leaves[88]);
+	n174:
+		return(tree_7_leaves[89]);
+	n66:
+		if (x[0] > -1.16917068619986891e-02) goto n110;
+		goto n109;
+	n109:
+		return(tree_7_leaves[90]);
+	n110:
+		return(tree_7_leaves[91]);
+	n18:
+		if (x[1] > 2.04116170885192613e-02) goto n36;
+		goto n35;
+	n35:
+		if (x[0] > 2.00586414139040103e-02) goto n68;
+		goto n67;
+	n67:
+		if (x[5] > -9.04309570912411806e-03) goto n112;
+		goto n111;
+	n111:
+		if (x[8] > -2.79497577813267659e-02) goto n176;
+		goto n175;
+	n175:
+		if (x[7] > -3.59861744174059389e-03) goto n248;
+		goto n247;
+	n247:
+		return(tree_7_leaves[92]);
+	n248:
+		return(tree_7_leaves[93]);
+	n176:
+		return(tree_7_leaves[94]);
+	n112:
+		if (x[4] > 6.08434693214809311e-03) goto n178;
+		goto n177;
+	n177:
+		if (x[5] > 1.08656964332062324e-02) goto n250;
+		goto n249;
+	n249:
+		if (x[2] > -3.60084916681913877e-02) goto n326;
+		goto n325;
+	n325:
+		return(tree_7_leaves[95]);
+	n326:
+		if (x[6] > 2.24023043918510148e-02) goto n394;
+		goto n393;
+	n393:
+		return(tree_7_leaves[96]);
+	n394:
+		return(tree_7_leaves[97]);
+	n250:
+		return(tree_7_leaves[98]);
+	n178:
+		if (x[2] > -5.18535625203862954e-02) goto n252;
+		goto n251;
+	n251:
+		return(tree_7_leaves[99]);
+	n252:
+		if (x[2] > -1.95963829193934388e-02) goto n328;
+		goto n327;
+	n327:
+		return(tree_7_leaves[100]);
+	n328:
+		return(tree_7_leaves[101]);
+	n68:
+		if (x[8] > -9.60096685704511094e-03) goto n114;
+		goto n113;
+	n113:
+		if (x[6] > 1.47930602971644176e-01) goto n180;
+		goto n179;
+	n179:
+		if (x[3] > -6.84139646061073144e-03) goto n254;
+		goto n253;
+	n253:
+		return(tree_7_leaves[102]);
+	n254:
+		if (x[4] > -2.35014177966642824e-03) goto n330;
+		goto n329;
+	n329:
+		return(tree_7_leaves[103]);
+	n330:
+		return(tree_7_leaves[104]);
+	n180:
+		return(tree_7_leaves[105]);
+	n114:
+		if (x[0] > 6.70748929363382679e-02) goto n182;
+		goto n181;
+	n181:
+		return(tree_7_leaves[106]);
+	n182:
+		return(tree_7_leaves[107]);
+	n36:
+		if (x[9] > 1.65051482387910779e-02) goto n70;
+		goto n69;
+	n69:
+		if (x[5] > -1.65368619248047154e-02) goto n116;
+		goto n115;
+	n115:
+		if (x[3] > -3.32271645268076600e-03) goto n184;
+		goto n183;
+	n183:
+		if (x[9] > -1.98663829272709772e-02) goto n256;
+		goto n255;
+	n255:
+		return(tree_7_leaves[108]);
+	n256:
+		return(tree_7_leaves[109]);
+	n184:
+		if (x[8] > -3.45474960629522029e-02) goto n258;
+		goto n257;
+	n257:
+		return(tree_7_leaves[110]);
+	n258:
+		if (x[7] > 2.94466732902138595e-02) goto n332;
+		goto n331;
+	n331:
+		if (x[6] > 3.11365243980624221e-02) goto n396;
+		goto n395;
+	n395:
+		if (x[0] > -7.41800778137070987e-02) goto n450;
+		goto n449;
+	n449:
+		return(tree_7_leaves[111]);
+	n450:
+		return(tree_7_leaves[112]);
+	n396:
+		if (x[4] > -2.61473040385197183e-02) goto n452;
+		goto n451;
+	n451:
+		return(tree_7_leaves[113]);
+	n452:
+		return(tree_7_leaves[114]);
+	n332:
+		return(tree_7_leaves[115]);
+	n116:
+		if (x[4] > 5.58073639550942988e-04) goto n186;
+		goto n185;
+	n185:
+		if (x[5] > 5.97026199311242491e-03) goto n260;
+		goto n259;
+	n259:
+		if (x[8] > -2.24105158391201403e-02) goto n334;
+		goto n333;
+	n333:
+		return(tree_7_leaves[116]);
+	n334:
+		return(tree_7_leaves[117]);
+	n260:
+		return(tree_7_leaves[118]);
+	n186:
+		if (x[0] > 6.23550765082953526e-02) goto n262;
+		goto n261;
+	n261:
+		return(tree_7_leaves[119]);
+	n262:
+		if (x[8] > -3.81354720501503180e-02) goto n336;
+		goto n335;
+	n335:
+		return(tree_7_leaves[120]);
+	n336:
+		return(tree_7_leaves[121]);
+	n70:
+		if (x[0] > 2.34646473350957410e-02) goto n118;
+		goto n117;
+	n117:
+		if (x[6] > 2.18362002329163980e-02) goto n188;
+		goto n187;
+	n187:
+		if (x[3] > -2.33139398348486144e-03) goto n264;
+		goto n263;
+	n263:
+		return(tree_7_leaves[122]);
+	n264:
+		return(tree_7_leaves[123]);
+	n188:
+		if (x[5] > 2.93900948498307252e-02) goto n266;
+		goto n265;
+	n265:
+		return(tree_7_leaves[124]);
+	n266:
+		return(tree_7_leaves[125]);
+	n118:
+		if (x[3] > 6.26526002289440245e-03) goto n190;
+		goto n189;
+	n189:
+		return(tree_7_leaves[126]);
+	n190:
+		if (x[2] > -9.74031338700102021e-03) goto n268;
+		goto n267;
+	n267:
+		return(tree_7_leaves[127]);
+	n268:
+		return(tree_7_leaves[128]);
+	n4:
+		if (x[3] > 2.85409831598425028e-02) goto n10;
+		goto n9;
+	n9:
+		if (x[0] > -7.77922316146680559e-02) goto n20;
+		goto n19;
+	n19:
+		if (x[8] > -1.87801545240738471e-02) goto n38;
+		goto n37;
+	n37:
+		return(tree_7_leaves[129]);
+	n38:
+		return(tree_7_leaves[130]);
+	n20:
+		if (x[8] > 3.46045672981469500e-04) goto n40;
+		goto n39;
+	n39:
+		if (x[4] > -3.24027281886802021e-02) goto n72;
+		goto n71;
+	n71:
+		if (x[6] > -2.74603612725474698e-03) goto n120;
+		goto n119;
+	n119:
+		if (x[9] > -2.52004375456630868e-02) goto n192;
+		goto n191;
+	n191:
+		if (x[2] > 1.79349717224206902e-02) goto n270;
+		goto n269;
+	n269:
+		if (x[4] > -7.04022852095389506e-02) goto n338;
+		goto n337;
+	n337:
+		return(tree_7_leaves[131]);
+	n338:
+		if (x[6] > -1.59612321188335980e-02) goto n398;
+		goto n397;
+	n397:
+		return(tree_7_leaves[132]);
+	n398:
+		return(tree_7_leaves[133]);
+	n270:
+		return(tree_7_leaves[134]);
+	n192:
+		return(tree_7_leaves[135]);
+	n120:
+		if (x[3] > -4.00980858556062511e-02) goto n194;
+		goto n193;
+	n193:
+		return(tree_7_leaves[136]);
+	n194:
+		return(tree_7_leaves[137]);
+	n72:
+		if (x[2] > 3.98972379884822356e-02) goto n122;
+		goto n121;
+	n121:
+		if (x[3] > -4.86861292721567987e-02) goto n196;
+		goto n195;
+	n195:
+		return(tree_7_leaves[138]);
+	n196:
+		if (x[4] > 1.55946551640994205e-02) goto n272;
+		goto n271;
+	n271:
+		if (x[9] > -4.09846709707702428e-02) goto n340;
+		goto n339;
+	n339:
+		return(tree_7_leaves[139]);
+	n340:
+		return(tree_7_leaves[140]);
+	n272:
+		return(tree_7_leaves[141]);
+	n122:
+		if (x[3] > -5.36215540649171568e-02) goto n198;
+		goto n197;
+	n197:
+		if (x[8] > -3.78629196104729657e-02) goto n274;
+		goto n273;
+	n273:
+		return(tree_7_leaves[142]);
+	n274:
+		if (x[6] > -3.63246019619921229e-02) goto n342;
+		goto n341;
+	n341:
+		return(tree_7_leaves[143]);
+	n342:
+		return(tree_7_leaves[144]);
+	n198:
+		if (x[4] > -1.29870880300504959e-02) goto n276;
+		goto n275;
+	n275:
+		if (x[7] > -3.40144436582189708e-03) goto n344;
+		goto n343;
+	n343:
+		return(tree_7_leaves[145]);
+	n344:
+		return(tree_7_leaves[146]);
+	n276:
+		if (x[0] > -4.52671037155825545e-02) goto n346;
+		goto n345;
+	n345:
+		return(tree_7_leaves[147]);
+	n346:
+		if (x[8] > -3.64341843183280181e-02) goto n400;
+		goto n399;
+	n399:
+		if (x[9] > 1.33648142897814376e-02) goto n454;
+		goto n453;
+	n453:
+		return(tree_7_leaves[148]);
+	n454:
+		return(tree_7_leaves[149]);
+	n400:
+		return(tree_7_leaves[150]);
+	n40:
+		if (x[9] > 3.38309569898980825e-02) goto n74;
+		goto n73;
+	n73:
+		if (x[9] > -2.73123310319952316e-03) goto n124;
+		goto n123;
+	n123:
+		if (x[8] > 3.11467007241793747e-03) goto n200;
+		goto n199;
+	n199:
+		return(tree_7_leaves[151]);
+	n200:
+		if (x[7] > 1.63872889760091484e-02) goto n278;
+		goto n277;
+	n277:
+		return(tree_7_leaves[152]);
+	n278:
+		return(tree_7_leaves[153]);
+	n124:
+		if (x[5] > 2.07033522641951150e-02) goto n202;
+		goto n201;
+	n201:
+		if (x[4] > -3.35985637352075456e-02) goto n280;
+		goto n279;
+	n279:
+		return(tree_7_leaves[154]);
+	n280:
+		if (x[0] > 5.94942735288002886e-02) goto n348;
+		goto n347;
+	n347:
+		if (x[0] > -3.39985124293956387e-02) goto n402;
+		goto n401;
+	n401:
+		return(tree_7_leaves[155]);
+	n402:
+		return(tree_7_leaves[156]);
+	n348:
+		return(tree_7_leaves[157]);
+	n202:
+		if (x[0] > 2.96361340113965310e-02) goto n282;
+		goto n281;
+	n281:
+		return(tree_7_leaves[158]);
+	n282:
+		if (x[9] > 6.28458348649843165e-03) goto n350;
+		goto n349;
+	n349:
+		return(tree_7_leaves[159]);
+	n350:
+		if (x[3] > 6.54394961799922847e-03) goto n404;
+		goto n403;
+	n403:
+		return(tree_7_leaves[160]);
+	n404:
+		return(tree_7_leaves[161]);
+	n74:
+		if (x[6] > -2.32974680637827378e-02) goto n126;
+		goto n125;
+	n125:
+		return(tree_7_leaves[162]);
+	n126:
+		return(tree_7_leaves[163]);
+	n10:
+		if (x[8] > -5.23395321639685222e-04) goto n22;
+		goto n21;
+	n21:
+		if (x[9] > -1.06307638682716747e-02) goto n42;
+		goto n41;
+	n41:
+		if (x[4] > -3.99538008280275747e-02) goto n76;
+		goto n75;
+	n75:
+		return(tree_7_leaves[164]);
+	n76:
+		return(tree_7_leaves[165]);
+	n42:
+		if (x[2] > 1.57115253499905336e-02) goto n78;
+		goto n77;
+	n77:
+		return(tree_7_leaves[166]);
+	n78:
+		if (x[9] > 5.59008507231404661e-02) goto n128;
+		goto n127;
+	n127:
+		if (x[6] > -4.79851081972438379e-02) goto n204;
+		goto n203;
+	n203:
+		return(tree_7_leaves[167]);
+	n204:
+		if (x[2] > 4.01810326518307337e-02) goto n284;
+		goto n283;
+	n283:
+		return(tree_7_leaves[168]);
+	n284:
+		return(tree_7_leaves[169]);
+	n128:
+		if (x[4] > 1.46303247348203644e-02) goto n206;
+		goto n205;
+	n205:
+		return(tree_7_leaves[170]);
+	n206:
+		return(tree_7_leaves[171]);
+	n22:
+		if (x[4] > 4.18935428437163110e-02) goto n44;
+		goto n43;
+	n43:
+		if (x[6] > -7.68255382290310151e-03) goto n80;
+		goto n79;
+	n79:
+		if (x[7] > 9.08688842206104019e-02) goto n130;
+		goto n129;
+	n129:
+		if (x[3] > 4.09836654605570047e-02) goto n208;
+		goto n207;
+	n207:
+		return(tree_7_leaves[172]);
+	n208:
+		return(tree_7_leaves[173]);
+	n130:
+		return(tree_7_leaves[174]);
+	n80:
+		if (x[6] > 1.46029571915018246e-02) goto n132;
+		goto n131;
+	n131:
+		return(tree_7_leaves[175]);
+	n132:
+		if (x[3] > 5.17545840938660670e-02) goto n210;
+		goto n209;
+	n209:
+		return(tree_7_leaves[176]);
+	n210:
+		return(tree_7_leaves[177]);
+	n44:
+		return(tree_7_leaves[178]);
+	n2:
+		if (x[2] > 1.34085616501478828e-02) goto n6;
+		goto n5;
+	n5:
+		if (x[3] > 6.24441979392274665e-02) goto n12;
+		goto n11;
+	n11:
+		if (x[6] > 2.81824739652371328e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[9] > -6.66882032311445555e-04) goto n46;
+		goto n45;
+	n45:
+		if (x[1] > 3.54981522134982172e-02) goto n82;
+		goto n81;
+	n81:
+		if (x[4] > 7.73210779899805370e-03) goto n134;
+		goto n133;
+	n133:
+		if (x[9] > -4.52467899478404198e-02) goto n212;
+		goto n211;
+	n211:
+		return(tree_7_leaves[179]);
+	n212:
+		return(tree_7_leaves[180]);
+	n134:
+		if (x[8] > 3.02909931171553015e-02) goto n214;
+		goto n213;
+	n213:
+		return(tree_7_leaves[181]);
+	n214:
+		if (x[5] > 2.86520458795861029e-02) goto n286;
+		goto n285;
+	n285:
+		return(tree_7_leaves[182]);
+	n286:
+		return(tree_7_leaves[183]);
+	n82:
+		if (x[0] > -6.70492760733421983e-02) goto n136;
+		goto n135;
+	n135:
+		return(tree_7_leaves[184]);
+	n136:
+		if (x[3] > 5.36327400584996686e-02) goto n216;
+		goto n215;
+	n215:
+		if (x[2] > 1.79587304561289727e-03) goto n288;
+		goto n287;
+	n287:
+		if (x[2] > -2.55479874599710416e-02) goto n352;
+		goto n351;
+	n351:
+		return(tree_7_leaves[185]);
+	n352:
+		if (x[3] > 2.49198359849616621e-02) goto n406;
+		goto n405;
+	n405:
+		return(tree_7_leaves[186]);
+	n406:
+		if (x[2] > -8.22575511834179249e-03) goto n456;
+		goto n455;
+	n455:
+		return(tree_7_leaves[187]);
+	n456:
+		return(tree_7_leaves[188]);
+	n288:
+		if (x[0] > 2.71446455558526159e-02) goto n354;
+		goto n353;
+	n353:
+		return(tree_7_leaves[189]);
+	n354:
+		return(tree_7_leaves[190]);
+	n216:
+		if (x[8] > 2.73881977166938531e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_7_leaves[191]);
+	n290:
+		return(tree_7_leaves[192]);
+	n46:
+		if (x[7] > 9.83309628177582717e-02) goto n84;
+		goto n83;
+	n83:
+		if (x[9] > 3.08084046445831275e-02) goto n138;
+		goto n137;
+	n137:
+		if (x[6] > -2.67936570232994963e-02) goto n218;
+		goto n217;
+	n217:
+		if (x[0] > 2.74933475419271867e-04) goto n292;
+		goto n291;
+	n291:
+		if (x[9] > 1.62550963836520096e-02) goto n356;
+		goto n355;
+	n355:
+		if (x[4] > 3.99572529224118816e-03) goto n408;
+		goto n407;
+	n407:
+		return(tree_7_leaves[193]);
+	n408:
+		return(tree_7_leaves[194]);
+	n356:
+		if (x[1] > 3.31361630364738688e-02) goto n410;
+		goto n409;
+	n409:
+		return(tree_7_leaves[195]);
+	n410:
+		return(tree_7_leaves[196]);
+	n292:
+		if (x[0] > 3.41576299877065503e-02) goto n358;
+		goto n357;
+	n357:
+		if (x[7] > 5.19466454243037168e-02) goto n412;
+		goto n411;
+	n411:
+		return(tree_7_leaves[197]);
+	n412:
+		return(tree_7_leaves[198]);
+	n358:
+		return(tree_7_leaves[199]);
+	n218:
+		if (x[6] > 4.89178695596262543e-03) goto n294;
+		goto n293;
+	n293:
+		if (x[2] > -7.56816558316280169e-02) goto n360;
+		goto n359;
+	n359:
+		return(tree_7_leaves[200]);
+	n360:
+		return(tree_7_leaves[201]);
+	n294:
+		return(tree_7_leaves[202]);
+	n138:
+		if (x[7] > 3.43878307923430188e-02) goto n220;
+		goto n219;
+	n219:
+		if (x[6] > -1.15784524949130198e-02) goto n296;
+		goto n295;
+	n295:
+		if (x[5] > -2.19257433659949576e-03) goto n362;
+		goto n361;
+	n361:
+		if (x[2] > 9.78164329080884361e-03) goto n414;
+		goto n413;
+	n413:
+		return(tree_7_leaves[203]);
+	n414:
+		return(tree_7_leaves[204]);
+	n362:
+		if (x[3] > 1.25553155176500574e-02) goto n416;
+		goto n415;
+	n415:
+		return(tree_7_leaves[205]);
+	n416:
+		return(tree_7_leaves[206]);
+	n296:
+		return(tree_7_leaves[207]);
+	n220:
+		if (x[5] > 3.68046658904796417e-02) goto n298;
+		goto n297;
+	n297:
+		return(tree_7_leaves[208]);
+	n298:
+		return(tree_7_leaves[209]);
+	n84:
+		if (x[0] > -1.23556076118389833e-02) goto n140;
+		goto n139;
+	n139:
+		return(tree_7_leaves[210]);
+	n140:
+		return(tree_7_leaves[211]);
+	n24:
+		if (x[3] > -1.00500815675652719e-03) goto n48;
+		goto n47;
+	n47:
+		if (x[5] > 5.05368721227646145e-02) goto n86;
+		goto n85;
+	n85:
+		if (x[3] > -3.79722446496580379e-03) goto n142;
+		goto n141;
+	n141:
+		return(tree_7_leaves[212]);
+	n142:
+		return(tree_7_leaves[213]);
+	n86:
+		if (x[0] > 1.13545558562478353e-02) goto n144;
+		goto n143;
+	n143:
+		return(tree_7_leaves[214]);
+	n144:
+		return(tree_7_leaves[215]);
+	n48:
+		if (x[7] > -2.31217473428991828e-02) goto n88;
+		goto n87;
+	n87:
+		return(tree_7_leaves[216]);
+	n88:
+		if (x[5] > 3.26540739159692645e-02) goto n146;
+		goto n145;
+	n145:
+		return(tree_7_leaves[217]);
+	n146:
+		return(tree_7_leaves[218]);
+	n12:
+		if (x[9] > 3.19985839453120688e-02) goto n26;
+		goto n25;
+	n25:
+		return(tree_7_leaves[219]);
+	n26:
+		if (x[6] > -6.02677803255533828e-02) goto n50;
+		goto n49;
+	n49:
+		return(tree_7_leaves[220]);
+	n50:
+		if (x[7] > -2.82149818165810806e-02) goto n90;
+		goto n89;
+	n89:
+		return(tree_7_leaves[221]);
+	n90:
+		return(tree_7_leaves[222]);
+	n6:
+		if (x[0] > -7.09210806035595193e-02) goto n14;
+		goto n13;
+	n13:
+		return(tree_7_leaves[223]);
+	n14:
+		if (x[8] > 3.79379803815556305e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[8] > 3.34488157886692131e-02) goto n52;
+		goto n51;
+	n51:
+		if (x[4] > 3.77198275776580785e-02) goto n92;
+		goto n91;
+	n91:
+		if (x[6] > -6.57951563473805068e-02) goto n148;
+		goto n147;
+	n147:
+		return(tree_7_leaves[224]);
+	n148:
+		if (x[4] > 2.34511330882287705e-02) goto n222;
+		goto n221;
+	n221:
+		return(tree_7_leaves[225]);
+	n222:
+		return(tree_7_leaves[226]);
+	n92:
+		return(tree_7_leaves[227]);
+	n52:
+		if (x[9] > 1.14179099545789163e-02) goto n94;
+		goto n93;
+	n93:
+		return(tree_7_leaves[228]);
+	n94:
+		if (x[5] > 1.67889044579290839e-03) goto n150;
+		goto n149;
+	n149:
+		return(tree_7_leaves[229]);
+	n150:
+		if (x[9] > 6.01966823940351808e-02) goto n224;
+		goto n223;
+	n223:
+		return(tree_7_leaves[230]);
+	n224:
+		return(tree_7_leaves[231]);
+	n28:
+		if (x[5] > -6.97144243803811542e-02) goto n54;
+		goto n53;
+	n53:
+		return(tree_7_leaves[232]);
+	n54:
+		if (x[6] > -2.27762053095980702e-02) goto n96;
+		goto n95;
+	n95:
+		if (x[6] > -3.63482991950475828e-02) goto n152;
+		goto n151;
+	n151:
+		if (x[8] > 4.52024087201245012e-02) goto n226;
+		goto n225;
+	n225:
+		return(tree_7_leaves[233]);
+	n226:
+		if (x[2] > 6.43775013707471172e-02) goto n300;
+		goto n299;
+	n299:
+		if (x[2] > 1.73358065694469085e-02) goto n364;
+		goto n363;
+	n363:
+		return(tree_7_leaves[234]);
+	n364:
+		if (x[3] > -5.80353292991593189e-02) goto n418;
+		goto n417;
+	n417:
+		return(tree_7_leaves[235]);
+	n418:
+		if (x[7] > 1.42441465129347106e-01) goto n458;
+		goto n457;
+	n457:
+		if (x[5] > -4.59839827292709558e-02) goto n482;
+		goto n481;
+	n481:
+		if (x[0] > 4.38933601748519100e-02) goto n502;
+		goto n501;
+	n501:
+		return(tree_7_leaves[236]);
+	n502:
+		return(tree_7_leaves[237]);
+	n482:
+		if (x[1] > -1.98319796883315407e-02) goto n504;
+		goto n503;
+	n503:
+		if (x[0] > 6.65215424028057917e-02) goto n518;
+		goto n517;
+	n517:
+		return(tree_7_leaves[238]);
+	n518:
+		return(tree_7_leaves[239]);
+	n504:
+		if (x[4] > 7.66248363024835955e-02) goto n520;
+		goto n519;
+	n519:
+		return(tree_7_leaves[240]);
+	n520:
+		return(tree_7_leaves[241]);
+	n458:
+		if (x[4] > 5.20102976332854142e-02) goto n484;
+		goto n483;
+	n483:
+		return(tree_7_leaves[242]);
+	n484:
+		return(tree_7_leaves[243]);
+	n300:
+		if (x[7] > 4.51074656151912445e-02) goto n366;
+		goto n365;
+	n365:
+		if (x[2] > 9.29989374023387633e-02) goto n420;
+		goto n419;
+	n419:
+		return(tree_7_leaves[244]);
+	n420:
+		return(tree_7_leaves[245]);
+	n366:
+		return(tree_7_leaves[246]);
+	n152:
+		if (x[8] > 6.00933142457483749e-02) goto n228;
+		goto n227;
+	n227:
+		if (x[3] > 4.00831102429545227e-02) goto n302;
+		goto n301;
+	n301:
+		return(tree_7_leaves[247]);
+	n302:
+		return(tree_7_leaves[248]);
+	n228:
+		if (x[4] > -1.27043573819768576e-02) goto n304;
+		goto n303;
+	n303:
+		return(tree_7_leaves[249]);
+	n304:
+		return(tree_7_leaves[250]);
+	n96:
+		if (x[8] > 7.08147428636852899e-02) goto n154;
+		goto n153;
+	n153:
+		if (x[0] > 1.25663333346882032e-02) goto n230;
+		goto n229;
+	n229:
+		if (x[0] > -7.72891072561427729e-03) goto n306;
+		goto n305;
+	n305:
+		if (x[3] > 5.40484243486211297e-02) goto n368;
+		goto n367;
+	n367:
+		if (x[1] > -3.20940397187658294e-02) goto n422;
+		goto n421;
+	n421:
+		return(tree_7_leaves[251]);
+	n422:
+		if (x[9] > -2.27117977076394389e-02) goto n460;
+		goto n459;
+	n459:
+		return(tree_7_leaves[252]);
+	n460:
+		return(tree_7_leaves[253]);
+	n368:
+		return(tree_7_leaves[254]);
+	n306:
+		if (x[6] > -1.29593050366936784e-02) goto n370;
+		goto n369;
+	n369:
+		return(tree_7_leaves[255]);
+	n370:
+		if (x[3] > 4.92628877085773478e-02) goto n424;
+		goto n423;
+	n423:
+		return(tree_7_leaves[256]);
+	n424:
+		return(tree_7_leaves[257]);
+	n230:
+		if (x[5] > -4.84274092781893442e-03) goto n308;
+		goto n307;
+	n307:
+		if (x[0] > 2.67357462910155080e-02) goto n372;
+		goto n371;
+	n371:
+		if (x[2] > 4.66982270598312738e-02) goto n426;
+		goto n425;
+	n425:
+		return(tree_7_leaves[258]);
+	n426:
+		return(tree_7_leaves[259]);
+	n372:
+		return(tree_7_leaves[260]);
+	n308:
+		if (x[9] > 1.24222699625263916e-02) goto n374;
+		goto n373;
+	n373:
+		if (x[0] > 5.86063187957744786e-02) goto n428;
+		goto n427;
+	n427:
+		return(tree_7_leaves[261]);
+	n428:
+		return(tree_7_leaves[262]);
+	n374:
+		return(tree_7_leaves[263]);
+	n154:
+		if (x[6] > -2.08903796631135681e-02) goto n232;
+		goto n231;
+	n231:
+		return(tree_7_leaves[264]);
+	n232:
+		if (x[0] > 3.60466966750188217e-02) goto n310;
+		goto n309;
+	n309:
+		return(tree_7_leaves[265]);
+	n310:
+		return(tree_7_leaves[266]);
+}
+
+static const leaf_t tree_8_leaves[] = {
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.54000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.89000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.84000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.87000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.67000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.93000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.76000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.49000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.66000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.26000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.88000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.86000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_8_find_leaf(const num_t *x){
+		if (x[2] > -6.30064193283679658e-03) goto n2;
+		goto n1;
+	n1:
+		if (x[8] > -9.79727407397066805e-03) goto n4;
+		goto n3;
+	n3:
+		if (x[8] > -5.28029318929023259e-02) goto n8;
+		goto n7;
+	n7:
+		if (x[0] > -8.81138919544149080e-02) goto n16;
+		goto n15;
+	n15:
+		if (x[9] > -1.31287041779599156e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[5] > -6.09429500459088627e-02) goto n56;
+		goto n55;
+	n55:
+		if (x[4] > -8.01557480310517156e-02) goto n96;
+		goto n95;
+	n95:
+		return(tree_8_leaves[0]);
+	n96:
+		return(tree_8_leaves[1]);
+	n56:
+		if (x[7] > -5.11175152867519161e-02) goto n98;
+		goto n97;
+	n97:
+		return(tree_8_leaves[2]);
+	n98:
+		return(tree_8_leaves[3]);
+	n30:
+		return(tree_8_leaves[4]);
+	n16:
+		if (x[3] > -5.01751694126643874e-02) goto n32;
+		goto n31;
+	n31:
+		if (x[9] > -6.91196262359919933e-02) goto n58;
+		goto n57;
+	n57:
+		if (x[8] > -6.08286922210041006e-02) goto n100;
+		goto n99;
+	n99:
+		return(tree_8_leaves[5]);
+	n100:
+		return(tree_8_leaves[6]);
+	n58:
+		if (x[9] > -5.43214769306120046e-02) goto n102;
+		goto n101;
+	n101:
+		if (x[5] > -9.44412908701554171e-02) goto n154;
+		goto n153;
+	n153:
+		return(tree_8_leaves[7]);
+	n154:
+		return(tree_8_leaves[8]);
+	n102:
+		if (x[3] > -6.37041748476384062e-02) goto n156;
+		goto n155;
+	n155:
+		return(tree_8_leaves[9]);
+	n156:
+		if (x[0] > -3.21976105544204763e-02) goto n234;
+		goto n233;
+	n233:
+		return(tree_8_leaves[10]);
+	n234:
+		return(tree_8_leaves[11]);
+	n32:
+		if (x[4] > -2.61903433814388506e-02) goto n60;
+		goto n59;
+	n59:
+		if (x[0] > -1.95580308868010082e-02) goto n104;
+		goto n103;
+	n103:
+		if (x[2] > -7.71967000512113616e-02) goto n158;
+		goto n157;
+	n157:
+		if (x[5] > -3.32363753774571266e-02) goto n236;
+		goto n235;
+	n235:
+		return(tree_8_leaves[12]);
+	n236:
+		return(tree_8_leaves[13]);
+	n158:
+		if (x[9] > -3.73048044474692322e-02) goto n238;
+		goto n237;
+	n237:
+		return(tree_8_leaves[14]);
+	n238:
+		if (x[0] > -8.48053759904403293e-02) goto n312;
+		goto n311;
+	n311:
+		return(tree_8_leaves[15]);
+	n312:
+		if (x[5] > -3.78899138008891231e-02) goto n374;
+		goto n373;
+	n373:
+		return(tree_8_leaves[16]);
+	n374:
+		return(tree_8_leaves[17]);
+	n104:
+		if (x[5] > -4.31605611794742758e-02) goto n160;
+		goto n159;
+	n159:
+		if (x[1] > -2.40621839291519507e-02) goto n240;
+		goto n239;
+	n239:
+		return(tree_8_leaves[18]);
+	n240:
+		return(tree_8_leaves[19]);
+	n160:
+		return(tree_8_leaves[20]);
+	n60:
+		if (x[9] > -1.93686094613730909e-02) goto n106;
+		goto n105;
+	n105:
+		if (x[0] > -2.30679540189984780e-02) goto n162;
+		goto n161;
+	n161:
+		return(tree_8_leaves[21]);
+	n162:
+		return(tree_8_leaves[22]);
+	n106:
+		if (x[5] > -9.01386347917774479e-03) goto n164;
+		goto n163;
+	n163:
+		if (x[5] > -2.03593310506832159e-02) goto n242;
+		goto n241;
+	n241:
+		return(tree_8_leaves[23]);
+	n242:
+		if (x[4] > -9.56836126706860773e-03) goto n314;
+		goto n313;
+	n313:
+		return(tree_8_leaves[24]);
+	n314:
+		return(tree_8_leaves[25]);
+	n164:
+		return(tree_8_leaves[26]);
+	n8:
+		if (x[3] > 1.30132759365013145e-01) goto n18;
+		goto n17;
+	n17:
+		if (x[6] > -8.72705483041283890e-03) goto n34;
+		goto n33;
+	n33:
+		if (x[1] > -2.28820408408672189e-02) goto n62;
+		goto n61;
+	n61:
+		if (x[0] > -4.27583747638678735e-02) goto n108;
+		goto n107;
+	n107:
+		return(tree_8_leaves[27]);
+	n108:
+		if (x[6] > -1.94894206999733366e-02) goto n166;
+		goto n165;
+	n165:
+		return(tree_8_leaves[28]);
+	n166:
+		return(tree_8_leaves[29]);
+	n62:
+		if (x[5] > -2.36699658769174842e-02) goto n110;
+		goto n109;
+	n109:
+		if (x[6] > -2.24266133274086364e-02) goto n168;
+		goto n167;
+	n167:
+		return(tree_8_leaves[30]);
+	n168:
+		return(tree_8_leaves[31]);
+	n110:
+		if (x[9] > 1.17422516608749455e-02) goto n170;
+		goto n169;
+	n169:
+		if (x[0] > 3.13827512674292736e-02) goto n244;
+		goto n243;
+	n243:
+		if (x[9] > -4.20829774648696434e-02) goto n316;
+		goto n315;
+	n315:
+		return(tree_8_leaves[32]);
+	n316:
+		return(tree_8_leaves[33]);
+	n244:
+		if (x[4] > -1.87983777078009617e-02) goto n318;
+		goto n317;
+	n317:
+		return(tree_8_leaves[34]);
+	n318:
+		return(tree_8_leaves[35]);
+	n170:
+		if (x[0] > 4.04341555082876267e-02) goto n246;
+		goto n245;
+	n245:
+		if (x[3] > -1.34658253650497411e-02) goto n320;
+		goto n319;
+	n319:
+		return(tree_8_leaves[36]);
+	n320:
+		return(tree_8_leaves[37]);
+	n246:
+		return(tree_8_leaves[38]);
+	n34:
+		if (x[0] > 3.37235798688266322e-02) goto n64;
+		goto n63;
+	n63:
+		if (x[6] > -7.04807300206508093e-04) goto n112;
+		goto n111;
+	n111:
+		if (x[5] > -4.24553713763395346e-03) goto n172;
+		goto n171;
+	n171:
+		return(tree_8_leaves[39]);
+	n172:
+		return(tree_8_leaves[40]);
+	n112:
+		if (x[2] > -1.13823176562891891e-02) goto n174;
+		goto n173;
+	n173:
+		if (x[2] > -1.43513833400068930e-02) goto n248;
+		goto n247;
+	n247:
+		if (x[3] > -7.37089701886490256e-02) goto n322;
+		goto n321;
+	n321:
+		if (x[3] > -1.10283425941707050e-01) goto n376;
+		goto n375;
+	n375:
+		return(tree_8_leaves[41]);
+	n376:
+		if (x[5] > -3.66161361188810583e-02) goto n420;
+		goto n419;
+	n419:
+		return(tree_8_leaves[42]);
+	n420:
+		return(tree_8_leaves[43]);
+	n322:
+		if (x[5] > -1.06768334632102224e-01) goto n378;
+		goto n377;
+	n377:
+		return(tree_8_leaves[44]);
+	n378:
+		if (x[4] > -5.55484844002720815e-02) goto n422;
+		goto n421;
+	n421:
+		if (x[6] > 3.42809240635117973e-02) goto n450;
+		goto n449;
+	n449:
+		if (x[6] > 3.01349265471214274e-02) goto n468;
+		goto n467;
+	n467:
+		return(tree_8_leaves[45]);
+	n468:
+		return(tree_8_leaves[46]);
+	n450:
+		return(tree_8_leaves[47]);
+	n422:
+		if (x[3] > -1.51786788585219646e-02) goto n452;
+		goto n451;
+	n451:
+		if (x[2] > -6.49226542296058723e-02) goto n470;
+		goto n469;
+	n469:
+		if (x[7] > -5.39294487187716165e-02) goto n478;
+		goto n477;
+	n477:
+		return(tree_8_leaves[48]);
+	n478:
+		if (x[2] > -7.13017181330650590e-02) goto n488;
+		goto n487;
+	n487:
+		return(tree_8_leaves[49]);
+	n488:
+		return(tree_8_leaves[50]);
+	n470:
+		if (x[2] > -6.01519178375964289e-02) goto n480;
+		goto n479;
+	n479:
+		return(tree_8_leaves[51]);
+	n480:
+		if (x[4] > 1.95155422321471421e-02) goto n490;
+		goto n489;
+	n489:
+		if (x[9] > -2.10585956962174685e-02) goto n502;
+		goto n501;
+	n501:
+		if (x[0] > -1.00276965985889824e-01) goto n510;
+		goto n509;
+	n509:
+		return(tree_8_leaves[52]);
+	n510:
+		if (x[0] > 4.72049474456216409e-03) goto n514;
+		goto n513;
+	n513:
+		if (x[0] > -3.24826512934015543e-02) goto n520;
+		goto n519;
+	n519:
+		return(tree_8_leaves[53]);
+	n520:
+		return(tree_8_leaves[54]);
+	n514:
+		return(tree_8_leaves[55]);
+	n502:
+		return(tree_8_leaves[56]);
+	n490:
+		if (x[2] > -3.33450050528217995e-02) goto n504;
+		goto n503;
+	n503:
+		return(tree_8_leaves[57]);
+	n504:
+		if (x[6] > 6.69583779893950792e-02) goto n512;
+		goto n511;
+	n511:
+		if (x[9] > -3.43722065866712695e-02) goto n516;
+		goto n515;
+	n515:
+		return(tree_8_leaves[58]);
+	n516:
+		return(tree_8_leaves[59]);
+	n512:
+		if (x[3] > -5.94111072922330341e-02) goto n518;
+		goto n517;
+	n517:
+		return(tree_8_leaves[60]);
+	n518:
+		if (x[9] > -2.64581320245377907e-02) goto n522;
+		goto n521;
+	n521:
+		return(tree_8_leaves[61]);
+	n522:
+		return(tree_8_leaves[62]);
+	n452:
+		if (x[6] > 2.39989548342448705e-02) goto n472;
+		goto n471;
+	n471:
+		if (x[0] > -1.18071238139210843e-02) goto n482;
+		goto n481;
+	n481:
+		if (x[2] > -3.17284038587450010e-02) goto n492;
+		goto n491;
+	n491:
+		return(tree_8_leaves[63]);
+	n492:
+		return(tree_8_leaves[64]);
+	n482:
+		if (x[5] > 1.55837169073007355e-02) goto n494;
+		goto n493;
+	n493:
+		return(tree_8_leaves[65]);
+	n494:
+		if (x[8] > -3.15359478679847899e-02) goto n506;
+		goto n505;
+	n505:
+		return(tree_8_leaves[66]);
+	n506:
+		return(tree_8_leaves[67]);
+	n472:
+		if (x[8] > -2.57696947494103629e-02) goto n484;
+		goto n483;
+	n483:
+		if (x[9] > -6.09407520739383007e-02) goto n496;
+		goto n495;
+	n495:
+		return(tree_8_leaves[68]);
+	n496:
+		if (x[1] > -1.71130014533778414e-02) goto n508;
+		goto n507;
+	n507:
+		return(tree_8_leaves[69]);
+	n508:
+		return(tree_8_leaves[70]);
+	n484:
+		if (x[9] > 2.27826879552584724e-02) goto n498;
+		goto n497;
+	n497:
+		return(tree_8_leaves[71]);
+	n498:
+		return(tree_8_leaves[72]);
+	n248:
+		return(tree_8_leaves[73]);
+	n174:
+		if (x[8] > -1.94788527463510656e-02) goto n250;
+		goto n249;
+	n249:
+		return(tree_8_leaves[74]);
+	n250:
+		return(tree_8_leaves[75]);
+	n64:
+		if (x[0] > 4.32175712666232822e-02) goto n114;
+		goto n113;
+	n113:
+		return(tree_8_leaves[76]);
+	n114:
+		if (x[5] > -5.80965600780923713e-02) goto n176;
+		goto n175;
+	n175:
+		return(tree_8_leaves[77]);
+	n176:
+		if (x[5] > 4.12989130850315109e-03) goto n252;
+		goto n251;
+	n251:
+		if (x[0] > 4.82477102999531865e-02) goto n324;
+		goto n323;
+	n323:
+		return(tree_8_leaves[78]);
+	n324:
+		if (x[3] > 6.18547822540422704e-02) goto n380;
+		goto n379;
+	n379:
+		return(tree_8_leaves[79]);
+	n380:
+		return(tree_8_leaves[80]);
+	n252:
+		return(tree_8_leaves[81]);
+	n18:
+		return(tree_8_leaves[82]);
+	n4:
+		if (x[8] > 2.00533149973181266e-02) goto n10;
+		goto n9;
+	n9:
+		if (x[3] > -3.08267993283023040e-02) goto n20;
+		goto n19;
+	n19:
+		if (x[6] > 6.76424429847831687e-02) goto n36;
+		goto n35;
+	n35:
+		if (x[2] > -4.34297418963899562e-02) goto n66;
+		goto n65;
+	n65:
+		return(tree_8_leaves[83]);
+	n66:
+		if (x[9] > -8.43966665639811625e-02) goto n116;
+		goto n115;
+	n115:
+		return(tree_8_leaves[84]);
+	n116:
+		if (x[2] > -4.14330901953631897e-02) goto n178;
+		goto n177;
+	n177:
+		return(tree_8_leaves[85]);
+	n178:
+		if (x[4] > -1.89313403047601629e-02) goto n254;
+		goto n253;
+	n253:
+		if (x[0] > -1.01587488022398059e-01) goto n326;
+		goto n325;
+	n325:
+		return(tree_8_leaves[86]);
+	n326:
+		return(tree_8_leaves[87]);
+	n254:
+		return(tree_8_leaves[88]);
+	n36:
+		return(tree_8_leaves[89]);
+	n20:
+		if (x[0] > 8.99714814018653941e-04) goto n38;
+		goto n37;
+	n37:
+		if (x[0] > -6.23231151896836422e-02) goto n68;
+		goto n67;
+	n67:
+		return(tree_8_leaves[90]);
+	n68:
+		if (x[5] > -2.70939771907801772e-04) goto n118;
+		goto n117;
+	n117:
+		if (x[0] > -1.40594938689490006e-02) goto n180;
+		goto n179;
+	n179:
+		if (x[6] > -5.27767166446155844e-02) goto n256;
+		goto n255;
+	n255:
+		return(tree_8_leaves[91]);
+	n256:
+		return(tree_8_leaves[92]);
+	n180:
+		return(tree_8_leaves[93]);
+	n118:
+		if (x[5] > 3.65920882702542027e-02) goto n182;
+		goto n181;
+	n181:
+		return(tree_8_leaves[94]);
+	n182:
+		if (x[9] > -2.91116093748319919e-02) goto n258;
+		goto n257;
+	n257:
+		return(tree_8_leaves[95]);
+	n258:
+		return(tree_8_leaves[96]);
+	n38:
+		if (x[6] > -1.37400768801974275e-02) goto n70;
+		goto n69;
+	n69:
+		if (x[8] > -2.22621969225360187e-03) goto n120;
+		goto n119;
+	n119:
+		return(tree_8_leaves[97]);
+	n120:
+		if (x[5] > 1.94581625400892843e-03) goto n184;
+		goto n183;
+	n183:
+		return(tree_8_leaves[98]);
+	n184:
+		if (x[9] > 2.11724266277772619e-02) goto n260;
+		goto n259;
+	n259:
+		return(tree_8_leaves[99]);
+	n260:
+		return(tree_8_leaves[100]);
+	n70:
+		if (x[3] > 2.45219254929993219e-02) goto n122;
+		goto n121;
+	n121:
+		if (x[4] > 1.31394229885460189e-03) goto n186;
+		goto n185;
+	n185:
+		return(tree_8_leaves[101]);
+	n186:
+		return(tree_8_leaves[102]);
+	n122:
+		if (x[7] > -3.17409877177021807e-02) goto n188;
+		goto n187;
+	n187:
+		return(tree_8_leaves[103]);
+	n188:
+		return(tree_8_leaves[104]);
+	n10:
+		if (x[6] > -3.05704954866861320e-05) goto n22;
+		goto n21;
+	n21:
+		if (x[5] > -2.36966211178505012e-02) goto n40;
+		goto n39;
+	n39:
+		if (x[7] > 1.30095131692934476e-02) goto n72;
+		goto n71;
+	n71:
+		return(tree_8_leaves[105]);
+	n72:
+		return(tree_8_leaves[106]);
+	n40:
+		if (x[4] > -1.25124764155945326e-02) goto n74;
+		goto n73;
+	n73:
+		return(tree_8_leaves[107]);
+	n74:
+		if (x[0] > 6.35599887219574500e-02) goto n124;
+		goto n123;
+	n123:
+		if (x[4] > -3.67252646446018620e-03) goto n190;
+		goto n189;
+	n189:
+		return(tree_8_leaves[108]);
+	n190:
+		if (x[3] > 2.31319733833401132e-02) goto n262;
+		goto n261;
+	n261:
+		if (x[7] > 4.90965620024878951e-02) goto n328;
+		goto n327;
+	n327:
+		return(tree_8_leaves[109]);
+	n328:
+		return(tree_8_leaves[110]);
+	n262:
+		if (x[7] > 4.16032623336358778e-02) goto n330;
+		goto n329;
+	n329:
+		if (x[3] > 4.74510348057983825e-02) goto n382;
+		goto n381;
+	n381:
+		return(tree_8_leaves[111]);
+	n382:
+		if (x[5] > -1.89070120318187984e-02) goto n424;
+		goto n423;
+	n423:
+		return(tree_8_leaves[112]);
+	n424:
+		if (x[7] > 2.37400366841198640e-02) goto n454;
+		goto n453;
+	n453:
+		return(tree_8_leaves[113]);
+	n454:
+		return(tree_8_leaves[114]);
+	n330:
+		return(tree_8_leaves[115]);
+	n124:
+		if (x[0] > 7.27526450800378977e-02) goto n192;
+		goto n191;
+	n191:
+		return(tree_8_leaves[116]);
+	n192:
+		return(tree_8_leaves[117]);
+	n22:
+		if (x[9] > 2.42276724281970703e-02) goto n42;
+		goto n41;
+	n41:
+		if (x[2] > -2.88292077590568858e-02) goto n76;
+		goto n75;
+	n75:
+		if (x[3] > -1.86888535001485112e-03) goto n126;
+		goto n125;
+	n125:
+		if (x[7] > -5.29850184326064594e-03) goto n194;
+		goto n193;
+	n193:
+		return(tree_8_leaves[118]);
+	n194:
+		return(tree_8_leaves[119]);
+	n126:
+		if (x[9] > -3.09826874011980696e-02) goto n196;
+		goto n195;
+	n195:
+		return(tree_8_leaves[120]);
+	n196:
+		return(tree_8_leaves[121]);
+	n76:
+		return(tree_8_leaves[122]);
+	n42:
+		return(tree_8_leaves[123]);
+	n2:
+		if (x[9] > 3.27518261272895447e-02) goto n6;
+		goto n5;
+	n5:
+		if (x[2] > 6.71236687563278728e-02) goto n12;
+		goto n11;
+	n11:
+		if (x[8] > 1.68661416892006595e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[0] > -8.89911032698654236e-02) goto n44;
+		goto n43;
+	n43:
+		return(tree_8_leaves[124]);
+	n44:
+		if (x[2] > 3.74718922874478430e-02) goto n78;
+		goto n77;
+	n77:
+		if (x[7] > -3.30541432618986289e-02) goto n128;
+		goto n127;
+	n127:
+		if (x[5] > -4.53018031254870390e-02) goto n198;
+		goto n197;
+	n197:
+		if (x[7] > -3.77731469563928265e-02) goto n264;
+		goto n263;
+	n263:
+		return(tree_8_leaves[125]);
+	n264:
+		return(tree_8_leaves[126]);
+	n198:
+		if (x[5] > 1.44221524084395137e-02) goto n266;
+		goto n265;
+	n265:
+		if (x[8] > -2.17556366134528216e-02) goto n332;
+		goto n331;
+	n331:
+		if (x[3] > 9.05774844625238523e-02) goto n384;
+		goto n383;
+	n383:
+		if (x[0] > 4.23554645636226579e-02) goto n426;
+		goto n425;
+	n425:
+		if (x[0] > -5.17198829930872253e-02) goto n456;
+		goto n455;
+	n455:
+		return(tree_8_leaves[127]);
+	n456:
+		if (x[8] > -3.88663972358076829e-02) goto n474;
+		goto n473;
+	n473:
+		if (x[4] > 9.23192927793220486e-04) goto n486;
+		goto n485;
+	n485:
+		if (x[8] > -4.14316954429848477e-02) goto n500;
+		goto n499;
+	n499:
+		return(tree_8_leaves[128]);
+	n500:
+		return(tree_8_leaves[129]);
+	n486:
+		return(tree_8_leaves[130]);
+	n474:
+		return(tree_8_leaves[131]);
+	n426:
+		if (x[3] > -2.95043792643469478e-02) goto n458;
+		goto n457;
+	n457:
+		return(tree_8_leaves[132]);
+	n458:
+		return(tree_8_leaves[133]);
+	n384:
+		return(tree_8_leaves[134]);
+	n332:
+		if (x[3] > 7.96408568413537188e-02) goto n386;
+		goto n385;
+	n385:
+		if (x[6] > 5.49202157800038615e-02) goto n428;
+		goto n427;
+	n427:
+		return(tree_8_leaves[135]);
+	n428:
+		return(tree_8_leaves[136]);
+	n386:
+		return(tree_8_leaves[137]);
+	n266:
+		if (x[0] > 5.85706081675993473e-02) goto n334;
+		goto n333;
+	n333:
+		if (x[5] > 3.55732014751395931e-02) goto n388;
+		goto n387;
+	n387:
+		return(tree_8_leaves[138]);
+	n388:
+		return(tree_8_leaves[139]);
+	n334:
+		return(tree_8_leaves[140]);
+	n128:
+		if (x[6] > -3.45266040410083103e-02) goto n200;
+		goto n199;
+	n199:
+		if (x[9] > -3.73475365737855614e-02) goto n268;
+		goto n267;
+	n267:
+		return(tree_8_leaves[141]);
+	n268:
+		if (x[9] > -6.17939508722223103e-03) goto n336;
+		goto n335;
+	n335:
+		if (x[5] > 4.61247053908622126e-02) goto n390;
+		goto n389;
+	n389:
+		return(tree_8_leaves[142]);
+	n390:
+		return(tree_8_leaves[143]);
+	n336:
+		if (x[8] > 1.49052908919364013e-02) goto n392;
+		goto n391;
+	n391:
+		if (x[2] > 1.61446747546543541e-02) goto n430;
+		goto n429;
+	n429:
+		return(tree_8_leaves[144]);
+	n430:
+		return(tree_8_leaves[145]);
+	n392:
+		return(tree_8_leaves[146]);
+	n200:
+		if (x[6] > 1.51076025745061487e-02) goto n270;
+		goto n269;
+	n269:
+		if (x[6] > 3.89520359652955391e-04) goto n338;
+		goto n337;
+	n337:
+		if (x[2] > 2.09169606126049928e-02) goto n394;
+		goto n393;
+	n393:
+		if (x[1] > 4.06989362674832558e-02) goto n432;
+		goto n431;
+	n431:
+		return(tree_8_leaves[147]);
+	n432:
+		return(tree_8_leaves[148]);
+	n394:
+		if (x[2] > 3.16565467733662328e-02) goto n434;
+		goto n433;
+	n433:
+		if (x[2] > 2.39804597818574078e-02) goto n460;
+		goto n459;
+	n459:
+		return(tree_8_leaves[149]);
+	n460:
+		return(tree_8_leaves[150]);
+	n434:
+		return(tree_8_leaves[151]);
+	n338:
+		if (x[1] > -1.80606170751626584e-02) goto n396;
+		goto n395;
+	n395:
+		return(tree_8_leaves[152]);
+	n396:
+		return(tree_8_leaves[153]);
+	n270:
+		if (x[3] > 3.99397769264435154e-02) goto n340;
+		goto n339;
+	n339:
+		return(tree_8_leaves[154]);
+	n340:
+		return(tree_8_leaves[155]);
+	n78:
+		if (x[3] > 4.34918088994189073e-02) goto n130;
+		goto n129;
+	n129:
+		if (x[2] > 5.87598490371749604e-02) goto n202;
+		goto n201;
+	n201:
+		if (x[6] > 4.43127587876143703e-02) goto n272;
+		goto n271;
+	n271:
+		if (x[8] > -4.59341212582908276e-02) goto n342;
+		goto n341;
+	n341:
+		if (x[6] > -1.66968876656821003e-02) goto n398;
+		goto n397;
+	n397:
+		return(tree_8_leaves[156]);
+	n398:
+		return(tree_8_leaves[157]);
+	n342:
+		if (x[9] > 2.49444672684338009e-02) goto n400;
+		goto n399;
+	n399:
+		if (x[8] > 5.68725322539243711e-03) goto n436;
+		goto n435;
+	n435:
+		return(tree_8_leaves[158]);
+	n436:
+		return(tree_8_leaves[159]);
+	n400:
+		return(tree_8_leaves[160]);
+	n272:
+		return(tree_8_leaves[161]);
+	n202:
+		if (x[3] > -4.24952968665981284e-02) goto n274;
+		goto n273;
+	n273:
+		if (x[3] > -5.80696406858801362e-02) goto n344;
+		goto n343;
+	n343:
+		return(tree_8_leaves[162]);
+	n344:
+		return(tree_8_leaves[163]);
+	n274:
+		if (x[6] > -1.80050178500867457e-02) goto n346;
+		goto n345;
+	n345:
+		return(tree_8_leaves[164]);
+	n346:
+		return(tree_8_leaves[165]);
+	n130:
+		if (x[3] > 8.78555576720999876e-02) goto n204;
+		goto n203;
+	n203:
+		if (x[7] > -5.86548816958927521e-03) goto n276;
+		goto n275;
+	n275:
+		return(tree_8_leaves[166]);
+	n276:
+		return(tree_8_leaves[167]);
+	n204:
+		return(tree_8_leaves[168]);
+	n24:
+		if (x[3] > 6.18570434278895506e-02) goto n46;
+		goto n45;
+	n45:
+		if (x[1] > 2.05111676121654193e-02) goto n80;
+		goto n79;
+	n79:
+		if (x[8] > 3.70809146900170153e-02) goto n132;
+		goto n131;
+	n131:
+		if (x[6] > 7.29751288336462703e-03) goto n206;
+		goto n205;
+	n205:
+		if (x[2] > 3.47679888538615020e-02) goto n278;
+		goto n277;
+	n277:
+		if (x[5] > 3.50060059640659935e-02) goto n348;
+		goto n347;
+	n347:
+		if (x[8] > 3.10439402246547209e-02) goto n402;
+		goto n401;
+	n401:
+		return(tree_8_leaves[169]);
+	n402:
+		return(tree_8_leaves[170]);
+	n348:
+		if (x[5] > 9.18477901999924518e-02) goto n404;
+		goto n403;
+	n403:
+		return(tree_8_leaves[171]);
+	n404:
+		return(tree_8_leaves[172]);
+	n278:
+		return(tree_8_leaves[173]);
+	n206:
+		if (x[3] > -4.27824377877321013e-02) goto n280;
+		goto n279;
+	n279:
+		return(tree_8_leaves[174]);
+	n280:
+		return(tree_8_leaves[175]);
+	n132:
+		if (x[2] > 2.45110730098219744e-02) goto n208;
+		goto n207;
+	n207:
+		if (x[2] > 1.71544746894862904e-02) goto n282;
+		goto n281;
+	n281:
+		if (x[2] > 8.03198279503095428e-03) goto n350;
+		goto n349;
+	n349:
+		return(tree_8_leaves[176]);
+	n350:
+		return(tree_8_leaves[177]);
+	n282:
+		return(tree_8_leaves[178]);
+	n208:
+		if (x[5] > -1.76351543351884604e-03) goto n284;
+		goto n283;
+	n283:
+		return(tree_8_leaves[179]);
+	n284:
+		if (x[3] > 1.25059246940478763e-04) goto n352;
+		goto n351;
+	n351:
+		return(tree_8_leaves[180]);
+	n352:
+		if (x[9] > 5.70282754064629568e-03) goto n406;
+		goto n405;
+	n405:
+		return(tree_8_leaves[181]);
+	n406:
+		return(tree_8_leaves[182]);
+	n80:
+		if (x[3] > -1.85291362633112702e-02) goto n134;
+		goto n133;
+	n133:
+		if (x[4] > -2.03191875085065241e-02) goto n210;
+		goto n209;
+	n209:
+		if (x[5] > -2.37722997862538435e-02) goto n286;
+		goto n285;
+	n285:
+		if (x[9] > 1.24715680024382360e-02) goto n354;
+		goto n353;
+	n353:
+		return(tree_8_leaves[183]);
+	n354:
+		return(tree_8_leaves[184]);
+	n286:
+		return(tree_8_leaves[185]);
+	n210:
+		if (x[3] > -2.63604579568076577e-02) goto n288;
+		goto n287;
+	n287:
+		if (x[3] > -6.00006211006949772e-02) goto n356;
+		goto n355;
+	n355:
+		return(tree_8_leaves[186]);
+	n356:
+		return(tree_8_leaves[187]);
+	n288:
+		if (x[7] > 7.68582921043142048e-02) goto n358;
+		goto n357;
+	n357:
+		return(tree_8_leaves[188]);
+	n358:
+		return(tree_8_leaves[189]);
+	n134:
+		if (x[8] > 2.73109832096032831e-02) goto n212;
+		goto n211;
+	n211:
+		if (x[5] > 5.65637784104803323e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_8_leaves[190]);
+	n290:
+		return(tree_8_leaves[191]);
+	n212:
+		if (x[8] > 6.29649125618255701e-02) goto n292;
+		goto n291;
+	n291:
+		if (x[7] > 5.91682518853569629e-03) goto n360;
+		goto n359;
+	n359:
+		if (x[4] > -5.08468347594590465e-03) goto n408;
+		goto n407;
+	n407:
+		return(tree_8_leaves[192]);
+	n408:
+		return(tree_8_leaves[193]);
+	n360:
+		if (x[7] > 5.16420319164705016e-02) goto n410;
+		goto n409;
+	n409:
+		if (x[4] > 3.39606792750136027e-02) goto n438;
+		goto n437;
+	n437:
+		if (x[5] > -5.74497604743069365e-03) goto n462;
+		goto n461;
+	n461:
+		return(tree_8_leaves[194]);
+	n462:
+		if (x[6] > -1.12198712853177271e-02) goto n476;
+		goto n475;
+	n475:
+		return(tree_8_leaves[195]);
+	n476:
+		return(tree_8_leaves[196]);
+	n438:
+		return(tree_8_leaves[197]);
+	n410:
+		if (x[2] > 6.98962302210550702e-03) goto n440;
+		goto n439;
+	n439:
+		return(tree_8_leaves[198]);
+	n440:
+		if (x[2] > 1.56611840325238914e-02) goto n464;
+		goto n463;
+	n463:
+		return(tree_8_leaves[199]);
+	n464:
+		return(tree_8_leaves[200]);
+	n292:
+		if (x[7] > 4.82846937779137925e-02) goto n362;
+		goto n361;
+	n361:
+		if (x[5] > -1.59708538370320827e-02) goto n412;
+		goto n411;
+	n411:
+		return(tree_8_leaves[201]);
+	n412:
+		if (x[3] > -1.10007401074363326e-02) goto n442;
+		goto n441;
+	n441:
+		return(tree_8_leaves[202]);
+	n442:
+		return(tree_8_leaves[203]);
+	n362:
+		return(tree_8_leaves[204]);
+	n46:
+		if (x[8] > 3.97745659715380562e-02) goto n82;
+		goto n81;
+	n81:
+		if (x[9] > 4.78678768169977370e-03) goto n136;
+		goto n135;
+	n135:
+		return(tree_8_leaves[205]);
+	n136:
+		return(tree_8_leaves[206]);
+	n82:
+		return(tree_8_leaves[207]);
+	n12:
+		if (x[4] > 1.75241492015873364e-02) goto n26;
+		goto n25;
+	n25:
+		if (x[4] > -4.61818835601412320e-02) goto n48;
+		goto n47;
+	n47:
+		return(tree_8_leaves[208]);
+	n48:
+		if (x[8] > -1.86306531746792715e-02) goto n84;
+		goto n83;
+	n83:
+		return(tree_8_leaves[209]);
+	n84:
+		if (x[0] > 4.71772791162516775e-02) goto n138;
+		goto n137;
+	n137:
+		if (x[9] > -1.03841410539284498e-02) goto n214;
+		goto n213;
+	n213:
+		return(tree_8_leaves[210]);
+	n214:
+		return(tree_8_leaves[211]);
+	n138:
+		return(tree_8_leaves[212]);
+	n26:
+		if (x[4] > 2.37871909126358451e-02) goto n50;
+		goto n49;
+	n49:
+		return(tree_8_leaves[213]);
+	n50:
+		if (x[7] > 4.31910319352781583e-02) goto n86;
+		goto n85;
+	n85:
+		if (x[6] > 2.18672740256164663e-03) goto n140;
+		goto n139;
+	n139:
+		return(tree_8_leaves[214]);
+	n140:
+		if (x[1] > 4.94914175155559272e-03) goto n216;
+		goto n215;
+	n215:
+		return(tree_8_leaves[215]);
+	n216:
+		return(tree_8_leaves[216]);
+	n86:
+		return(tree_8_leaves[217]);
+	n6:
+		if (x[7] > 1.45814997192453444e-01) goto n14;
+		goto n13;
+	n13:
+		if (x[5] > 2.25260408358546084e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[3] > -2.19105624227915741e-02) goto n52;
+		goto n51;
+	n51:
+		if (x[3] > -4.07062567553667168e-02) goto n88;
+		goto n87;
+	n87:
+		return(tree_8_leaves[218]);
+	n88:
+		if (x[5] > -6.25686458728049871e-02) goto n142;
+		goto n141;
+	n141:
+		return(tree_8_leaves[219]);
+	n142:
+		return(tree_8_leaves[220]);
+	n52:
+		if (x[6] > -5.75273282707546539e-03) goto n90;
+		goto n89;
+	n89:
+		if (x[9] > 9.04537242306251293e-02) goto n144;
+		goto n143;
+	n143:
+		if (x[0] > 1.77364198087385065e-02) goto n218;
+		goto n217;
+	n217:
+		if (x[9] > 3.96272977818835637e-02) goto n294;
+		goto n293;
+	n293:
+		return(tree_8_leaves[221]);
+	n294:
+		if (x[2] > 4.29023791140496630e-02) goto n364;
+		goto n363;
+	n363:
+		return(tree_8_leaves[222]);
+	n364:
+		if (x[8] > 1.01201370415796882e-01) goto n414;
+		goto n413;
+	n413:
+		if (x[0] > -4.71920043710784831e-02) goto n444;
+		goto n443;
+	n443:
+		return(tree_8_leaves[223]);
+	n444:
+		return(tree_8_leaves[224]);
+	n414:
+		return(tree_8_leaves[225]);
+	n218:
+		if (x[6] > -5.60417256721356671e-02) goto n296;
+		goto n295;
+	n295:
+		return(tree_8_leaves[226]);
+	n296:
+		if (x[2] > 7.63235810313194901e-02) goto n366;
+		goto n365;
+	n365:
+		if (x[6] > -4.51156723925535061e-02) goto n416;
+		goto n415;
+	n415:
+		return(tree_8_leaves[227]);
+	n416:
+		if (x[8] > 7.40015400457561257e-02) goto n446;
+		goto n445;
+	n445:
+		return(tree_8_leaves[228]);
+	n446:
+		if (x[9] > 6.81554923995209977e-02) goto n466;
+		goto n465;
+	n465:
+		return(tree_8_leaves[229]);
+	n466:
+		return(tree_8_leaves[230]);
+	n366:
+		if (x[0] > 2.75178394938396347e-02) goto n418;
+		goto n417;
+	n417:
+		return(tree_8_leaves[231]);
+	n418:
+		if (x[2] > 9.16446949332512112e-02) goto n448;
+		goto n447;
+	n447:
+		return(tree_8_leaves[232]);
+	n448:
+		return(tree_8_leaves[233]);
+	n144:
+		if (x[2] > 6.30951388140820746e-02) goto n220;
+		goto n219;
+	n219:
+		if (x[6] > -5.12895811208576163e-02) goto n298;
+		goto n297;
+	n297:
+		return(tree_8_leaves[234]);
+	n298:
+		if (x[3] > 4.09327070922265585e-04) goto n368;
+		goto n367;
+	n367:
+		return(tree_8_leaves[235]);
+	n368:
+		return(tree_8_leaves[236]);
+	n220:
+		return(tree_8_leaves[237]);
+	n90:
+		if (x[0] > 5.83409283707001861e-02) goto n146;
+		goto n145;
+	n145:
+		if (x[7] > -1.36159437590861396e-02) goto n222;
+		goto n221;
+	n221:
+		return(tree_8_leaves[238]);
+	n222:
+		if (x[4] > 1.16997236814021729e-02) goto n300;
+		goto n299;
+	n299:
+		return(tree_8_leaves[239]);
+	n300:
+		return(tree_8_leaves[240]);
+	n146:
+		if (x[5] > -4.64665604872408489e-02) goto n224;
+		goto n223;
+	n223:
+		return(tree_8_leaves[241]);
+	n224:
+		return(tree_8_leaves[242]);
+	n28:
+		if (x[7] > 7.60212896241592301e-02) goto n54;
+		goto n53;
+	n53:
+		if (x[3] > 8.72984585810697433e-02) goto n92;
+		goto n91;
+	n91:
+		if (x[8] > 5.02762614977113956e-02) goto n148;
+		goto n147;
+	n147:
+		if (x[3] > 9.47043197255826967e-03) goto n226;
+		goto n225;
+	n225:
+		if (x[4] > 3.50541128766984691e-02) goto n302;
+		goto n301;
+	n301:
+		return(tree_8_leaves[243]);
+	n302:
+		if (x[0] > 6.82027178728011191e-02) goto n370;
+		goto n369;
+	n369:
+		return(tree_8_leaves[244]);
+	n370:
+		return(tree_8_leaves[245]);
+	n226:
+		if (x[6] > -2.35718190855071022e-02) goto n304;
+		goto n303;
+	n303:
+		return(tree_8_leaves[246]);
+	n304:
+		return(tree_8_leaves[247]);
+	n148:
+		if (x[1] > 1.59264616357999017e-02) goto n228;
+		goto n227;
+	n227:
+		return(tree_8_leaves[248]);
+	n228:
+		if (x[6] > -4.18116553545454100e-02) goto n306;
+		goto n305;
+	n305:
+		return(tree_8_leaves[249]);
+	n306:
+		return(tree_8_leaves[250]);
+	n92:
+		return(tree_8_leaves[251]);
+	n54:
+		if (x[8] > 4.53837046230479227e-02) goto n94;
+		goto n93;
+	n93:
+		if (x[9] > 8.40307562600344227e-02) goto n150;
+		goto n149;
+	n149:
+		return(tree_8_leaves[252]);
+	n150:
+		return(tree_8_leaves[253]);
+	n94:
+		if (x[3] > 4.26401370521592438e-02) goto n152;
+		goto n151;
+	n151:
+		if (x[6] > -5.83476655915275630e-02) goto n230;
+		goto n229;
+	n229:
+		return(tree_8_leaves[254]);
+	n230:
+		return(tree_8_leaves[255]);
+	n152:
+		if (x[9] > 5.73056178177119291e-02) goto n232;
+		goto n231;
+	n231:
+		if (x[6] > -5.45744697887577471e-02) goto n308;
+		goto n307;
+	n307:
+		if (x[4] > 5.50670055795400709e-02) goto n372;
+		goto n371;
+	n371:
+		return(tree_8_leaves[256]);
+	n372:
+		return(tree_8_leaves[257]);
+	n308:
+		return(tree_8_leaves[258]);
+	n232:
+		if (x[8] > 8.42193914513300612e-02) goto n310;
+		goto n309;
+	n309:
+		return(tree_8_leaves[259]);
+	n310:
+		return(tree_8_leaves[260]);
+	n14:
+		return(tree_8_leaves[261]);
+}
+
+static const leaf_t tree_9_leaves[] = {
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.01000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.99000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.04000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.83000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.07000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.60000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{4.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.13000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.18000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.30000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.88000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.87000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.20000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{5.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.50000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.03000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.93000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.46000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.98000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.82000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.40000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.16000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.80000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.00000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.53000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.14000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.71000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{7.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.60000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{8.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.56000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.24000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.90000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.70000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.89000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.00000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.26000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.72000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.68000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.64000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.45000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.74000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.09000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.40000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.67000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.90000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.21000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.76000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.51000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.78000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.79000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.85000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.73000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.34000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.62000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.12000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.65000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.25000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.35000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.37000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.91000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.11000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.15000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.02000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.19000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{6.70000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{9.10000000000000000e+01, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.31000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.39000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.44000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.41000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.38000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.22000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.86000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.50000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.57000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.55000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.29000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.96000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.97000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.92000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.30000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.17000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.48000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.58000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.36000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.28000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.75000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.77000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.81000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.61000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.63000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.32000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.95000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.08000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.10000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.42000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.59000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.52000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.43000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{1.80000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.20000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{2.33000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+	{3.06000000000000000e+02, 0.00000000000000000e+00, 0.00000000000000000e+00},
+};
+
+static const leaf_t& tree_9_find_leaf(const num_t *x){
+		if (x[8] > -5.76695324110960538e-03) goto n2;
+		goto n1;
+	n1:
+		if (x[2] > 2.00956360717299866e-02) goto n4;
+		goto n3;
+	n3:
+		if (x[6] > 1.73650155285647104e-02) goto n8;
+		goto n7;
+	n7:
+		if (x[4] > 6.98746371079584927e-02) goto n16;
+		goto n15;
+	n15:
+		if (x[8] > -3.38268085468376237e-02) goto n30;
+		goto n29;
+	n29:
+		if (x[0] > -4.37321455942425164e-02) goto n58;
+		goto n57;
+	n57:
+		if (x[4] > -6.74604444352366744e-02) goto n94;
+		goto n93;
+	n93:
+		if (x[5] > -6.31074688478206608e-02) goto n142;
+		goto n141;
+	n141:
+		return(tree_9_leaves[0]);
+	n142:
+		return(tree_9_leaves[1]);
+	n94:
+		if (x[8] > -7.36883613952699912e-02) goto n144;
+		goto n143;
+	n143:
+		if (x[6] > -1.26336520975444296e-02) goto n202;
+		goto n201;
+	n201:
+		return(tree_9_leaves[2]);
+	n202:
+		return(tree_9_leaves[3]);
+	n144:
+		if (x[0] > -1.01307052532841196e-01) goto n204;
+		goto n203;
+	n203:
+		return(tree_9_leaves[4]);
+	n204:
+		if (x[6] > -4.72997038940545841e-04) goto n274;
+		goto n273;
+	n273:
+		return(tree_9_leaves[5]);
+	n274:
+		if (x[2] > -4.81527138532089199e-02) goto n350;
+		goto n349;
+	n349:
+		return(tree_9_leaves[6]);
+	n350:
+		if (x[0] > -7.01076390706880104e-02) goto n406;
+		goto n405;
+	n405:
+		return(tree_9_leaves[7]);
+	n406:
+		return(tree_9_leaves[8]);
+	n58:
+		if (x[0] > 7.81293688812411402e-02) goto n96;
+		goto n95;
+	n95:
+		if (x[0] > 2.76729358590635834e-02) goto n146;
+		goto n145;
+	n145:
+		if (x[5] > -5.91202976727644505e-02) goto n206;
+		goto n205;
+	n205:
+		if (x[6] > -5.96564137325796690e-03) goto n276;
+		goto n275;
+	n275:
+		if (x[4] > -7.41346904941163204e-02) goto n352;
+		goto n351;
+	n351:
+		return(tree_9_leaves[9]);
+	n352:
+		return(tree_9_leaves[10]);
+	n276:
+		return(tree_9_leaves[11]);
+	n206:
+		if (x[6] > -1.55026356600291952e-02) goto n278;
+		goto n277;
+	n277:
+		if (x[3] > -2.16781852623248728e-02) goto n354;
+		goto n353;
+	n353:
+		if (x[5] > 4.06129266303026024e-02) goto n408;
+		goto n407;
+	n407:
+		return(tree_9_leaves[12]);
+	n408:
+		return(tree_9_leaves[13]);
+	n354:
+		return(tree_9_leaves[14]);
+	n278:
+		if (x[2] > -5.71243204249534883e-02) goto n356;
+		goto n355;
+	n355:
+		if (x[2] > -6.31683665502356384e-02) goto n410;
+		goto n409;
+	n409:
+		return(tree_9_leaves[15]);
+	n410:
+		return(tree_9_leaves[16]);
+	n356:
+		if (x[9] > -5.13523071959591862e-02) goto n412;
+		goto n411;
+	n411:
+		return(tree_9_leaves[17]);
+	n412:
+		if (x[6] > -6.88925160138524791e-03) goto n454;
+		goto n453;
+	n453:
+		return(tree_9_leaves[18]);
+	n454:
+		if (x[8] > -4.40770363961669881e-02) goto n486;
+		goto n485;
+	n485:
+		return(tree_9_leaves[19]);
+	n486:
+		return(tree_9_leaves[20]);
+	n146:
+		if (x[2] > -1.83031606062440816e-02) goto n208;
+		goto n207;
+	n207:
+		if (x[9] > 2.42774118233821216e-02) goto n280;
+		goto n279;
+	n279:
+		return(tree_9_leaves[21]);
+	n280:
+		return(tree_9_leaves[22]);
+	n208:
+		return(tree_9_leaves[23]);
+	n96:
+		return(tree_9_leaves[24]);
+	n30:
+		if (x[5] > -4.73073761293711717e-02) goto n60;
+		goto n59;
+	n59:
+		if (x[2] > -2.06671609425138521e-02) goto n98;
+		goto n97;
+	n97:
+		if (x[6] > -1.56647315791622679e-02) goto n148;
+		goto n147;
+	n147:
+		return(tree_9_leaves[25]);
+	n148:
+		return(tree_9_leaves[26]);
+	n98:
+		if (x[4] > -5.19103672548048428e-02) goto n150;
+		goto n149;
+	n149:
+		if (x[2] > -1.74888766236083772e-02) goto n210;
+		goto n209;
+	n209:
+		return(tree_9_leaves[27]);
+	n210:
+		return(tree_9_leaves[28]);
+	n150:
+		return(tree_9_leaves[29]);
+	n60:
+		if (x[0] > 2.95178601318177615e-02) goto n100;
+		goto n99;
+	n99:
+		if (x[5] > 1.36154485127648259e-02) goto n152;
+		goto n151;
+	n151:
+		if (x[8] > -2.12055512880415555e-02) goto n212;
+		goto n211;
+	n211:
+		return(tree_9_leaves[30]);
+	n212:
+		if (x[3] > 3.42690056797884720e-03) goto n282;
+		goto n281;
+	n281:
+		if (x[9] > 1.25686010987054522e-03) goto n358;
+		goto n357;
+	n357:
+		if (x[3] > -8.81171122819305978e-03) goto n414;
+		goto n413;
+	n413:
+		if (x[3] > -3.80009979949921181e-02) goto n456;
+		goto n455;
+	n455:
+		return(tree_9_leaves[31]);
+	n456:
+		if (x[9] > -2.03749502660373477e-02) goto n488;
+		goto n487;
+	n487:
+		return(tree_9_leaves[32]);
+	n488:
+		return(tree_9_leaves[33]);
+	n414:
+		return(tree_9_leaves[34]);
+	n358:
+		return(tree_9_leaves[35]);
+	n282:
+		return(tree_9_leaves[36]);
+	n152:
+		if (x[8] > -7.60123352100820597e-03) goto n214;
+		goto n213;
+	n213:
+		if (x[3] > -6.59919102205165226e-02) goto n284;
+		goto n283;
+	n283:
+		if (x[5] > 7.02041026032012294e-02) goto n360;
+		goto n359;
+	n359:
+		return(tree_9_leaves[37]);
+	n360:
+		return(tree_9_leaves[38]);
+	n284:
+		if (x[2] > -3.77024108916741221e-02) goto n362;
+		goto n361;
+	n361:
+		return(tree_9_leaves[39]);
+	n362:
+		if (x[1] > -4.05886120318020432e-02) goto n416;
+		goto n415;
+	n415:
+		if (x[8] > -3.29781031797625884e-02) goto n458;
+		goto n457;
+	n457:
+		return(tree_9_leaves[40]);
+	n458:
+		if (x[8] > -3.18939948197793574e-02) goto n490;
+		goto n489;
+	n489:
+		return(tree_9_leaves[41]);
+	n490:
+		return(tree_9_leaves[42]);
+	n416:
+		return(tree_9_leaves[43]);
+	n214:
+		return(tree_9_leaves[44]);
+	n100:
+		if (x[3] > 2.26551641020855572e-02) goto n154;
+		goto n153;
+	n153:
+		if (x[4] > -2.97760093797517431e-02) goto n216;
+		goto n215;
+	n215:
+		if (x[8] > -1.68506396477732037e-02) goto n286;
+		goto n285;
+	n285:
+		return(tree_9_leaves[45]);
+	n286:
+		return(tree_9_leaves[46]);
+	n216:
+		if (x[0] > 3.32425190270368848e-02) goto n288;
+		goto n287;
+	n287:
+		return(tree_9_leaves[47]);
+	n288:
+		return(tree_9_leaves[48]);
+	n154:
+		if (x[8] > -2.68848151626246076e-02) goto n218;
+		goto n217;
+	n217:
+		return(tree_9_leaves[49]);
+	n218:
+		return(tree_9_leaves[50]);
+	n16:
+		if (x[8] > -2.00662956956981706e-02) goto n32;
+		goto n31;
+	n31:
+		return(tree_9_leaves[51]);
+	n32:
+		return(tree_9_leaves[52]);
+	n8:
+		if (x[8] > -9.14123820771227912e-03) goto n18;
+		goto n17;
+	n17:
+		if (x[4] > -7.03551556769330122e-02) goto n34;
+		goto n33;
+	n33:
+		if (x[7] > -7.24014728835885718e-02) goto n62;
+		goto n61;
+	n61:
+		if (x[0] > -7.23520821719541435e-02) goto n102;
+		goto n101;
+	n101:
+		return(tree_9_leaves[53]);
+	n102:
+		return(tree_9_leaves[54]);
+	n62:
+		return(tree_9_leaves[55]);
+	n34:
+		if (x[8] > -7.90810796054143283e-02) goto n64;
+		goto n63;
+	n63:
+		if (x[9] > -4.00528550398886116e-02) goto n104;
+		goto n103;
+	n103:
+		if (x[4] > -5.63464946370542258e-02) goto n156;
+		goto n155;
+	n155:
+		return(tree_9_leaves[56]);
+	n156:
+		if (x[9] > -4.68546621981528952e-02) goto n220;
+		goto n219;
+	n219:
+		return(tree_9_leaves[57]);
+	n220:
+		return(tree_9_leaves[58]);
+	n104:
+		if (x[5] > -2.16931982799835818e-02) goto n158;
+		goto n157;
+	n157:
+		if (x[4] > -5.74984752492674334e-03) goto n222;
+		goto n221;
+	n221:
+		if (x[2] > -3.10605596581821214e-02) goto n290;
+		goto n289;
+	n289:
+		return(tree_9_leaves[59]);
+	n290:
+		return(tree_9_leaves[60]);
+	n222:
+		return(tree_9_leaves[61]);
+	n158:
+		return(tree_9_leaves[62]);
+	n64:
+		if (x[2] > -5.84351946664465605e-02) goto n106;
+		goto n105;
+	n105:
+		if (x[0] > 4.14494679276375573e-03) goto n160;
+		goto n159;
+	n159:
+		if (x[5] > -2.13397710648086623e-02) goto n224;
+		goto n223;
+	n223:
+		if (x[2] > -6.62318484162428417e-02) goto n292;
+		goto n291;
+	n291:
+		return(tree_9_leaves[63]);
+	n292:
+		if (x[6] > 6.04778936679415055e-02) goto n364;
+		goto n363;
+	n363:
+		return(tree_9_leaves[64]);
+	n364:
+		return(tree_9_leaves[65]);
+	n224:
+		if (x[6] > 1.00780620218277064e-01) goto n294;
+		goto n293;
+	n293:
+		if (x[3] > -3.22466132012658654e-02) goto n366;
+		goto n365;
+	n365:
+		return(tree_9_leaves[66]);
+	n366:
+		if (x[6] > 3.00662839765995227e-02) goto n418;
+		goto n417;
+	n417:
+		return(tree_9_leaves[67]);
+	n418:
+		return(tree_9_leaves[68]);
+	n294:
+		return(tree_9_leaves[69]);
+	n160:
+		if (x[3] > -4.40776391406668896e-02) goto n226;
+		goto n225;
+	n225:
+		if (x[3] > -6.73867396928326257e-02) goto n296;
+		goto n295;
+	n295:
+		return(tree_9_leaves[70]);
+	n296:
+		return(tree_9_leaves[71]);
+	n226:
+		return(tree_9_leaves[72]);
+	n106:
+		if (x[2] > -4.61545334129262672e-02) goto n162;
+		goto n161;
+	n161:
+		if (x[6] > 5.74071674178999111e-02) goto n228;
+		goto n227;
+	n227:
+		if (x[8] > -4.77738242386016726e-02) goto n298;
+		goto n297;
+	n297:
+		return(tree_9_leaves[73]);
+	n298:
+		return(tree_9_leaves[74]);
+	n228:
+		if (x[2] > -4.99737267627475279e-02) goto n300;
+		goto n299;
+	n299:
+		if (x[0] > 2.27822009715666247e-02) goto n368;
+		goto n367;
+	n367:
+		return(tree_9_leaves[75]);
+	n368:
+		return(tree_9_leaves[76]);
+	n300:
+		if (x[5] > -1.02986289009258693e-02) goto n370;
+		goto n369;
+	n369:
+		return(tree_9_leaves[77]);
+	n370:
+		return(tree_9_leaves[78]);
+	n162:
+		if (x[8] > -2.52692336576943559e-02) goto n230;
+		goto n229;
+	n229:
+		if (x[8] > -3.28352746419413588e-02) goto n302;
+		goto n301;
+	n301:
+		if (x[3] > 7.74727514992259447e-02) goto n372;
+		goto n371;
+	n371:
+		if (x[5] > 7.66513001598495211e-03) goto n420;
+		goto n419;
+	n419:
+		if (x[9] > -8.95979632947244836e-03) goto n460;
+		goto n459;
+	n459:
+		if (x[4] > -4.96246804770783465e-02) goto n492;
+		goto n491;
+	n491:
+		if (x[8] > -5.13805359353486368e-02) goto n512;
+		goto n511;
+	n511:
+		if (x[0] > -5.29865774022400954e-02) goto n534;
+		goto n533;
+	n533:
+		return(tree_9_leaves[79]);
+	n534:
+		return(tree_9_leaves[80]);
+	n512:
+		if (x[9] > -1.23680626380955588e-01) goto n536;
+		goto n535;
+	n535:
+		return(tree_9_leaves[81]);
+	n536:
+		return(tree_9_leaves[82]);
+	n492:
+		if (x[4] > -2.74321427871402311e-02) goto n514;
+		goto n513;
+	n513:
+		return(tree_9_leaves[83]);
+	n514:
+		if (x[6] > 6.75968125209974458e-02) goto n538;
+		goto n537;
+	n537:
+		if (x[9] > -3.17090141986479668e-02) goto n550;
+		goto n549;
+	n549:
+		return(tree_9_leaves[84]);
+	n550:
+		return(tree_9_leaves[85]);
+	n538:
+		return(tree_9_leaves[86]);
+	n460:
+		if (x[6] > 7.78060323870762294e-02) goto n494;
+		goto n493;
+	n493:
+		if (x[1] > -4.23320620732488204e-02) goto n516;
+		goto n515;
+	n515:
+		return(tree_9_leaves[87]);
+	n516:
+		return(tree_9_leaves[88]);
+	n494:
+		if (x[8] > -5.46946620343827516e-02) goto n518;
+		goto n517;
+	n517:
+		return(tree_9_leaves[89]);
+	n518:
+		return(tree_9_leaves[90]);
+	n420:
+		if (x[9] > 3.07788300872642445e-02) goto n462;
+		goto n461;
+	n461:
+		if (x[9] > -3.15748506210486238e-02) goto n496;
+		goto n495;
+	n495:
+		return(tree_9_leaves[91]);
+	n496:
+		if (x[9] > -1.46949395830984000e-02) goto n520;
+		goto n519;
+	n519:
+		if (x[5] > 2.97320627158858888e-02) goto n540;
+		goto n539;
+	n539:
+		return(tree_9_leaves[92]);
+	n540:
+		return(tree_9_leaves[93]);
+	n520:
+		if (x[7] > 1.54172034821551621e-02) goto n542;
+		goto n541;
+	n541:
+		if (x[7] > -1.80723102681363754e-02) goto n552;
+		goto n551;
+	n551:
+		return(tree_9_leaves[94]);
+	n552:
+		return(tree_9_leaves[95]);
+	n542:
+		return(tree_9_leaves[96]);
+	n462:
+		return(tree_9_leaves[97]);
+	n372:
+		return(tree_9_leaves[98]);
+	n302:
+		if (x[2] > -3.01264268150101926e-02) goto n374;
+		goto n373;
+	n373:
+		if (x[9] > -3.49776254937917419e-02) goto n422;
+		goto n421;
+	n421:
+		if (x[2] > -3.25144151259647365e-02) goto n464;
+		goto n463;
+	n463:
+		return(tree_9_leaves[99]);
+	n464:
+		return(tree_9_leaves[100]);
+	n422:
+		return(tree_9_leaves[101]);
+	n374:
+		if (x[2] > -2.67971177274548451e-02) goto n424;
+		goto n423;
+	n423:
+		return(tree_9_leaves[102]);
+	n424:
+		if (x[7] > -9.95444722967415638e-03) goto n466;
+		goto n465;
+	n465:
+		return(tree_9_leaves[103]);
+	n466:
+		return(tree_9_leaves[104]);
+	n230:
+		if (x[6] > 7.63590514137292564e-02) goto n304;
+		goto n303;
+	n303:
+		if (x[2] > -1.76870566905094617e-02) goto n376;
+		goto n375;
+	n375:
+		if (x[4] > 3.01279020606843168e-02) goto n426;
+		goto n425;
+	n425:
+		if (x[6] > 2.83775586713496154e-02) goto n468;
+		goto n467;
+	n467:
+		return(tree_9_leaves[105]);
+	n468:
+		if (x[8] > -1.87108249119347647e-02) goto n498;
+		goto n497;
+	n497:
+		return(tree_9_leaves[106]);
+	n498:
+		return(tree_9_leaves[107]);
+	n426:
+		if (x[6] > 6.84607398059076527e-02) goto n470;
+		goto n469;
+	n469:
+		return(tree_9_leaves[108]);
+	n470:
+		return(tree_9_leaves[109]);
+	n376:
+		if (x[3] > -2.83280648060622586e-02) goto n428;
+		goto n427;
+	n427:
+		return(tree_9_leaves[110]);
+	n428:
+		return(tree_9_leaves[111]);
+	n304:
+		return(tree_9_leaves[112]);
+	n18:
+		if (x[9] > -2.00021512528047174e-02) goto n36;
+		goto n35;
+	n35:
+		return(tree_9_leaves[113]);
+	n36:
+		return(tree_9_leaves[114]);
+	n4:
+		if (x[5] > 1.74595923050015686e-02) goto n10;
+		goto n9;
+	n9:
+		if (x[6] > -2.93022328026825533e-02) goto n20;
+		goto n19;
+	n19:
+		if (x[1] > -3.90157497346039286e-02) goto n38;
+		goto n37;
+	n37:
+		return(tree_9_leaves[115]);
+	n38:
+		if (x[4] > -1.17216676112690238e-01) goto n66;
+		goto n65;
+	n65:
+		return(tree_9_leaves[116]);
+	n66:
+		return(tree_9_leaves[117]);
+	n20:
+		if (x[3] > 7.00304477362588551e-02) goto n40;
+		goto n39;
+	n39:
+		if (x[5] > -4.57492242638621524e-02) goto n68;
+		goto n67;
+	n67:
+		if (x[3] > -2.43156722384652822e-02) goto n108;
+		goto n107;
+	n107:
+		return(tree_9_leaves[118]);
+	n108:
+		return(tree_9_leaves[119]);
+	n68:
+		if (x[9] > -5.79902934513897503e-02) goto n110;
+		goto n109;
+	n109:
+		if (x[6] > 2.27097750783235748e-02) goto n164;
+		goto n163;
+	n163:
+		if (x[8] > -6.98399140064822621e-02) goto n232;
+		goto n231;
+	n231:
+		return(tree_9_leaves[120]);
+	n232:
+		return(tree_9_leaves[121]);
+	n164:
+		return(tree_9_leaves[122]);
+	n110:
+		if (x[8] > -4.67179999431880932e-02) goto n166;
+		goto n165;
+	n165:
+		if (x[6] > -1.23005901282161687e-02) goto n234;
+		goto n233;
+	n233:
+		return(tree_9_leaves[123]);
+	n234:
+		return(tree_9_leaves[124]);
+	n166:
+		if (x[0] > 4.19439004521856840e-02) goto n236;
+		goto n235;
+	n235:
+		if (x[5] > -3.96410741384409099e-02) goto n306;
+		goto n305;
+	n305:
+		return(tree_9_leaves[125]);
+	n306:
+		if (x[8] > -1.61929643200874433e-02) goto n378;
+		goto n377;
+	n377:
+		if (x[2] > 4.69036673198404142e-02) goto n430;
+		goto n429;
+	n429:
+		return(tree_9_leaves[126]);
+	n430:
+		return(tree_9_leaves[127]);
+	n378:
+		return(tree_9_leaves[128]);
+	n236:
+		return(tree_9_leaves[129]);
+	n40:
+		if (x[0] > 9.41203161242371369e-03) goto n70;
+		goto n69;
+	n69:
+		return(tree_9_leaves[130]);
+	n70:
+		return(tree_9_leaves[131]);
+	n10:
+		if (x[4] > 6.01397863866483078e-03) goto n22;
+		goto n21;
+	n21:
+		if (x[4] > -5.63309398454098220e-03) goto n42;
+		goto n41;
+	n41:
+		return(tree_9_leaves[132]);
+	n42:
+		if (x[9] > 3.16230149198921326e-02) goto n72;
+		goto n71;
+	n71:
+		if (x[9] > 8.36113335599956466e-03) goto n112;
+		goto n111;
+	n111:
+		return(tree_9_leaves[133]);
+	n112:
+		return(tree_9_leaves[134]);
+	n72:
+		return(tree_9_leaves[135]);
+	n22:
+		if (x[9] > 1.87352303403194864e-02) goto n44;
+		goto n43;
+	n43:
+		if (x[9] > 7.62342909486274974e-05) goto n74;
+		goto n73;
+	n73:
+		if (x[5] > 4.92618559831978498e-02) goto n114;
+		goto n113;
+	n113:
+		return(tree_9_leaves[136]);
+	n114:
+		return(tree_9_leaves[137]);
+	n74:
+		return(tree_9_leaves[138]);
+	n44:
+		return(tree_9_leaves[139]);
+	n2:
+		if (x[2] > 6.80751255030655755e-02) goto n6;
+		goto n5;
+	n5:
+		if (x[3] > -5.88845107402970747e-02) goto n12;
+		goto n11;
+	n11:
+		if (x[6] > -3.61253363436993616e-02) goto n24;
+		goto n23;
+	n23:
+		if (x[0] > 5.38032686849436708e-03) goto n46;
+		goto n45;
+	n45:
+		if (x[2] > -4.97151254243046667e-02) goto n76;
+		goto n75;
+	n75:
+		return(tree_9_leaves[140]);
+	n76:
+		return(tree_9_leaves[141]);
+	n46:
+		if (x[5] > 7.96216669234233870e-02) goto n78;
+		goto n77;
+	n77:
+		return(tree_9_leaves[142]);
+	n78:
+		return(tree_9_leaves[143]);
+	n24:
+		if (x[3] > -6.19764173833497259e-02) goto n48;
+		goto n47;
+	n47:
+		return(tree_9_leaves[144]);
+	n48:
+		return(tree_9_leaves[145]);
+	n12:
+		if (x[2] > -1.41003980719084064e-02) goto n26;
+		goto n25;
+	n25:
+		if (x[8] > 4.25177695762078561e-02) goto n50;
+		goto n49;
+	n49:
+		if (x[7] > -3.89854457435188997e-02) goto n80;
+		goto n79;
+	n79:
+		if (x[2] > -3.47584174424852288e-02) goto n116;
+		goto n115;
+	n115:
+		if (x[6] > 3.83718894421789733e-02) goto n168;
+		goto n167;
+	n167:
+		if (x[8] > 2.19214580060979602e-02) goto n238;
+		goto n237;
+	n237:
+		if (x[0] > -2.85294370100961994e-02) goto n308;
+		goto n307;
+	n307:
+		return(tree_9_leaves[146]);
+	n308:
+		return(tree_9_leaves[147]);
+	n238:
+		return(tree_9_leaves[148]);
+	n168:
+		if (x[7] > -6.94026730474199410e-02) goto n240;
+		goto n239;
+	n239:
+		return(tree_9_leaves[149]);
+	n240:
+		return(tree_9_leaves[150]);
+	n116:
+		if (x[3] > 3.14865804744315012e-02) goto n170;
+		goto n169;
+	n169:
+		return(tree_9_leaves[151]);
+	n170:
+		return(tree_9_leaves[152]);
+	n80:
+		if (x[0] > 1.78982295372811032e-02) goto n118;
+		goto n117;
+	n117:
+		if (x[6] > -3.24320623668504573e-02) goto n172;
+		goto n171;
+	n171:
+		if (x[9] > -4.26552801753319263e-02) goto n242;
+		goto n241;
+	n241:
+		if (x[6] > -6.72192175943197023e-02) goto n310;
+		goto n309;
+	n309:
+		return(tree_9_leaves[153]);
+	n310:
+		return(tree_9_leaves[154]);
+	n242:
+		if (x[3] > -3.51484176106919843e-02) goto n312;
+		goto n311;
+	n311:
+		return(tree_9_leaves[155]);
+	n312:
+		if (x[3] > 2.66739591849165132e-02) goto n380;
+		goto n379;
+	n379:
+		if (x[0] > -2.34296866158929182e-02) goto n432;
+		goto n431;
+	n431:
+		return(tree_9_leaves[156]);
+	n432:
+		return(tree_9_leaves[157]);
+	n380:
+		if (x[0] > -5.22514030660845424e-02) goto n434;
+		goto n433;
+	n433:
+		return(tree_9_leaves[158]);
+	n434:
+		return(tree_9_leaves[159]);
+	n172:
+		if (x[2] > -2.23643663250487554e-02) goto n244;
+		goto n243;
+	n243:
+		if (x[4] > 8.78138965443739893e-03) goto n314;
+		goto n313;
+	n313:
+		if (x[0] > 6.76469407080316359e-03) goto n382;
+		goto n381;
+	n381:
+		return(tree_9_leaves[160]);
+	n382:
+		return(tree_9_leaves[161]);
+	n314:
+		return(tree_9_leaves[162]);
+	n244:
+		return(tree_9_leaves[163]);
+	n118:
+		if (x[6] > -3.09638572124477165e-02) goto n174;
+		goto n173;
+	n173:
+		if (x[3] > 3.57487027276424535e-02) goto n246;
+		goto n245;
+	n245:
+		if (x[7] > 5.18229968562793769e-02) goto n316;
+		goto n315;
+	n315:
+		return(tree_9_leaves[164]);
+	n316:
+		return(tree_9_leaves[165]);
+	n246:
+		if (x[5] > 2.70943428445373433e-02) goto n318;
+		goto n317;
+	n317:
+		return(tree_9_leaves[166]);
+	n318:
+		return(tree_9_leaves[167]);
+	n174:
+		if (x[6] > 2.90613342330144006e-02) goto n248;
+		goto n247;
+	n247:
+		if (x[1] > 1.68300645566476087e-02) goto n320;
+		goto n319;
+	n319:
+		return(tree_9_leaves[168]);
+	n320:
+		return(tree_9_leaves[169]);
+	n248:
+		return(tree_9_leaves[170]);
+	n50:
+		if (x[6] > -2.56879076424727099e-03) goto n82;
+		goto n81;
+	n81:
+		if (x[6] > -3.24837564171705298e-02) goto n120;
+		goto n119;
+	n119:
+		if (x[3] > 7.17376965712155090e-02) goto n176;
+		goto n175;
+	n175:
+		if (x[3] > -2.11130521596646567e-02) goto n250;
+		goto n249;
+	n249:
+		return(tree_9_leaves[171]);
+	n250:
+		if (x[7] > 9.22150257354167613e-02) goto n322;
+		goto n321;
+	n321:
+		return(tree_9_leaves[172]);
+	n322:
+		return(tree_9_leaves[173]);
+	n176:
+		return(tree_9_leaves[174]);
+	n120:
+		if (x[8] > 5.87638628388086476e-02) goto n178;
+		goto n177;
+	n177:
+		return(tree_9_leaves[175]);
+	n178:
+		return(tree_9_leaves[176]);
+	n82:
+		if (x[7] > 1.33362383221044493e-02) goto n122;
+		goto n121;
+	n121:
+		return(tree_9_leaves[177]);
+	n122:
+		return(tree_9_leaves[178]);
+	n26:
+		if (x[3] > 5.78591088363535136e-02) goto n52;
+		goto n51;
+	n51:
+		if (x[6] > -4.57775213213650334e-02) goto n84;
+		goto n83;
+	n83:
+		if (x[0] > -3.47715497461072651e-02) goto n124;
+		goto n123;
+	n123:
+		if (x[2] > -6.60081053333278801e-03) goto n180;
+		goto n179;
+	n179:
+		return(tree_9_leaves[179]);
+	n180:
+		if (x[4] > -1.95643871013789564e-02) goto n252;
+		goto n251;
+	n251:
+		return(tree_9_leaves[180]);
+	n252:
+		return(tree_9_leaves[181]);
+	n124:
+		if (x[0] > 1.70164992740162932e-02) goto n182;
+		goto n181;
+	n181:
+		if (x[1] > -1.67803821690112806e-02) goto n254;
+		goto n253;
+	n253:
+		if (x[7] > 3.61106540812248106e-02) goto n324;
+		goto n323;
+	n323:
+		return(tree_9_leaves[182]);
+	n324:
+		return(tree_9_leaves[183]);
+	n254:
+		if (x[2] > 5.31090711842216179e-02) goto n326;
+		goto n325;
+	n325:
+		if (x[2] > 2.21186479092927218e-03) goto n384;
+		goto n383;
+	n383:
+		return(tree_9_leaves[184]);
+	n384:
+		if (x[7] > 5.50953433606108517e-02) goto n436;
+		goto n435;
+	n435:
+		return(tree_9_leaves[185]);
+	n436:
+		return(tree_9_leaves[186]);
+	n326:
+		return(tree_9_leaves[187]);
+	n182:
+		if (x[2] > -9.45698521680054215e-04) goto n256;
+		goto n255;
+	n255:
+		return(tree_9_leaves[188]);
+	n256:
+		if (x[5] > 4.89912659275159937e-02) goto n328;
+		goto n327;
+	n327:
+		if (x[6] > -4.85710382795373277e-02) goto n386;
+		goto n385;
+	n385:
+		if (x[3] > 3.28538912050404391e-02) goto n438;
+		goto n437;
+	n437:
+		if (x[0] > 4.58332000905755377e-02) goto n472;
+		goto n471;
+	n471:
+		if (x[3] > 2.99457991764001952e-02) goto n500;
+		goto n499;
+	n499:
+		if (x[9] > -7.61374407758443755e-03) goto n522;
+		goto n521;
+	n521:
+		return(tree_9_leaves[189]);
+	n522:
+		return(tree_9_leaves[190]);
+	n500:
+		return(tree_9_leaves[191]);
+	n472:
+		return(tree_9_leaves[192]);
+	n438:
+		return(tree_9_leaves[193]);
+	n386:
+		return(tree_9_leaves[194]);
+	n328:
+		return(tree_9_leaves[195]);
+	n84:
+		if (x[5] > 4.92817543932144858e-02) goto n126;
+		goto n125;
+	n125:
+		if (x[3] > 2.59378049532238558e-02) goto n184;
+		goto n183;
+	n183:
+		if (x[0] > -8.91446068539138714e-02) goto n258;
+		goto n257;
+	n257:
+		return(tree_9_leaves[196]);
+	n258:
+		if (x[8] > 1.20985233564003172e-02) goto n330;
+		goto n329;
+	n329:
+		if (x[2] > 1.26320023029227804e-02) goto n388;
+		goto n387;
+	n387:
+		if (x[9] > 5.31350171820020450e-02) goto n440;
+		goto n439;
+	n439:
+		return(tree_9_leaves[197]);
+	n440:
+		return(tree_9_leaves[198]);
+	n388:
+		return(tree_9_leaves[199]);
+	n330:
+		if (x[5] > -4.66119893418221257e-02) goto n390;
+		goto n389;
+	n389:
+		if (x[6] > -2.30319246381728987e-02) goto n442;
+		goto n441;
+	n441:
+		if (x[9] > 3.29724490723586755e-02) goto n474;
+		goto n473;
+	n473:
+		if (x[3] > -5.48654986616664564e-03) goto n502;
+		goto n501;
+	n501:
+		return(tree_9_leaves[200]);
+	n502:
+		return(tree_9_leaves[201]);
+	n474:
+		return(tree_9_leaves[202]);
+	n442:
+		return(tree_9_leaves[203]);
+	n390:
+		if (x[4] > -9.60513257708182216e-03) goto n444;
+		goto n443;
+	n443:
+		if (x[2] > 5.20071125809042634e-02) goto n476;
+		goto n475;
+	n475:
+		if (x[9] > -4.11002882860226001e-02) goto n504;
+		goto n503;
+	n503:
+		return(tree_9_leaves[204]);
+	n504:
+		if (x[9] > 6.15512136475362612e-05) goto n524;
+		goto n523;
+	n523:
+		return(tree_9_leaves[205]);
+	n524:
+		if (x[4] > -1.65516364486799385e-02) goto n544;
+		goto n543;
+	n543:
+		return(tree_9_leaves[206]);
+	n544:
+		return(tree_9_leaves[207]);
+	n476:
+		return(tree_9_leaves[208]);
+	n444:
+		if (x[8] > 4.40162220484419664e-02) goto n478;
+		goto n477;
+	n477:
+		if (x[0] > 1.49205941820377171e-02) goto n506;
+		goto n505;
+	n505:
+		if (x[1] > -1.65354187903769510e-02) goto n526;
+		goto n525;
+	n525:
+		return(tree_9_leaves[209]);
+	n526:
+		if (x[0] > 1.35479433507587274e-03) goto n546;
+		goto n545;
+	n545:
+		if (x[9] > 5.44615749134021165e-02) goto n554;
+		goto n553;
+	n553:
+		return(tree_9_leaves[210]);
+	n554:
+		return(tree_9_leaves[211]);
+	n546:
+		return(tree_9_leaves[212]);
+	n506:
+		if (x[8] > 2.58648788249221107e-02) goto n528;
+		goto n527;
+	n527:
+		return(tree_9_leaves[213]);
+	n528:
+		if (x[9] > -1.87607625084659120e-02) goto n548;
+		goto n547;
+	n547:
+		return(tree_9_leaves[214]);
+	n548:
+		if (x[9] > 2.28623086906042904e-02) goto n556;
+		goto n555;
+	n555:
+		return(tree_9_leaves[215]);
+	n556:
+		return(tree_9_leaves[216]);
+	n478:
+		if (x[0] > 2.40924825437607015e-02) goto n508;
+		goto n507;
+	n507:
+		return(tree_9_leaves[217]);
+	n508:
+		if (x[2] > 1.55329083075475792e-02) goto n530;
+		goto n529;
+	n529:
+		return(tree_9_leaves[218]);
+	n530:
+		return(tree_9_leaves[219]);
+	n184:
+		if (x[8] > 4.60082273901023658e-02) goto n260;
+		goto n259;
+	n259:
+		if (x[7] > 3.42464793685482716e-02) goto n332;
+		goto n331;
+	n331:
+		if (x[9] > 5.33672503645224172e-02) goto n392;
+		goto n391;
+	n391:
+		if (x[0] > 1.44928778815234735e-02) goto n446;
+		goto n445;
+	n445:
+		return(tree_9_leaves[220]);
+	n446:
+		if (x[4] > -1.04801870040911772e-02) goto n480;
+		goto n479;
+	n479:
+		return(tree_9_leaves[221]);
+	n480:
+		if (x[3] > 4.52378871453745501e-02) goto n510;
+		goto n509;
+	n509:
+		if (x[0] > 4.49015768560672018e-02) goto n532;
+		goto n531;
+	n531:
+		return(tree_9_leaves[222]);
+	n532:
+		return(tree_9_leaves[223]);
+	n510:
+		return(tree_9_leaves[224]);
+	n392:
+		return(tree_9_leaves[225]);
+	n332:
+		return(tree_9_leaves[226]);
+	n260:
+		if (x[0] > 1.10681104744101734e-02) goto n334;
+		goto n333;
+	n333:
+		if (x[9] > 2.93696968998964775e-02) goto n394;
+		goto n393;
+	n393:
+		return(tree_9_leaves[227]);
+	n394:
+		return(tree_9_leaves[228]);
+	n334:
+		if (x[4] > 1.13345071380515430e-02) goto n396;
+		goto n395;
+	n395:
+		return(tree_9_leaves[229]);
+	n396:
+		return(tree_9_leaves[230]);
+	n126:
+		if (x[9] > 2.31656512772404344e-02) goto n186;
+		goto n185;
+	n185:
+		if (x[2] > -3.69960644144288813e-03) goto n262;
+		goto n261;
+	n261:
+		if (x[4] > 7.57523365807784010e-02) goto n336;
+		goto n335;
+	n335:
+		return(tree_9_leaves[231]);
+	n336:
+		return(tree_9_leaves[232]);
+	n262:
+		if (x[3] > 3.81842118573516298e-02) goto n338;
+		goto n337;
+	n337:
+		if (x[5] > 8.16493005722963988e-02) goto n398;
+		goto n397;
+	n397:
+		if (x[2] > 5.18800374541208004e-02) goto n448;
+		goto n447;
+	n447:
+		return(tree_9_leaves[233]);
+	n448:
+		return(tree_9_leaves[234]);
+	n398:
+		if (x[9] > 1.09809800300609047e-02) goto n450;
+		goto n449;
+	n449:
+		if (x[3] > -5.22985139399211301e-03) goto n482;
+		goto n481;
+	n481:
+		return(tree_9_leaves[235]);
+	n482:
+		return(tree_9_leaves[236]);
+	n450:
+		return(tree_9_leaves[237]);
+	n338:
+		if (x[5] > 7.19200742662952641e-02) goto n400;
+		goto n399;
+	n399:
+		if (x[4] > 7.32320862893275082e-02) goto n452;
+		goto n451;
+	n451:
+		if (x[9] > -4.03069990312175924e-03) goto n484;
+		goto n483;
+	n483:
+		return(tree_9_leaves[238]);
+	n484:
+		return(tree_9_leaves[239]);
+	n452:
+		return(tree_9_leaves[240]);
+	n400:
+		return(tree_9_leaves[241]);
+	n186:
+		if (x[4] > 4.01754009830331896e-02) goto n264;
+		goto n263;
+	n263:
+		return(tree_9_leaves[242]);
+	n264:
+		if (x[9] > 6.76197512766585768e-02) goto n340;
+		goto n339;
+	n339:
+		if (x[1] > 4.17324432368450723e-02) goto n402;
+		goto n401;
+	n401:
+		return(tree_9_leaves[243]);
+	n402:
+		return(tree_9_leaves[244]);
+	n340:
+		return(tree_9_leaves[245]);
+	n52:
+		if (x[8] > 1.38414117349840073e-02) goto n86;
+		goto n85;
+	n85:
+		if (x[6] > -6.18844738753212414e-02) goto n128;
+		goto n127;
+	n127:
+		return(tree_9_leaves[246]);
+	n128:
+		if (x[8] > 1.03721469415771726e-02) goto n188;
+		goto n187;
+	n187:
+		return(tree_9_leaves[247]);
+	n188:
+		return(tree_9_leaves[248]);
+	n86:
+		if (x[8] > 5.18679037324144554e-02) goto n130;
+		goto n129;
+	n129:
+		if (x[3] > 1.07373927296310817e-01) goto n190;
+		goto n189;
+	n189:
+		if (x[9] > 3.24678326053156885e-02) goto n266;
+		goto n265;
+	n265:
+		if (x[7] > 2.96202976665934370e-02) goto n342;
+		goto n341;
+	n341:
+		return(tree_9_leaves[249]);
+	n342:
+		return(tree_9_leaves[250]);
+	n266:
+		if (x[5] > 4.20418316034885942e-02) goto n344;
+		goto n343;
+	n343:
+		if (x[8] > 4.49995658220924619e-02) goto n404;
+		goto n403;
+	n403:
+		return(tree_9_leaves[251]);
+	n404:
+		return(tree_9_leaves[252]);
+	n344:
+		return(tree_9_leaves[253]);
+	n190:
+		return(tree_9_leaves[254]);
+	n130:
+		if (x[6] > -3.82053698789200230e-02) goto n192;
+		goto n191;
+	n191:
+		if (x[2] > 6.11080930658696730e-02) goto n268;
+		goto n267;
+	n267:
+		return(tree_9_leaves[255]);
+	n268:
+		return(tree_9_leaves[256]);
+	n192:
+		if (x[3] > 8.71536870962279220e-02) goto n270;
+		goto n269;
+	n269:
+		if (x[2] > 4.20836067342335515e-02) goto n346;
+		goto n345;
+	n345:
+		return(tree_9_leaves[257]);
+	n346:
+		return(tree_9_leaves[258]);
+	n270:
+		if (x[2] > 5.94566144479376502e-02) goto n348;
+		goto n347;
+	n347:
+		return(tree_9_leaves[259]);
+	n348:
+		return(tree_9_leaves[260]);
+	n6:
+		if (x[0] > -5.38301319403084802e-02) goto n14;
+		goto n13;
+	n13:
+		return(tree_9_leaves[261]);
+	n14:
+		if (x[7] > 3.66725883917292036e-02) goto n28;
+		goto n27;
+	n27:
+		if (x[5] > 1.38010188381999018e-02) goto n54;
+		goto n53;
+	n53:
+		if (x[9] > 8.34904926810676462e-02) goto n88;
+		goto n87;
+	n87:
+		if (x[3] > 6.73183522938834850e-02) goto n132;
+		goto n131;
+	n131:
+		if (x[4] > 1.76500391643293134e-02) goto n194;
+		goto n193;
+	n193:
+		return(tree_9_leaves[262]);
+	n194:
+		return(tree_9_leaves[263]);
+	n132:
+		return(tree_9_leaves[264]);
+	n88:
+		if (x[2] > 8.98214682212479243e-02) goto n134;
+		goto n133;
+	n133:
+		return(tree_9_leaves[265]);
+	n134:
+		return(tree_9_leaves[266]);
+	n54:
+		if (x[5] > 2.85206555200247722e-02) goto n90;
+		goto n89;
+	n89:
+		if (x[6] > -2.82317321404777673e-02) goto n136;
+		goto n135;
+	n135:
+		return(tree_9_leaves[267]);
+	n136:
+		if (x[3] > 3.55353938098274466e-02) goto n196;
+		goto n195;
+	n195:
+		return(tree_9_leaves[268]);
+	n196:
+		if (x[5] > 1.76643096930408222e-02) goto n272;
+		goto n271;
+	n271:
+		return(tree_9_leaves[269]);
+	n272:
+		return(tree_9_leaves[270]);
+	n90:
+		return(tree_9_leaves[271]);
+	n28:
+		if (x[7] > 1.30417531652005564e-01) goto n56;
+		goto n55;
+	n55:
+		if (x[9] > 4.23008196899095842e-02) goto n92;
+		goto n91;
+	n91:
+		if (x[2] > 8.04217199714908487e-02) goto n138;
+		goto n137;
+	n137:
+		if (x[5] > 3.51333649378725368e-02) goto n198;
+		goto n197;
+	n197:
+		return(tree_9_leaves[272]);
+	n198:
+		return(tree_9_leaves[273]);
+	n138:
+		return(tree_9_leaves[274]);
+	n92:
+		if (x[6] > -4.88831890562889462e-02) goto n140;
+		goto n139;
+	n139:
+		return(tree_9_leaves[275]);
+	n140:
+		if (x[2] > 8.83094517140360358e-02) goto n200;
+		goto n199;
+	n199:
+		return(tree_9_leaves[276]);
+	n200:
+		return(tree_9_leaves[277]);
+	n56:
+		return(tree_9_leaves[278]);
+}
+
+}
+
+extern "C" {
+
+unsigned int num_features(){ return(10); }
+
+unsigned int num_trees(){ return(10); }
+
+response_t predict(const num_t *feature_vector){
+	running_statistics mean_stats;
+	mean_stats.push(response_t(tree_0_find_leaf(feature_vector).mean));
+	mean_stats.push(response_t(tree_1_find_leaf(feature_vector).mean));
+	mean_stats.push(response_t(tree_2_find_leaf(feature_vector).mean));
+	mean_stats.push(response_t(tree_3_find_leaf(feature_vector).mean));
+	mean_stats.push(response_t(tree_4_find_leaf(feature_vector).mean));
+	mean_stats.push(response_t(tree_5_find_leaf(feature_vector).mean));
+	mean_stats.push(response_t(tree_6_find_leaf(feature_vector).mean));
+	mean_stats.push(response_t(tree_7_find_leaf(feature_vector).mean));
+	mean_stats.push(response_t(tree_8_find_leaf(feature_vector).mean));
+	mean_stats.push(response_t(tree_9_find_leaf(feature_vector).mean));
+	return(mean_stats.mean());
+}
+
+void predict_mean_var(const num_t *feature_vector, int weighted_data, num_t *mean, num_t *var){
+	running_statistics mean_stats, var_stats;
+	push_leaf(tree_0_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	push_leaf(tree_1_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	push_leaf(tree_2_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	push_leaf(tree_3_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	push_leaf(tree_4_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	push_leaf(tree_5_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	push_leaf(tree_6_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	push_leaf(tree_7_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	push_leaf(tree_8_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	push_leaf(tree_9_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);
+	*mean = mean_stats.mean();
+	*var = std::max<num_t>(0, mean_stats.variance_sample() + var_stats.mean());
+}
+
+}
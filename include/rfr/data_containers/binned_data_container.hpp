@@ -0,0 +1,190 @@
+#ifndef RFR_BINNED_CONTAINER_HPP
+#define RFR_BINNED_CONTAINER_HPP
+
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+
+#include "rfr/data_containers/default_data_container.hpp"
+
+
+namespace rfr{ namespace data_containers{
+
+/** \brief A default_container that additionally stores every continuous feature quantized into at most 256 bins.
+ *
+ * The raw values are still stored and returned by all members of the base
+ * interface, so the forest makes the same predictions on it as on a
+ * default_container. Histogram based splits use the bins
+ * (one uint8 code per value) to find a split without sorting.
+ *
+ * The bins of a feature are separated by thresholds t_0 < t_1 < ... and the
+ * code of a value x is the number of thresholds smaller than x. Therefore,
+ * x <= t_b holds exactly if the code of x is <= b, so a split on a bin
+ * boundary can be stored as the numerical split value t_b.
+ */
+template<typename num_t = float, typename response_t = float, typename index_t = unsigned int>
+class binned_container : public rfr::data_containers::default_container<num_t, response_t, index_t>{
+  private:
+	typedef rfr::data_containers::default_container<num_t, response_t, index_t> super;
+
+  protected:
+	index_t max_num_bins;								//!< maximum number of bins per feature (at most 256)
+	bool quantized;										//!< whether the bins are computed
+	std::vector<std::vector<num_t> > bin_thresholds;	//!< upper boundaries of all but the last bin for every continuous feature
+	std::vector<std::vector<std::uint8_t> > bin_codes;	//!< the bin of every value for every continuous feature
+
+	std::uint8_t compute_code (index_t feature_index, num_t value) const {
+		auto &t = bin_thresholds[feature_index];
+		return(static_cast<std::uint8_t>(std::distance(t.begin(), std::lower_bound(t.begin(), t.end(), value))));
+	}
+
+	void append_codes (const std::vector<num_t> &features){
+		for (auto i=0u; i<features.size(); ++i){
+			if (super::get_type_of_feature(i) == 0)
+				bin_codes[i].push_back(compute_code(i, features[i]));
+		}
+	}
+
+  public:
+
+	binned_container(index_t num_f, index_t max_bins = 256): super(num_f), max_num_bins(max_bins), quantized(false) {
+		if ((max_bins < 2) || (max_bins > 256))
+			throw std::runtime_error("The number of bins has to be in {2, ..., 256}.");
+		bin_thresholds.resize(num_f);
+		bin_codes.resize(num_f);
+	}
+
+	/** \brief (re)computes the bins of one feature based on the stored values
+	 *
+	 * If the feature takes at most max_num_bins different values, every value
+	 * gets its own bin. Otherwise the bin boundaries are placed at the
+	 * quantiles of the values. Categorical features are not binned.
+	 *
+	 * \param feature_index the index of the feature
+	 */
+	void quantize_feature (index_t feature_index){
+		auto &t = bin_thresholds.at(feature_index);
+		auto &c = bin_codes.at(feature_index);
+		t.clear();
+		c.clear();
+
+		if (super::get_type_of_feature(feature_index) > 0) return;
+
+		std::vector<num_t> values(super::feature_values[feature_index]);
+		std::sort(values.begin(), values.end());
+
+		std::vector<num_t> unique_values(values);
+		unique_values.erase(std::unique(unique_values.begin(), unique_values.end()), unique_values.end());
+
+		if (unique_values.size() <= max_num_bins){
+			// one bin per value, with the boundaries in the middle between them
+			for (auto i=1u; i<unique_values.size(); ++i)
+				t.push_back(unique_values[i-1] + (unique_values[i]-unique_values[i-1])/2);
+		}
+		else{
+			// boundaries behind the quantiles; repeated values can merge some bins
+			for (auto b=1u; b<max_num_bins; ++b){
+				num_t q = values[(values.size()*b)/max_num_bins];
+				auto next = std::upper_bound(unique_values.begin(), unique_values.end(), q);
+				if (next == unique_values.end()) break;
+				num_t threshold = q + (*next - q)/2;
+				if (t.empty() || (t.back() < threshold))
+					t.push_back(threshold);
+			}
+		}
+
+		c.reserve(values.size());
+		for (auto &v: super::feature_values[feature_index])
+			c.push_back(compute_code(feature_index, v));
+	}
+
+	/** \brief (re)computes the bins of all features
+	 *
+	 * Needs to be called once all data points are added, unless the data is
+	 * read with import_csv_files. Data points added later are sorted into the
+	 * existing bins.
+	 */
+	void quantize_features(){
+		bin_thresholds.resize(super::num_features());
+		bin_codes.resize(super::num_features());
+		for (auto i=0u; i<super::num_features(); ++i)
+			quantize_feature(i);
+		quantized = true;
+	}
+
+	/** \brief whether quantize_features has been called */
+	bool is_quantized() const {return(quantized);}
+
+	/** \brief the bin of a value of a continuous feature, consistency checks are omitted for performance*/
+	std::uint8_t bin (index_t feature_index, index_t sample_index) const {
+		return(bin_codes[feature_index][sample_index]);
+	}
+
+	/** \brief pointer to the bins of all data points for a continuous feature */
+	const std::uint8_t* bins (index_t feature_index) const {return(bin_codes[feature_index].data());}
+
+	/** \brief number of bins of a continuous feature*/
+	index_t num_bins (index_t feature_index) const {return(bin_thresholds[feature_index].size()+1);}
+
+	/** \brief the largest value that falls into a bin; not defined for the last bin*/
+	num_t bin_threshold (index_t feature_index, index_t bin_index) const {return(bin_thresholds[feature_index][bin_index]);}
+
+
+	virtual void add_data_point (std::vector<num_t> features, response_t response, num_t weight = 1){
+		if (super::num_features() == 0){
+			bin_thresholds.resize(features.size());
+			bin_codes.resize(features.size());
+		}
+		super::add_data_point(features, response, weight);
+		append_codes(features);
+	}
+
+	virtual void add_data_point (std::vector<num_t> features, std::vector<response_t> response, num_t weight = 1){
+		if (super::num_features() == 0){
+			bin_thresholds.resize(features.size());
+			bin_codes.resize(features.size());
+		}
+		super::add_data_point(features, response, weight);
+		append_codes(features);
+	}
+
+	virtual void set_type_of_feature(index_t index, index_t type){
+		super::set_type_of_feature(index, type);
+		if (quantized)
+			quantize_feature(index);
+	}
+
+	virtual void normalize_data(){
+		super::normalize_data();
+		if (quantized)
+			quantize_features();
+	}
+
+	/** \brief reads the data like default_container::import_csv_files and quantizes all features*/
+	int import_csv_files (const std::string &feature_file, const std::string &response_file, std::string weight_file="",
+						  const std::vector<index_t> &feature_types = std::vector<index_t>(), unsigned int num_threads = 1){
+		// the features are quantized once at the end, not for every type that is set
+		bool was_quantized = quantized;
+		quantized = false;
+		int rv;
+		try{
+			rv = super::import_csv_files(feature_file, response_file, weight_file, feature_types, num_threads);
+		}
+		catch (...){
+			// the data is unchanged, and so are the bins
+			quantized = was_quantized;
+			throw;
+		}
+		quantize_features();
+		return(rv);
+	}
+};
+
+
+}}//namespace rfr::data_containers
+#endif
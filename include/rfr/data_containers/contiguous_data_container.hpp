@@ -0,0 +1,355 @@
+#ifndef RFR_CONTIGUOUS_CONTAINER_HPP
+#define RFR_CONTIGUOUS_CONTAINER_HPP
+
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+
+#include "rfr/data_containers/data_container.hpp"
+#include "rfr/data_containers/data_container_utils.hpp"
+
+
+namespace rfr{ namespace data_containers{
+
+/** \brief A data container that stores all feature values in one contiguous, column-major buffer.
+ *
+ * It behaves like the default_container, but the values of feature f are stored
+ * at [f*capacity(), f*capacity() + num_data_points()) of a single buffer instead
+ * of one vector per feature. The capacity can be reserved up front, and many
+ * data points can be added at once with add_data_points, so appending data
+ * does not reallocate every feature separately.
+ */
+template<typename num_t = float, typename response_t = float, typename index_t = unsigned int>
+class contiguous_container : public rfr::data_containers::base<num_t, response_t, index_t>{
+  protected:
+	index_t n_features;									//!< number of features of every data point
+	index_t n_data_points;								//!< number of stored data points
+	index_t data_capacity;								//!< number of data points that fit into the buffer
+	std::vector<num_t> feature_values;					//!< the column-major buffer with n_features*data_capacity values
+	std::vector<response_t> response_values;			//!< the associated responses (fitting)
+	std::vector<response_t> predict_values;				//!< the associated responses (predicting)
+	std::vector<num_t> weights;							//!< the associated weights
+	index_t response_type;								//!< to discriminate between regression and classification
+	std::vector<std::pair<num_t, num_t> > bounds;		//!< stores the intervals for all continuous variables, stores the number of categories for categoricals
+	std::vector<std::pair<num_t, num_t> > min_max;		//!< if no bounds are know, they can be imputed by the min/max values
+
+
+	void check_data_point (const num_t *features, response_t response, num_t weight) const {
+		if (weight <= 0)
+			throw std::runtime_error("Weight of a datapoint has to be positive.");
+
+		for (index_t i=0; i<n_features; i++){
+			if (get_type_of_feature(i) > 0){
+				if ((features[i] >= get_type_of_feature(i)) || features[i] < 0){
+					std::stringstream errMsg;
+					errMsg << "Feature "<<i<<" is categorical with values in {0,...,"<<get_type_of_feature(i)-1<<"}, but datapoint has value "<<features[i]<<" which is inconsistent!";
+					throw std::runtime_error(errMsg.str().c_str());
+				}
+			}
+		}
+
+		if (get_type_of_response() > 0){
+			if ((response >= get_type_of_response()) || response < 0){
+				std::stringstream errMsg;
+				errMsg << "Response is categorical with values in {0,...,"<<get_type_of_response()-1<<"}, but datapoint has value "<<response<<" which is inconsistent!";
+				throw std::runtime_error(errMsg.str().c_str());
+			}
+		}
+	}
+
+	void append_data_point (const num_t *features, response_t response, response_t predict_value, num_t weight){
+		for (index_t i=0; i<n_features; i++){
+			feature_values[static_cast<size_t>(i)*data_capacity + n_data_points] = features[i];
+			min_max[i] = std::pair<num_t,num_t> (std::min(min_max[i].first, features[i]), std::max(min_max[i].second, features[i]));
+		}
+		response_values.push_back(response);
+		predict_values.push_back(predict_value);
+		weights.push_back(weight);
+		n_data_points++;
+	}
+
+	/** \brief makes room for num_new more data points, growing the buffer geometrically*/
+	void grow_for (index_t num_new){
+		if (n_data_points + num_new > data_capacity)
+			reserve(std::max<index_t>(n_data_points + num_new, 2*data_capacity));
+	}
+
+	void guess_bounds_from_data(){
+		for (auto i=0u; i<min_max.size(); ++i){
+			if (std::isnan(bounds.at(i).second)) continue;
+			bounds[i] = min_max[i];
+		}
+	}
+
+  public:
+
+	/** \brief creates an empty container
+	 *
+	 * \param num_f number of features
+	 * \param capacity number of data points to reserve memory for
+	 */
+	contiguous_container(index_t num_f, index_t capacity = 0) { init_protected(num_f); reserve(capacity);}
+
+	void init_protected (index_t num_f){
+		n_features = num_f;
+		n_data_points = 0;
+		data_capacity = 0;
+		feature_values.clear();
+		response_values.clear();
+		predict_values.clear();
+		weights.clear();
+		response_type = 0;
+		bounds = std::vector<std::pair<num_t, num_t> > (num_f, std::pair<num_t,num_t>(-std::numeric_limits<num_t>::infinity(), std::numeric_limits<num_t>::infinity()));
+		min_max = std::vector<std::pair<num_t, num_t> > (num_f, std::pair<num_t,num_t>(std::numeric_limits<num_t>::infinity(), -std::numeric_limits<num_t>::infinity()));
+	}
+
+	/** \brief makes sure that capacity data points can be stored without reallocating the buffer*/
+	void reserve (index_t capacity){
+		if (capacity <= data_capacity) return;
+
+		std::vector<num_t> new_values(static_cast<size_t>(n_features)*capacity);
+		for (index_t i=0; i<n_features; i++){
+			auto column = feature_values.begin() + static_cast<size_t>(i)*data_capacity;
+			std::copy(column, column + n_data_points, new_values.begin() + static_cast<size_t>(i)*capacity);
+		}
+		feature_values.swap(new_values);
+		data_capacity = capacity;
+
+		response_values.reserve(capacity);
+		predict_values.reserve(capacity);
+		weights.reserve(capacity);
+	}
+
+	/** \brief number of data points that can be stored without reallocating the buffer*/
+	index_t capacity() const {return(data_capacity);}
+
+	/** \brief pointer to the num_data_points() values of one feature; invalidated when the buffer grows*/
+	const num_t* feature_column (index_t feature_index) const {
+		return(feature_values.data() + static_cast<size_t>(feature_index)*data_capacity);
+	}
+
+	virtual num_t feature  (index_t feature_index, index_t sample_index) const {
+		return(feature_values[static_cast<size_t>(feature_index)*data_capacity + sample_index]);
+	}
+
+	virtual std::vector<num_t> features (index_t feature_index, const std::vector<index_t> &sample_indices) const {
+		std::vector<num_t> rv;
+		rv.reserve(sample_indices.size());
+		auto column = feature_column(feature_index);
+		for (auto i : sample_indices)
+			rv.push_back(column[i]);
+		return(rv);
+	}
+
+	virtual response_t response (index_t sample_index) const{
+		return(response_values[sample_index]);
+	}
+
+	virtual response_t predict_value (index_t sample_index) const{
+		return(predict_values[sample_index]);
+	}
+
+	virtual void add_data_point (std::vector<num_t> features, response_t response, num_t weight = 1){
+		if (n_features == 0)
+			init_protected(features.size());
+
+		if (n_features != features.size())
+			throw std::runtime_error("Number of elements does not match.");
+
+		check_data_point(features.data(), response, weight);
+		grow_for(1);
+		append_data_point(features.data(), response, response, weight);
+	}
+
+	virtual void add_data_point (std::vector<num_t> features, std::vector<response_t> response, num_t weight = 1){
+		if (n_features == 0)
+			init_protected(features.size());
+
+		if (n_features != features.size())
+			throw std::runtime_error("Number of elements does not match.");
+		if (response.size() > 2)
+			throw std::runtime_error("This container does not support adding a responses with more than two columns");
+
+		check_data_point(features.data(), response[0], weight);
+		grow_for(1);
+		append_data_point(features.data(), response[0], response.back(), weight);
+	}
+
+	/** \brief adds many data points at once
+	 *
+	 * All data points are checked before any of them is added, so the container
+	 * is unchanged if one of them is invalid.
+	 *
+	 * \param features pointer to num_rows*num_features() values, one data point per row
+	 * \param num_rows number of data points
+	 * \param responses pointer to the num_rows responses
+	 * \param sample_weights pointer to the num_rows weights, or nullptr to give every data point the weight 1
+	 */
+	void add_data_points (const num_t *features, index_t num_rows, const response_t *responses, const num_t *sample_weights = nullptr){
+		for (index_t j=0; j<num_rows; j++)
+			check_data_point(features + static_cast<size_t>(j)*n_features, responses[j], sample_weights == nullptr ? 1 : sample_weights[j]);
+
+		grow_for(num_rows);
+		for (index_t j=0; j<num_rows; j++)
+			append_data_point(features + static_cast<size_t>(j)*n_features, responses[j], responses[j], sample_weights == nullptr ? 1 : sample_weights[j]);
+	}
+
+	virtual std::vector<num_t> retrieve_data_point (index_t index) const {
+		if (index >= n_data_points)
+			throw std::out_of_range("Unknown data point requested.");
+		std::vector<num_t> vec(n_features);
+		for (index_t i = 0; i < n_features; i++)
+			vec[i] = feature(i, index);
+		return(vec);
+	}
+
+	virtual num_t weight(index_t sample_index) const{ return(weights[sample_index]);}
+
+	/** \copydoc rfr::data_containers::default_container::get_type_of_feature */
+	virtual index_t get_type_of_feature (index_t feature_index) const{
+		// categorical features
+		if (bounds[feature_index].first > 0 && std::isnan(bounds[feature_index].second))
+			return(bounds[feature_index].first);
+		return(0);
+	}
+
+	virtual void set_type_of_feature(index_t index, index_t type){
+		if (index >= num_features())
+			throw std::runtime_error("Unknown index specified.");
+
+		auto column = feature_column(index);
+		if (type > 0){
+			//check if the data so far is consistent with the choice
+			for (auto it = column; it != column + n_data_points; ++it){
+				if (!(*it<type))
+					throw std::runtime_error("Feature values not consistent with provided type. Data contains a value larger than allowed.");
+				if (*it < 0)
+					throw std::runtime_error("Feature values contain a negative value, can't make that a categorical feature.");
+			}
+			bounds[index] = std::pair<num_t, num_t>(type, NAN);
+		}
+		else{
+			// guess bounds from min_max values so far
+			if (num_data_points() > 1){
+				auto pikachu = std::minmax_element(column, column + n_data_points);
+				bounds[index] = std::pair<num_t,num_t> (*pikachu.first, *pikachu.second);
+			}
+			else
+				bounds[index] = std::pair<num_t,num_t>(-std::numeric_limits<num_t>::infinity(), std::numeric_limits<num_t>::infinity());
+		}
+	}
+
+	virtual index_t num_features() const {return(n_features);}
+
+	virtual index_t num_data_points() const {return(n_data_points);}
+
+	virtual index_t get_type_of_response () const{return(response_type);}
+
+	virtual void set_type_of_response (index_t resp_t){
+		if (resp_t > 0){
+			for (auto &rv: response_values){
+				if (!(rv < resp_t))
+					throw std::runtime_error("Response value not consistent with provided type. Data contains a value larger than allowed.");
+				if (rv < 0)
+					throw std::runtime_error("Response values contain a negative value, can't make that a categorical value.");
+			}
+		}
+		response_type = resp_t;
+	}
+
+	virtual void set_bounds_of_feature(index_t feature_index, num_t min, num_t max){
+		if (std::isnan(bounds.at(feature_index).second))
+			throw std::runtime_error("You are trying to set bounds for a categorical feature! This is not supported!");
+		bounds.at(feature_index).first = min;
+		bounds.at(feature_index).second = max;
+	}
+
+	virtual std::pair<num_t, num_t> get_bounds_of_feature(index_t feature_index) const {
+		return(bounds.at(feature_index));
+	}
+
+	virtual std::pair<num_t, num_t> get_min_max_of_feature(index_t feature_index) const{
+		return(min_max.at(feature_index));
+	}
+
+
+	/** \copydoc rfr::data_containers::default_container::import_csv_files
+	 *
+	 * The features are parsed straight into a new column-major buffer, which replaces the old one once all files are checked.
+	 */
+	int import_csv_files (const std::string &feature_file, const std::string &response_file, std::string weight_file="",
+						  const std::vector<index_t> &feature_types = std::vector<index_t>(), unsigned int num_threads = 1){
+		std::vector<num_t> tmp_feature_values;
+		index_t num_d = 0;
+		rfr::read_csv_file_into<num_t>(feature_file, [&] (size_t num_rows, size_t num_columns){
+			if (num_columns != num_features()){
+				std::stringstream errMsg;
+				errMsg << "Number of features in the file ("<<num_columns <<") != expected number of features ("<<num_features() << ")!";
+				throw std::runtime_error(errMsg.str().c_str());
+			}
+			num_d = num_rows;
+			tmp_feature_values.resize(num_columns*num_rows);
+			std::vector<num_t*> columns;
+			for (size_t i=0; i<num_columns; ++i)
+				columns.push_back(tmp_feature_values.data() + i*num_rows);
+			return(columns);
+		}, num_threads);
+
+		if (tmp_feature_values.empty())
+			throw std::runtime_error("The file " + feature_file + " contains no data!");
+
+		auto tmp_response_values = (read_csv_file<response_t>(response_file, num_threads))[0];
+
+		if (num_d != tmp_response_values.size()){
+			std::stringstream errMsg;
+			errMsg << "Number of datapoints in feature and response file differ: "<<num_d <<" != "<<tmp_response_values.size() << " !";
+			throw std::runtime_error(errMsg.str().c_str());
+		}
+
+		std::vector<num_t> tmp_weights (num_d, 1);
+		if (weight_file.size()>0)
+			tmp_weights = (read_csv_file<num_t>(weight_file, num_threads))[0];
+
+		if (num_d != tmp_weights.size()){
+			std::stringstream errMsg;
+			errMsg << "Wrong number of weights provided; should be "<<num_d <<", but is "<< tmp_weights.size() << "!";
+			throw std::runtime_error(errMsg.str().c_str());
+		}
+
+		std::vector<const num_t*> columns;
+		for (index_t i=0; i<num_features(); i++)
+			columns.push_back(tmp_feature_values.data() + static_cast<size_t>(i)*num_d);
+		rfr::check_csv_feature_types(feature_types, columns, num_d);
+
+		init_protected(n_features);
+		feature_values.swap(tmp_feature_values);
+		data_capacity = num_d;
+		n_data_points = num_d;
+		for (index_t i=0; i<n_features; i++){
+			auto pikachu = std::minmax_element(columns[i], columns[i] + num_d);
+			min_max[i] = std::pair<num_t,num_t> (*pikachu.first, *pikachu.second);
+		}
+		response_values.swap(tmp_response_values);
+		predict_values = response_values;
+		weights.swap(tmp_weights);
+
+		guess_bounds_from_data();
+
+		// the types were checked above, so this cannot fail anymore
+		for (auto i=0u; i<feature_types.size(); ++i){
+			if (feature_types[i] > 0)
+				set_type_of_feature(i, feature_types[i]);
+		}
+		return(n_features);
+	}
+};
+
+
+}}//namespace rfr::data_containers
+#endif
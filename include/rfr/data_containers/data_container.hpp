@@ -142,5 +142,22 @@ class base{
 	virtual index_t num_data_points()  const = 0;
 };
 
+
+/** \brief reads a feature value bypassing the virtual dispatch of the concrete container type data_t
+ *
+ * The call can be inlined, but data_t has to be the exact (dynamic) type of the container,
+ * otherwise an overridden feature function would be skipped. Check the typeid first!
+ */
+template <typename data_t, typename index_t>
+inline auto static_feature(const data_t &data, index_t feature_index, index_t sample_index) -> decltype(data.feature(feature_index, sample_index)){
+	return(data.data_t::feature(feature_index, sample_index));
+}
+
+/** \brief overload for the interface itself that uses the virtual function */
+template <typename num_t, typename response_t, typename index_t>
+inline num_t static_feature(const base<num_t, response_t, index_t> &data, index_t feature_index, index_t sample_index){
+	return(data.feature(feature_index, sample_index));
+}
+
 }} // namespace rfr::data_containers
 #endif // RFR_DATA_CONTAINER_BASE_HPP
@@ -7,46 +7,298 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <memory>
+#include <numeric>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <clocale>
+#include <locale>
+#include <stdexcept>
+
+// strtod with an explicit locale is not part of the C++ standard library
+#if defined(_MSC_VER)
+#define RFR_HAVE_STRTOD_L 1
+#elif defined(__GLIBC__) || defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+#define RFR_HAVE_STRTOD_L 1
+#include <locale.h>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+#endif
+
+#include "rfr/util.hpp"
+#include "rfr/memory_mapped_file.hpp"
 
 namespace rfr{
 
 
+/** \brief converts a number like strtod does in the "C" locale, regardless of the global locale
+ *
+ * Uses strtod_l (_strtod_l with MSVC) where it exists. Elsewhere, a std::istringstream with
+ * the classic locale reads the number; unlike strtod, it does not accept hexadecimal numbers,
+ * infinities or NANs, and yields zero for them.
+ */
+inline double strtod_c_locale(const std::string &field){
+#if defined(_MSC_VER)
+	static _locale_t c_locale = _create_locale(LC_ALL, "C");
+	return(_strtod_l(field.c_str(), nullptr, c_locale));
+#elif defined(RFR_HAVE_STRTOD_L)
+	static locale_t c_locale = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
+	return(strtod_l(field.c_str(), nullptr, c_locale));
+#else
+	std::istringstream stream(field);
+	stream.imbue(std::locale::classic());
+	double value = 0;
+	stream >> value;
+	return(value);
+#endif
+}
+
+
+/** \brief parses the number at the beginning of a CSV field exactly like strtod, but without the locale
+ *
+ * Plain decimal numbers with at most 19 significant digits and a decimal exponent of
+ * at most 22 are converted with a single, correctly rounded multiplication or division
+ * (Clinger's fast path). Anything else is handed to strtod_c_locale, so the
+ * result is always the same as strtod's in the "C" locale.
+ *
+ * \param begin pointer to the first character of the field
+ * \param end pointer behind the last character of the field
+ */
+inline double parse_csv_field(const char* begin, const char* end){
+	static const double powers_of_ten[] = {	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+											1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+	const char* p = begin;
+	while ((p != end) && ((*p == ' ') || (*p == '\t'))) ++p;
+
+	bool negative = false;
+	if ((p != end) && ((*p == '-') || (*p == '+'))){
+		negative = (*p == '-');
+		++p;
+	}
+
+	std::uint64_t mantissa = 0;
+	int num_digits = 0, exponent = 0;
+	bool any_digits = false, fast_path = true;
+
+	for (; (p != end) && (*p >= '0') && (*p <= '9'); ++p){
+		any_digits = true;
+		if ((mantissa == 0) && (*p == '0')) continue;
+		if (++num_digits > 19) fast_path = false;
+		else mantissa = 10*mantissa + (*p - '0');
+	}
+	if ((p != end) && (*p == '.')){
+		for (++p; (p != end) && (*p >= '0') && (*p <= '9'); ++p){
+			any_digits = true;
+			if ((mantissa == 0) && (*p == '0')){ --exponent; continue;}
+			if (++num_digits > 19) fast_path = false;
+			else{
+				mantissa = 10*mantissa + (*p - '0');
+				--exponent;
+			}
+		}
+	}
+	if (any_digits && (p != end) && ((*p == 'e') || (*p == 'E'))){
+		const char* q = p+1;
+		bool negative_exponent = false;
+		if ((q != end) && ((*q == '-') || (*q == '+'))){
+			negative_exponent = (*q == '-');
+			++q;
+		}
+		if ((q != end) && (*q >= '0') && (*q <= '9')){
+			int e = 0;
+			for (; (q != end) && (*q >= '0') && (*q <= '9'); ++q)
+				if (e < 10000) e = 10*e + (*q - '0');
+			exponent += negative_exponent ? -e : e;
+			p = q;
+		}
+	}
+	// strtod would also read hexadecimals, infinities, NANs, ...
+	while ((p != end) && ((*p == ' ') || (*p == '\t') || (*p == '\r'))) ++p;
+	if (!any_digits || (p != end)) fast_path = false;
+
+	if (fast_path){
+		while ((mantissa != 0) && (mantissa % 10 == 0)){
+			mantissa /= 10;
+			++exponent;
+		}
+		if (mantissa == 0)
+			return(negative ? -0.0 : 0.0);
+		if ((mantissa <= (std::uint64_t(1) << 53)) && (exponent >= -22) && (exponent <= 22)){
+			double value = double(mantissa);
+			value = (exponent < 0) ? value / powers_of_ten[-exponent] : value * powers_of_ten[exponent];
+			return(negative ? -value : value);
+		}
+	}
+
+	return(strtod_c_locale(std::string(begin, end)));
+}
+
+
+/** \brief calls f(field_index, field_begin, field_end) for every comma separated field of a line
+ *
+ * Like std::getline, an empty field after the last comma is ignored.
+ *
+ * \return the number of fields
+ */
+template <typename function_t>
+size_t for_each_csv_field(const char* line_begin, const char* line_end, function_t f){
+	size_t i = 0;
+	const char* field_begin = line_begin;
+	while (field_begin != line_end){
+		const char* field_end = static_cast<const char*>(std::memchr(field_begin, ',', line_end - field_begin));
+		if (field_end == nullptr){
+			f(i++, field_begin, line_end);
+			break;
+		}
+		f(i++, field_begin, field_end);
+		field_begin = field_end + 1;
+	}
+	return(i);
+}
+
+
+/** \brief whether a line contains nothing but white space*/
+inline bool is_blank_csv_line(const char* line_begin, const char* line_end){
+	for (const char* p = line_begin; p != line_end; ++p){
+		if ((*p != ' ') && (*p != '\t') && (*p != '\r')) return(false);
+	}
+	return(true);
+}
+
+
+/** \brief reads a csv file containing only numerical values into storage provided by the caller
+ *
+ *  The file is memory mapped and split into chunks at line breaks, which are parsed in parallel
+ *  directly into the columns. Blank lines are skipped, and lines with a different number of
+ *  values than the first one raise an exception. Every value is parsed like strtod does in the
+ *  "C" locale, see parse_csv_field. It does NOT read any header information.
+ *
+ * \param filename the CSV file to be read
+ * \param allocate called as allocate(num_rows, num_columns) once the size of the data is known and before any value is parsed;
+ *        it has to return a std::vector<num_type*> with a pointer to room for num_rows values for each of the columns,
+ *        e.g. the columns of a column-major buffer. It is not called for an empty file.
+ * \param num_threads maximum number of threads; 0 uses all cores, but small files are always read by one thread
+ */
+template <typename num_type, typename allocate_t>
+void read_csv_file_into(const std::string &filename, allocate_t allocate, unsigned int num_threads = 1){
+
+	std::unique_ptr<rfr::util::memory_mapped_file> file;
+	try{
+		file.reset(new rfr::util::memory_mapped_file(filename));
+	}
+	catch (const std::runtime_error &){
+		throw std::runtime_error("Couldn't open file " + filename);
+	}
+
+	const char* file_begin = file->data();
+	const char* file_end = file_begin + file->size();
+	if (file->size() == 0)
+		return;
+
+	auto line_end = [file_end] (const char* line_begin){
+		auto p = static_cast<const char*>(std::memchr(line_begin, '\n', file_end - line_begin));
+		return(p == nullptr ? file_end : p);
+	};
+	auto next_line = [file_end, &line_end] (const char* line_begin){
+		auto p = line_end(line_begin);
+		return(p == file_end ? file_end : p+1);
+	};
+
+	// chunks of about 1MB start at the beginning of a line
+	size_t num_chunks = rfr::util::effective_num_threads(num_threads, file->size()/(1<<20) + 1);
+	std::vector<const char*> chunk_begins(num_chunks+1, file_end);
+	chunk_begins[0] = file_begin;
+	for (auto c=1u; c<num_chunks; ++c){
+		chunk_begins[c] = next_line(std::max(chunk_begins[c-1], file_begin + (file->size()*c)/num_chunks));
+	}
+
+	// the number of columns is determined by the first line with values
+	size_t num_columns = 0;
+	for (const char* p = file_begin; p < file_end; p = next_line(p)){
+		if (is_blank_csv_line(p, line_end(p))) continue;
+		num_columns = for_each_csv_field(p, line_end(p), [] (size_t, const char*, const char*){});
+		break;
+	}
+
+	// count the lines of every chunk to know where its rows go
+	std::vector<size_t> first_row(num_chunks+1, 0);
+	rfr::util::parallel_for<size_t>(num_chunks, num_chunks, [&] (size_t c){
+		for (const char* p = chunk_begins[c]; p < chunk_begins[c+1]; p = next_line(p)){
+			if (!is_blank_csv_line(p, line_end(p)))
+				++first_row[c+1];
+		}
+	});
+	std::partial_sum(first_row.begin(), first_row.end(), first_row.begin());
+
+	std::vector<num_type*> columns = allocate(first_row.back(), num_columns);
+
+	rfr::util::parallel_for<size_t>(num_chunks, num_chunks, [&] (size_t c){
+		size_t row = first_row[c];
+		for (const char* p = chunk_begins[c]; p < chunk_begins[c+1]; p = next_line(p)){
+			const char* end = line_end(p);
+			if (is_blank_csv_line(p, end)) continue;
+
+			size_t n = for_each_csv_field(p, end, [&] (size_t i, const char* field_begin, const char* field_end){
+				if (i < num_columns)
+					columns[i][row] = parse_csv_field(field_begin, field_end);
+			});
+			if (n != num_columns)
+				throw std::runtime_error("The lines of " + filename + " contain different numbers of values!");
+			++row;
+		}
+	});
+}
+
+
 /** \brief A utility function that reads a csv file containing only numerical values
  *
  *  A very common use case should be reading the 'training data' from a file in csv format. This function does that assuming that each row has the same number of entries. It does NOT read any header information.
+ *  See read_csv_file_into for the details.
  *
  * \param filename the CSV file to be read
- * \return The data in a 2d 'array' ready to be used by the data container classes
+ * \param num_threads maximum number of threads; 0 uses all cores, but small files are always read by one thread
+ * \return The data in a 2d 'array' ready to be used by the data container classes (one vector per column)
  *
  */
 template <typename num_type>
-std::vector< std::vector<num_type> > read_csv_file( std::string filename){
-
+std::vector< std::vector<num_type> > read_csv_file( std::string filename, unsigned int num_threads = 1){
 	std::vector< std::vector<num_type> > csv_values;
+	read_csv_file_into<num_type>(filename, [&csv_values] (size_t num_rows, size_t num_columns){
+		csv_values.assign(num_columns, std::vector<num_type>(num_rows));
+		std::vector<num_type*> columns;
+		for (auto &c: csv_values)
+			columns.push_back(c.data());
+		return(columns);
+	}, num_threads);
+	return(csv_values);
+}
 
-	std::fstream file(filename, std::ios::in);
-	if (file)
-	{
-		std::string line;
-		while (std::getline(file, line)){
-			size_t i=0;
-			std::istringstream s(line);
-			std::string field;
-			while (std::getline(s, field,',')){
-				if (i==csv_values.size()){
-					csv_values.push_back( std::vector<num_type>(1,strtod(field.c_str(), 0)));
-				}
-				else{
-					// convert data into double value, and store
-					(csv_values[i]).push_back(strtod(field.c_str(), 0));
-				}
-				i++;
-			}
+
+/** \brief checks the optional feature types passed to import_csv_files against the values read from the file
+ *
+ * Throws the same errors as set_type_of_feature would, but before the container is changed.
+ *
+ * \param feature_types empty, or the type of every feature (0 for continuous, the number of values for categoricals)
+ * \param columns pointers to the values of every feature
+ * \param num_rows number of values per feature
+ */
+template <typename num_type, typename index_type>
+void check_csv_feature_types(const std::vector<index_type> &feature_types, const std::vector<const num_type*> &columns, size_t num_rows){
+	if (feature_types.empty()) return;
+	if (feature_types.size() != columns.size())
+		throw std::runtime_error("The number of feature types does not match the number of features!");
+	for (auto i=0u; i<feature_types.size(); ++i){
+		if (feature_types[i] == 0) continue;
+		for (auto v = columns[i]; v != columns[i] + num_rows; ++v){
+			if (!(*v < feature_types[i]))
+				throw std::runtime_error("Feature values not consistent with provided type. Data contains a value larger than allowed.");
+			if (*v < 0)
+				throw std::runtime_error("Feature values contain a negative value, can't make that a categorical feature.");
 		}
 	}
-	else
-		throw std::runtime_error("Couldn't open file " + filename);
-	return(csv_values);
 }
 
 template<class T>
@@ -266,10 +266,23 @@ class default_container : public rfr::data_containers::base<num_t, response_t, i
 	}
 
 
-	// some helper functions
-	int import_csv_files (const std::string &feature_file, const std::string &response_file, std::string weight_file=""){
-		auto tmp_feature_values =  rfr::read_csv_file<num_t>(feature_file);
-        auto tmp_response_values = (read_csv_file<response_t>(response_file))[0];
+	/** \brief reads the data from CSV files, replacing all stored data points
+	 *
+	 * All files are read and checked before anything is stored, so the container
+	 * is left unchanged if any of them is invalid.
+	 *
+	 * \param feature_file CSV file with one data point per line
+	 * \param response_file CSV file with one response per line
+	 * \param weight_file optional CSV file with one weight per line
+	 * \param feature_types optional type of every feature (0 for continuous, the number of values for categoricals)
+	 * \param num_threads maximum number of threads used to parse each file, see rfr::read_csv_file
+	 *
+	 * \return int the number of features
+	 */
+	int import_csv_files (const std::string &feature_file, const std::string &response_file, std::string weight_file="",
+						  const std::vector<index_t> &feature_types = std::vector<index_t>(), unsigned int num_threads = 1){
+		auto tmp_feature_values =  rfr::read_csv_file<num_t>(feature_file, num_threads);
+		auto tmp_response_values = (read_csv_file<response_t>(response_file, num_threads))[0];
 
 		index_t num_f = tmp_feature_values.size();
 		index_t num_d = tmp_feature_values[0].size();
@@ -283,24 +296,29 @@ class default_container : public rfr::data_containers::base<num_t, response_t, i
 
 		if (num_d != tmp_response_values.size()){
 			std::stringstream errMsg;
-			errMsg << "Number of datapoints in feature and response file differ: "<<num_d <<" != "<<response_values.size() << " !";
+			errMsg << "Number of datapoints in feature and response file differ: "<<num_d <<" != "<<tmp_response_values.size() << " !";
 			throw std::runtime_error(errMsg.str().c_str());
 		}
 
-        if (weight_file.size()>0)
-            weights = (read_csv_file<num_t>(weight_file))[0];
-        else
-            weights = std::vector<num_t> (num_d, 1);
+		std::vector<num_t> tmp_weights (num_d, 1);
+		if (weight_file.size()>0)
+			tmp_weights = (read_csv_file<num_t>(weight_file, num_threads))[0];
 
-		if (num_d != weights.size()){
+		if (num_d != tmp_weights.size()){
 			std::stringstream errMsg;
-			errMsg << "Wrong number of weights provided; should be "<<num_d <<", but is "<< weights.size() << "!";
+			errMsg << "Wrong number of weights provided; should be "<<num_d <<", but is "<< tmp_weights.size() << "!";
 			throw std::runtime_error(errMsg.str().c_str());
 		}
 
+		std::vector<const num_t*> columns;
+		for (auto &f: tmp_feature_values)
+			columns.push_back(f.data());
+		rfr::check_csv_feature_types(feature_types, columns, num_d);
+
 		feature_values.swap(tmp_feature_values);
 		response_values.swap(tmp_response_values);
-        predict_values = response_values;
+		predict_values = response_values;
+		weights.swap(tmp_weights);
 
 		min_max.clear();
 
@@ -310,6 +328,12 @@ class default_container : public rfr::data_containers::base<num_t, response_t, i
 		}
 		
 		guess_bounds_from_data();
+
+		// the types were checked above, so this cannot fail anymore
+		for (auto i=0u; i<feature_types.size(); ++i){
+			if (feature_types[i] > 0)
+				set_type_of_feature(i, feature_types[i]);
+		}
 		return(feature_values.size());
 	}
 
@@ -0,0 +1,220 @@
+#ifndef RFR_CPP_CODE_GENERATOR_HPP
+#define RFR_CPP_CODE_GENERATOR_HPP
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <ostream>
+#include <fstream>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <cctype>
+
+
+#include "rfr/util.hpp"
+
+
+namespace rfr{ namespace forests{
+
+
+/** \brief the C++ spelling of the floating point types the forests can use */
+template <typename T> struct cpp_type{};
+template <> struct cpp_type<float>{ static const char* name(){return("float");} static const char* suffix(){return("f");} };
+template <> struct cpp_type<double>{ static const char* name(){return("double");} static const char* suffix(){return("");} };
+template <> struct cpp_type<long double>{ static const char* name(){return("long double");} static const char* suffix(){return("L");} };
+
+
+/** \brief writes a fitted forest as a self-contained C++ translation unit
+ *
+ * Every tree becomes one function with a hard-coded comparison for every internal node.
+ * The nodes are connected by gotos instead of nested blocks, so arbitrarily deep trees
+ * do not hit the compilers' nesting limits. The leaf statistics needed for the predictions
+ * are stored in one static table per tree.
+ *
+ * The generated code only includes standard headers and exports the C functions
+ *
+ *     unsigned int num_features();
+ *     unsigned int num_trees();
+ *     response_t predict(const num_t *feature_vector);
+ *     void predict_mean_var(const num_t *feature_vector, int weighted_data, num_t *mean, num_t *var);
+ *
+ * so it can be compiled into a shared object and loaded with dlopen. A symbol prefix is put in front
+ * of all four names (e.g. my_forest_predict), so the code of several forests can be linked into the
+ * same program. All constants are
+ * written with enough digits to be read back exactly, and the statistics are combined in
+ * the same order as in regression_forest, so the results are the same as the ones of
+ * regression_forest::predict and regression_forest::predict_mean_var as long as the code is
+ * compiled without value-changing optimizations like -ffast-math.
+ *
+ * Use regression_forest::save_cpp_source to create one.
+ */
+template <typename num_t = float, typename response_t = float, typename index_t = unsigned int>
+class cpp_code_generator{
+  protected:
+	std::vector<std::string> tree_functions;
+	index_t num_features;
+	bool compute_law_of_total_variance;
+	std::string symbol_prefix;
+
+	static std::string literal(num_t value){
+		std::stringstream ss;
+		if (std::isnan(value))
+			ss << "std::numeric_limits<num_t>::quiet_NaN()";
+		else if (std::isinf(value))
+			ss << (value < 0 ? "-" : "") << "std::numeric_limits<num_t>::infinity()";
+		else{
+			ss.precision(std::numeric_limits<num_t>::max_digits10);
+			ss << std::scientific << value << cpp_type<num_t>::suffix();
+		}
+		return(ss.str());
+	}
+
+	/** \brief writes the code of the subtree below node, every node gets the label n<index> */
+	template <typename tree_t>
+	static void write_subtree(const tree_t &tree, index_t node_index, std::ostream &code, std::ostream &leaves, index_t &num_leaves, std::ostream &sets, std::string const &prefix){
+		auto &n = tree.get_node(node_index);
+		// the root is never jumped to
+		if (node_index != 0)
+			code << "\tn" << node_index << ":\n";
+
+		if (n.is_a_leaf()){
+			auto &stat = n.leaf_statistic();
+			// the variances as pushed by regression_forest::push_leaf_statistic
+			bool many = stat.number_of_points() > 1;
+			leaves	<< "\t{" << literal(stat.mean())
+					<< ", " << literal(many ? stat.variance_unbiased_frequency() : 0)
+					<< ", " << literal(many ? stat.variance_unbiased_importance() : 0) << "},\n";
+			code << "\t\treturn(" << prefix << "leaves[" << num_leaves++ << "]);\n";
+			return;
+		}
+
+		auto &split = n.get_split();
+		index_t f = split.get_feature_index();
+		if (std::isnan(split.get_num_split_value())){
+			// values outside the set go right, just like int(value) in the split
+			auto set = split.get_cat_split_set();
+			sets << "static const unsigned char " << prefix << "set_" << node_index << "[] = {";
+			for (auto v = 0u; v < set.size(); ++v)
+				sets << (v ? "," : "") << (set[v] ? 1 : 0);
+			if (set.size() == 0)
+				sets << "0";
+			sets << "};\n";
+			code << "\t\tif (!in_set(" << prefix << "set_" << node_index << ", " << set.size() << ", x[" << f << "])) goto n" << n.get_child_index(1) << ";\n";
+		}
+		else
+			code << "\t\tif (x[" << f << "] > " << literal(split.get_num_split_value()) << ") goto n" << n.get_child_index(1) << ";\n";
+		code << "\t\tgoto n" << n.get_child_index(0) << ";\n";
+
+		write_subtree(tree, n.get_child_index(0), code, leaves, num_leaves, sets, prefix);
+		write_subtree(tree, n.get_child_index(1), code, leaves, num_leaves, sets, prefix);
+	}
+
+  public:
+
+	/** \brief creates an empty generator, add the trees with add_tree
+	 *
+	 * \param num_feats number of features the trees were trained on
+	 * \param law_of_total_variance see forest_options::compute_law_of_total_variance
+	 * \param prefix put in front of the names of the exported functions; letters, digits and underscores that do not start with a digit
+	 */
+	cpp_code_generator(index_t num_feats, bool law_of_total_variance, const std::string &prefix = ""):
+		num_features(num_feats), compute_law_of_total_variance(law_of_total_variance), symbol_prefix(prefix) {
+		for (auto c: symbol_prefix){
+			if (!(std::isalnum(static_cast<unsigned char>(c)) || (c == '_')))
+				throw std::runtime_error("The symbol prefix '" + symbol_prefix + "' is not part of a valid C identifier!");
+		}
+		if (!symbol_prefix.empty() && std::isdigit(static_cast<unsigned char>(symbol_prefix[0])))
+			throw std::runtime_error("The symbol prefix '" + symbol_prefix + "' must not start with a digit!");
+	}
+
+
+	/** \brief appends a fitted binary tree
+	 *
+	 * The tree has to provide number_of_nodes and get_node, and its splits need
+	 * get_feature_index, get_num_split_value and get_cat_split_set like
+	 * rfr::splits::binary_split_one_feature_rss_loss.
+	 */
+	template <typename tree_t>
+	void add_tree (const tree_t &tree){
+		if (tree.number_of_nodes() == 0)
+			throw std::runtime_error("Cannot generate code for an empty tree!");
+
+		std::stringstream prefix, code, leaves, sets, function;
+		prefix << "tree_" << tree_functions.size() << "_";
+
+		index_t num_leaves = 0;
+		write_subtree(tree, 0, code, leaves, num_leaves, sets, prefix.str());
+
+		function << sets.str();
+		function << "static const leaf_t " << prefix.str() << "leaves[] = {\n" << leaves.str() << "};\n\n";
+		function << "static const leaf_t& " << prefix.str() << "find_leaf(const num_t *x){\n" << code.str() << "}\n\n";
+		tree_functions.push_back(function.str());
+	}
+
+	index_t num_trees() const {return(tree_functions.size());}
+
+
+	/** \brief writes the whole translation unit */
+	void write(std::ostream &os) const {
+		os	<< "// generated by rfr::forests::cpp_code_generator\n"
+			<< "// compile without -ffast-math to get exactly the predictions of the original forest\n\n"
+			<< "#include <cstddef>\n#include <cmath>\n#include <limits>\n#include <algorithm>\n\n"
+			<< "namespace {\n\n"
+			<< "typedef " << cpp_type<num_t>::name() << " num_t;\n"
+			<< "typedef " << cpp_type<response_t>::name() << " response_t;\n\n"
+			<< "struct leaf_t{ num_t mean, variance_frequency, variance_importance; };\n\n"
+			// same arithmetic as rfr::util::running_statistics
+			<< "struct running_statistics{\n"
+			<< "\tlong unsigned int N = 0;\n"
+			<< "\tnum_t avg = 0, sdm = 0;\n"
+			<< "\tvoid push(num_t x){ ++N; num_t delta = x - avg; avg += delta/N; sdm += delta*(x-avg); }\n"
+			<< "\tnum_t divide_sdm_by(num_t value) const { return(N>1 ? std::max<num_t>(0.,sdm/value) : NAN); }\n"
+			<< "\tnum_t mean() const { return(N>0 ? avg : NAN); }\n"
+			<< "\tnum_t variance_sample() const { return(divide_sdm_by(N-1)); }\n"
+			<< "};\n\n"
+			<< "inline void push_leaf(const leaf_t &leaf, int weighted_data, running_statistics &mean_stats, running_statistics &var_stats){\n"
+			<< "\tmean_stats.push(leaf.mean);\n"
+			<< "\tvar_stats.push(weighted_data ? leaf.variance_importance : leaf.variance_frequency);\n"
+			<< "}\n\n"
+			<< "inline bool in_set(const unsigned char *set, std::size_t size, num_t value){\n"
+			<< "\tstd::size_t v = std::size_t(int(value));\n"
+			<< "\treturn((v < size) && set[v]);\n"
+			<< "}\n\n";
+
+		for (auto &f: tree_functions)
+			os << f;
+
+		// the trees are called one after another, without any indirection
+		os	<< "}\n\n"
+			<< "extern \"C\" {\n\n"
+			<< "unsigned int " << symbol_prefix << "num_features(){ return(" << num_features << "); }\n\n"
+			<< "unsigned int " << symbol_prefix << "num_trees(){ return(" << tree_functions.size() << "); }\n\n"
+			<< "response_t " << symbol_prefix << "predict(const num_t *feature_vector){\n"
+			<< "\trunning_statistics mean_stats;\n";
+		for (auto t = 0u; t < tree_functions.size(); ++t)
+			os << "\tmean_stats.push(response_t(tree_" << t << "_find_leaf(feature_vector).mean));\n";
+		os	<< "\treturn(mean_stats.mean());\n"
+			<< "}\n\n"
+			<< "void " << symbol_prefix << "predict_mean_var(const num_t *feature_vector, int weighted_data, num_t *mean, num_t *var){\n"
+			<< "\trunning_statistics mean_stats, var_stats;\n";
+		for (auto t = 0u; t < tree_functions.size(); ++t)
+			os << "\tpush_leaf(tree_" << t << "_find_leaf(feature_vector), weighted_data, mean_stats, var_stats);\n";
+		os	<< "\t*mean = mean_stats.mean();\n"
+			<< "\t*var = std::max<num_t>(0, mean_stats.variance_sample()" << (compute_law_of_total_variance ? " + var_stats.mean()" : "") << ");\n"
+			<< "}\n\n"
+			<< "}\n";
+	}
+
+	/** \brief writes the translation unit into a file */
+	void save(const std::string &filename) const {
+		std::ofstream ofs(filename);
+		if (!ofs)
+			throw std::runtime_error("Could not open " + filename + " for writing!");
+		write(ofs);
+	}
+};
+
+
+}}//namespace rfr::forests
+#endif
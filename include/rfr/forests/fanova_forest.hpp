@@ -58,6 +58,15 @@ class fANOVA_forest: public	rfr::forests::regression_forest< rfr::trees::binary_
 		}
 	}
 
+	/* \brief grows additional trees, see regression_forest::add_trees
+	 *
+	 * The marginals of all trees are computed again with the current cutoffs.
+	 */
+	virtual void add_trees(const rfr::data_containers::base<num_t, response_t, index_t> &data, index_t num_new_trees, rng_t &rng){
+		super::add_trees(data, num_new_trees, rng);
+		precompute_marginals();
+	}
+
 	/* \brief sets the cutoff to perform fANOVA on subspaces with bounded predictions
 	 *
 	 * This function is used for the fANOVA with a uniform prior on the subspace
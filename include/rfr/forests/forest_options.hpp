@@ -21,13 +21,15 @@ struct forest_options{
 
 	bool compute_law_of_total_variance; ///< flag to enable/disable computation with the lotv
 
+	index_t num_threads;				///< number of threads used to grow the trees and for batch predictions (0 means all available cores)
+
 	rfr::trees::tree_options<num_t,response_t,index_t> tree_opts;	///< the options for each tree
 
   	/* serialize function for saving forests */
   	template<class Archive>
 	void serialize(Archive & archive)
 	{
-		archive( num_trees,num_data_points_per_tree, do_bootstrapping, compute_oob_error, tree_opts);
+		archive( num_trees,num_data_points_per_tree, do_bootstrapping, compute_oob_error, tree_opts, num_threads);
 	}
 
 
@@ -43,6 +45,7 @@ struct forest_options{
 		compute_oob_error = false;
 		compute_law_of_total_variance = true;
 
+		num_threads = 1;
 	}
 
 
@@ -72,6 +75,7 @@ struct forest_options{
 		str += "  min samples in leaf   :" + std::to_string(tree_opts.min_samples_in_leaf) + "\n";
 		str += "        life time       :" + std::to_string(tree_opts.life_time) + "\n";
         str += "compute_law_of_total_var:" + std::to_string(compute_law_of_total_variance) + "\n";
+		str += "      num_threads       :" + std::to_string(num_threads) + "\n";
 		return str;
 	}
 };
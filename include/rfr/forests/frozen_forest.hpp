@@ -0,0 +1,526 @@
+#ifndef RFR_FROZEN_FOREST_HPP
+#define RFR_FROZEN_FOREST_HPP
+
+#include <vector>
+#include <array>
+#include <deque>
+#include <utility>
+#include <tuple>
+#include <iterator>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <fstream>
+#include <type_traits>
+
+
+#include "rfr/util.hpp"
+#include "rfr/memory_mapped_file.hpp"
+
+
+namespace rfr{ namespace forests{
+
+
+/** \brief a read-only, flat representation of a fitted regression forest for fast predictions
+ *
+ * All nodes of all trees live in one array with 8-16 bytes per node (depending on num_t and index_t).
+ * The two children of an internal node are stored next to each other, so a node only needs to
+ * know its first child. Categorical splits keep their sets in a side table, and the leaf
+ * statistics are stored in a separate array. That way, a traversal only touches one small
+ * node per level.
+ *
+ * Use regression_forest::freeze to create one. The predictions are exactly the same as the
+ * ones of the forest it was created from.
+ *
+ * The arrays can be written to a file with save_to_mmap_file. load_from_mmap_file maps such a
+ * file into memory and uses the arrays in place, so loading only needs one pass over the nodes
+ * to validate them, and processes that load the same file share the memory. Copies of a frozen_forest share the arrays, too.
+ * Where there is no POSIX memory map (see rfr/memory_mapped_file.hpp), the file is read into one buffer instead,
+ * which is used in place just the same, but not shared between processes.
+ */
+template <typename num_t = float, typename response_t = float, typename index_t = unsigned int>
+class frozen_forest{
+  public:
+
+	/** \brief one node of a frozen tree
+	 *
+	 * For leaves, feature_index is marked by leaf_flag and child_index is the index of the leaf statistic.
+	 * For categorical splits, feature_index is marked by categorical_flag and child_index points into the categorical side table.
+	 */
+	struct node_t{
+		num_t split_value;		//!< the threshold of a continuous split; data points with feature values > split_value go to the right child
+		index_t feature_index;	//!< the feature of the split, plus the flags
+		index_t child_index;	//!< the left child, the right one is the next node
+	};
+
+	typedef rfr::util::weighted_running_statistics<num_t> leaf_statistic_t;
+
+	static constexpr index_t leaf_flag = index_t(1) << (8*sizeof(index_t)-1);
+	static constexpr index_t categorical_flag = index_t(1) << (8*sizeof(index_t)-2);
+
+	/** \brief version of the layout written by save_to_mmap_file*/
+	static constexpr std::uint32_t mmap_file_version = 1;
+
+  protected:
+
+	/** \brief the arrays of a forest created by freeze*/
+	struct storage_t{
+		std::vector<node_t> nodes;
+		std::vector<index_t> roots;
+		std::vector<std::uint64_t> categorical_sets;
+		std::vector<index_t> categorical_children;
+		std::vector<leaf_statistic_t> leaf_statistics;
+		std::vector<index_t> types;
+		std::vector< std::array<num_t,2> > bounds;
+	};
+
+	/** \brief the beginning of a file written by save_to_mmap_file
+	 *
+	 * All arrays follow at the given byte offsets (aligned to 64 bytes) in the
+	 * machine's native representation. The sizes of the types and a byte order
+	 * marker make sure they are only read by a compatible build.
+	 */
+	struct mmap_header_t{
+		char magic[8];
+		std::uint32_t version;
+		std::uint32_t byte_order;
+		std::uint32_t num_t_size;
+		std::uint32_t index_t_size;
+		std::uint32_t node_size;
+		std::uint32_t leaf_statistic_size;
+		std::uint64_t num_features;
+		std::uint64_t num_trees;
+		std::uint64_t num_nodes;
+		std::uint64_t num_leaves;
+		std::uint64_t num_categorical_splits;
+		std::uint64_t words_per_set;
+		std::uint64_t compute_law_of_total_variance;
+		std::uint64_t offsets[7];	//!< nodes, roots, categorical sets, categorical children, leaf statistics, types, bounds
+	};
+
+	// owners of the memory; at most one of them is set
+	std::shared_ptr<storage_t> storage;
+	std::shared_ptr<rfr::util::memory_mapped_file> mapping;
+
+	// the arrays used for the predictions, they point into storage or mapping
+	const node_t *nodes;
+	const index_t *roots;
+	const std::uint64_t *categorical_sets;
+	const index_t *categorical_children;
+	const leaf_statistic_t *leaf_statistics;
+	const index_t *types;
+	const std::array<num_t,2> *bounds;
+
+	index_t n_trees, n_nodes, n_leaves, n_categorical_splits;
+	index_t words_per_set;							//!< number of 64 bit words in every categorical set; values in the set go to the left child
+
+	index_t num_features;
+	bool compute_law_of_total_variance;
+
+	void update_pointers(){
+		nodes = storage->nodes.data();
+		roots = storage->roots.data();
+		categorical_sets = storage->categorical_sets.data();
+		categorical_children = storage->categorical_children.data();
+		leaf_statistics = storage->leaf_statistics.data();
+		types = storage->types.data();
+		bounds = storage->bounds.data();
+
+		n_trees = storage->roots.size();
+		n_nodes = storage->nodes.size();
+		n_leaves = storage->leaf_statistics.size();
+		n_categorical_splits = storage->categorical_children.size();
+	}
+
+	static size_t aligned_offset(size_t offset){ return((offset + 63)/64*64);}
+
+	/** \brief count*element_size for the untrusted counts of a file, throws if it does not fit into a size_t*/
+	static size_t checked_size(std::uint64_t count, size_t element_size, const std::string &filename){
+		if ((count > std::numeric_limits<size_t>::max()) || (count > std::numeric_limits<size_t>::max()/element_size))
+			throw std::runtime_error("The file " + filename + " is corrupted!");
+		return(size_t(count)*element_size);
+	}
+
+	/** \brief checks that every index in the arrays points to an existing element
+	 *
+	 * Children always come after their parent (see add_tree), which also rules out cycles.
+	 */
+	void validate_indices(const std::string &filename) const {
+		auto corrupted = [&filename] () {return(std::runtime_error("The file " + filename + " is corrupted!"));};
+
+		for (index_t t = 0; t < n_trees; ++t)
+			if (roots[t] >= n_nodes) throw corrupted();
+
+		for (index_t i = 0; i < n_nodes; ++i){
+			const node_t &n = nodes[i];
+			if (n.feature_index & leaf_flag){
+				if (n.child_index >= n_leaves) throw corrupted();
+				continue;
+			}
+
+			index_t first_child;
+			if (n.feature_index & categorical_flag){
+				if (((n.feature_index & ~categorical_flag) >= num_features) || (n.child_index >= n_categorical_splits)) throw corrupted();
+				first_child = categorical_children[n.child_index];
+			}
+			else{
+				if (n.feature_index >= num_features) throw corrupted();
+				first_child = n.child_index;
+			}
+			if ((first_child <= i) || (first_child >= n_nodes - 1)) throw corrupted();
+		}
+	}
+
+  public:
+
+	/** \brief number of threads used for batch predictions (0 means all available cores)*/
+	index_t num_threads;
+
+
+	frozen_forest(): frozen_forest(0, std::vector<index_t>(), std::vector< std::array<num_t,2> >(), false, 1) {}
+
+	/** \brief creates an empty forest, add the trees with add_tree
+	 *
+	 * \param num_feats number of features the trees were trained on
+	 * \param feature_types the types of the features (0 for continuous, the number of values for categoricals)
+	 * \param feature_bounds the bounds of the features
+	 * \param law_of_total_variance see forest_options::compute_law_of_total_variance
+	 * \param threads number of threads used for batch predictions
+	 */
+	frozen_forest(	index_t num_feats, const std::vector<index_t> &feature_types, const std::vector< std::array<num_t,2> > &feature_bounds,
+					bool law_of_total_variance, index_t threads):
+		storage(new storage_t()), words_per_set(0), num_features(num_feats),
+		compute_law_of_total_variance(law_of_total_variance), num_threads(threads) {
+		if (num_features >= categorical_flag)
+			throw std::runtime_error("Too many features to freeze the forest!");
+		storage->types = feature_types;
+		storage->bounds = feature_bounds;
+		update_pointers();
+	}
+
+
+	/** \brief appends a fitted binary tree
+	 *
+	 * The tree has to provide number_of_nodes and get_node, and its splits need
+	 * get_feature_index, get_num_split_value and get_cat_split_set like
+	 * rfr::splits::binary_split_one_feature_rss_loss.
+	 */
+	template <typename tree_t>
+	void add_tree (const tree_t &tree){
+		if (!storage)
+			throw std::runtime_error("Cannot add trees to a memory mapped forest!");
+		if (tree.number_of_nodes() == 0)
+			throw std::runtime_error("Cannot freeze an empty tree!");
+
+		// copies share the arrays, so they need their own ones before anything changes
+		if (storage.use_count() > 1)
+			storage = std::make_shared<storage_t>(*storage);
+
+		auto &s = *storage;
+		s.roots.push_back(s.nodes.size());
+		s.nodes.emplace_back();
+
+		// (index in the tree, index in the frozen nodes) of all nodes that still need to be copied
+		std::deque<std::pair<index_t, index_t> > queue;
+		queue.emplace_back(0, s.roots.back());
+
+		while (!queue.empty()){
+			index_t old_index = queue.front().first;
+			index_t new_index = queue.front().second;
+			queue.pop_front();
+
+			auto &n = tree.get_node(old_index);
+
+			if (n.is_a_leaf()){
+				s.nodes[new_index].split_value = NAN;
+				s.nodes[new_index].feature_index = leaf_flag;
+				s.nodes[new_index].child_index = s.leaf_statistics.size();
+				s.leaf_statistics.push_back(n.leaf_statistic());
+				continue;
+			}
+
+			index_t first_child = s.nodes.size();
+			s.nodes.resize(first_child + 2);
+			queue.emplace_back(n.get_child_index(0), first_child);
+			queue.emplace_back(n.get_child_index(1), first_child+1);
+
+			auto &split = n.get_split();
+			s.nodes[new_index].split_value = split.get_num_split_value();
+
+			// a NAN split value marks a categorical split
+			if (std::isnan(split.get_num_split_value())){
+				auto set = split.get_cat_split_set();
+				// sets that grow as needed are at most as large as the feature's number of values
+				if (words_per_set == 0)
+					words_per_set = (std::max<std::size_t>(set.size(), *std::max_element(s.types.begin(), s.types.end())) + 63)/64;
+				if (words_per_set*64 < set.size())
+					throw std::runtime_error("All categorical splits need to have the same maximum number of categories!");
+
+				s.nodes[new_index].feature_index = split.get_feature_index() | categorical_flag;
+				s.nodes[new_index].child_index = s.categorical_children.size();
+				s.categorical_children.push_back(first_child);
+
+				s.categorical_sets.resize(s.categorical_sets.size() + words_per_set, 0);
+				auto words = std::prev(s.categorical_sets.end(), words_per_set);
+				for (auto v=0u; v < set.size(); ++v){
+					if (set[v])
+						words[v/64] |= std::uint64_t(1) << (v%64);
+				}
+			}
+			else{
+				s.nodes[new_index].feature_index = split.get_feature_index();
+				s.nodes[new_index].child_index = first_child;
+			}
+		}
+		update_pointers();
+	}
+
+
+	/** \brief index of the leaf (into the leaf statistics) a feature vector falls into
+	 *
+	 * \param tree_index the index of the tree
+	 * \param feature_vector pointer to the num_features values of a feature vector (not checked!)
+	 */
+	index_t find_leaf_index (index_t tree_index, const num_t *feature_vector) const {
+		index_t i = roots[tree_index];
+		while (true){
+			const node_t &n = nodes[i];
+			if (n.feature_index & leaf_flag)
+				return(n.child_index);
+
+			if (n.feature_index & categorical_flag){
+				index_t v = index_t(feature_vector[n.feature_index & ~categorical_flag]);
+				const std::uint64_t *set = categorical_sets + n.child_index*words_per_set;
+				bool in_set = (v < words_per_set*64) && ((set[v/64] >> (v%64)) & 1u);
+				i = categorical_children[n.child_index] + !in_set;
+			}
+			else
+				i = n.child_index + (feature_vector[n.feature_index] > n.split_value);
+		}
+	}
+
+	index_t find_leaf_index (index_t tree_index, const std::vector<num_t> &feature_vector) const {
+		return(find_leaf_index(tree_index, feature_vector.data()));
+	}
+
+	leaf_statistic_t const & leaf_statistic (index_t tree_index, const num_t *feature_vector) const {
+		return(leaf_statistics[find_leaf_index(tree_index, feature_vector)]);
+	}
+
+
+	/** \brief same as regression_forest::predict */
+	response_t predict (const num_t *feature_vector) const {
+		rfr::util::running_statistics<num_t> mean_stats;
+		for (auto t=0u; t < n_trees; ++t)
+			mean_stats.push(leaf_statistic(t, feature_vector).mean());
+		return(mean_stats.mean());
+	}
+
+	response_t predict (const std::vector<num_t> &feature_vector) const {
+		return(predict(feature_vector.data()));
+	}
+
+
+	/** \brief same as regression_forest::predict_mean_var */
+	std::pair<num_t, num_t> predict_mean_var (const num_t *feature_vector, bool weighted_data = false) const {
+		rfr::util::running_statistics<num_t> mean_stats, var_stats;
+		for (auto t=0u; t < n_trees; ++t){
+			auto &stat = leaf_statistic(t, feature_vector);
+			mean_stats.push(stat.mean());
+			if (stat.number_of_points() > 1){
+				if (weighted_data) var_stats.push(stat.variance_unbiased_importance());
+				else var_stats.push(stat.variance_unbiased_frequency());
+			} else{
+				var_stats.push(0);
+			}
+		}
+		num_t var = mean_stats.variance_sample();
+		if (compute_law_of_total_variance) {
+			return std::pair<num_t, num_t> (mean_stats.mean(), std::max<num_t>(0, var + var_stats.mean()) );
+		}
+		return std::pair<num_t, num_t> (mean_stats.mean(), std::max<num_t>(0, var) );
+	}
+
+	std::pair<num_t, num_t> predict_mean_var (const std::vector<num_t> &feature_vector, bool weighted_data = false) const {
+		return(predict_mean_var(feature_vector.data(), weighted_data));
+	}
+
+
+	/** \brief same as regression_forest::predict_batch, but the rows are used in place */
+	void predict_batch(const num_t *features, index_t num_rows, index_t num_cols, response_t *predictions) const {
+		if (num_cols != num_features)
+			throw std::runtime_error("The number of columns does not match the number of features the forest was trained on!");
+
+		rfr::util::parallel_for<index_t>(num_rows, num_threads, [&] (index_t i){
+			predictions[i] = predict(features + static_cast<size_t>(i)*num_cols);
+		});
+	}
+
+	/** \brief same as regression_forest::predict_mean_var_batch, but the rows are used in place */
+	void predict_mean_var_batch(const num_t *features, index_t num_rows, index_t num_cols, num_t *means, num_t *variances, bool weighted_data = false) const {
+		if (num_cols != num_features)
+			throw std::runtime_error("The number of columns does not match the number of features the forest was trained on!");
+
+		rfr::util::parallel_for<index_t>(num_rows, num_threads, [&] (index_t i){
+			std::tie(means[i], variances[i]) = predict_mean_var(features + static_cast<size_t>(i)*num_cols, weighted_data);
+		});
+	}
+
+
+	/** \brief writes all arrays into a file that can be used with load_from_mmap_file
+	 *
+	 * The file uses the machine's native representation of all numbers, so it can only be
+	 * loaded by a build with the same types and byte order.
+	 *
+	 * \param filename name of the file; an existing file will be overwritten
+	 */
+	void save_to_mmap_file(const std::string &filename) const {
+		static_assert(std::is_trivially_copyable<node_t>::value, "The nodes need to be trivially copyable.");
+		static_assert(std::is_trivially_copyable<leaf_statistic_t>::value, "The leaf statistics need to be trivially copyable.");
+
+		mmap_header_t header;
+		std::memset(&header, 0, sizeof(header));
+		std::memcpy(header.magic, "RFRFRZN", 8);
+		header.version = mmap_file_version;
+		header.byte_order = 0x01020304;
+		header.num_t_size = sizeof(num_t);
+		header.index_t_size = sizeof(index_t);
+		header.node_size = sizeof(node_t);
+		header.leaf_statistic_size = sizeof(leaf_statistic_t);
+		header.num_features = num_features;
+		header.num_trees = n_trees;
+		header.num_nodes = n_nodes;
+		header.num_leaves = n_leaves;
+		header.num_categorical_splits = n_categorical_splits;
+		header.words_per_set = words_per_set;
+		header.compute_law_of_total_variance = compute_law_of_total_variance;
+
+		const char* arrays[7] = {
+			reinterpret_cast<const char*>(nodes), reinterpret_cast<const char*>(roots),
+			reinterpret_cast<const char*>(categorical_sets), reinterpret_cast<const char*>(categorical_children),
+			reinterpret_cast<const char*>(leaf_statistics), reinterpret_cast<const char*>(types),
+			reinterpret_cast<const char*>(bounds)};
+		size_t sizes[7] = {
+			n_nodes*sizeof(node_t), n_trees*sizeof(index_t),
+			n_categorical_splits*words_per_set*sizeof(std::uint64_t), n_categorical_splits*sizeof(index_t),
+			n_leaves*sizeof(leaf_statistic_t), num_features*sizeof(index_t),
+			num_features*sizeof(std::array<num_t,2>)};
+
+		size_t offset = sizeof(header);
+		for (auto i=0u; i<7; ++i){
+			offset = aligned_offset(offset);
+			header.offsets[i] = offset;
+			offset += sizes[i];
+		}
+
+		std::ofstream ofs(filename, std::ios::binary);
+		if (!ofs)
+			throw std::runtime_error("Could not open file " + filename);
+
+		ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		size_t position = sizeof(header);
+		const char padding[64] = {};
+		for (auto i=0u; i<7; ++i){
+			ofs.write(padding, header.offsets[i] - position);
+			if (sizes[i] > 0)
+				ofs.write(arrays[i], sizes[i]);
+			position = header.offsets[i] + sizes[i];
+		}
+		if (!ofs)
+			throw std::runtime_error("Could not write file " + filename);
+	}
+
+
+	/** \brief maps a file written by save_to_mmap_file into memory and uses it without copying
+	 *
+	 * \param filename name of the file
+	 */
+	void load_from_mmap_file(const std::string &filename){
+		auto map = std::make_shared<rfr::util::memory_mapped_file>(filename);
+
+		if (map->size() < sizeof(mmap_header_t))
+			throw std::runtime_error("The file " + filename + " is too small to contain a forest!");
+
+		mmap_header_t header;
+		std::memcpy(&header, map->data(), sizeof(header));
+
+		if (std::memcmp(header.magic, "RFRFRZN", 8) != 0)
+			throw std::runtime_error("The file " + filename + " does not contain a frozen forest!");
+		if (header.version != mmap_file_version)
+			throw std::runtime_error("The file " + filename + " has an unsupported version!");
+		if ((header.byte_order != 0x01020304) || (header.num_t_size != sizeof(num_t)) || (header.index_t_size != sizeof(index_t)) ||
+			(header.node_size != sizeof(node_t)) || (header.leaf_statistic_size != sizeof(leaf_statistic_t)))
+			throw std::runtime_error("The file " + filename + " was written with different types or byte order!");
+
+		// all counts are stored as index_t, and the categorical sets are looked up with words_per_set*64
+		const std::uint64_t max_index = std::numeric_limits<index_t>::max();
+		if ((header.num_features >= categorical_flag) || (header.num_trees > max_index) || (header.num_nodes > max_index) ||
+			(header.num_leaves > max_index) || (header.num_categorical_splits > max_index) || (header.words_per_set > max_index/64))
+			throw std::runtime_error("The file " + filename + " is corrupted!");
+
+		size_t sizes[7] = {
+			checked_size(header.num_nodes, sizeof(node_t), filename), checked_size(header.num_trees, sizeof(index_t), filename),
+			checked_size(header.num_categorical_splits, checked_size(header.words_per_set, sizeof(std::uint64_t), filename), filename),
+			checked_size(header.num_categorical_splits, sizeof(index_t), filename),
+			checked_size(header.num_leaves, sizeof(leaf_statistic_t), filename), checked_size(header.num_features, sizeof(index_t), filename),
+			checked_size(header.num_features, sizeof(std::array<num_t,2>), filename)};
+		for (auto i=0u; i<7; ++i){
+			if ((header.offsets[i] % 64 != 0) || (header.offsets[i] > map->size()) || (sizes[i] > map->size() - header.offsets[i]))
+				throw std::runtime_error("The file " + filename + " is corrupted!");
+		}
+
+		// the forest only changes once the file has passed all checks
+		frozen_forest loaded;
+		const char* base = map->data();
+		loaded.nodes = reinterpret_cast<const node_t*>(base + header.offsets[0]);
+		loaded.roots = reinterpret_cast<const index_t*>(base + header.offsets[1]);
+		loaded.categorical_sets = reinterpret_cast<const std::uint64_t*>(base + header.offsets[2]);
+		loaded.categorical_children = reinterpret_cast<const index_t*>(base + header.offsets[3]);
+		loaded.leaf_statistics = reinterpret_cast<const leaf_statistic_t*>(base + header.offsets[4]);
+		loaded.types = reinterpret_cast<const index_t*>(base + header.offsets[5]);
+		loaded.bounds = reinterpret_cast<const std::array<num_t,2>*>(base + header.offsets[6]);
+
+		loaded.n_trees = header.num_trees;
+		loaded.n_nodes = header.num_nodes;
+		loaded.n_leaves = header.num_leaves;
+		loaded.n_categorical_splits = header.num_categorical_splits;
+		loaded.words_per_set = header.words_per_set;
+		loaded.num_features = header.num_features;
+		loaded.compute_law_of_total_variance = header.compute_law_of_total_variance;
+		loaded.validate_indices(filename);
+
+		loaded.storage.reset();
+		loaded.mapping = map;
+		loaded.num_threads = num_threads;
+		*this = loaded;
+	}
+
+
+	index_t num_trees()  const {return(n_trees);}
+	index_t num_nodes()  const {return(n_nodes);}
+	index_t num_leaves() const {return(n_leaves);}
+
+	std::vector<index_t> get_types() const {return(std::vector<index_t>(types, types + num_features));}
+	std::vector< std::array<num_t,2> > get_bounds() const {return(std::vector< std::array<num_t,2> >(bounds, bounds + num_features));}
+
+	/** \brief whether the arrays live in a file loaded by load_from_mmap_file (mapped, or read into a buffer without RFR_USE_MMAP)*/
+	bool is_memory_mapped() const {return(bool(mapping));}
+};
+
+template <typename num_t, typename response_t, typename index_t>
+constexpr index_t frozen_forest<num_t, response_t, index_t>::leaf_flag;
+
+template <typename num_t, typename response_t, typename index_t>
+constexpr index_t frozen_forest<num_t, response_t, index_t>::categorical_flag;
+
+template <typename num_t, typename response_t, typename index_t>
+constexpr std::uint32_t frozen_forest<num_t, response_t, index_t>::mmap_file_version;
+
+
+}}//namespace rfr::forests
+#endif
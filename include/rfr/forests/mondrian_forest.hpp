@@ -45,8 +45,6 @@ class mondrian_forest{
 	std::vector<tree_t> the_trees;
 	index_t num_features;
 
-	std::vector<std::vector<num_t> > bootstrap_sample_weights;
-	
 	num_t oob_error = NAN;
 	
 	// the forest needs to remember the data types on which it was trained
@@ -65,7 +63,7 @@ class mondrian_forest{
   	template<class Archive>
 	void serialize(Archive & archive)
 	{
-		archive( options, the_trees, num_features, bootstrap_sample_weights, oob_error, types/*, bounds*/);
+		archive( options, the_trees, num_features, oob_error, types/*, bounds*/);
 	}
 
 	mondrian_forest(): options()	{}
@@ -107,7 +105,10 @@ class mondrian_forest{
 		if (options.tree_opts.max_features == 0)
 			throw std::runtime_error("The number of features used for a split is set to zero!");
 		
-		bootstrap_sample_weights.clear();
+		// the predictions of all trees that did not see the data point
+		std::vector<rfr::util::running_statistics<num_t> > oob_prediction_stats;
+		if (options.compute_oob_error)
+			oob_prediction_stats.resize(data.num_data_points());
 
 		for (auto &tree : the_trees){
             std::vector<num_t> bssf (data.num_data_points(), 0); // BootStrap Sample Frequencies
@@ -128,39 +129,23 @@ class mondrian_forest{
 			
 			tree.fit(data, options.tree_opts, bssf, rng);
 			
-			// record sample counts for later use
-			if (options.compute_oob_error)
-				bootstrap_sample_weights.push_back(bssf);
+			// only consider data points that were not part of that bootstrap sample
+			if (options.compute_oob_error){
+				for (auto i=0u; i < data.num_data_points(); i++)
+					if (bssf[i] == 0)
+						oob_prediction_stats[i].push(tree.predict( data.retrieve_data_point(i)));
+			}
 		}
 		
 		oob_error = NAN;
-		index_t amount_obb_test = 0;
-		num_t pred;
-		bool bootstrapable = false;
 		if (options.compute_oob_error){
 			
 			rfr::util::running_statistics<num_t> oob_error_stat;
 			
 			for (auto i=0u; i < data.num_data_points(); i++){
-
-				rfr::util::running_statistics<num_t> prediction_stat;
-
-				for (auto j=0u; j<the_trees.size(); j++){
-					// only consider data points that were not part of that bootstrap sample
-					if (bootstrap_sample_weights[j][i] == 0){
-						amount_obb_test++;
-						pred = the_trees[j].predict( data.retrieve_data_point(i));
-						prediction_stat.push(pred);
-						bootstrapable = true;
-					}
-				}
-				if(bootstrapable){
-					// compute squared error of prediction
-					oob_error_stat.push(std::pow(prediction_stat.mean() - data.response(i), 2));	
-					oob_error = std::sqrt(oob_error_stat.mean());
-				}
-				bootstrapable = false;
-				
+				// compute squared error of prediction
+				if (oob_prediction_stats[i].number_of_points() > 0)
+					oob_error_stat.push(std::pow(oob_prediction_stats[i].mean() - data.response(i), 2));
 			}
 			oob_error = std::sqrt(oob_error_stat.mean());
 		}
@@ -204,6 +189,48 @@ class mondrian_forest{
 	}
     
 
+	/* \brief predictions for many feature vectors stored in one contiguous array
+	 *
+	 * Equivalent to calling predict for every row. The rows are distributed
+	 * over options.num_threads threads.
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of features per vector, has to match the training data
+	 * \param predictions pointer to num_rows values receiving the predictions
+	 */
+	void predict_batch(const num_t *features, index_t num_rows, index_t num_cols, response_t *predictions) const {
+		if (num_cols != num_features)
+			throw std::runtime_error("The number of columns does not match the number of features the forest was trained on!");
+
+		rfr::util::parallel_for_each_row(features, num_rows, num_cols, options.num_threads,
+			[&] (index_t i, const std::vector<num_t> &feature_vector){
+				predictions[i] = predict(feature_vector);
+			});
+	}
+
+	/* \brief mean and variance predictions for many feature vectors stored in one contiguous array
+	 *
+	 * Equivalent to calling predict_mean_var for every row. The rows are distributed
+	 * over options.num_threads threads.
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of features per vector, has to match the training data
+	 * \param means pointer to num_rows values receiving the mean predictions
+	 * \param variances pointer to num_rows values receiving the variance predictions
+	 */
+	void predict_mean_var_batch(const num_t *features, index_t num_rows, index_t num_cols, num_t *means, num_t *variances){
+		if (num_cols != num_features)
+			throw std::runtime_error("The number of columns does not match the number of features the forest was trained on!");
+
+		rfr::util::parallel_for_each_row(features, num_rows, num_cols, options.num_threads,
+			[&] (index_t i, const std::vector<num_t> &feature_vector){
+				std::tie(means[i], variances[i]) = predict_mean_var(feature_vector);
+			});
+	}
+
+
 	response_t predict_median( const std::vector<num_t> &feature_vector){
 
 		// collect the predictions of individual trees
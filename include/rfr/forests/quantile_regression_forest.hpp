@@ -78,6 +78,29 @@ class quantile_regression_forest: public rfr::forests::regression_forest<tree_t,
 		return(rv);
 	}
 
+
+	/* \brief quantile predictions for many feature vectors stored in one contiguous array
+	 *
+	 * Equivalent to calling predict_quantiles for every row. The rows are distributed
+	 * over options.num_threads threads.
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of features per vector, has to match the training data
+	 * \param quantiles a vector of all the quantiles to predict
+	 * \param predictions pointer to num_rows*quantiles.size() values receiving the (sorted) quantiles row by row
+	 */
+	void predict_quantiles_batch (const num_t *features, index_t num_rows, index_t num_cols, const std::vector<num_t> &quantiles, num_t *predictions) const {
+		if (num_cols != super::num_features)
+			throw std::runtime_error("The number of columns does not match the number of features the forest was trained on!");
+
+		rfr::util::parallel_for_each_row(features, num_rows, num_cols, super::options.num_threads,
+			[&] (index_t i, const std::vector<num_t> &feature_vector){
+				auto q = predict_quantiles(feature_vector, quantiles);
+				std::copy(q.begin(), q.end(), predictions + static_cast<size_t>(i)*quantiles.size());
+			});
+	}
+
 };
 
 
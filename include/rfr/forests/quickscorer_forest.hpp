@@ -0,0 +1,380 @@
+#ifndef RFR_QUICKSCORER_FOREST_HPP
+#define RFR_QUICKSCORER_FOREST_HPP
+
+#include <vector>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+
+#include "rfr/util.hpp"
+
+
+// the AVX2 and AVX-512 kernels are compiled for their instruction set only (and only used if the
+// processor supports it), so they need no compiler flags; define RFR_NO_SIMD to leave them out
+#if !defined(RFR_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define RFR_USE_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+
+namespace rfr{ namespace forests{
+
+
+/** \brief a read-only regression forest of small trees evaluated with the QuickScorer algorithm
+ *
+ * Source: "QuickScorer: a Fast Algorithm to Rank Documents with Additive Ensembles of Regression Trees"
+ * by Lucchese et al.
+ *
+ * Every tree may have at most 64 leaves, numbered from left to right, so the leaves a feature vector
+ * can still reach are the bits of one 64 bit word per tree. Every internal node stores the bits of the
+ * leaves in its left subtree; if a feature vector goes to the right child, these leaves are removed
+ * from the tree's word with a single AND. The leaf a feature vector falls into is then the lowest bit
+ * left. The continuous splits of all trees are sorted by their threshold for every feature, so for a
+ * feature vector only the splits it goes right at are visited, in one linear scan per feature and
+ * without following any pointers. Categorical splits are checked one by one.
+ *
+ * Batch predictions evaluate several feature vectors at once with AVX2 (4 per pass) or AVX-512
+ * (8 per pass) if the processor supports it: every split is compared against all of them with
+ * one instruction, and the scan over a feature's splits stops once none of them goes right anymore.
+ * The instruction set is detected at run time, see best_instruction_set.
+ *
+ * Use regression_forest::make_quickscorer to create one. The predictions are exactly the same as the
+ * ones of the forest it was created from.
+ */
+template <typename num_t = float, typename response_t = float, typename index_t = unsigned int>
+class quickscorer_forest{
+  public:
+	typedef rfr::util::weighted_running_statistics<num_t> leaf_statistic_t;
+
+	/** \brief the maximum number of leaves of every tree */
+	static constexpr index_t max_num_leaves = 64;
+
+	/** \brief the kernels available for batch predictions, each one needs the instruction sets before it */
+	enum instruction_set_t {scalar = 0, avx2 = 1, avx512 = 2};
+
+  protected:
+
+	/** \brief a continuous split: feature vectors with values > threshold go right and remove the left leaves*/
+	struct condition_t{
+		num_t threshold;
+		index_t tree_index;
+		std::uint64_t mask;		//!< all bits but the ones of the leaves in the left subtree
+	};
+
+	/** \brief a categorical split: feature vectors with values outside the set go right*/
+	struct categorical_condition_t{
+		index_t feature_index;
+		index_t tree_index;
+		std::uint64_t mask;
+	};
+
+	// the continuous splits of every feature sorted by their threshold
+	std::vector<std::vector<condition_t> > conditions;
+
+	std::vector<categorical_condition_t> categorical_conditions;
+	std::vector<std::uint64_t> categorical_sets;	//!< words_per_set words per categorical condition; values in the set go to the left child
+	index_t words_per_set;
+
+	// the leaves of tree t are leaf_offsets[t], ..., leaf_offsets[t+1]-1 in the order of their bits
+	std::vector<index_t> leaf_offsets;
+	std::vector<leaf_statistic_t> leaf_statistics;
+	std::vector<index_t> leaf_node_indices;		//!< index of every leaf in its original tree
+
+	index_t num_features;
+
+	/** \brief numbers the leaves of the subtree below node from the left and collects the masks of its splits
+	 *
+	 * \return index_t the number of the first leaf not in the subtree
+	 */
+	template <typename tree_t>
+	index_t add_subtree(const tree_t &tree, index_t tree_index, index_t node_index, index_t first_leaf){
+		auto &n = tree.get_node(node_index);
+		if (n.is_a_leaf()){
+			leaf_statistics.push_back(n.leaf_statistic());
+			leaf_node_indices.push_back(node_index);
+			return(first_leaf + 1);
+		}
+
+		index_t first_right_leaf = add_subtree(tree, tree_index, n.get_child_index(0), first_leaf);
+		index_t end_leaf = add_subtree(tree, tree_index, n.get_child_index(1), first_right_leaf);
+
+		// the bits first_leaf, ..., first_right_leaf-1 are cleared
+		std::uint64_t left_leaves = ((first_right_leaf - first_leaf == 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << (first_right_leaf - first_leaf)) - 1)) << first_leaf;
+
+		auto &split = n.get_split();
+		if (std::isnan(split.get_num_split_value())){
+			categorical_conditions.push_back({split.get_feature_index(), tree_index, ~left_leaves});
+
+			auto set = split.get_cat_split_set();
+			if ((set.size() + 63)/64 > words_per_set){
+				// all sets need the same number of words
+				std::vector<std::uint64_t> old_sets(categorical_sets);
+				index_t old_words = words_per_set;
+				words_per_set = (set.size() + 63)/64;
+				categorical_sets.assign((categorical_conditions.size()-1)*words_per_set, 0);
+				for (auto i = 0u; i+1 < categorical_conditions.size(); ++i)
+					std::copy(old_sets.begin() + i*old_words, old_sets.begin() + (i+1)*old_words, categorical_sets.begin() + i*words_per_set);
+			}
+			categorical_sets.resize(categorical_conditions.size()*words_per_set, 0);
+			auto words = std::prev(categorical_sets.end(), words_per_set);
+			for (auto v = 0u; v < set.size(); ++v){
+				if (set[v])
+					words[v/64] |= std::uint64_t(1) << (v%64);
+			}
+		}
+		else
+			conditions.at(split.get_feature_index()).push_back({split.get_num_split_value(), tree_index, ~left_leaves});
+		return(end_leaf);
+	}
+
+  public:
+
+	/** \brief number of threads used for batch predictions (0 means all available cores)*/
+	index_t num_threads;
+
+
+	quickscorer_forest(): quickscorer_forest(0, 1) {}
+
+	/** \brief creates an empty forest, add the trees with add_tree
+	 *
+	 * \param num_feats number of features the trees were trained on
+	 * \param threads number of threads used for batch predictions
+	 */
+	quickscorer_forest(index_t num_feats, index_t threads):
+		conditions(num_feats), words_per_set(0), leaf_offsets(1, 0), num_features(num_feats), num_threads(threads) {}
+
+
+	/** \brief appends a fitted binary tree
+	 *
+	 * The tree has to provide get_node and number_of_leafs, and its splits need
+	 * get_feature_index, get_num_split_value and get_cat_split_set like
+	 * rfr::splits::binary_split_one_feature_rss_loss.
+	 */
+	template <typename tree_t>
+	void add_tree (const tree_t &tree){
+		if (tree.number_of_nodes() == 0)
+			throw std::runtime_error("Cannot add an empty tree!");
+		if (tree.number_of_leafs() > max_num_leaves)
+			throw std::runtime_error("QuickScorer only supports trees with at most 64 leaves!");
+
+		std::vector<size_t> old_sizes;
+		for (auto &c: conditions)
+			old_sizes.push_back(c.size());
+
+		index_t tree_index = num_trees();
+		add_subtree(tree, tree_index, 0, 0);
+		leaf_offsets.push_back(leaf_statistics.size());
+
+		// only the new splits need to be sorted, the old ones already are
+		auto by_threshold = [] (const condition_t &a, const condition_t &b) {return(a.threshold < b.threshold);};
+		for (index_t f = 0; f < num_features; ++f){
+			auto &c = conditions[f];
+			std::sort(c.begin() + old_sizes[f], c.end(), by_threshold);
+			std::inplace_merge(c.begin(), c.begin() + old_sizes[f], c.end(), by_threshold);
+		}
+	}
+
+	index_t num_trees() const {return(leaf_offsets.size()-1);}
+
+
+	/** \brief the most capable instruction set supported by the processor
+	 *
+	 * The vector kernels compare the values as doubles, which is exact for float and double only;
+	 * for other types of num_t, and without RFR_USE_X86_KERNELS, this is always scalar.
+	 */
+	static instruction_set_t best_instruction_set(){
+#ifdef RFR_USE_X86_KERNELS
+		if (std::is_same<num_t, float>::value || std::is_same<num_t, double>::value){
+			static const instruction_set_t best = __builtin_cpu_supports("avx512f") ? avx512 : (__builtin_cpu_supports("avx2") ? avx2 : scalar);
+			return(best);
+		}
+#endif
+		return(scalar);
+	}
+
+	/** \brief how many feature vectors the kernels of an instruction set evaluate at once */
+	static index_t num_lanes(instruction_set_t set) {return((set == avx512) ? 8 : ((set == avx2) ? 4 : 1));}
+
+
+	/** \brief the leaf of every tree a feature vector falls into
+	 *
+	 * \param feature_vector pointer to the num_features values of a feature vector (not checked!)
+	 * \param leaves pointer to num_trees() values receiving the leaves' indices into the leaf statistics
+	 */
+	void find_leaves (const num_t *feature_vector, index_t *leaves) const {
+		std::vector<std::uint64_t> reachable(num_trees());
+		find_leaves(feature_vector, 1, num_features, scalar, reachable.data(), leaves);
+	}
+
+	/** \brief the leaves of up to num_lanes(set) feature vectors
+	 *
+	 * \param features pointer to num_rows feature vectors, one per row of num_cols values (not checked!)
+	 * \param num_rows number of feature vectors, at most num_lanes(set)
+	 * \param num_cols the distance between two rows, at least num_features
+	 * \param set the kernels to use, must be supported by the processor (see best_instruction_set)
+	 * \param reachable scratch space for num_trees()*num_lanes(set) words
+	 * \param leaves pointer to num_rows*num_trees() values receiving the leaves of every row, one row after the other
+	 */
+	void find_leaves (const num_t *features, index_t num_rows, index_t num_cols, instruction_set_t set,
+						std::uint64_t *reachable, index_t *leaves) const {
+		// the words of the rows are interleaved: all words of a tree are next to each other
+		index_t lanes = num_lanes(set);
+		std::fill(reachable, reachable + num_trees()*lanes, ~std::uint64_t(0));
+
+		switch (set){
+#ifdef RFR_USE_X86_KERNELS
+			case avx512: remove_right_leaves_avx512(features, num_rows, num_cols, reachable); break;
+			case avx2: remove_right_leaves_avx2(features, num_rows, num_cols, reachable); break;
+#endif
+			default: remove_right_leaves(features, num_rows, num_cols, lanes, reachable);
+		}
+
+		for (index_t r = 0; r < num_rows; ++r){
+			const num_t *feature_vector = features + static_cast<size_t>(r)*num_cols;
+			for (index_t i = 0; i < categorical_conditions.size(); ++i){
+				auto &c = categorical_conditions[i];
+				index_t v = index_t(feature_vector[c.feature_index]);
+				const std::uint64_t *set = categorical_sets.data() + i*words_per_set;
+				bool in_set = (v < words_per_set*64) && ((set[v/64] >> (v%64)) & 1u);
+				if (!in_set)
+					reachable[c.tree_index*lanes + r] &= c.mask;
+			}
+
+			// the rightmost leaf is never removed, so every word has a bit left
+			for (index_t t = 0; t < num_trees(); ++t)
+				leaves[r*num_trees() + t] = leaf_offsets[t] + rfr::util::count_trailing_zeros(reachable[t*lanes + r]);
+		}
+	}
+
+	/** \brief index of the leaf in the original tree, for the leaves returned by find_leaves */
+	index_t leaf_node_index (index_t leaf) const {return(leaf_node_indices[leaf]);}
+
+	leaf_statistic_t const & get_leaf_statistic (index_t leaf) const {return(leaf_statistics[leaf]);}
+
+
+	/** \brief same as regression_forest::predict */
+	response_t predict (const num_t *feature_vector) const {
+		std::vector<index_t> leaves(num_trees());
+		find_leaves(feature_vector, leaves.data());
+		return(mean_prediction(leaves.data()));
+	}
+
+	response_t predict (const std::vector<num_t> &feature_vector) const {
+		return(predict(feature_vector.data()));
+	}
+
+
+	/** \brief same as regression_forest::predict_batch, using the kernels of best_instruction_set() */
+	void predict_batch(const num_t *features, index_t num_rows, index_t num_cols, response_t *predictions) const {
+		predict_batch(features, num_rows, num_cols, predictions, best_instruction_set());
+	}
+
+	/** \brief same as above, but with the kernels of the given instruction set
+	 *
+	 * All instruction sets give exactly the same predictions.
+	 *
+	 * \param set the kernels to use, must be supported by the processor (see best_instruction_set)
+	 */
+	void predict_batch(const num_t *features, index_t num_rows, index_t num_cols, response_t *predictions, instruction_set_t set) const {
+		if (num_cols != num_features)
+			throw std::runtime_error("The number of columns does not match the number of features the forest was trained on!");
+		if (set > best_instruction_set())
+			throw std::runtime_error("The processor does not support the requested instruction set!");
+
+		// every work item is a block of rows, evaluated num_lanes(set) at a time with the buffers of its worker
+		const index_t lanes = num_lanes(set), block_size = 64;
+		index_t num_blocks = (num_rows + block_size - 1)/block_size;
+
+		unsigned int num_workers = rfr::util::effective_num_threads(num_threads, num_blocks);
+		std::vector<std::vector<std::uint64_t> > reachable(num_workers, std::vector<std::uint64_t>(num_trees()*lanes));
+		std::vector<std::vector<index_t> > leaves(num_workers, std::vector<index_t>(num_trees()*lanes));
+
+		rfr::util::parallel_for_with_worker<index_t>(num_blocks, num_workers, [&] (index_t b, unsigned int w){
+			index_t end = std::min<index_t>(num_rows, (b+1)*block_size);
+			for (index_t first = b*block_size; first < end; first += lanes){
+				index_t n = std::min<index_t>(lanes, end - first);
+				find_leaves(features + static_cast<size_t>(first)*num_cols, n, num_cols, set, reachable[w].data(), leaves[w].data());
+				for (index_t r = 0; r < n; ++r)
+					predictions[first + r] = mean_prediction(leaves[w].data() + r*num_trees());
+			}
+		});
+	}
+
+  protected:
+
+	/** \brief the mean of the leaves' means, in the order of the trees like regression_forest::predict */
+	response_t mean_prediction (const index_t *leaves) const {
+		rfr::util::running_statistics<num_t> mean_stats;
+		for (index_t t = 0; t < num_trees(); ++t)
+			mean_stats.push(leaf_statistics[leaves[t]].mean());
+		return(mean_stats.mean());
+	}
+
+	/** \brief applies the continuous splits the rows go right at to their words, one row after the other */
+	void remove_right_leaves (const num_t *features, index_t num_rows, index_t num_cols, index_t lanes, std::uint64_t *reachable) const {
+		for (index_t r = 0; r < num_rows; ++r){
+			const num_t *feature_vector = features + static_cast<size_t>(r)*num_cols;
+			for (index_t f = 0; f < num_features; ++f){
+				num_t x = feature_vector[f];
+				// a NAN goes left everywhere, just like for the original splits
+				for (auto &c: conditions[f]){
+					if (!(x > c.threshold)) break;
+					reachable[c.tree_index*lanes + r] &= c.mask;
+				}
+			}
+		}
+	}
+
+#ifdef RFR_USE_X86_KERNELS
+	/** \brief the values of a feature of up to lanes rows as doubles, missing rows are NAN so they never go right */
+	static void gather_feature (const num_t *features, index_t num_rows, index_t num_cols, index_t f, index_t lanes, double *x){
+		for (index_t r = 0; r < lanes; ++r)
+			x[r] = (r < num_rows) ? double(features[static_cast<size_t>(r)*num_cols + f]) : std::numeric_limits<double>::quiet_NaN();
+	}
+
+	/** \brief remove_right_leaves for up to 4 rows at once */
+	__attribute__((target("avx2")))
+	void remove_right_leaves_avx2 (const num_t *features, index_t num_rows, index_t num_cols, std::uint64_t *reachable) const {
+		alignas(32) double values[4];
+		for (index_t f = 0; f < num_features; ++f){
+			gather_feature(features, num_rows, num_cols, f, 4, values);
+			__m256d x = _mm256_load_pd(values);
+			for (auto &c: conditions[f]){
+				// all bits are set in the lanes that go right; comparisons with a NAN are false
+				__m256d right = _mm256_cmp_pd(x, _mm256_set1_pd(double(c.threshold)), _CMP_GT_OQ);
+				if (_mm256_movemask_pd(right) == 0) break;
+				__m256i removed = _mm256_andnot_si256(_mm256_set1_epi64x(static_cast<long long>(c.mask)), _mm256_castpd_si256(right));
+				__m256i *words = reinterpret_cast<__m256i*>(reachable + c.tree_index*4);
+				_mm256_storeu_si256(words, _mm256_andnot_si256(removed, _mm256_loadu_si256(words)));
+			}
+		}
+	}
+
+	/** \brief remove_right_leaves for up to 8 rows at once */
+	__attribute__((target("avx512f")))
+	void remove_right_leaves_avx512 (const num_t *features, index_t num_rows, index_t num_cols, std::uint64_t *reachable) const {
+		alignas(64) double values[8];
+		for (index_t f = 0; f < num_features; ++f){
+			gather_feature(features, num_rows, num_cols, f, 8, values);
+			__m512d x = _mm512_load_pd(values);
+			for (auto &c: conditions[f]){
+				__mmask8 right = _mm512_cmp_pd_mask(x, _mm512_set1_pd(double(c.threshold)), _CMP_GT_OQ);
+				if (right == 0) break;
+				std::uint64_t *words = reachable + c.tree_index*8;
+				__m512i w = _mm512_loadu_si512(words);
+				_mm512_storeu_si512(words, _mm512_mask_and_epi64(w, right, w, _mm512_set1_epi64(static_cast<long long>(c.mask))));
+			}
+		}
+	}
+#endif
+};
+
+
+}}//namespace rfr::forests
+#endif
@@ -12,6 +12,8 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <cstdint>
+#include <limits>
 
 
 #include <cereal/cereal.hpp>
@@ -27,6 +29,9 @@
 
 #include "rfr/trees/tree_options.hpp"
 #include "rfr/forests/forest_options.hpp"
+#include "rfr/forests/frozen_forest.hpp"
+#include "rfr/forests/quickscorer_forest.hpp"
+#include "rfr/forests/cpp_code_generator.hpp"
 #include "rfr/util.hpp"
 
 namespace rfr{ namespace forests{
@@ -46,9 +51,16 @@ class regression_forest{
 	std::vector<tree_type> the_trees;
 	index_t num_features;
 
-	std::vector<std::vector<num_t> > bootstrap_sample_weights;
+	// instead of the (bootstrap) sample of every tree, only the seed of its RNG is stored;
+	// together with the sampling parameters used in fit, the sample can be drawn again
+	std::vector<std::uint64_t> tree_seeds;
+	index_t num_training_points;
+	index_t sample_size = 0;
+	bool bootstrapped = false;
 	
 	num_t oob_error = NAN;
+	// the predictions of all trees that did not see the data point
+	std::vector<rfr::util::running_statistics<num_t> > oob_prediction_stats;
 	
 	// the forest needs to remember the data types on which it was trained
 	std::vector<index_t> types;
@@ -64,16 +76,20 @@ class regression_forest{
   	template<class Archive>
 	void serialize(Archive & archive)
 	{
-		archive( options, the_trees, num_features, bootstrap_sample_weights, oob_error, types, bounds);
+		archive( options, the_trees, num_features, tree_seeds, num_training_points, sample_size, bootstrapped, oob_error, oob_prediction_stats, types, bounds);
 	}
 
-	regression_forest(): options()	{}
+	regression_forest(): num_features(0), num_training_points(0), options()	{}
 	
-	regression_forest(forest_options<num_t, response_t, index_t> opts): options(opts){}
+	regression_forest(forest_options<num_t, response_t, index_t> opts): num_features(0), num_training_points(0), options(opts){}
 
 	virtual ~regression_forest()	{};
 
 	/**\brief growing the random forest for a given data set
+	 * 
+	 * The trees are grown in parallel using options.num_threads threads. Every
+	 * tree draws from its own RNG stream seeded by rng, so the result is the
+	 * same for any number of threads.
 	 * 
 	 * \param data a filled data container
 	 * \param rng the random number generator to be used
@@ -96,12 +112,6 @@ class regression_forest{
 			bounds[i][1] = p.second;
 		}
 
-		the_trees.resize(options.num_trees);
-
-
-		std::vector<index_t> data_indices( data.num_data_points());
-		std::iota(data_indices.begin(), data_indices.end(), 0);
-
 		num_features = data.num_features();
 		
 		// catch some stupid things that will make the forest crash when fitting
@@ -111,54 +121,60 @@ class regression_forest{
 		if (options.tree_opts.max_features == 0)
 			throw std::runtime_error("The number of features used for a split is set to zero!");
 		
-		bootstrap_sample_weights.clear();
-
-		for (auto &tree : the_trees){
-            std::vector<num_t> bssf (data.num_data_points(), 0); // BootStrap Sample Frequencies
-			// prepare the data(sub)set
-			if (options.do_bootstrapping){
-                std::uniform_int_distribution<index_t> dist (0,data.num_data_points()-1);
-                for (auto i=0u; i < options.num_data_points_per_tree; ++i){
-					bssf[dist(rng)]+=1;
-				}
-			}
-			else{
-				std::shuffle(data_indices.begin(), data_indices.end(), rng);
-                for (auto i=0u; i < options.num_data_points_per_tree; ++i)
-                    bssf[data_indices[i]] += 1;
-			}
-			
-			tree.fit(data, options.tree_opts, bssf, rng);
-			
-			// record sample counts for later use
-			if (options.compute_oob_error)
-				bootstrap_sample_weights.push_back(bssf);
-		}
-		
-		oob_error = NAN;
-		
-		if (options.compute_oob_error){
-			
-			rfr::util::running_statistics<num_t> oob_error_stat;
-			
-			for (auto i=0u; i < data.num_data_points(); i++){
+		num_training_points = data.num_data_points();
+		sample_size = options.num_data_points_per_tree;
+		bootstrapped = options.do_bootstrapping;
 
-				rfr::util::running_statistics<num_t> prediction_stat;
+		the_trees.clear();
+		tree_seeds.clear();
+		oob_prediction_stats.clear();
+		if (options.compute_oob_error)
+			oob_prediction_stats.resize(data.num_data_points());
 
-				for (auto j=0u; j<the_trees.size(); j++){
-					// only consider data points that were not part of that bootstrap sample
-					if (bootstrap_sample_weights[j][i] == 0)
-						prediction_stat.push(the_trees[j].predict( data.retrieve_data_point(i)));
-				}
-				
-				// compute squared error of prediction
+		grow_trees(data, 0, options.num_trees, rng);
+	}
 
-				if (prediction_stat.number_of_points() > 0u){
-					oob_error_stat.push(std::pow(prediction_stat.mean() - data.response(i), (num_t) 2));
-				}
-			}
-			oob_error = std::sqrt(oob_error_stat.mean());
+
+	/** \brief grows additional trees into an already fitted (or loaded) forest
+	 *
+	 * The first trees stay untouched. The new ones use the same sampling as in fit and the
+	 * current options.tree_opts. If the out-of-bag error was computed in fit, it is updated
+	 * with the new trees. Using the same rng, fitting n trees and adding k gives the same
+	 * forest as fitting n+k trees right away.
+	 *
+	 * \param data the container with the training data used in fit
+	 * \param num_new_trees the number of trees to add
+	 * \param rng the random number generator to be used
+	 */
+	virtual void add_trees(const rfr::data_containers::base<num_t, response_t, index_t> &data, index_t num_new_trees, rng_type &rng){
+		if (the_trees.empty())
+			throw std::runtime_error("Only a fitted forest can be extended. Call fit first!");
+
+		if ((data.num_features() != num_features) || (data.num_data_points() != num_training_points))
+			throw std::runtime_error("The data does not match the data the forest was fitted on!");
+
+		for (auto i=0u; i<data.num_features(); ++i){
+			if (data.get_type_of_feature(i) != types[i])
+				throw std::runtime_error("The feature types do not match the data the forest was fitted on!");
 		}
+
+		grow_trees(data, the_trees.size(), num_new_trees, rng);
+	}
+
+
+	/* \brief the (bootstrap) sample of a tree as the number of times every data point is in it
+	 *
+	 * The sample is not stored, but drawn again from the tree's seed.
+	 *
+	 * \param tree_index the index of the tree
+	 * \return std::vector<index_t> how often every training data point was used by the tree
+	 */
+	std::vector<index_t> bootstrap_sample_counts(index_t tree_index) const {
+		if (tree_index >= tree_seeds.size())
+			throw std::runtime_error("The tree index is out of range!");
+		rng_type tree_rng = rfr::util::make_rng<rng_type>(tree_seeds[tree_index]);
+		auto bssf = draw_sample_weights(tree_rng);
+		return(std::vector<index_t>(bssf.begin(), bssf.end()));
 	}
 
 
@@ -192,28 +208,226 @@ class regression_forest{
 	* \param weighted_data whether the data had importance weights
 	* \return std::pair<response_t, num_t> mean and variance prediction
     */
-    std::pair<num_t, num_t> predict_mean_var( const std::vector<num_t> &feature_vector, bool weighted_data = false){
+    std::pair<num_t, num_t> predict_mean_var( const std::vector<num_t> &feature_vector, bool weighted_data = false) const{
 
 		// collect the predictions of individual trees
 		rfr::util::running_statistics<num_t> mean_stats, var_stats;
-		for (auto &tree: the_trees){
-			auto stat = tree.leaf_statistic(feature_vector);
-			mean_stats.push(stat.mean());
-			if (stat.number_of_points() > 1){
-				if (weighted_data) var_stats.push(stat.variance_unbiased_importance());
-				else var_stats.push(stat.variance_unbiased_frequency());
-			} else{
-				var_stats.push(0);
+		for (auto &tree: the_trees)
+			push_leaf_statistic(tree.leaf_statistic(feature_vector), mean_stats, var_stats, weighted_data);
+		return(combine_mean_var(mean_stats, var_stats));
+	}
+
+
+	/* \brief predictions for many feature vectors stored in one contiguous array
+	 *
+	 * Equivalent to calling predict for every row, but without creating a
+	 * vector per query. Tiles of rows are sent through one tree at a time
+	 * (see for_each_tile) and distributed over options.num_threads threads.
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of features per vector, has to match the training data
+	 * \param predictions pointer to num_rows values receiving the predictions
+	 */
+	void predict_batch(const num_t *features, index_t num_rows, index_t num_cols, response_t *predictions) const {
+		if (num_cols != num_features)
+			throw std::runtime_error("The number of columns does not match the number of features the forest was trained on!");
+
+		for_each_tile(features, num_rows, num_cols, [&] (index_t first, index_t n, const std::vector<index_t> &leaves){
+			for (index_t j = 0; j < n; ++j){
+				rfr::util::running_statistics<num_t> mean_stats;
+				for (index_t t = 0; t < the_trees.size(); ++t)
+					mean_stats.push(the_trees[t].get_node(leaves[t*n + j]).leaf_statistic().mean());
+				predictions[first + j] = mean_stats.mean();
 			}
+		});
+	}
+
+
+	/* \brief mean and variance predictions for many feature vectors stored in one contiguous array
+	 *
+	 * Equivalent to calling predict_mean_var for every row. Like predict_batch, tiles of
+	 * rows are sent through one tree at a time and distributed over options.num_threads threads.
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of features per vector, has to match the training data
+	 * \param means pointer to num_rows values receiving the mean predictions
+	 * \param variances pointer to num_rows values receiving the variance predictions
+	 * \param weighted_data whether the data had importance weights, see predict_mean_var
+	 */
+	void predict_mean_var_batch(const num_t *features, index_t num_rows, index_t num_cols, num_t *means, num_t *variances, bool weighted_data = false) const {
+		if (num_cols != num_features)
+			throw std::runtime_error("The number of columns does not match the number of features the forest was trained on!");
+
+		for_each_tile(features, num_rows, num_cols, [&] (index_t first, index_t n, const std::vector<index_t> &leaves){
+			for (index_t j = 0; j < n; ++j){
+				rfr::util::running_statistics<num_t> mean_stats, var_stats;
+				for (index_t t = 0; t < the_trees.size(); ++t)
+					push_leaf_statistic(the_trees[t].get_node(leaves[t*n + j]).leaf_statistic(), mean_stats, var_stats, weighted_data);
+				std::tie(means[first + j], variances[first + j]) = combine_mean_var(mean_stats, var_stats);
+			}
+		});
+	}
+
+
+	/* \brief the leaf of every tree for many feature vectors stored in one contiguous array
+	 *
+	 * The leaves are found like in predict_batch. Quantities that compare pairs of points,
+	 * like kernel_matrix and covariance_matrix, only need these indices instead of sending
+	 * both points of every pair through all trees.
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of features per vector, has to match the training data
+	 * \param leaf_indices pointer to num_rows*num_trees() values; leaf_indices[i*num_trees() + t] receives the node index of row i's leaf in tree t
+	 */
+	void predict_leaf_indices(const num_t *features, index_t num_rows, index_t num_cols, index_t *leaf_indices) const {
+		if (num_cols != num_features)
+			throw std::runtime_error("The number of columns does not match the number of features the forest was trained on!");
+
+		index_t T = the_trees.size();
+		for_each_tile(features, num_rows, num_cols, [&] (index_t first, index_t n, const std::vector<index_t> &leaves){
+			for (index_t j = 0; j < n; ++j)
+				for (index_t t = 0; t < T; ++t)
+					leaf_indices[static_cast<size_t>(first + j)*T + t] = leaves[t*n + j];
+		});
+	}
+
+
+	/* \brief the number of columns of the forest embedding, i.e. the number of leaves of all trees */
+	index_t embedding_dimension() const {
+		index_t d = 0;
+		for (auto &t: the_trees)
+			d += t.number_of_leafs();
+		return(d);
+	}
+
+	/* \brief sparse one-hot encoding of the leaves the feature vectors fall into (forest embedding)
+	 *
+	 * Every leaf is one of embedding_dimension() columns; the leaves of tree t come after the
+	 * ones of tree t-1 and are ordered by their node index. Every row has exactly one 1 per tree,
+	 * so only the columns of the ones are stored, which is the CSR format with the row
+	 * offsets i*num_trees() and all values 1. Two points fall into the same leaf of a tree
+	 * if and only if they share the column.
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of features per vector, has to match the training data
+	 * \param column_indices pointer to num_rows*num_trees() values receiving the columns of the ones, row by row
+	 */
+	void forest_embedding(const num_t *features, index_t num_rows, index_t num_cols, index_t *column_indices) const {
+		predict_leaf_indices(features, num_rows, num_cols, column_indices);
+
+		// the column of every leaf, indexed by tree and node
+		index_t T = the_trees.size();
+		std::vector<std::vector<index_t> > columns(T);
+		index_t next_column = 0;
+		for (index_t t = 0; t < T; ++t){
+			columns[t].resize(the_trees[t].number_of_nodes());
+			for (index_t i = 0; i < columns[t].size(); ++i)
+				if (the_trees[t].get_node(i).is_a_leaf())
+					columns[t][i] = next_column++;
 		}
-	    num_t var = mean_stats.variance_sample();
-		if (options.compute_law_of_total_variance) {
-			return std::pair<num_t, num_t> (mean_stats.mean(), std::max<num_t>(0, var + var_stats.mean()) );
-		}
-		return std::pair<num_t, num_t> (mean_stats.mean(), std::max<num_t>(0, var) );
+
+		rfr::util::parallel_for<index_t>(num_rows, options.num_threads, [&] (index_t i){
+			for (index_t t = 0; t < T; ++t){
+				index_t &c = column_indices[static_cast<size_t>(i)*T + t];
+				c = columns[t][c];
+			}
+		});
 	}
 
 
+	/* \brief the kernel of all pairs of many feature vectors
+	 *
+	 * Same as calling kernel for every pair, but every feature vector is only sent through
+	 * the trees once (see predict_leaf_indices).
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of features per vector, has to match the training data
+	 * \param kernel pointer to num_rows*num_rows values receiving the kernel matrix
+	 */
+	void kernel_matrix(const num_t *features, index_t num_rows, index_t num_cols, num_t *kernel) const {
+		index_t T = the_trees.size();
+		std::vector<index_t> leaves(static_cast<size_t>(num_rows)*T);
+		predict_leaf_indices(features, num_rows, num_cols, leaves.data());
+
+		for_each_pair(num_rows, kernel, [&] (index_t i, index_t j){
+			rfr::util::running_statistics<num_t> stat;
+			for (index_t t = 0; t < T; ++t)
+				stat.push(leaves[static_cast<size_t>(i)*T + t] == leaves[static_cast<size_t>(j)*T + t]);
+			return(stat.mean());
+		});
+	}
+
+	/* \brief the covariance of all pairs of many feature vectors
+	 *
+	 * Same as calling covariance for every pair, but every feature vector is only sent through
+	 * the trees once (see predict_leaf_indices).
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of features per vector, has to match the training data
+	 * \param covariance pointer to num_rows*num_rows values receiving the covariance matrix
+	 */
+	void covariance_matrix(const num_t *features, index_t num_rows, index_t num_cols, num_t *covariance) const {
+		index_t T = the_trees.size();
+		std::vector<index_t> leaves(static_cast<size_t>(num_rows)*T);
+		predict_leaf_indices(features, num_rows, num_cols, leaves.data());
+
+		// the predictions of the individual trees
+		std::vector<num_t> predictions(leaves.size());
+		rfr::util::parallel_for<index_t>(num_rows, options.num_threads, [&] (index_t i){
+			for (index_t t = 0; t < T; ++t){
+				size_t k = static_cast<size_t>(i)*T + t;
+				predictions[k] = response_t(the_trees[t].get_node(leaves[k]).leaf_statistic().mean());
+			}
+		});
+
+		for_each_pair(num_rows, covariance, [&] (index_t i, index_t j){
+			rfr::util::running_covariance<num_t> run_cov_of_means;
+			for (index_t t = 0; t < T; ++t)
+				run_cov_of_means.push(predictions[static_cast<size_t>(i)*T + t], predictions[static_cast<size_t>(j)*T + t]);
+			return(run_cov_of_means.covariance());
+		});
+	}
+
+
+	/* \brief creates a compact, read-only copy of the forest for fast predictions
+	 *
+	 * See rfr::forests::frozen_forest. The copy makes exactly the same predictions
+	 * (predict, predict_mean_var and their batch versions), but it cannot be
+	 * updated or refitted.
+	 */
+	frozen_forest<num_t, response_t, index_t> freeze() const {
+		if (the_trees.empty())
+			throw std::runtime_error("Cannot freeze a forest that has not been fitted!");
+
+		frozen_forest<num_t, response_t, index_t> frozen(num_features, types, bounds, options.compute_law_of_total_variance, options.num_threads);
+		for (auto &t: the_trees)
+			frozen.add_tree(t);
+		return(frozen);
+	}
+
+
+	/* \brief creates a copy of the forest evaluated with the QuickScorer algorithm
+	 *
+	 * See rfr::forests::quickscorer_forest. Every tree may have at most 64 leaves
+	 * (e.g. by setting tree_options::max_num_leaves), otherwise a std::runtime_error is thrown.
+	 * The copy makes exactly the same predictions as predict and predict_batch.
+	 */
+	quickscorer_forest<num_t, response_t, index_t> make_quickscorer() const {
+		if (the_trees.empty())
+			throw std::runtime_error("Cannot convert a forest that has not been fitted!");
+
+		quickscorer_forest<num_t, response_t, index_t> qs(num_features, options.num_threads);
+		for (auto &t: the_trees)
+			qs.add_tree(t);
+		return(qs);
+	}
+
 	/* \brief predict the mean and the variance deviation for a configuration marginalized over a given set of partial configurations
 	 * 
 	 * This function will be mostly used to predict the mean over a given set of instances, but could be used to marginalize over any discrete set of partial configurations.
@@ -329,8 +543,9 @@ class regression_forest{
 		rfr::util::running_statistics<num_t> stat;
 
 		for (auto &t: the_trees){
-			auto l1 = t.find_leaf_index(f1);
-			auto l2 = t.find_leaf_index(f2);
+			index_t l1, l2;
+			t.find_leaf_indices(f1.data(), 1, f1.size(), &l1);
+			t.find_leaf_indices(f2.data(), 1, f2.size(), &l2);
 
 			stat.push(l1==l2);
 		}
@@ -345,7 +560,9 @@ class regression_forest{
 		rv.reserve(the_trees.size());
 
 		for (auto &t: the_trees){
-			rv.push_back(t.leaf_entries(feature_vector));
+			index_t leaf;
+			t.find_leaf_indices(feature_vector.data(), 1, feature_vector.size(), &leaf);
+			rv.push_back(t.get_node(leaf).responses());
 		}
 		return(rv);
 	}
@@ -400,6 +617,19 @@ class regression_forest{
 	
 	num_t out_of_bag_error(){return(oob_error);}
 
+	/* \brief the out-of-bag prediction for every training data point
+	 *
+	 * Only available if options.compute_oob_error was set during fitting.
+	 * Data points that were part of every bootstrap sample get NaN.
+	 */
+	std::vector<num_t> out_of_bag_predictions() const {
+		std::vector<num_t> predictions;
+		predictions.reserve(oob_prediction_stats.size());
+		for (auto &stat: oob_prediction_stats)
+			predictions.push_back(stat.mean());
+		return(predictions);
+	}
+
 	/* \brief writes serialized representation into a binary file
 	 * 
 	 * \param filename name of the file to store the forest in. Make sure that the directory exists!
@@ -459,6 +689,24 @@ class regression_forest{
 		}
 	}
 
+	/* \brief writes the forest as a self-contained C++ source file
+	 *
+	 * See rfr::forests::cpp_code_generator. Compiled into a shared object, the functions
+	 * predict and predict_mean_var of the file give the same results as the ones of the forest.
+	 *
+	 * \param filename name of the source file to write. Make sure that the directory exists!
+	 * \param symbol_prefix put in front of the names of the exported functions, e.g. "my_forest_" for my_forest_predict
+	 */
+	void save_cpp_source(const std::string filename, const std::string symbol_prefix = "") const {
+		if (the_trees.empty())
+			throw std::runtime_error("Cannot generate code for a forest that has not been fitted!");
+
+		cpp_code_generator<num_t, response_t, index_t> generator(num_features, options.compute_law_of_total_variance, symbol_prefix);
+		for (auto &t: the_trees)
+			generator.add_tree(t);
+		generator.save(filename);
+	}
+
 	void print_info(){
 		for (auto t: the_trees){
 			t.print_info();
@@ -467,7 +715,144 @@ class regression_forest{
 
 
 	virtual unsigned int num_trees (){ return(the_trees.size());}
-	
+
+  protected:
+
+	/** \brief calls f(first, n, leaves) for every tile of up to 64 consecutive rows
+	 *
+	 * The tile's rows are sent through one tree after another (see find_leaf_indices of the tree),
+	 * so every tree's upper levels are loaded into cache once per tile instead of once per row.
+	 * leaves[t*n + j] is the leaf of row first+j in tree t. The tiles are distributed over
+	 * options.num_threads threads, so f should only write the outputs of its own rows.
+	 */
+	template <typename function_t>
+	void for_each_tile(const num_t *features, index_t num_rows, index_t num_cols, function_t f) const {
+		const index_t tile_size = 64;
+		index_t num_tiles = (num_rows + tile_size - 1)/tile_size;
+
+		rfr::util::parallel_for<index_t>(num_tiles, options.num_threads, [&] (index_t b){
+			index_t first = b*tile_size;
+			index_t n = std::min<index_t>(tile_size, num_rows - first);
+			std::vector<index_t> leaves(the_trees.size()*n);
+			for (index_t t = 0; t < the_trees.size(); ++t)
+				the_trees[t].find_leaf_indices(features + static_cast<size_t>(first)*num_cols, n, num_cols, &leaves[t*n]);
+			f(first, n, leaves);
+		});
+	}
+
+	/** \brief fills the num_rows x num_rows matrix with f(i,j)
+	 *
+	 * Both halves are computed, because the rounding of the running covariance depends on
+	 * the order of its arguments. The rows are distributed over options.num_threads threads.
+	 */
+	template <typename function_t>
+	void for_each_pair(index_t num_rows, num_t *matrix, function_t f) const {
+		rfr::util::parallel_for<index_t>(num_rows, options.num_threads, [&] (index_t i){
+			for (index_t j = 0; j < num_rows; ++j)
+				matrix[static_cast<size_t>(i)*num_rows + j] = f(i, j);
+		});
+	}
+
+	/** \brief adds the mean and the variance of one tree's leaf to the statistics of predict_mean_var */
+	static void push_leaf_statistic(const rfr::util::weighted_running_statistics<num_t> &stat,
+									rfr::util::running_statistics<num_t> &mean_stats, rfr::util::running_statistics<num_t> &var_stats,
+									bool weighted_data){
+		mean_stats.push(stat.mean());
+		if (stat.number_of_points() > 1){
+			if (weighted_data) var_stats.push(stat.variance_unbiased_importance());
+			else var_stats.push(stat.variance_unbiased_frequency());
+		} else{
+			var_stats.push(0);
+		}
+	}
+
+	/** \brief the mean and variance prediction from the statistics collected by push_leaf_statistic */
+	std::pair<num_t, num_t> combine_mean_var(const rfr::util::running_statistics<num_t> &mean_stats, const rfr::util::running_statistics<num_t> &var_stats) const {
+	    num_t var = mean_stats.variance_sample();
+		if (options.compute_law_of_total_variance) {
+			return std::pair<num_t, num_t> (mean_stats.mean(), std::max<num_t>(0, var + var_stats.mean()) );
+		}
+		return std::pair<num_t, num_t> (mean_stats.mean(), std::max<num_t>(0, var) );
+	}
+
+	/** \brief grows all trees starting with the_trees[first_tree] and updates the out-of-bag error
+	 *
+	 * The trees are grown in parallel, every one with its own RNG seeded by rng, and the trees
+	 * grown by the same thread share one rfr::trees::fit_workspace. For the out-of-bag error,
+	 * each tree sends its out-of-bag data points through itself once right after it is grown; the predictions
+	 * are then collected per data point from the statistics of these leaves.
+	 *
+	 * \param data the training data
+	 * \param first_tree index of the first tree to grow, the ones before are kept
+	 * \param num_new_trees the number of trees to grow
+	 * \param rng the random number generator to draw the trees' seeds from
+	 */
+	void grow_trees(const rfr::data_containers::base<num_t, response_t, index_t> &data, index_t first_tree, index_t num_new_trees, rng_type &rng){
+
+		the_trees.resize(first_tree + num_new_trees);
+		tree_seeds.resize(first_tree + num_new_trees);
+		for (auto t=first_tree; t < tree_seeds.size(); ++t)
+			tree_seeds[t] = rng();
+		options.num_trees = the_trees.size();
+
+		// the leaf of every out-of-bag data point in every new tree, only needed for the out-of-bag error;
+		// the trees mark the data points in their bootstrap sample with in_bag
+		bool update_oob = !oob_prediction_stats.empty();
+		const index_t in_bag = std::numeric_limits<index_t>::max();
+		std::vector<std::vector<index_t> > leaf_indices;
+		if (update_oob)
+			leaf_indices.resize(num_new_trees);
+
+		// every thread fits its trees with the same scratch space, which is released after the fit
+		unsigned int num_workers = rfr::util::effective_num_threads(options.num_threads, num_new_trees);
+		std::vector<typename tree_type::workspace_t> workspaces(num_workers);
+
+		rfr::util::parallel_for_with_worker<index_t>(num_new_trees, num_workers, [&] (index_t j, unsigned int w){
+			index_t t = first_tree + j;
+			rng_type tree_rng = rfr::util::make_rng<rng_type>(tree_seeds[t]);
+			auto bssf = draw_sample_weights(tree_rng); // BootStrap Sample Frequencies
+
+			the_trees[t].fit(data, options.tree_opts, bssf, tree_rng, update_oob ? &leaf_indices[j] : nullptr, workspaces[w]);
+		});
+		
+		oob_error = NAN;
+		if (update_oob){
+
+			// every data point's prediction only uses the trees that did not see it
+			rfr::util::parallel_for<index_t>(data.num_data_points(), options.num_threads, [&] (index_t i){
+				for (auto j=0u; j<num_new_trees; j++){
+					if (leaf_indices[j][i] != in_bag)
+						oob_prediction_stats[i].push(the_trees[first_tree+j].get_node(leaf_indices[j][i]).leaf_statistic().mean());
+				}
+			});
+
+			// compute squared error of prediction
+			rfr::util::running_statistics<num_t> oob_error_stat;
+			for (auto i=0u; i < data.num_data_points(); i++){
+				if (oob_prediction_stats[i].number_of_points() > 0u)
+					oob_error_stat.push(std::pow(oob_prediction_stats[i].mean() - data.response(i), (num_t) 2));
+			}
+			oob_error = std::sqrt(oob_error_stat.mean());
+		}
+	}
+
+	/** \brief draws the (bootstrap) sample of a tree with the sampling parameters of the last fit */
+	std::vector<num_t> draw_sample_weights(rng_type &tree_rng) const {
+		std::vector<num_t> bssf (num_training_points, 0);
+		if (bootstrapped){
+			std::uniform_int_distribution<index_t> dist (0,num_training_points-1);
+			for (auto i=0u; i < sample_size; ++i)
+				bssf[dist(tree_rng)]+=1;
+		}
+		else{
+			std::vector<index_t> data_indices(num_training_points);
+			std::iota(data_indices.begin(), data_indices.end(), 0);
+			std::shuffle(data_indices.begin(), data_indices.end(), tree_rng);
+			for (auto i=0u; i < sample_size; ++i)
+				bssf[data_indices[i]] += 1;
+		}
+		return(bssf);
+	}
 };
 
 
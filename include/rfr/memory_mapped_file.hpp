@@ -0,0 +1,110 @@
+#ifndef RFR_MEMORY_MAPPED_FILE_HPP
+#define RFR_MEMORY_MAPPED_FILE_HPP
+
+#include <string>
+#include <stdexcept>
+#include <cstddef>
+
+// the POSIX memory map is only used where it exists; define RFR_NO_MMAP to always read the files into memory instead
+#if !defined(RFR_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define RFR_USE_MMAP 1
+#endif
+
+#ifdef RFR_USE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#include <fstream>
+#include <vector>
+#endif
+
+
+namespace rfr{ namespace util{
+
+
+/** \brief read-only view of a whole file
+ *
+ * With RFR_USE_MMAP, the file is memory mapped and unmapped when the object is destroyed.
+ * Several processes mapping the same file share its pages in the page cache. Without it
+ * (on platforms without POSIX, or if RFR_NO_MMAP is defined), the file is read into a private
+ * buffer with a std::ifstream, so the contents are the same, but not shared.
+ */
+class memory_mapped_file{
+	const char* ptr;
+	size_t length;
+#ifndef RFR_USE_MMAP
+	std::vector<char> buffer;
+#endif
+
+  public:
+	/** \brief maps (or reads) the file, throws a std::runtime_error if that fails */
+	memory_mapped_file(const std::string &filename): ptr(nullptr), length(0){
+#ifdef RFR_USE_MMAP
+		int fd = ::open(filename.c_str(), O_RDONLY);
+		if (fd < 0)
+			throw std::runtime_error("Could not open file " + filename);
+
+		struct stat file_stat;
+		if (::fstat(fd, &file_stat) != 0){
+			::close(fd);
+			throw std::runtime_error("Could not determine the size of file " + filename);
+		}
+		length = file_stat.st_size;
+
+		if (length > 0){
+			void* p = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+			if (p == MAP_FAILED){
+				::close(fd);
+				throw std::runtime_error("Could not map file " + filename);
+			}
+			ptr = static_cast<const char*>(p);
+		}
+		::close(fd);
+#else
+		std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+		if (!ifs)
+			throw std::runtime_error("Could not open file " + filename);
+
+		std::streamoff file_size = ifs.tellg();
+		if (file_size < 0)
+			throw std::runtime_error("Could not determine the size of file " + filename);
+		length = file_size;
+
+		if (length > 0){
+			buffer.resize(length);
+			ifs.seekg(0);
+			if (!ifs.read(buffer.data(), length))
+				throw std::runtime_error("Could not read file " + filename);
+			ptr = buffer.data();
+		}
+#endif
+	}
+
+	memory_mapped_file(const memory_mapped_file &) = delete;
+	memory_mapped_file& operator=(const memory_mapped_file &) = delete;
+
+	~memory_mapped_file(){
+#ifdef RFR_USE_MMAP
+		if (ptr != nullptr)
+			::munmap(const_cast<char*>(ptr), length);
+#endif
+	}
+
+	const char* data() const {return(ptr);}
+	size_t size() const {return(length);}
+
+	/** \brief whether the pages are shared with other processes mapping the same file*/
+	static constexpr bool is_shared() {
+#ifdef RFR_USE_MMAP
+		return(true);
+#else
+		return(false);
+#endif
+	}
+};
+
+
+}}//namespace rfr::util
+#endif
@@ -14,6 +14,8 @@
 #include "rfr/nodes/temporary_node.hpp"
 #include "rfr/util.hpp"
 #include "rfr/splits/split_base.hpp"
+#include "rfr/splits/presorted_features.hpp"
+#include "rfr/splits/split_workspace.hpp"
 
 #include "cereal/cereal.hpp"
 #include <cereal/types/vector.hpp>
@@ -42,6 +44,8 @@ class k_ary_node_minimal{
 	
   public:
 
+	typedef split_type split_t;
+
 	virtual ~k_ary_node_minimal () {};
 
   	/* serialize function for saving forests */
@@ -62,6 +66,9 @@ class k_ary_node_minimal{
 	* \param min_samples_in_leaf sets the minimum number of distinct data points in a leaf
 	* \param min_weight_in_leaf sets the minimum sum of sample weights in a leaf
     * \param rng a RNG instance
+	* \param presorted the data sorted by every continuous feature, kept in sync with the split; can be a nullptr
+	* \param workspace the scratch buffers for the split search; if it is a nullptr, the search allocates its own
+	* \param num_threads if positive, the split may evaluate the features with up to that many threads (see rfr::splits::k_ary_split_base::find_best_split)
 	*
 	* \return num_t the loss of the split
 	*/ 
@@ -72,13 +79,21 @@ class k_ary_node_minimal{
 							 std::deque<rfr::nodes::temporary_node<num_t, response_t, index_t> > &tmp_nodes,
 							 index_t min_samples_in_leaf,
 							 num_t min_weight_in_leaf,
-							 rng_t &rng){
+							 rng_t &rng,
+							 rfr::splits::presorted_features<num_t, response_t, index_t> *presorted = nullptr,
+							 rfr::splits::split_workspace<num_t, response_t, index_t> *workspace = nullptr,
+							 unsigned int num_threads = 0){
 		parent_index = tmp_node.parent_index;
 		std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t> >::iterator, k+1> split_indices_it;
-		num_t best_loss = split.find_best_split(data, features_to_try, tmp_node.begin, tmp_node.end, split_indices_it, min_samples_in_leaf, min_weight_in_leaf, rng);
+		rfr::splits::split_workspace<num_t, response_t, index_t> own_workspace;
+		num_t best_loss = split.find_best_split(data, features_to_try, tmp_node.begin, tmp_node.end, split_indices_it, min_samples_in_leaf, min_weight_in_leaf, rng,
+												presorted, (workspace != nullptr) ? *workspace : own_workspace, num_threads);
 		//check if a split was found
 		// note: if the number of features to try is too small, there is a chance that the data cannot be split any further
 		if (best_loss <  std::numeric_limits<num_t>::infinity()){
+			if (presorted != nullptr)
+				presorted->partition(split_indices_it);
+
 			// create a tmp node for each child
             num_t total_weight = 0;
 			for (index_t i = 0; i < k; i++){
@@ -113,6 +128,19 @@ class k_ary_node_minimal{
 		}
 	}	
 
+	/** \brief maps the indices of the node's parent and children, e.g. to move a subtree into another tree
+	 *
+	 * \param f callable mapping an old node index to the new one
+	 */
+	template <typename function_t>
+	void renumber(function_t f){
+		parent_index = f(parent_index);
+		if (!is_a_leaf()){
+			for (auto &c: children)
+				c = f(c);
+		}
+	}
+
 	/* \brief function to check if a feature vector can be splitted */
 	bool can_be_split(const std::vector<num_t> &feature_vector) const {
 		if (is_a_leaf()) return(false);
@@ -130,6 +158,16 @@ class k_ary_node_minimal{
 		return(children[split(feature_vector)]);
 	}
 
+	/** \brief same as above for a feature vector given as a pointer to its values
+	 *
+	 * The split has to provide get_feature_index and an operator() taking a single
+	 * feature value like rfr::splits::binary_split_one_feature_rss_loss.
+	 */
+	index_t falls_into_child(const num_t *feature_vector) const {
+		if (is_a_leaf()) return(0);
+		return(children[split(feature_vector[split.get_feature_index()])]);
+	}
+
 
 	/** \brief adds an observation to the leaf node
 	 *
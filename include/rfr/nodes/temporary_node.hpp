@@ -2,7 +2,10 @@
 #define RFR_TEMPORARY_NODE_HPP
 
 #include <vector>
+#include <limits>
+#include <algorithm>
 
+#include <rfr/util.hpp>
 #include <rfr/splits/split_base.hpp>
 
 namespace rfr{ namespace nodes{
@@ -12,6 +15,8 @@ template <typename num_t = float, typename response_t = float, typename index_t
  *
  * When fitting a tree, every split creates two or more children. This class is used
  * to temporarily store all information needed to continue splitting.
+ * The statistics of the responses are computed once when the node is created,
+ * so checking whether the node should be split does not need another pass over its data points.
  */
 struct temporary_node{
 
@@ -20,6 +25,10 @@ struct temporary_node{
 	typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t> >::iterator begin, end; 
 	index_t node_level;
 
+	rfr::util::weighted_running_statistics<num_t> response_stat;	///< statistics of the weighted responses
+	response_t min_response, max_response;
+
+
 
 	/* \param note_id the unique ID of the node
 	 * \param b iterator to the first element of the data_info vector associated with the node
@@ -29,17 +38,20 @@ struct temporary_node{
 	temporary_node (index_t node_id, index_t parent_id,	index_t node_lvl,
 					typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator b,
 					typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator e):
-						node_index(node_id), parent_index(parent_id), begin(b), end(e), node_level(node_lvl)
-						{}
-	
-
-	num_t total_weight (){
-        num_t tw = 0.;
-        for (auto it = begin; it != end; ++it){
-            tw += (*it).weight;
-        }
-        return(tw);
-    }
+						node_index(node_id), parent_index(parent_id), begin(b), end(e), node_level(node_lvl),
+						min_response(std::numeric_limits<response_t>::infinity()), max_response(-std::numeric_limits<response_t>::infinity()){
+		for (auto it = begin; it != end; ++it){
+			response_stat.push((*it).response, (*it).weight);
+			min_response = std::min(min_response, (*it).response);
+			max_response = std::max(max_response, (*it).response);
+		}
+	}
+
+
+	num_t total_weight () const {return(response_stat.sum_of_weights());}
+
+	/** \brief number of data points in the node */
+	index_t num_data_points() const {return(std::distance(begin, end));}
 
 	void print_info() const{
 		std::cout<<"node_index = "<<node_index <<"\n";
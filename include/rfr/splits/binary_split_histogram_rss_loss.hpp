@@ -0,0 +1,223 @@
+#ifndef RFR_BINARY_SPLIT_HISTOGRAM_RSS_HPP
+#define RFR_BINARY_SPLIT_HISTOGRAM_RSS_HPP
+
+#include <vector>
+#include <bitset>
+#include <array>
+#include <random>
+#include <limits>
+#include <stdexcept>
+#include <typeinfo>
+
+
+#include <rfr/util.hpp>
+#include <rfr/data_containers/data_container.hpp>
+#include <rfr/data_containers/binned_data_container.hpp>
+#include <rfr/splits/binary_split_one_feature_rss_loss.hpp>
+
+namespace rfr{ namespace splits{
+
+
+/** \brief binary split minimizing the RSS loss that only considers the bin boundaries of a binned_container
+ *
+ * Instead of sorting the data points for every continuous feature, the responses are
+ * accumulated into a histogram over the feature's (at most 256) bins, and only the bin
+ * boundaries are considered as split values. That reduces the work per feature and node
+ * to one pass over the data points plus one over the bins. Categorical features are
+ * handled exactly like in binary_split_one_feature_rss_loss.
+ *
+ * The training data has to be stored in a rfr::data_containers::binned_container.
+ * For predictions, the split behaves exactly like binary_split_one_feature_rss_loss.
+ */
+template <	typename num_t = float,
+			typename response_t=float,
+			typename index_t = unsigned int,
+			typename rng_t = std::default_random_engine,
+			unsigned int max_num_categories = 128>
+class binary_split_histogram_rss_loss: public rfr::splits::binary_split_one_feature_rss_loss<num_t, response_t, index_t, rng_t, max_num_categories> {
+  private:
+	typedef rfr::splits::binary_split_one_feature_rss_loss<num_t, response_t, index_t, rng_t, max_num_categories> super;
+	typedef rfr::data_containers::binned_container<num_t, response_t, index_t> binned_container_t;
+
+  public:
+
+	static constexpr bool uses_presorted_features = false;
+
+	virtual num_t find_best_split(	const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+									std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator, 3> &info_split_its,
+									index_t min_samples_in_child, num_t min_weight_in_child,
+									rng_t &rng){
+		return(find_best_split(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, nullptr));
+	}
+
+	virtual num_t find_best_split(	const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+									std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator, 3> &info_split_its,
+									index_t min_samples_in_child, num_t min_weight_in_child,
+									rng_t &rng,
+									rfr::splits::presorted_features<num_t, response_t, index_t> *presorted){
+		rfr::splits::split_workspace<num_t, response_t, index_t> workspace;
+		return(find_best_split(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted, workspace, 0));
+	}
+
+	/** \brief finds the best split among all allowed features using the bins of the continuous ones
+	 *
+	 * See binary_split_one_feature_rss_loss::find_best_split for the parameters.
+	 * The presorted data is not needed and therefore ignored. Evaluating a feature
+	 * is cheap with the bins, so they are always evaluated one after another.
+	 *
+	 * \return num_t loss of the best found split
+	 */
+	virtual num_t find_best_split(	const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+									std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator, 3> &info_split_its,
+									index_t min_samples_in_child, num_t min_weight_in_child,
+									rng_t &rng,
+									rfr::splits::presorted_features<num_t, response_t, index_t> *,
+									rfr::splits::split_workspace<num_t, response_t, index_t> &workspace,
+									unsigned int){
+
+		auto binned_data = dynamic_cast<const binned_container_t*> (&data);
+		if (binned_data == nullptr)
+			throw std::runtime_error("The histogram split requires the data in a binned_container!");
+		if (!binned_data->is_quantized())
+			throw std::runtime_error("The features of the binned_container have not been quantized, yet. Call quantize_features first!");
+
+		// precompute mean and variance of all responses
+		rfr::util::weighted_running_statistics<num_t> total_stat;
+		for (auto it = infos_begin; it != infos_end; ++it){
+			total_stat.push(it->response, it->weight);
+		}
+
+		num_t best_loss = std::numeric_limits<num_t>::infinity();
+
+		for (index_t fi : features_to_try){
+
+			num_t loss = std::numeric_limits<num_t>::infinity();
+			num_t num_split_copy = NAN;
+			typename super::category_set_t cat_split_copy;
+
+			index_t ft = data.get_type_of_feature(fi);
+			// feature_type zero means that it is a continous variable
+			if (ft == 0){
+				loss = best_split_histogram(*binned_data, fi, infos_begin, infos_end, num_split_copy, min_samples_in_child, min_weight_in_child, workspace);
+			}
+			// a positive feature type encodes the number of possible values
+			else{
+				for (auto it = infos_begin; it != infos_end; ++it){
+					it->feature = data.feature( fi, it->index);
+				}
+				loss = super::best_split_categorical(infos_begin, infos_end, ft, cat_split_copy, total_stat, min_samples_in_child, min_weight_in_child, rng, workspace);
+			}
+
+			// check if this split is the best so far
+			if (loss < best_loss){
+				best_loss = loss;
+				super::feature_index = fi;
+
+				if (ft == 0){
+					super::num_split_value = num_split_copy;
+				}
+				else{
+					super::num_split_value = NAN;
+					super::cat_split_set = cat_split_copy;
+				}
+			}
+		}
+		// now we have to rearrange the indices based on which leaf they fall into
+		if (best_loss < std::numeric_limits<num_t>::infinity()){
+			if (typeid(data) == typeid(binned_container_t))
+				super::partition_data_infos(*binned_data, infos_begin, infos_end, info_split_its);
+			else
+				super::partition_data_infos(data, infos_begin, infos_end, info_split_its);
+		}
+		return(best_loss);
+	}
+
+
+	/** \brief member function to find the best split for a single (continuous) feature on its bin boundaries
+	 *
+	 * \param data the binned container holding the training data
+	 * \param feature_index the (continuous) feature to split on
+	 * \param infos_begin iterator to the first (relevant) element in a vector containing the minimal information in tuples
+	 * \param infos_end iterator beyond the last (relevant) element in a vector containing the minimal information in tuples
+	 * \param split_value a reference to store the split (numerical) criterion
+	 * \param min_samples_in_child smallest acceptable number of distinct data points in any of the children
+	 * \param min_weight_in_child smallest acceptable sum of all weights in any of the children
+	 * \param workspace provides the buffers for the histogram
+	 *
+	 * \return float the loss of this split
+	 */
+	num_t best_split_histogram(	const binned_container_t &data,
+								index_t feature_index,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+								num_t &split_value,
+								index_t min_samples_in_child, num_t min_weight_in_child,
+								rfr::splits::split_workspace<num_t, response_t, index_t> &workspace) const {
+
+		index_t num_bins = data.num_bins(feature_index);
+		const std::uint8_t* bins = data.bins(feature_index);
+
+		// the histogram of the responses; the buffers are reused by every call with this workspace
+		auto &histogram = workspace.histogram;
+		auto &right_stats = workspace.right_stats;
+		histogram.assign(num_bins, rfr::util::weighted_running_statistics<num_t>());
+		for (auto it = infos_begin; it != infos_end; ++it)
+			histogram[bins[it->index]].push(it->response, it->weight);
+
+		// statistics of all bins to the right of a boundary; only non-empty bins are
+		// added as combining two empty statistics is not defined
+		right_stats.assign(num_bins+1, rfr::util::weighted_running_statistics<num_t>());
+		for (index_t b = num_bins; b > 0; --b){
+			right_stats[b-1] = right_stats[b];
+			if (histogram[b-1].sum_of_weights() > 0)
+				right_stats[b-1] += histogram[b-1];
+		}
+
+		rfr::util::weighted_running_statistics<num_t> left_stat;
+		num_t best_loss = std::numeric_limits<num_t>::infinity();
+
+		// move one bin at a time from the right to the left child
+		for (index_t b = 0; b+1 < num_bins; ++b){
+			// an empty bin gives the same split as the one before
+			if (histogram[b].sum_of_weights() == 0) continue;
+			left_stat += histogram[b];
+
+			auto &right_stat = right_stats[b+1];
+
+			// stop if all data points are now in the left child as this is not a meaningful split
+			if (right_stat.sum_of_weights() == 0) break;
+
+			// if there are not enough points/weight in the left child move more over
+			if ( (left_stat.number_of_points()  < min_samples_in_child) ||
+				 ( left_stat.sum_of_weights() < min_weight_in_child))
+				 continue;
+
+			// if the right child is 'too empty' this feature is done
+			if ((right_stat.number_of_points() < min_samples_in_child) ||
+				(right_stat.sum_of_weights() < min_weight_in_child))
+				break;
+
+			num_t loss = 	left_stat.squared_deviations_from_the_mean() +
+							right_stat.squared_deviations_from_the_mean();
+
+			if (loss < best_loss){
+				best_loss = loss;
+				split_value = data.bin_threshold(feature_index, b);
+			}
+		}
+		return(best_loss);
+	}
+};
+
+
+}}//namespace rfr::splits
+#endif
@@ -9,32 +9,52 @@
 #include <string>
 #include <sstream>
 #include <iterator>
+#include <typeinfo>
+#include <type_traits>
+#include <cstdint>
 
 
 #include <cereal/cereal.hpp>
 #include <cereal/types/bitset.hpp>
 #include <rfr/util.hpp>
 #include <rfr/data_containers/data_container.hpp>
+#include <rfr/data_containers/default_data_container.hpp>
+#include <rfr/data_containers/contiguous_data_container.hpp>
 #include <rfr/splits/split_base.hpp>
+#include <rfr/splits/presorted_features.hpp>
+#include <rfr/splits/split_workspace.hpp>
+#include <rfr/splits/category_set.hpp>
 #include <rfr/data_containers/data_container_utils.hpp>
 namespace rfr{ namespace splits{
 
 
 
+/** \brief binary split on a single feature minimizing the RSS loss
+ *
+ * Categorical splits store the values going to the left child in a std::bitset
+ * of size max_num_categories. With max_num_categories = 0, a category_set that
+ * grows as needed is used instead, so there is no limit on the number of categories.
+ */
 template <	typename num_t = float,
 			typename response_t=float,
 			typename index_t = unsigned int,
 			typename rng_t = std::default_random_engine,
 			unsigned int max_num_categories = 128>
 class binary_split_one_feature_rss_loss: public rfr::splits::k_ary_split_base<2, num_t, response_t, index_t, rng_t> {
-  private:
+  public:
+	typedef typename std::conditional<max_num_categories == 0, rfr::splits::category_set, std::bitset<max_num_categories> >::type category_set_t;
+
+  protected:
+	typedef rfr::data_containers::default_container<num_t, response_t, index_t> default_container_t;
+	typedef rfr::data_containers::contiguous_container<num_t, response_t, index_t> contiguous_container_t;
 
 	index_t feature_index;	//!< split needs to know which feature it uses
 	num_t num_split_value;	//!< value of a numerical split
-	std::bitset<max_num_categories> cat_split_set;	//!< set of values for a categorical split
+	category_set_t cat_split_set;	//!< set of values for a categorical split
 
   public:
 
+	static constexpr bool uses_presorted_features = true;
 
   	/* serialize function for saving forests */
   	template<class Archive>
@@ -74,7 +94,74 @@ class binary_split_one_feature_rss_loss: public rfr::splits::k_ary_split_base<2,
 									std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator, 3> &info_split_its,
 									index_t min_samples_in_child, num_t min_weight_in_child,
 									rng_t &rng){
+		return(find_best_split(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, nullptr));
+	}
+
+	/** \brief same as above, but continuous features are not sorted again if presorted data is provided
+	 *
+	 * \param presorted the data points sorted by every continuous feature, or a nullptr to sort at this node
+	 */
+	 virtual num_t find_best_split(	const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+									std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator, 3> &info_split_its,
+									index_t min_samples_in_child, num_t min_weight_in_child,
+									rng_t &rng,
+									rfr::splits::presorted_features<num_t, response_t, index_t> *presorted){
+		rfr::splits::split_workspace<num_t, response_t, index_t> workspace;
+		return(find_best_split(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted, workspace, 0));
+	}
+
+	/** \brief same as above, but with the caller's scratch buffers, and the features are evaluated by up to num_threads threads
+	 *
+	 * With num_threads = 0, the features are evaluated one after another, otherwise see
+	 * find_best_split_parallel_impl for how the result stays independent of the number of threads.
+	 */
+	 virtual num_t find_best_split(	const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+									std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator, 3> &info_split_its,
+									index_t min_samples_in_child, num_t min_weight_in_child,
+									rng_t &rng,
+									rfr::splits::presorted_features<num_t, response_t, index_t> *presorted,
+									rfr::splits::split_workspace<num_t, response_t, index_t> &workspace,
+									unsigned int num_threads){
+
+		// dispatch once on the container's exact type, so the accessors in the loops over the data points can be inlined;
+		// any other container (including classes derived from these) goes through the virtual interface
+		if (num_threads == 0){
+			if (typeid(data) == typeid(default_container_t))
+				return(find_best_split_impl(static_cast<const default_container_t&>(data), features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted, workspace));
+			if (typeid(data) == typeid(contiguous_container_t))
+				return(find_best_split_impl(static_cast<const contiguous_container_t&>(data), features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted, workspace));
+			return(find_best_split_impl(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted, workspace));
+		}
+		if (typeid(data) == typeid(default_container_t))
+			return(find_best_split_parallel_impl(static_cast<const default_container_t&>(data), features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted, workspace, num_threads));
+		if (typeid(data) == typeid(contiguous_container_t))
+			return(find_best_split_parallel_impl(static_cast<const contiguous_container_t&>(data), features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted, workspace, num_threads));
+		return(find_best_split_parallel_impl(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted, workspace, num_threads));
+	}
 
+	/** \brief the actual implementation of find_best_split for a container of type data_t
+	 *
+	 * data_t has to be either the exact type of the container or the interface rfr::data_containers::base
+	 * (see rfr::data_containers::static_feature).
+	 * Splits with equal loss (e.g. two splits into pure children, which both have a loss of exactly zero)
+	 * are resolved in favor of the feature that comes first in features_to_try.
+	 */
+	template <typename data_t>
+	num_t find_best_split_impl(	const data_t &data,
+								const std::vector<index_t> &features_to_try,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+								std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator, 3> &info_split_its,
+								index_t min_samples_in_child, num_t min_weight_in_child,
+								rng_t &rng,
+								rfr::splits::presorted_features<num_t, response_t, index_t> *presorted,
+								rfr::splits::split_workspace<num_t, response_t, index_t> &workspace){
 
 		// precompute mean and variance of all responses
 		rfr::util::weighted_running_statistics<num_t> total_stat;
@@ -86,55 +173,168 @@ class binary_split_one_feature_rss_loss: public rfr::splits::k_ary_split_base<2,
 
 		for (index_t fi : features_to_try){ //! > uses C++11 range based loop
 
-			num_t loss;
 			num_t num_split_copy = NAN;
-			std::bitset<max_num_categories> cat_split_copy;
-
-			for (auto it = infos_begin; it != infos_end; ++it){
-				it->feature = data.feature( fi, it->index);
-			}
+			category_set_t cat_split_copy;
 
-			index_t ft = data.get_type_of_feature(fi);
-			// feature_type zero means that it is a continous variable
-			if (ft == 0){
-				// find best split for the current feature_index
-				loss = best_split_continuous(infos_begin, infos_end, num_split_copy, total_stat, min_samples_in_child, min_weight_in_child, rng);
-			}
-			// a positive feature type encodes the number of possible values
-			if (ft > 0){
-				// find best split for the current feature_index
-				loss = best_split_categorical(infos_begin, infos_end, ft, cat_split_copy, total_stat, min_samples_in_child, min_weight_in_child, rng);
-			}
+			num_t loss = best_split_one_feature(data, fi, infos_begin, infos_end, num_split_copy, cat_split_copy, total_stat, min_samples_in_child, min_weight_in_child, rng, presorted, workspace);
 
 			// check if this split is the best so far
 			if (loss < best_loss){
 				best_loss = loss;
-				feature_index = fi;
-
-				if (ft == 0){
-					num_split_value = num_split_copy;
-				}
-				else{
-					num_split_value = NAN;
-					cat_split_set = cat_split_copy;
-				}
-
+				set_split(data, fi, num_split_copy, cat_split_copy);
 			}
 		}
 		// now we have to rearrange the indices based on which leaf they fall into
-		if (best_loss < std::numeric_limits<num_t>::infinity()){
-			// the default values for the two split iterators
-			info_split_its[0] = infos_begin;
-			info_split_its[2] = infos_end;
-
-			info_split_its[1] = std::partition (infos_begin, infos_end,
-				[this,&data] (rfr::splits::data_info_t<num_t, response_t, index_t> &arg){
-					return !(this->operator()(data.feature(this->feature_index, arg.index)));
-				});
+		if (best_loss < std::numeric_limits<num_t>::infinity())
+			partition_data_infos(data, infos_begin, infos_end, info_split_its);
+		return(best_loss);
+	}
+
+	/** \brief same as find_best_split_impl, but the features are evaluated concurrently
+	 *
+	 * Every feature gets its own random number generator seeded from rng, and unless it is
+	 * presorted, its own copy of the node's data_infos in the workspace of the worker evaluating it.
+	 * The split is therefore the same for any number of threads, but generally not the one
+	 * find_best_split_impl would find.
+	 */
+	template <typename data_t>
+	num_t find_best_split_parallel_impl(const data_t &data,
+								const std::vector<index_t> &features_to_try,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+								std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator, 3> &info_split_its,
+								index_t min_samples_in_child, num_t min_weight_in_child,
+								rng_t &rng,
+								rfr::splits::presorted_features<num_t, response_t, index_t> *presorted,
+								rfr::splits::split_workspace<num_t, response_t, index_t> &workspace,
+								unsigned int num_threads){
+
+		rfr::util::weighted_running_statistics<num_t> total_stat;
+		for (auto it = infos_begin; it != infos_end; ++it){
+			total_stat.push(it->response, it->weight);
+		}
+
+		index_t n = features_to_try.size();
+		std::vector<typename rng_t::result_type> seeds(n);
+		for (auto &s: seeds)
+			s = rng();
+
+		std::vector<num_t> losses(n), num_splits(n, NAN);
+		std::vector<category_set_t> cat_splits(n);
+
+		num_threads = rfr::util::effective_num_threads(num_threads, n);
+		workspace.reserve_workers(num_threads);
+
+		rfr::util::parallel_for_with_worker<index_t>(n, num_threads, [&] (index_t i, unsigned int w){
+			index_t fi = features_to_try[i];
+			rng_t feature_rng = rfr::util::make_rng<rng_t>(seeds[i]);
+			auto &worker_workspace = workspace.worker(w);
+
+			if ((data.get_type_of_feature(fi) == 0) && (presorted != nullptr) && presorted->is_presorted(fi)){
+				losses[i] = best_split_one_feature(data, fi, infos_begin, infos_end, num_splits[i], cat_splits[i], total_stat, min_samples_in_child, min_weight_in_child, feature_rng, presorted, worker_workspace);
+			}
+			else{
+				// the search reorders the data_infos and stores the feature values in them, so every worker uses its own copy
+				auto &infos = worker_workspace.infos;
+				infos.assign(infos_begin, infos_end);
+				losses[i] = best_split_one_feature(data, fi, infos.begin(), infos.end(), num_splits[i], cat_splits[i], total_stat, min_samples_in_child, min_weight_in_child, feature_rng, nullptr, worker_workspace);
+			}
+		});
+
+		num_t best_loss = std::numeric_limits<num_t>::infinity();
+		for (index_t i = 0; i < n; ++i){
+			if (losses[i] < best_loss){
+				best_loss = losses[i];
+				set_split(data, features_to_try[i], num_splits[i], cat_splits[i]);
+			}
 		}
+
+		if (best_loss < std::numeric_limits<num_t>::infinity())
+			partition_data_infos(data, infos_begin, infos_end, info_split_its);
 		return(best_loss);
 	}
 
+	/** \brief finds the best split for one feature of any type
+	 *
+	 * The feature values are stored in the data_infos (which are reordered for a continuous feature),
+	 * unless the feature is presorted.
+	 *
+	 * \param num_split_value receives the split value of a continuous feature
+	 * \param cat_split_set receives the split set of a categorical feature
+	 * \param workspace scratch buffers for the categorical search
+	 *
+	 * \return num_t the loss of the best split
+	 */
+	template <typename data_t>
+	num_t best_split_one_feature(const data_t &data, index_t fi,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+								num_t &num_split_value, category_set_t &cat_split_set,
+								const rfr::util::weighted_running_statistics<num_t> &total_stat,
+								index_t min_samples_in_child, num_t min_weight_in_child,
+								rng_t &rng,
+								rfr::splits::presorted_features<num_t, response_t, index_t> *presorted,
+								rfr::splits::split_workspace<num_t, response_t, index_t> &workspace){
+
+		index_t ft = data.get_type_of_feature(fi);
+
+		// with presorted data, the node's data points are already in order
+		if ((ft == 0) && (presorted != nullptr) && presorted->is_presorted(fi)){
+			const num_t *values = presorted->sorted_values(fi, infos_begin);
+			const response_t *responses = presorted->sorted_responses(fi, infos_begin);
+			const num_t *weights = presorted->sorted_weights(fi, infos_begin);
+			return(scan_sorted_continuous(index_t(std::distance(infos_begin, infos_end)),
+						[values] (index_t i) {return(values[i]);},
+						[responses] (index_t i) {return(responses[i]);},
+						[weights] (index_t i) {return(weights[i]);},
+						num_split_value, total_stat, min_samples_in_child, min_weight_in_child, rng));
+		}
+
+		for (auto it = infos_begin; it != infos_end; ++it){
+			it->feature = rfr::data_containers::static_feature(data, fi, it->index);
+		}
+		// feature_type zero means that it is a continous variable
+		if (ft == 0)
+			return(best_split_continuous(infos_begin, infos_end, num_split_value, total_stat, min_samples_in_child, min_weight_in_child, rng));
+		// a positive feature type encodes the number of possible values
+		return(best_split_categorical(infos_begin, infos_end, ft, cat_split_set, total_stat, min_samples_in_child, min_weight_in_child, rng, workspace));
+	}
+
+	/** \brief makes this the split on feature fi found by best_split_one_feature */
+	template <typename data_t>
+	void set_split(const data_t &data, index_t fi, num_t num_split, const category_set_t &cat_split){
+		feature_index = fi;
+		if (data.get_type_of_feature(fi) == 0){
+			num_split_value = num_split;
+		}
+		else{
+			num_split_value = NAN;
+			cat_split_set = cat_split;
+		}
+	}
+
+	/** \brief rearranges the data_infos according to the (found) split
+	 *
+	 * \param data the container holding the training data
+	 * \param infos_begin iterator to the first (relevant) element in a vector containing the minimal information in tuples
+	 * \param infos_end iterator beyond the last (relevant) element in a vector containing the minimal information in tuples
+	 * \param info_split_its iterators into this vector saying where to split the data for the two children
+	 */
+	template <typename data_t>
+	void partition_data_infos(	const data_t &data,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+								typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+								std::array<typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator, 3> &info_split_its) const {
+		// the default values for the two split iterators
+		info_split_its[0] = infos_begin;
+		info_split_its[2] = infos_end;
+
+		info_split_its[1] = std::partition (infos_begin, infos_end,
+			[this,&data] (rfr::splits::data_info_t<num_t, response_t, index_t> &arg){
+				return !(this->operator()(rfr::data_containers::static_feature(data, this->feature_index, arg.index)));
+			});
+	}
+
 
 	/** \brief this operator tells into which child the given feature vector falls
 	 *
@@ -182,53 +382,90 @@ class binary_split_one_feature_rss_loss: public rfr::splits::k_ary_split_base<2,
 		std::sort(infos_begin, infos_end,
 			[] (const rfr::splits::data_info_t<num_t, response_t, index_t> &a, const rfr::splits::data_info_t<num_t, response_t, index_t> &b) {return (a.feature < b.feature) ;});
 
-		// first some temporary variables
-		rfr::util::weighted_running_statistics<num_t> left_stat;
+		return(best_split_sorted_continuous(infos_begin, infos_end, split_value, right_stat, min_samples_in_child, min_weight_in_child, rng));
+	}
+
+	/** \brief finds the best split for a single (continuous) feature with the data points already sorted by it
+	 *
+	 * A single linear scan over the data points, see best_split_continuous for the parameters.
+	 * The range has to be sorted by the feature value stored in the data_infos.
+	 * The statistics of the left child are prefix sums of the (shifted) responses,
+	 * the ones of the right child are the total minus the left. The sums are in double precision over
+	 * the responses shifted by their mean, which avoids the cancellation of large offsets, and losses within
+	 * the round off error are zero (see rfr::util::rss_split_loss). So the scan never fails and is linear even
+	 * for (nearly) constant responses.
+	 *
+	 * \return float the loss of this split
+	 */
+	virtual num_t best_split_sorted_continuous(
+					typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
+					typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
+					num_t &split_value,
+					rfr::util::weighted_running_statistics<num_t> right_stat,
+					index_t min_samples_in_child, num_t min_weight_in_child,
+					rng_t &rng){
+		return(scan_sorted_continuous(index_t(std::distance(infos_begin, infos_end)),
+					[infos_begin] (index_t i) {return(infos_begin[i].feature);},
+					[infos_begin] (index_t i) {return(infos_begin[i].response);},
+					[infos_begin] (index_t i) {return(infos_begin[i].weight);},
+					split_value, right_stat, min_samples_in_child, min_weight_in_child, rng));
+	}
+
+	/** \brief the scan of best_split_sorted_continuous over n data points given by accessors
+	 *
+	 * feature(i), response(i) and weight(i) return the values of the i-th data point in the
+	 * order of the feature, so the same scan works on the data_infos and on the parallel
+	 * arrays of rfr::splits::presorted_features.
+	 */
+	template <typename feature_f, typename response_f, typename weight_f>
+	num_t scan_sorted_continuous(index_t n, feature_f feature, response_f response, weight_f weight,
+					num_t &split_value,
+					const rfr::util::weighted_running_statistics<num_t> &right_stat,
+					index_t min_samples_in_child, num_t min_weight_in_child,
+					rng_t &rng){
+
 		num_t best_loss = std::numeric_limits<num_t>::infinity();
+		if (n == 0) return(best_loss);
 
+		// shifting the responses by their mean keeps the sums of squares small
+		double shift = (right_stat.sum_of_weights() > 0) ? right_stat.mean() : 0;
+
+		rfr::util::shifted_response_sums<> total, left;
+		for (index_t i = 0; i < n; ++i)
+			total.push(double(response(i)) - shift, weight(i));
+		rfr::util::rss_split_loss loss_of_split(total);
 
 		// now we can increase the splitting value to move data points from the right to the left child
-		for (auto it = infos_begin;true;){
-			num_t psv = (*it).feature + 1e-6; // potential split value add small delta for numerical inaccuracy
+		for (index_t i = 0;true;){
+			num_t psv = feature(i) + 1e-6; // potential split value add small delta for numerical inaccuracy
 			// combine data points that are very close
 			do {
-				left_stat.push((*it).response, (*it).weight);
-                try{// substraction of statistics can lead to negative squared distances from the mean, especially if the right
-                    // child contains samples with the same response value. This happens all the time if a categorical feature is
-                    // not specified as such.
-                    right_stat.pop((*it).response, (*it).weight);
-                }
-                catch (const std::runtime_error& e){
-                    // Just recompute the statistic from scratch, which should always work!
-                    right_stat = rfr::util::weighted_running_statistics<num_t> ();
-                    for (auto tmp_it = it+1; tmp_it != infos_end; tmp_it++)
-                        right_stat.push((*tmp_it).response, (*tmp_it).weight);
-                }
-				++it;
-			} while ((it != infos_end) && ((*it).feature <= psv));
+				left.push(double(response(i)) - shift, weight(i));
+				++i;
+			} while ((i != n) && (feature(i) <= psv));
 
 			// stop if all data points are now in the left child as this is not a meaningful split
-			if (it == infos_end) break;
+			if (i == n) break;
 
 			// if there are not enough points/weight in the left child move more over
-			if ( (left_stat.number_of_points()  < min_samples_in_child) ||
-				 ( left_stat.sum_of_weights() < min_weight_in_child))
+			if ( (left.n  < min_samples_in_child) ||
+				 ( left.sum_of_weights() < min_weight_in_child))
 				 continue;
 
 			// if the right child is 'too empty' this feature is done
-			if ((right_stat.number_of_points() < min_samples_in_child) ||
-				(right_stat.sum_of_weights() < min_weight_in_child))
+			double right_w = total.sum_of_weights() - left.sum_of_weights();
+			if ((total.n - left.n < min_samples_in_child) ||
+				(right_w < min_weight_in_child))
 				break;
 
 			// compute the loss
-			num_t loss = 	left_stat.squared_deviations_from_the_mean() +
-							right_stat.squared_deviations_from_the_mean();
+			num_t loss = loss_of_split(left);
 
 			// store the best split
 			if (loss < best_loss){
 				std::uniform_real_distribution<num_t> dist(0.0,1.0);
 				best_loss = loss;
-				split_value = psv + dist(rng)*((*it).feature - psv);
+				split_value = psv + dist(rng)*(feature(i) - psv);
 			}
 		}
 		return(best_loss);
@@ -244,6 +481,7 @@ class binary_split_one_feature_rss_loss: public rfr::splits::k_ary_split_base<2,
 	 * \param min_samples_in_child smallest acceptable number of distinct data points in any of the children
 	 * \param min_weight_in_child smallest acceptable weight in any of the children
 	 * \param rng an pseudo random number generator instance
+	 * \param workspace provides the sums of every category, their entries are zero before and after the call
 	 *
 	 * \return float the loss of this split
 	 */
@@ -251,97 +489,154 @@ class binary_split_one_feature_rss_loss: public rfr::splits::k_ary_split_base<2,
 									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_begin,
 									typename std::vector<rfr::splits::data_info_t<num_t, response_t, index_t>>::iterator infos_end,
 									index_t num_categories,
-									std::bitset<max_num_categories> &split_set,
+									category_set_t &split_set,
 									rfr::util::weighted_running_statistics<num_t> right_stat,
 									index_t min_samples_in_child, num_t min_weight_in_child,
-									rng_t &rng){
-		// auxiliary variables
+									rng_t &rng,
+									rfr::splits::split_workspace<num_t, response_t, index_t> &workspace){
 		num_t best_loss = std::numeric_limits<num_t>::infinity();
-		rfr::util::weighted_running_statistics<num_t> left_stat;
 
-		std::vector<rfr::util::weighted_running_statistics<num_t> > cat_stats (num_categories);
+		// the sums of (shifted) responses of every category; the buffers are reused by every call with this workspace
+		// and all entries are zero between calls, so only the categories present in the node are ever touched
+		typedef rfr::util::shifted_response_sums<> category_sums;
+		auto &cat_sums = workspace.category_sums;
+		// (mean response, category) of all categories present in the node
+		auto &cat_ranking = workspace.category_ranking;
+
+		if (cat_sums.size() < num_categories)
+			cat_sums.resize(num_categories);
+		cat_ranking.clear();
+
+		// zeroes the touched entries again on every way out of this function, including exceptions
+		struct reset_category_sums{
+			std::vector<category_sums> &sums;
+			std::vector<std::pair<double, index_t> > &ranking;
+			~reset_category_sums(){
+				for (auto &r: ranking)
+					sums[r.second] = category_sums();
+				ranking.clear();
+			}
+		} reset_on_exit{cat_sums, cat_ranking};
+
+		double shift = (right_stat.sum_of_weights() > 0) ? right_stat.mean() : 0;
 		for (auto it = infos_begin; it != infos_end; ++it){
 			// find the category for each entry as a proper int
 			//! >assumes that the features for categoricals have been properly rounded so casting them to ints results in the right value!
-			int cat = it->feature;
-			// collect all the data to compute the loss
-			cat_stats[cat].push(it->response, it->weight);
+			index_t cat = it->feature;
+			auto &c = cat_sums[cat];
+			if (c.n == 0)
+				cat_ranking.emplace_back(0, cat);
+			c.push(double(it->response) - shift, it->weight);
 		}
 
-		// take care b/c certain categories might not be encountered (maybe there was a split on the same variable further up the tree...)
-		// sort the categories by whether there were samples or not
-		// std::partition rearranges the data using a boolean predicate into all that evaluate to true in front of all evaluating to false.
-		// it even returns an iterator pointing to the first element where the predicate is false, how convenient :)
-		std::vector<index_t> cat_ranking(num_categories);
-		std::iota(cat_ranking.begin(), cat_ranking.end(), 0);
-
-		auto empty_cat_ranking_it = std::partition(cat_ranking.begin(), cat_ranking.end(),
-						[cat_stats](index_t &index){return(cat_stats[index].sum_of_weights() > 0);});
-
+		// categories might not be encountered (maybe there was a split on the same variable further up the tree...)
+		// and only the ones with actual specimen are ranked
+		auto active_end = std::partition(cat_ranking.begin(), cat_ranking.end(),
+							[&cat_sums] (const std::pair<double, index_t> &r){return(cat_sums[r.second].w > 0);});
+		index_t active_categories = std::distance(cat_ranking.begin(), active_end);
+
+		category_sums total;
+		for (auto it = cat_ranking.begin(); it != active_end; ++it){
+			auto &c = cat_sums[it->second];
+			it->first = c.wy/c.w;
+			total += c;
+		}
 
 		// it can happen that the node is not pure wrt the response, but the
 		// feature at hand takes only one value in this node. By returning
 		// best_loss = inf, this split will not be chosen.
-		unsigned int active_categories = std::distance(cat_ranking.begin(), empty_cat_ranking_it);
-		if (active_categories == 1) return(best_loss);
-
-		// sort the categories by their individual mean. only consider the ones with actual specimen here
-		std::sort(	cat_ranking.begin(), empty_cat_ranking_it,
-					[cat_stats](const index_t a, const index_t &b){return ( cat_stats[a].mean() < cat_stats[b].mean() );});		// C++11 lambda function, how exciting :)
+		if (active_categories > 1){
+			// sort the categories by their individual mean; ties are broken by the category
+			std::sort(cat_ranking.begin(), active_end);
 
+			rfr::util::rss_split_loss loss_of_split(total);
 
-		auto it1 = cat_ranking.begin();
-		auto it_best_split = cat_ranking.begin()+1;
+			// now move one category at a time to the left child and recompute the loss
+			category_sums left;
+			index_t best_num_left = 1;
+			for (index_t i = 0; i+1 < active_categories; ++i){
+				auto &c = cat_sums[cat_ranking[i].second];
+				left += c;
+				double right_w = total.w - left.w;
 
-		// now move one category at a time to the left child and recompute the loss
-		do{
-			left_stat += cat_stats[*it1];
-			right_stat-= cat_stats[*it1];
+				if ( (right_w < min_weight_in_child) || (left.w < min_weight_in_child))
+					 continue;
 
-			++it1;
-			--active_categories;
+				if ((total.n - left.n < min_samples_in_child) || (left.n  < min_samples_in_child))
+					continue;
 
-			if ( (right_stat.sum_of_weights() < min_weight_in_child) ||
-				 ( left_stat.sum_of_weights() < min_weight_in_child))
-				 continue;
+				num_t loss = loss_of_split(left);
 
-			if ((right_stat.number_of_points() < min_samples_in_child) ||
-				(left_stat.number_of_points()  < min_samples_in_child))
-				continue;
+				// keep the best split
+				if (loss < best_loss){
+					best_loss = loss;
+					best_num_left = i+1;
+				}
+			}
 
-			num_t loss = left_stat.squared_deviations_from_the_mean() +
-						right_stat.squared_deviations_from_the_mean();
+			store_split_set(split_set, cat_ranking.begin(), cat_ranking.begin()+best_num_left, active_end, num_categories, cat_sums, rng);
+		}
 
-			// keep the best split
-			if (loss < best_loss){
-				best_loss = loss;
-				it_best_split = it1;
-			}
+		return(best_loss);
+	}
 
-		} while (active_categories > 1);
+  protected:
+	typedef typename std::vector<std::pair<double, index_t> >::const_iterator ranking_iterator;
 
-		// store the split set for the left leaf
+	/** \brief stores the categories of the left child in a std::bitset
+	 *
+	 * The left child gets the categories in [ranking_begin, ranking_split), and every unobserved
+	 * category goes to a random child with one draw each.
+	 */
+	template <size_t num_bits>
+	void store_split_set(std::bitset<num_bits> &split_set,
+						ranking_iterator ranking_begin, ranking_iterator ranking_split, ranking_iterator ranking_end,
+						index_t num_categories,
+						const std::vector<rfr::util::shifted_response_sums<> > &cat_sums,
+						rng_t &rng){
 		split_set.reset();
-		for (auto it1 = cat_ranking.begin(); it1 != it_best_split; it1++)
-			split_set.set(*it1);
+		for (auto it = ranking_begin; it != ranking_split; ++it)
+			split_set.set(it->second);
 
-		// add unobserved values randomly to the split_set
-		if (empty_cat_ranking_it != cat_ranking.end()){
+		if (index_t(std::distance(ranking_begin, ranking_end)) < num_categories){
 			std::bernoulli_distribution dist;
-
-			for (auto it1 = empty_cat_ranking_it; it1 != cat_ranking.end(); it1++){
-				if (dist(rng))
-					split_set.set(*it1);
+			for (index_t cat = 0; cat < num_categories; ++cat){
+				if (!(cat_sums[cat].w > 0) && dist(rng))
+					split_set.set(cat);
 			}
 		}
-		return(best_loss);
 	}
 
+	/** \brief stores the categories of the left child in a category_set
+	 *
+	 * Drawing for every unobserved category would make the search linear in the number of
+	 * categories, and the set as large as the feature's range. Instead, unobserved categories
+	 * are never in the set and therefore go right. A single draw decides whether the left child
+	 * gets the categories with the smaller means, [ranking_begin, ranking_split), or the ones with
+	 * the larger means, so the unobserved categories still end up on either side.
+	 */
+	void store_split_set(rfr::splits::category_set &split_set,
+						ranking_iterator ranking_begin, ranking_iterator ranking_split, ranking_iterator ranking_end,
+						index_t,
+						const std::vector<rfr::util::shifted_response_sums<> > &,
+						rng_t &rng){
+		split_set.reset();
+		std::bernoulli_distribution dist;
+		if (dist(rng)){
+			ranking_begin = ranking_split;
+			ranking_split = ranking_end;
+		}
+		for (auto it = ranking_begin; it != ranking_split; ++it)
+			split_set.set(it->second);
+	}
+
+  public:
+
 
 	virtual void print_info() const {
 		if(std::isnan(num_split_value)){
 			std::cout<<"split: f_"<<feature_index<<" in {";
-			for (size_t i = 0; i < max_num_categories; i++)
+			for (size_t i = 0; i < cat_split_set.size(); i++)
 				if (cat_split_set[i]) std::cout<<i<<", ";
 			std::cout<<"\b\b}\n";
 		}
@@ -358,11 +653,11 @@ class binary_split_one_feature_rss_loss: public rfr::splits::k_ary_split_base<2,
 
 		if (std::isnan(num_split_value)){
 			auto i = 0u;
-			while (cat_split_set[i] == 0)
+			while ((i < cat_split_set.size()) && (cat_split_set[i] == 0))
 				i++;
 			str << "$f_{" << feature_index << "} \\in \\{"<<i;
 
-			for (i++; i < max_num_categories; i++){
+			for (i++; i < cat_split_set.size(); i++){
 				if (cat_split_set[i])
 					str<<i<<" ";
 			}
@@ -375,7 +670,7 @@ class binary_split_one_feature_rss_loss: public rfr::splits::k_ary_split_base<2,
 
 	index_t get_feature_index() const {return(feature_index);}
 	num_t get_num_split_value() const {return(num_split_value);}
-	std::bitset<max_num_categories> get_cat_split_set() const {return(cat_split_set);}
+	category_set_t get_cat_split_set() const {return(cat_split_set);}
 
 	/* \brief takes a subspace and returns the 2 corresponding subspaces after the split is applied
 	 *
@@ -0,0 +1,225 @@
+#ifndef RFR_BINARY_SPLIT_RANDOM_THRESHOLD_RSS_HPP
+#define RFR_BINARY_SPLIT_RANDOM_THRESHOLD_RSS_HPP
+
+#include <vector>
+#include <bitset>
+#include <array>
+#include <random>
+#include <limits>
+#include <algorithm>
+#include <typeinfo>
+
+
+#include <rfr/util.hpp>
+#include <rfr/data_containers/data_container.hpp>
+#include <rfr/splits/binary_split_one_feature_rss_loss.hpp>
+
+namespace rfr{ namespace splits{
+
+
+/** \brief extremely randomized binary split minimizing the RSS loss
+ *
+ * Instead of the best split value of a continuous feature, only num_thresholds values
+ * drawn uniformly between the smallest and the largest value in the node are considered
+ * (as in 'Extremely randomized trees' by Geurts et al.). The data points are not sorted;
+ * one pass finds the range of the feature, and a second one scores all thresholds at once.
+ * The best of these random splits among all allowed features is chosen. That makes the
+ * trees more diverse, which reduces the variance of a forest, and cheaper to grow.
+ *
+ * Categorical features are handled exactly like in binary_split_one_feature_rss_loss.
+ * For predictions, the split behaves exactly like binary_split_one_feature_rss_loss.
+ */
+template <	typename num_t = float,
+			typename response_t=float,
+			typename index_t = unsigned int,
+			typename rng_t = std::default_random_engine,
+			unsigned int num_thresholds = 1,
+			unsigned int max_num_categories = 128>
+class binary_split_random_threshold_rss_loss: public rfr::splits::binary_split_one_feature_rss_loss<num_t, response_t, index_t, rng_t, max_num_categories> {
+  private:
+	typedef rfr::splits::binary_split_one_feature_rss_loss<num_t, response_t, index_t, rng_t, max_num_categories> super;
+	typedef rfr::splits::data_info_t<num_t, response_t, index_t> info_t;
+
+  public:
+
+	static constexpr bool uses_presorted_features = false;
+
+	virtual num_t find_best_split(	const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<info_t>::iterator infos_begin,
+									typename std::vector<info_t>::iterator infos_end,
+									std::array<typename std::vector<info_t>::iterator, 3> &info_split_its,
+									index_t min_samples_in_child, num_t min_weight_in_child,
+									rng_t &rng){
+		return(find_best_split(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, nullptr));
+	}
+
+	virtual num_t find_best_split(	const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<info_t>::iterator infos_begin,
+									typename std::vector<info_t>::iterator infos_end,
+									std::array<typename std::vector<info_t>::iterator, 3> &info_split_its,
+									index_t min_samples_in_child, num_t min_weight_in_child,
+									rng_t &rng,
+									rfr::splits::presorted_features<num_t, response_t, index_t> *presorted){
+		rfr::splits::split_workspace<num_t, response_t, index_t> workspace;
+		return(find_best_split(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted, workspace, 0));
+	}
+
+	/** \brief finds the best of the random splits among all allowed features
+	 *
+	 * See binary_split_one_feature_rss_loss::find_best_split for the parameters.
+	 * Nothing is sorted, so the presorted data is not needed and therefore ignored.
+	 * Every feature is a single pass over the data points, so they are always evaluated one after another.
+	 *
+	 * \return num_t loss of the best found split
+	 */
+	virtual num_t find_best_split(	const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<info_t>::iterator infos_begin,
+									typename std::vector<info_t>::iterator infos_end,
+									std::array<typename std::vector<info_t>::iterator, 3> &info_split_its,
+									index_t min_samples_in_child, num_t min_weight_in_child,
+									rng_t &rng,
+									rfr::splits::presorted_features<num_t, response_t, index_t> *,
+									rfr::splits::split_workspace<num_t, response_t, index_t> &workspace,
+									unsigned int){
+
+		if (typeid(data) == typeid(typename super::default_container_t))
+			return(find_best_split_impl(static_cast<const typename super::default_container_t&>(data), features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, workspace));
+		if (typeid(data) == typeid(typename super::contiguous_container_t))
+			return(find_best_split_impl(static_cast<const typename super::contiguous_container_t&>(data), features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, workspace));
+		return(find_best_split_impl(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, workspace));
+	}
+
+	/** \brief the actual implementation of find_best_split for a container of type data_t (see rfr::data_containers::static_feature) */
+	template <typename data_t>
+	num_t find_best_split_impl(	const data_t &data,
+								const std::vector<index_t> &features_to_try,
+								typename std::vector<info_t>::iterator infos_begin,
+								typename std::vector<info_t>::iterator infos_end,
+								std::array<typename std::vector<info_t>::iterator, 3> &info_split_its,
+								index_t min_samples_in_child, num_t min_weight_in_child,
+								rng_t &rng,
+								rfr::splits::split_workspace<num_t, response_t, index_t> &workspace){
+
+		// precompute mean and variance of all responses
+		rfr::util::weighted_running_statistics<num_t> total_stat;
+		for (auto it = infos_begin; it != infos_end; ++it){
+			total_stat.push(it->response, it->weight);
+		}
+
+		num_t best_loss = std::numeric_limits<num_t>::infinity();
+
+		for (index_t fi : features_to_try){
+
+			num_t loss;
+			num_t num_split_copy = NAN;
+			typename super::category_set_t cat_split_copy;
+
+			for (auto it = infos_begin; it != infos_end; ++it){
+				it->feature = rfr::data_containers::static_feature(data, fi, it->index);
+			}
+
+			index_t ft = data.get_type_of_feature(fi);
+			// feature_type zero means that it is a continous variable
+			if (ft == 0)
+				loss = best_split_random_thresholds(infos_begin, infos_end, num_split_copy, total_stat, min_samples_in_child, min_weight_in_child, rng);
+			// a positive feature type encodes the number of possible values
+			else
+				loss = super::best_split_categorical(infos_begin, infos_end, ft, cat_split_copy, total_stat, min_samples_in_child, min_weight_in_child, rng, workspace);
+
+			// check if this split is the best so far
+			if (loss < best_loss){
+				best_loss = loss;
+				super::set_split(data, fi, num_split_copy, cat_split_copy);
+			}
+		}
+		// now we have to rearrange the indices based on which leaf they fall into
+		if (best_loss < std::numeric_limits<num_t>::infinity())
+			super::partition_data_infos(data, infos_begin, infos_end, info_split_its);
+		return(best_loss);
+	}
+
+
+	/** \brief member function to find the best of num_thresholds random splits for a single (continuous) feature
+	 *
+	 * The feature values have to be stored in the data_infos already; their order does not matter.
+	 * The statistics of the data points between two consecutive thresholds are accumulated in one pass,
+	 * the ones of the children for every threshold are sums of those.
+	 *
+	 * \param infos_begin iterator to the first (relevant) element in a vector containing the minimal information in tuples
+	 * \param infos_end iterator beyond the last (relevant) element in a vector containing the minimal information in tuples
+	 * \param split_value a reference to store the split (numerical) criterion
+	 * \param total_stat the statistics of the responses of all data points
+	 * \param min_samples_in_child smallest acceptable number of distinct data points in any of the children
+	 * \param min_weight_in_child smallest acceptable sum of all weights in any of the children
+	 * \param rng a pseudo random number generator instance
+	 *
+	 * \return float the loss of this split
+	 */
+	num_t best_split_random_thresholds(
+					typename std::vector<info_t>::iterator infos_begin,
+					typename std::vector<info_t>::iterator infos_end,
+					num_t &split_value,
+					const rfr::util::weighted_running_statistics<num_t> &total_stat,
+					index_t min_samples_in_child, num_t min_weight_in_child,
+					rng_t &rng) const {
+
+		num_t best_loss = std::numeric_limits<num_t>::infinity();
+
+		num_t min_value = std::numeric_limits<num_t>::infinity();
+		num_t max_value = -std::numeric_limits<num_t>::infinity();
+		for (auto it = infos_begin; it != infos_end; ++it){
+			min_value = std::min(min_value, it->feature);
+			max_value = std::max(max_value, it->feature);
+		}
+		// a constant feature cannot split the data
+		if (!(min_value < max_value)) return(best_loss);
+
+		std::array<num_t, num_thresholds> thresholds;
+		std::uniform_real_distribution<num_t> dist(min_value, max_value);
+		for (auto &t: thresholds)
+			t = dist(rng);
+		std::sort(thresholds.begin(), thresholds.end());
+
+		// statistics of the data points between two consecutive thresholds, the responses are shifted by their mean
+		std::array<rfr::util::shifted_response_sums<>, num_thresholds+1> bins;
+		double shift = total_stat.mean();
+
+		for (auto it = infos_begin; it != infos_end; ++it){
+			// a data point goes to the left of every threshold that is not smaller than its value
+			auto &b = bins[std::distance(thresholds.begin(), std::lower_bound(thresholds.begin(), thresholds.end(), it->feature))];
+			b.push(double(it->response) - shift, it->weight);
+		}
+
+		rfr::util::shifted_response_sums<> total;
+		for (auto &b: bins)
+			total += b;
+		rfr::util::rss_split_loss loss_of_split(total);
+
+		rfr::util::shifted_response_sums<> left;
+		for (auto i = 0u; i < num_thresholds; ++i){
+			left += bins[i];
+
+			index_t right_n = total.n - left.n;
+			double right_w = total.sum_of_weights() - left.sum_of_weights();
+
+			if ((left.n < std::max<index_t>(1, min_samples_in_child)) || (left.w < min_weight_in_child) ||
+				(right_n < std::max<index_t>(1, min_samples_in_child)) || (right_w < min_weight_in_child))
+				continue;
+
+			num_t loss = loss_of_split(left);
+
+			if (loss < best_loss){
+				best_loss = loss;
+				split_value = thresholds[i];
+			}
+		}
+		return(best_loss);
+	}
+};
+
+
+}}//namespace rfr::splits
+#endif
@@ -0,0 +1,83 @@
+#ifndef RFR_CATEGORY_SET_HPP
+#define RFR_CATEGORY_SET_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+
+#include <cereal/cereal.hpp>
+#include <cereal/types/vector.hpp>
+
+
+namespace rfr{ namespace splits{
+
+/** \brief a set of category values that grows as needed
+ *
+ * Drop-in replacement for the std::bitset used by categorical splits (offering the
+ * parts of its interface the splits need) without a fixed upper bound on the number
+ * of categories. Values that were never set, including all values beyond size(), are
+ * not in the set. The memory needed is proportional to the largest value in the set,
+ * so features with thousands of categories are no problem.
+ */
+class category_set{
+  private:
+	std::vector<std::uint64_t> words;
+	std::size_t num_bits;
+
+  public:
+	category_set(): num_bits(0) {}
+
+	template<class Archive>
+	void serialize(Archive & archive){
+		archive(words, num_bits);
+	}
+
+	/** \brief one beyond the largest value that was ever set */
+	std::size_t size() const {return(num_bits);}
+
+	bool operator[] (std::size_t i) const {
+		return((i < num_bits) && ((words[i/64] >> (i%64)) & 1u));
+	}
+
+	bool test (std::size_t i) const {return(operator[](i));}
+
+	/** \brief adds value i to the set */
+	category_set& set (std::size_t i){
+		if (i >= num_bits){
+			num_bits = i+1;
+			words.resize((num_bits+63)/64, 0);
+		}
+		words[i/64] |= std::uint64_t(1) << (i%64);
+		return(*this);
+	}
+
+	/** \brief removes all values */
+	category_set& reset (){
+		words.clear();
+		num_bits = 0;
+		return(*this);
+	}
+
+	std::size_t count() const {
+		std::size_t c = 0;
+		for (auto w: words)
+			for (; w; w &= w-1) ++c;
+		return(c);
+	}
+
+	bool operator== (const category_set &other) const {
+		return((num_bits == other.num_bits) && (words == other.words));
+	}
+	bool operator!= (const category_set &other) const {return(!(*this == other));}
+};
+
+/** \brief prints the set like a std::bitset, the largest value first */
+inline std::ostream& operator<< (std::ostream &os, const category_set &s){
+	for (auto i = s.size(); i > 0; --i)
+		os << (s[i-1] ? '1' : '0');
+	return(os);
+}
+
+}}//namespace rfr::splits
+#endif
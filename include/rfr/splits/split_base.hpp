@@ -27,10 +27,21 @@ struct data_info_t{
 
 
 
+template <typename num_t, typename response_t, typename index_t>
+class presorted_features;
+
+template <typename num_t, typename response_t, typename index_t>
+struct split_workspace;
+
+
+
 template <const int k, typename num_t = float, typename response_t = float, typename index_t = unsigned int, typename rng_t=std::default_random_engine>
 class k_ary_split_base{
   public:
 
+	/** \brief whether find_best_split makes use of the presorted data; the tree only sorts the data for splits that do */
+	static constexpr bool uses_presorted_features = false;
+
 	virtual ~k_ary_split_base() {};
   
 	/** \brief member function to find the optimal split for a subset of the data and features
@@ -60,6 +71,49 @@ class k_ary_split_base{
 									num_t min_weight_in_child,
 									rng_t &rng) = 0;
 
+	/** \brief same as above, but with access to the data presorted by every continuous feature
+	 *
+	 * Splits that can make use of the presorted data should override this function.
+	 * The default implementation simply ignores the presorted data.
+	 *
+	 * \param presorted the data points sorted by every continuous feature, can be a nullptr
+	 */
+	virtual num_t find_best_split(const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<data_info_t<num_t, response_t, index_t> >::iterator infos_begin,
+									typename std::vector<data_info_t<num_t, response_t, index_t> >::iterator infos_end,
+									std::array<typename std::vector<data_info_t<num_t, response_t, index_t> >::iterator, k+1> &info_split_its,
+									index_t min_samples_in_child,
+									num_t min_weight_in_child,
+									rng_t &rng,
+									presorted_features<num_t, response_t, index_t> *){
+		return(find_best_split(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng));
+	}
+
+	/** \brief same as above, but with scratch buffers owned by the caller, and the features may be evaluated by several threads
+	 *
+	 * This is the version the tree calls with its workspace, so the buffers are reused by all nodes.
+	 * The found split must not depend on the number of threads. Splits that need scratch space or can
+	 * evaluate their features concurrently should override this function. The default implementation
+	 * ignores the workspace and evaluates the features one after another.
+	 *
+	 * \param workspace the scratch buffers, only used by this search while it runs
+	 * \param num_threads maximum number of threads to use, 0 evaluates the features one after another like above
+	 */
+	virtual num_t find_best_split(const rfr::data_containers::base<num_t, response_t, index_t> &data,
+									const std::vector<index_t> &features_to_try,
+									typename std::vector<data_info_t<num_t, response_t, index_t> >::iterator infos_begin,
+									typename std::vector<data_info_t<num_t, response_t, index_t> >::iterator infos_end,
+									std::array<typename std::vector<data_info_t<num_t, response_t, index_t> >::iterator, k+1> &info_split_its,
+									index_t min_samples_in_child,
+									num_t min_weight_in_child,
+									rng_t &rng,
+									presorted_features<num_t, response_t, index_t> *presorted,
+									split_workspace<num_t, response_t, index_t> &,
+									unsigned int){
+		return(find_best_split(data, features_to_try, infos_begin, infos_end, info_split_its, min_samples_in_child, min_weight_in_child, rng, presorted));
+	}
+
 	/** \brief tells into which child a given feature vector falls
 	 * 
 	 * \param feature_vector an array containing a valid (in terms of size and values!) feature vector
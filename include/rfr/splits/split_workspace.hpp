@@ -0,0 +1,46 @@
+#ifndef RFR_SPLIT_WORKSPACE_HPP
+#define RFR_SPLIT_WORKSPACE_HPP
+
+#include <vector>
+#include <utility>
+#include <memory>
+
+#include "rfr/util.hpp"
+#include "rfr/splits/split_base.hpp"
+
+
+namespace rfr{ namespace splits{
+
+/** \brief scratch buffers of the split search
+ *
+ * The tree passes the same workspace to the split search of every node (see rfr::trees::fit_workspace),
+ * so the buffers only grow during the first nodes and are reused afterwards. A workspace must only be
+ * used by one search at a time; a search that evaluates its features concurrently gives every worker
+ * one of the worker workspaces.
+ */
+template <typename num_t = float, typename response_t = float, typename index_t = unsigned int>
+struct split_workspace{
+	std::vector<data_info_t<num_t, response_t, index_t> > infos;	//!< a copy of the node's data_infos for a feature searched concurrently
+	std::vector<rfr::util::shifted_response_sums<> > category_sums;	//!< the sums of the (shifted) responses of every category, all zero between two searches
+	std::vector<std::pair<double, index_t> > category_ranking;		//!< (mean response, category) of the categories present in the node
+	std::vector<rfr::util::weighted_running_statistics<num_t> > histogram, right_stats;	//!< the statistics of every bin and of all bins right of a boundary
+
+	/** \brief makes sure there are workspaces for the workers 0 to num_workers-1, must not be called concurrently */
+	void reserve_workers(unsigned int num_workers){
+		if (workers.size() < num_workers)
+			workers.resize(num_workers);
+		for (auto &w: workers){
+			if (!w)
+				w.reset(new split_workspace());
+		}
+	}
+
+	/** \brief the workspace of a worker of rfr::util::parallel_for_with_worker, see reserve_workers */
+	split_workspace& worker(unsigned int w) {return(*workers[w]);}
+
+  private:
+	std::vector<std::unique_ptr<split_workspace> > workers;
+};
+
+}}//namespace rfr::splits
+#endif
@@ -57,6 +57,8 @@ class binary_fANOVA_tree : public k_ary_random_tree<2,  rfr::nodes::k_ary_node_f
 	}
 
 
+	using super::fit;
+
 	/* \brief fit the fANOVA tree
 	 *
 	 * Overloads the ancestor's method to reinitialize variables after fitting.
@@ -64,9 +66,11 @@ class binary_fANOVA_tree : public k_ary_random_tree<2,  rfr::nodes::k_ary_node_f
 	virtual void fit(const rfr::data_containers::base<num_t, response_t, index_t> &data,
 			 rfr::trees::tree_options<num_t, response_t, index_t> tree_opts,
 			 const std::vector<num_t> &sample_weights,
-			 rng_t &rng){
+			 rng_t &rng,
+			 std::vector<index_t> *leaf_indices,
+			 typename super::workspace_t &workspace){
 				 
-		super::fit(data, tree_opts, sample_weights, rng);
+		super::fit(data, tree_opts, sample_weights, rng, leaf_indices, workspace);
 
 		// reset internal variables	
 		split_values.clear();
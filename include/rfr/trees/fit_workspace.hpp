@@ -0,0 +1,46 @@
+#ifndef RFR_FIT_WORKSPACE_HPP
+#define RFR_FIT_WORKSPACE_HPP
+
+#include <vector>
+#include <memory>
+
+#include "rfr/splits/split_base.hpp"
+#include "rfr/splits/split_workspace.hpp"
+
+
+namespace rfr{ namespace trees{
+
+/** \brief scratch space for fitting trees
+ *
+ * Whoever fits the trees owns the workspace (e.g. regression_forest::fit keeps one per thread)
+ * and passes it to every tree, which hands it down to the nodes and their splits. All trees
+ * fitted with it reuse the same buffers, and they are released together with the workspace,
+ * so nothing keeps its peak size once the fit is done. A workspace must only be used by one
+ * tree at a time; subtrees grown in parallel tasks use the worker workspaces.
+ */
+template <typename num_t = float, typename response_t = float, typename index_t = unsigned int>
+struct fit_workspace{
+	std::vector<rfr::splits::data_info_t<num_t, response_t, index_t> > data_infos;	//!< the data points of the tree
+	std::vector<index_t> feature_indices;	//!< all features, shuffled to draw the features to try at a node
+	std::vector<index_t> feature_subset;	//!< the features to try at the current node
+	rfr::splits::split_workspace<num_t, response_t, index_t> split;	//!< the scratch buffers of the split search
+
+	/** \brief makes sure there are workspaces for the workers 0 to num_workers-1, must not be called concurrently */
+	void reserve_workers(unsigned int num_workers){
+		if (workers.size() < num_workers)
+			workers.resize(num_workers);
+		for (auto &w: workers){
+			if (!w)
+				w.reset(new fit_workspace());
+		}
+	}
+
+	/** \brief the workspace of a worker of rfr::util::parallel_for_with_worker, see reserve_workers */
+	fit_workspace& worker(unsigned int w) {return(*workers[w]);}
+
+  private:
+	std::vector<std::unique_ptr<fit_workspace> > workers;
+};
+
+}}//namespace rfr::trees
+#endif
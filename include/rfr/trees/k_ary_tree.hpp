@@ -2,6 +2,7 @@
 #define RFR_K_ARY_TREE_HPP
 
 #include <vector>
+#include <array>
 #include <deque>
 #include <stack>
 #include <utility>       // std::pair
@@ -11,6 +12,7 @@
 #include <iterator>      // std::advance
 #include <fstream>
 #include <random>
+#include <memory>
 
 
 #include "cereal/cereal.hpp"
@@ -20,8 +22,10 @@
 #include "rfr/data_containers/data_container.hpp"
 #include "rfr/nodes/temporary_node.hpp"
 #include "rfr/nodes/k_ary_node.hpp"
+#include "rfr/splits/presorted_features.hpp"
 #include "rfr/trees/tree_base.hpp"
 #include "rfr/trees/tree_options.hpp"
+#include "rfr/trees/fit_workspace.hpp"
 
 #include "rfr/forests/regression_forest.hpp"
 
@@ -33,12 +37,14 @@ class k_ary_random_tree : public rfr::trees::tree_base<num_t, response_t, index_
 
   protected:
     typedef rfr::splits::data_info_t<num_t, response_t, index_t> info_t;
+	typedef rfr::nodes::temporary_node<num_t, response_t, index_t> tmp_node_t;
 
 	std::vector<node_type> the_nodes;
 	index_t num_leafs;
 	index_t actual_depth;
 
   public:
+	typedef rfr::trees::fit_workspace<num_t, response_t, index_t> workspace_t;
 
 	k_ary_random_tree(): the_nodes(0), num_leafs(0), actual_depth(0) {}
 
@@ -60,22 +66,59 @@ class k_ary_random_tree : public rfr::trees::tree_base<num_t, response_t, index_
 	 * \param tree_opts a tree_options object that controls certain aspects of "growing" the tree
 	 * \param sample_weights vector containing the weights of all allowed datapoints (set to individual entries to zero for subsampling), no checks are done here!
 	 * \param rng the random number generator to be used
+	 *
+	 * If tree_opts.num_threads is not 1 and neither the number of nodes nor the number of leaves is limited,
+	 * the tree is grown in tasks: the nodes with many data points are split one after another, but their features are
+	 * evaluated concurrently. Every smaller subtree is grown as a separate task with its own random number generator,
+	 * and the tasks are distributed over the threads. The tree differs from the one grown sequentially, but it is
+	 * the same for any number of threads.
+	 *
+	 * Growing depth first (see tree_options::growth_order) keeps only O(depth) temporary nodes around, and
+	 * the nodes are stored in pre-order afterwards. Growing best first always splits the node with the largest
+	 * reduction of the loss next, so a tree limited by max_num_leaves or max_num_nodes keeps the most valuable
+	 * splits. It always runs sequentially.
 	 */
 	virtual void fit(const rfr::data_containers::base<num_t, response_t, index_t> &data,
 			 rfr::trees::tree_options<num_t, response_t, index_t> tree_opts,
 			 const std::vector<num_t> &sample_weights,
 			 rng_type &rng){
+		fit(data, tree_opts, sample_weights, rng, nullptr);
+	}
 
-		tree_opts.adjust_limits_to_data(data);
-
-		// storage for all the temporary nodes
-		std::deque<rfr::nodes::temporary_node<num_t, response_t, index_t> > tmp_nodes;
+	/** \brief same as above, but also reports the leaf of every data point that was not used for training
+	 *
+	 * The data points with zero sample weight (e.g. the out-of-bag points) go through the
+	 * tree once after it is grown, using a single feature vector.
+	 *
+	 * \param leaf_indices if not a nullptr, it is resized to the number of data points; the entries of the data points with
+	 * zero sample weight receive the node index of their leaf, all others are set to std::numeric_limits<index_t>::max()
+	 */
+	virtual void fit(const rfr::data_containers::base<num_t, response_t, index_t> &data,
+			 rfr::trees::tree_options<num_t, response_t, index_t> tree_opts,
+			 const std::vector<num_t> &sample_weights,
+			 rng_type &rng,
+			 std::vector<index_t> *leaf_indices){
+		workspace_t workspace;
+		fit(data, tree_opts, sample_weights, rng, leaf_indices, workspace);
+	}
 
-		std::vector<index_t> feature_indices(data.num_features());
-		std::iota(feature_indices.begin(), feature_indices.end(), 0);
+	/** \brief same as above, but all scratch space comes from the caller's workspace
+	 *
+	 * Fitting several trees with the same workspace reuses its buffers, see rfr::trees::fit_workspace.
+	 *
+	 * \param workspace the scratch space, only used by this tree while it is fitted
+	 */
+	virtual void fit(const rfr::data_containers::base<num_t, response_t, index_t> &data,
+			 rfr::trees::tree_options<num_t, response_t, index_t> tree_opts,
+			 const std::vector<num_t> &sample_weights,
+			 rng_type &rng,
+			 std::vector<index_t> *leaf_indices,
+			 workspace_t &workspace){
 
+		tree_opts.adjust_limits_to_data(data);
 
-        std::vector<info_t > data_infos;
+        auto &data_infos = workspace.data_infos;
+        data_infos.clear();
         data_infos.reserve(data.num_data_points());
 
         for (auto i=0u; i<data.num_data_points(); ++i){
@@ -85,78 +128,46 @@ class k_ary_random_tree : public rfr::trees::tree_base<num_t, response_t, index_
         }
 
 
-		// add the root to the temporary nodes to get things started
-		tmp_nodes.emplace_back(0, 0, 0, data_infos.begin(), data_infos.end());
+		// sort the continuous features once for the whole tree, if requested and the split can use it
+		std::unique_ptr<rfr::splits::presorted_features<num_t, response_t, index_t> > presorted;
+		if (tree_opts.presort_features && node_type::split_t::uses_presorted_features)
+			presorted.reset(new rfr::splits::presorted_features<num_t, response_t, index_t>(data, data_infos.begin(), data_infos.end()));
 
 		// initialize the private variables in case the tree is refitted!
 		the_nodes.clear();
 		num_leafs = 0;
 		actual_depth = 0;
 
-		// as long as there are potentially splittable nodes
-		while (!tmp_nodes.empty()){
-
-			// resize 'the_nodes' if necessary
-			if (tmp_nodes.back().node_index >= the_nodes.size())
-				the_nodes.resize( tmp_nodes.back().node_index+1);
-
-			bool is_not_pure	= false;
-			bool was_not_split	= true;
-			num_t total_weight  = 0;
-
-			// check if the node is pure and contains enough weight!
-			{
-				num_t ref = (*(tmp_nodes.front().begin)).response;
-				total_weight = (*(tmp_nodes.front().begin)).weight;
-				for(auto it = std::next(tmp_nodes.front().begin); it!= tmp_nodes.front().end; it++){
-							if (std::abs((*it).response - ref) > tree_opts.epsilon_purity){
-									is_not_pure = true;
-							}
-
-							total_weight += (*it).weight;
-
-							if (is_not_pure && (total_weight > tree_opts.min_weight_to_split))
-								break;
-				}
-			}
-
-			// check if it should be split
-			if ((tmp_nodes.front().node_level < tree_opts.max_depth) &&                     // don't grow the tree to deep!
-				(std::distance(tmp_nodes.front().begin, tmp_nodes.front().end) >= tree_opts.min_samples_to_split)&& // are enough sample left in the node?
-				(total_weight >= tree_opts.min_weight_to_split) &&							// enought weight in the node
-				(is_not_pure) &&                                                            // are not all the values the same?
-				(the_nodes.size() <= tree_opts.max_num_nodes-k) &&                          // don't have more nodes than the user specified number
-				(tmp_nodes.size() < tree_opts.max_num_leaves - num_leafs)
-				){
-
-					// generate a subset of the features to try
-					std::shuffle(feature_indices.begin(), feature_indices.end(), rng);
-					std::vector<index_t> feature_subset(feature_indices.begin(), std::next(feature_indices.begin(), tree_opts.max_features));
-
-					//split the node
-					num_t best_loss = the_nodes[tmp_nodes.front().node_index].make_internal_node(
-											tmp_nodes.front(), data, feature_subset,
-											the_nodes.size(), tmp_nodes,
-											tree_opts.min_samples_in_leaf,
-											tree_opts.min_weight_in_leaf,
-											rng);
+		// add the root to the temporary nodes to get things started
+		the_nodes.resize(1);
+		std::deque<tmp_node_t> tmp_nodes;
+		tmp_nodes.emplace_back(0, 0, 0, data_infos.begin(), data_infos.end());
 
-					if (best_loss <  std::numeric_limits<num_t>::infinity())
-						was_not_split = false;
+		// the limits on the size of the tree would need a global view of all tasks
+		if (tree_opts.growth_order == best_first)
+			grow_best_first(tmp_nodes.front(), data, tree_opts, rng, presorted.get(), workspace);
+		else if ((tree_opts.num_threads != 1) &&
+			(tree_opts.max_num_nodes == std::numeric_limits<index_t>::max()) &&
+			(tree_opts.max_num_leaves == std::numeric_limits<index_t>::max()))
+			grow_in_tasks(tmp_nodes, data, tree_opts, rng, presorted.get(), workspace);
+		else
+			grow(the_nodes, tmp_nodes, num_leafs, actual_depth, data, tree_opts, rng, presorted.get(), workspace);
+
+		if (tree_opts.growth_order == depth_first)
+			sort_nodes_in_pre_order();
+		the_nodes.shrink_to_fit();
 
+		// the data points not used for training have to go through the tree
+		if (leaf_indices != nullptr){
+			leaf_indices->assign(data.num_data_points(), std::numeric_limits<index_t>::max());
+			std::vector<num_t> feature_vector(data.num_features());
+			for (auto i=0u; i<data.num_data_points(); ++i){
+				if (sample_weights[i] > 0) continue;
+				for (auto j=0u; j<data.num_features(); ++j)
+					feature_vector[j] = data.feature(j, i);
+				(*leaf_indices)[i] = find_leaf_index(feature_vector);
 			}
-			else{
-				the_nodes[tmp_nodes.front().node_index].make_leaf_node(tmp_nodes.front(), data);
-			}
-
-			if (was_not_split) {
-				actual_depth = std::max(actual_depth, tmp_nodes.front().node_level);
-				num_leafs++;
-			}
-
-			tmp_nodes.pop_front();
 		}
-		the_nodes.shrink_to_fit();
 	}
 
 	virtual index_t find_leaf_index(const std::vector<num_t> &feature_vector) const {
@@ -167,6 +178,46 @@ class k_ary_random_tree : public rfr::trees::tree_base<num_t, response_t, index_
 		return(node_index);
 	}
 
+	/** \brief finds the leaves of many feature vectors at once
+	 *
+	 * The rows are sent through the tree together in tiles of 64, one level at a time,
+	 * and the child node of every row is prefetched before the next row is handled.
+	 * That way the memory accesses of the rows in a tile overlap, and the upper levels
+	 * of the tree stay in cache for all of them.
+	 *
+	 * \param features pointer to num_rows*num_cols values, one feature vector per row
+	 * \param num_rows number of feature vectors
+	 * \param num_cols number of values per feature vector
+	 * \param leaf_indices pointer to num_rows values receiving the index of each row's leaf
+	 */
+	void find_leaf_indices(const num_t *features, index_t num_rows, index_t num_cols, index_t *leaf_indices) const {
+		const index_t tile_size = 64;
+		std::array<index_t, tile_size> active;
+
+		for (index_t first = 0; first < num_rows; first += tile_size){
+			index_t num_active = std::min<index_t>(tile_size, num_rows - first);
+			for (index_t j = 0; j < num_active; ++j){
+				active[j] = first + j;
+				leaf_indices[first + j] = 0;
+			}
+			// every pass moves all rows that have not reached a leaf yet one level down
+			while (num_active > 0){
+				index_t still_active = 0;
+				for (index_t j = 0; j < num_active; ++j){
+					index_t r = active[j];
+					auto &n = the_nodes[leaf_indices[r]];
+					if (n.is_a_leaf())
+						continue;
+					index_t c = n.falls_into_child(features + static_cast<size_t>(r)*num_cols);
+					rfr::util::prefetch(&the_nodes[c]);
+					leaf_indices[r] = c;
+					active[still_active++] = r;
+				}
+				num_active = still_active;
+			}
+		}
+	}
+
 	const node_type&  get_leaf(const std::vector<num_t> &feature_vector) const {
 		index_t node_index = find_leaf_index(feature_vector);
 		return(the_nodes[node_index]);
@@ -232,6 +283,9 @@ class k_ary_random_tree : public rfr::trees::tree_base<num_t, response_t, index_
 
 
 	virtual index_t number_of_nodes() const {return(the_nodes.size());}
+
+	/** \brief access to a node, e.g. to convert the tree into a different representation*/
+	const node_type & get_node(index_t node_index) const {return(the_nodes[node_index]);}
 	virtual index_t number_of_leafs() const {return(num_leafs);}
 	virtual index_t depth()           const {return(actual_depth);}
 
@@ -389,6 +443,293 @@ class k_ary_random_tree : public rfr::trees::tree_base<num_t, response_t, index_
 		str<<"\\end{forest}\n\\end{document}\n";
 		str.close();
 	}
+
+  protected:
+
+	/** \brief splits the temporary nodes (and their children) until they become leaves
+	 *
+	 * \param nodes the nodes of the tree, the temporary nodes refer to them by their index
+	 * \param tmp_nodes the nodes that still have to be checked, it is empty afterwards
+	 * \param leafs incremented for every new leaf
+	 * \param depth the maximum level of all leaves
+	 * \param workspace provides the feature subsets and the split's scratch buffers
+	 * \param tasks if not a nullptr, every node with fewer than min_task_size data points is moved in here instead of being split
+	 * \param num_threads if positive, the features of a node are evaluated with up to that many threads (at least 1024 data points per thread)
+	 */
+	void grow(	std::vector<node_type> &nodes, std::deque<tmp_node_t> &tmp_nodes, index_t &leafs, index_t &depth,
+				const rfr::data_containers::base<num_t, response_t, index_t> &data,
+				const rfr::trees::tree_options<num_t, response_t, index_t> &tree_opts,
+				rng_type &rng,
+				rfr::splits::presorted_features<num_t, response_t, index_t> *presorted,
+				workspace_t &workspace,
+				std::vector<tmp_node_t> *tasks = nullptr, index_t min_task_size = 0,
+				unsigned int num_threads = 0){
+
+		auto &feature_indices = workspace.feature_indices;
+		auto &feature_subset = workspace.feature_subset;
+		reset_feature_indices(data, tree_opts, workspace);
+
+		// as long as there are potentially splittable nodes
+		while (!tmp_nodes.empty()){
+
+			// a queue for breadth first, a stack for depth first growth
+			tmp_node_t current = (tree_opts.growth_order == depth_first) ? tmp_nodes.back() : tmp_nodes.front();
+			if (tree_opts.growth_order == depth_first)
+				tmp_nodes.pop_back();
+			else
+				tmp_nodes.pop_front();
+
+			index_t num_points = std::distance(current.begin, current.end);
+
+			if ((tasks != nullptr) && (num_points < min_task_size)){
+				tasks->push_back(current);
+				continue;
+			}
+
+			bool was_not_split	= true;
+
+			// check if it should be split
+			if (is_splittable(current, tree_opts) &&
+				(nodes.size() <= tree_opts.max_num_nodes-k) &&                              // don't have more nodes than the user specified number
+				(tmp_nodes.size() + 1 < tree_opts.max_num_leaves - leafs)
+				){
+
+					// generate a subset of the features to try
+					std::shuffle(feature_indices.begin(), feature_indices.end(), rng);
+					std::copy(feature_indices.begin(), std::next(feature_indices.begin(), tree_opts.max_features), feature_subset.begin());
+
+					//split the node, the children get the next k indices
+					num_t best_loss = nodes[current.node_index].make_internal_node(
+											current, data, feature_subset,
+											nodes.size(), tmp_nodes,
+											tree_opts.min_samples_in_leaf,
+											tree_opts.min_weight_in_leaf,
+											rng, presorted, &workspace.split,
+											(num_threads > 0) ? rfr::util::effective_num_threads(num_threads, num_points/1024) : 0);
+
+					if (best_loss <  std::numeric_limits<num_t>::infinity()){
+						was_not_split = false;
+						nodes.resize(nodes.size() + k);
+					}
+			}
+			else{
+				nodes[current.node_index].make_leaf_node(current, data);
+			}
+
+			if (was_not_split) {
+				depth = std::max(depth, current.node_level);
+				leafs++;
+			}
+		}
+	}
+
+	/** \brief puts all features in their natural order again, so the drawn subsets do not depend on the trees fitted before with the workspace */
+	void reset_feature_indices(const rfr::data_containers::base<num_t, response_t, index_t> &data,
+								const rfr::trees::tree_options<num_t, response_t, index_t> &tree_opts,
+								workspace_t &workspace) const {
+		workspace.feature_indices.resize(data.num_features());
+		std::iota(workspace.feature_indices.begin(), workspace.feature_indices.end(), 0);
+		workspace.feature_subset.resize(tree_opts.max_features);
+	}
+
+	/** \brief whether a node is large and diverse enough to be split, regardless of the limits on the tree's size */
+	bool is_splittable(const tmp_node_t &current, const rfr::trees::tree_options<num_t, response_t, index_t> &tree_opts) const {
+		return ((current.node_level < tree_opts.max_depth) &&                               // don't grow the tree to deep!
+				(current.num_data_points() >= tree_opts.min_samples_to_split)&&             // are enough sample left in the node?
+				(current.total_weight() >= tree_opts.min_weight_to_split) &&				// enought weight in the node
+				(current.max_response - current.min_response > tree_opts.epsilon_purity));  // are not all the values the same?
+	}
+
+	/** \brief grows the tree from the root always splitting the node with the largest reduction of the loss next
+	 *
+	 * The best split of every new node is computed right away (that also partitions its data points),
+	 * but its children are only created when the node is taken from the heap and the limits on the
+	 * size of the tree allow it. Otherwise, it becomes a leaf. Ties are broken in favor of the older node.
+	 */
+	void grow_best_first(	const tmp_node_t &root,
+							const rfr::data_containers::base<num_t, response_t, index_t> &data,
+							const rfr::trees::tree_options<num_t, response_t, index_t> &tree_opts,
+							rng_type &rng,
+							rfr::splits::presorted_features<num_t, response_t, index_t> *presorted,
+							workspace_t &workspace){
+
+		struct candidate{
+			num_t gain;
+			index_t age;
+			tmp_node_t node;
+			std::deque<tmp_node_t> children;	//!< with indices starting at the number of nodes when the split was computed
+		};
+		std::vector<candidate> heap;
+		auto less_valuable = [] (const candidate &a, const candidate &b){
+			return((a.gain < b.gain) || ((a.gain == b.gain) && (a.age > b.age)));};
+		index_t num_candidates = 0;
+
+		auto &feature_indices = workspace.feature_indices;
+		auto &feature_subset = workspace.feature_subset;
+		reset_feature_indices(data, tree_opts, workspace);
+
+		auto count_leaf = [&] (const tmp_node_t &current){
+			actual_depth = std::max(actual_depth, current.node_level);
+			num_leafs++;
+		};
+
+		auto evaluate = [&] (const tmp_node_t &current){
+			if (!is_splittable(current, tree_opts)){
+				the_nodes[current.node_index].make_leaf_node(current, data);
+				count_leaf(current);
+				return;
+			}
+
+			std::shuffle(feature_indices.begin(), feature_indices.end(), rng);
+			std::copy(feature_indices.begin(), std::next(feature_indices.begin(), tree_opts.max_features), feature_subset.begin());
+
+			candidate c{0, num_candidates++, current, std::deque<tmp_node_t>()};
+			num_t best_loss = the_nodes[current.node_index].make_internal_node(
+									current, data, feature_subset,
+									the_nodes.size(), c.children,
+									tree_opts.min_samples_in_leaf,
+									tree_opts.min_weight_in_leaf,
+									rng, presorted, &workspace.split);
+
+			// without a valid split, the node is a leaf already
+			if (!(best_loss < std::numeric_limits<num_t>::infinity())){
+				count_leaf(current);
+				return;
+			}
+			c.gain = current.response_stat.squared_deviations_from_the_mean() - best_loss;
+			heap.push_back(std::move(c));
+			std::push_heap(heap.begin(), heap.end(), less_valuable);
+		};
+
+		evaluate(root);
+
+		while (!heap.empty()){
+			std::pop_heap(heap.begin(), heap.end(), less_valuable);
+			candidate c = std::move(heap.back());
+			heap.pop_back();
+
+			// every candidate on the heap will become at least one leaf
+			if ((the_nodes.size() > tree_opts.max_num_nodes - k) ||
+				(heap.size() + k > tree_opts.max_num_leaves - num_leafs)){
+				the_nodes[c.node.node_index].make_leaf_node(c.node, data);
+				count_leaf(c.node);
+				continue;
+			}
+
+			// the children get the next k indices, all other indices are smaller than the placeholders
+			index_t placeholder = c.children.front().node_index;
+			index_t first_child = the_nodes.size();
+			the_nodes[c.node.node_index].renumber([placeholder, first_child] (index_t i){
+				return((i >= placeholder) ? first_child + (i - placeholder) : i);});
+			the_nodes.resize(the_nodes.size() + k);
+
+			for (auto &child: c.children){
+				child.node_index = first_child + (child.node_index - placeholder);
+				evaluate(child);
+			}
+		}
+	}
+
+	/** \brief renumbers the nodes in pre-order, so every node's first child follows the node directly */
+	void sort_nodes_in_pre_order(){
+
+		std::vector<index_t> new_index(the_nodes.size());
+		std::vector<index_t> stack(1, 0);
+		index_t next = 0;
+		while (!stack.empty()){
+			index_t i = stack.back();
+			stack.pop_back();
+			new_index[i] = next++;
+			if (!the_nodes[i].is_a_leaf()){
+				auto children = the_nodes[i].get_children();
+				stack.insert(stack.end(), children.rbegin(), children.rend());
+			}
+		}
+
+		std::vector<node_type> sorted_nodes(the_nodes.size());
+		for (auto i = 0u; i < the_nodes.size(); ++i){
+			the_nodes[i].renumber([&new_index] (index_t j) {return(new_index[j]);});
+			sorted_nodes[new_index[i]] = std::move(the_nodes[i]);
+		}
+		the_nodes.swap(sorted_nodes);
+	}
+
+	/** \brief grows the tree in tasks, see fit
+	 *
+	 * Nodes with at least 1/64th of the data points are split here. Every smaller node becomes
+	 * the root of a subtree that is grown independently into its own vector of nodes, using the
+	 * workspace of the worker growing it. Afterwards, the subtrees are appended to the_nodes in
+	 * the order in which they were created.
+	 */
+	void grow_in_tasks(	std::deque<tmp_node_t> &tmp_nodes,
+						const rfr::data_containers::base<num_t, response_t, index_t> &data,
+						const rfr::trees::tree_options<num_t, response_t, index_t> &tree_opts,
+						rng_type &rng,
+						rfr::splits::presorted_features<num_t, response_t, index_t> *presorted,
+						workspace_t &workspace){
+
+		unsigned int num_threads = rfr::util::effective_num_threads(tree_opts.num_threads, std::numeric_limits<index_t>::max());
+		index_t min_task_size = std::max<index_t>(tree_opts.min_samples_to_split, std::distance(tmp_nodes.front().begin, tmp_nodes.front().end)/64);
+
+		std::vector<tmp_node_t> tasks;
+		grow(the_nodes, tmp_nodes, num_leafs, actual_depth, data, tree_opts, rng, presorted, workspace, &tasks, min_task_size, num_threads);
+
+		std::vector<typename rng_type::result_type> seeds(tasks.size());
+		for (auto &s: seeds)
+			s = rng();
+
+		std::vector<std::vector<node_type> > subtrees(tasks.size());
+		std::vector<index_t> subtree_leafs(tasks.size(), 0), subtree_depths(tasks.size(), 0);
+
+		// the largest subtrees first, so the small ones can fill the gaps at the end
+		std::vector<index_t> order(tasks.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&tasks] (index_t a, index_t b){
+			return(std::distance(tasks[a].begin, tasks[a].end) > std::distance(tasks[b].begin, tasks[b].end));});
+
+		unsigned int num_workers = rfr::util::effective_num_threads(num_threads, tasks.size());
+		workspace.reserve_workers(num_workers);
+
+		rfr::util::parallel_for_with_worker<index_t>(tasks.size(), num_workers, [&] (index_t i, unsigned int w){
+			index_t t = order[i];
+			rng_type task_rng = rfr::util::make_rng<rng_type>(seeds[t]);
+
+			// every task needs its own scratch space for the presorted data
+			std::unique_ptr<rfr::splits::presorted_features<num_t, response_t, index_t> > task_presorted;
+			if (presorted != nullptr)
+				task_presorted.reset(new rfr::splits::presorted_features<num_t, response_t, index_t>(*presorted));
+
+			// the subtree's root is its node 0, and so is the root's parent for now
+			subtrees[t].resize(1);
+			std::deque<tmp_node_t> task_nodes(1, tasks[t]);
+			task_nodes.front().node_index = 0;
+			task_nodes.front().parent_index = 0;
+			grow(subtrees[t], task_nodes, subtree_leafs[t], subtree_depths[t], data, tree_opts, task_rng, task_presorted.get(), workspace.worker(w));
+		});
+
+		index_t num_nodes = the_nodes.size();
+		for (auto &subtree: subtrees)
+			num_nodes += subtree.size() - 1;
+		the_nodes.reserve(num_nodes);
+
+		for (auto t = 0u; t < tasks.size(); ++t){
+			index_t root = tasks[t].node_index;
+			index_t offset = the_nodes.size();
+			auto new_index = [root, offset] (index_t i) {return((i == 0) ? root : offset + i - 1);};
+
+			subtrees[t][0].renumber([&tasks, t, offset] (index_t i) {return((i == 0) ? tasks[t].parent_index : offset + i - 1);});
+			the_nodes[root] = subtrees[t][0];
+			for (auto i = 1u; i < subtrees[t].size(); ++i){
+				subtrees[t][i].renumber(new_index);
+				the_nodes.push_back(subtrees[t][i]);
+			}
+			subtrees[t].clear();
+			subtrees[t].shrink_to_fit();
+
+			num_leafs += subtree_leafs[t];
+			actual_depth = std::max(actual_depth, subtree_depths[t]);
+		}
+	}
 };
 
 }}//namespace rfr::trees
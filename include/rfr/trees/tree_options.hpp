@@ -11,6 +11,13 @@
 
 namespace rfr{ namespace trees{
 
+/** \brief order in which the nodes of a tree are split */
+enum growth_order_t {
+	breadth_first,	///< level by level, all nodes of the frontier are kept in memory
+	depth_first,	///< one subtree after another, the nodes are stored in pre-order
+	best_first		///< always the node with the largest reduction of the loss, so the limits on the size of the tree keep the most valuable splits
+};
+
 template <typename num_t = float,typename response_t = float, typename index_t = unsigned int>
 struct tree_options{
   index_t	max_features; 			///< number of features to consider for each split 
@@ -27,15 +34,25 @@ struct tree_options{
     
   response_t epsilon_purity;		///< minimum difference between two response values to be considered different*/
 
+  bool presort_features;		///< flag to sort every continuous feature once per tree instead of at every node (stores one copy of the data per feature)
+  growth_order_t growth_order;	///< order in which the nodes are split (see growth_order_t)
+  unsigned int num_threads;	///< number of threads to grow a single tree with, 0 uses all hardware threads; any value but 1 grows the tree in tasks (see k_ary_random_tree::fit)
+
   num_t life_time; ///< life time of a mondrian tree
   bool hierarchical_smoothing;		///< flag to enable/disable hierachical smoothing for mondrian forests
 
 
-  /** serialize function for saving forests */
+  /** serialize function for saving forests
+    *
+    * Version 1 added max_num_leaves, presort_features, growth_order and num_threads;
+    * loading a version 0 archive leaves them untouched.
+    */
   template<class Archive>
-	void serialize(Archive & archive)
+	void serialize(Archive & archive, std::uint32_t const version)
 	{
 		archive( max_features, max_depth, min_samples_to_split, min_weight_to_split, min_samples_in_leaf, min_weight_in_leaf, max_num_nodes, epsilon_purity, /*min_samples_node,*/ life_time, hierarchical_smoothing);
+		if (version > 0)
+			archive( max_num_leaves, presort_features, growth_order, num_threads);
 	}
 
   /** (Re)set to default values with no limits on the size of the tree
@@ -60,6 +77,10 @@ struct tree_options{
     max_num_leaves = std::numeric_limits<index_t>::max();
   
     epsilon_purity = 1e-10;
+
+    presort_features = false;
+    growth_order = breadth_first;
+    num_threads = 1;
     
     life_time = 1000;
     hierarchical_smoothing = false;
@@ -94,6 +115,9 @@ struct tree_options{
 		std::cout<<"max_num_nodes       : "<< max_num_nodes <<std::endl;
 		std::cout<<"max_num_leaves      : "<< max_num_leaves <<std::endl;
     std::cout<<"epsilon_purity      : "<< epsilon_purity <<std::endl;
+    std::cout<<"presort_features    : "<< presort_features <<std::endl;
+    std::cout<<"growth_order        : "<< growth_order <<std::endl;
+    std::cout<<"num_threads         : "<< num_threads <<std::endl;
     std::cout<<"life_time           : "<< life_time <<std::endl;
     std::cout<<"hierarchical_smoothing: "<< hierarchical_smoothing <<std::endl;
 	}
@@ -101,4 +125,16 @@ struct tree_options{
 };
 
 }}//namespace rfr::trees
+
+
+// CEREAL_CLASS_VERSION only works for a single type, not for all instances of a template
+namespace cereal{ namespace detail{
+template <typename num_t, typename response_t, typename index_t>
+struct Version<rfr::trees::tree_options<num_t, response_t, index_t> >{
+	static const std::uint32_t version = 1;
+};
+
+template <typename num_t, typename response_t, typename index_t>
+const std::uint32_t Version<rfr::trees::tree_options<num_t, response_t, index_t> >::version;
+}}//namespace cereal::detail
 #endif
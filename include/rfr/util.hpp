@@ -3,9 +3,17 @@
 
 #include <cmath>
 #include <vector>
+#include <cstdint>
 #include <algorithm>
 #include <iostream>
 #include <stdexcept>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <string>
+#include <random>
+#include <limits>
 
 
 #include "cereal/cereal.hpp"
@@ -491,6 +499,268 @@ class running_covariance{
 };
 
 
+/** \brief sum of many values in double precision with Neumaier's compensation for the lost low order bits */
+class compensated_sum{
+  private:
+	double sum, compensation;
+
+  public:
+	compensated_sum(): sum(0), compensation(0) {}
+
+	void add (double x){
+		double t = sum + x;
+		if (std::abs(sum) >= std::abs(x))
+			compensation += (sum - t) + x;
+		else
+			compensation += (x - t) + sum;
+		sum = t;
+	}
+
+	compensated_sum& operator+= (double x){
+		add(x);
+		return(*this);
+	}
+
+	double value() const {return(sum + compensation);}
+};
+
+
+inline double value_of(double x) {return(x);}
+inline double value_of(const compensated_sum &x) {return(x.value());}
+
+
+/** \brief sums of the weights and the weighted (squared) responses of a set of data points
+ *
+ * The responses are shifted by a constant, ideally their mean, which keeps the sums of
+ * squares small. sum_t is double, or compensated_sum for sums over many data points.
+ */
+template <typename sum_t = double>
+struct shifted_response_sums{
+	sum_t w = sum_t(), wy = sum_t(), wy2 = sum_t();
+	std::size_t n = 0;
+
+	/** \brief adds a data point given its shifted response y */
+	void push (double y, double weight){
+		w += weight;
+		wy += weight*y;
+		wy2 += weight*y*y;
+		++n;
+	}
+
+	template <typename other_sum_t>
+	shifted_response_sums& operator+= (const shifted_response_sums<other_sum_t> &other){
+		w += value_of(other.w);
+		wy += value_of(other.wy);
+		wy2 += value_of(other.wy2);
+		n += other.n;
+		return(*this);
+	}
+
+	double sum_of_weights() const {return(value_of(w));}
+};
+
+
+/** \brief the loss of splitting a set of data points into a subset and the rest
+ *
+ * The loss is the sum of the squared deviations from the mean of both parts, computed from
+ * the shifted_response_sums of the whole set and the subset. These differences cancel badly,
+ * so values within the round off error of the set's total are zero. That way, pure children
+ * are recognized as such and all splits into them have the same loss.
+ */
+class rss_split_loss{
+  private:
+	double total_w, total_wy, total_wy2, tolerance;
+
+  public:
+	template <typename sum_t>
+	rss_split_loss(const shifted_response_sums<sum_t> &total):
+		total_w(value_of(total.w)), total_wy(value_of(total.wy)), total_wy2(value_of(total.wy2)),
+		tolerance(64*std::numeric_limits<double>::epsilon()*total_wy2) {}
+
+	double squared_deviations_from_the_mean(double w, double wy, double wy2) const {
+		double v = wy2 - wy*wy/w;
+		return((v > tolerance) ? v : 0.);
+	}
+
+	template <typename sum_t>
+	double operator() (const shifted_response_sums<sum_t> &subset) const {
+		double w = value_of(subset.w), wy = value_of(subset.wy), wy2 = value_of(subset.wy2);
+		return(squared_deviations_from_the_mean(w, wy, wy2) + squared_deviations_from_the_mean(total_w - w, total_wy - wy, total_wy2 - wy2));
+	}
+};
+
+
+/** \brief the number of threads busy with the parallel_for calls the calling thread works for
+ *
+ * One outside of parallel_for; inside, the product of the thread counts of all enclosing calls.
+ */
+inline unsigned int& enclosing_num_threads(){
+	static thread_local unsigned int num_threads = 1;
+	return(num_threads);
+}
+
+
+/** \brief number of worker threads to use for a requested value
+ *
+ * Zero means 'use all the hardware threads'. Inside a parallel_for, at most the
+ * hardware threads not taken by the enclosing calls are used, so nested loops
+ * (e.g. trees grown in tasks inside a parallel forest fit) do not oversubscribe
+ * the machine. The result is never larger than the number of work items and at
+ * least one.
+ */
+inline unsigned int effective_num_threads(unsigned int num_threads, size_t num_items){
+	unsigned int hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+	if (num_threads == 0)
+		num_threads = hardware_threads;
+	if (enclosing_num_threads() > 1)
+		num_threads = std::min(num_threads, std::max(1u, hardware_threads/enclosing_num_threads()));
+	return(static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(num_threads, num_items))));
+}
+
+
+/** \brief calls f(i, worker) for every i in [0, n) using up to num_threads threads
+ *
+ * The indices are handed out one at a time, so the order in which they are
+ * processed (and by which thread) is not deterministic. Every call should
+ * therefore only write into storage owned by its index or by its worker. The
+ * workers are numbered from 0 to effective_num_threads(num_threads, n)-1, and
+ * each one handles a single index at a time. If any call throws, the remaining
+ * indices are skipped and the first exception is rethrown in the calling thread.
+ *
+ * \param n number of work items
+ * \param num_threads maximum number of threads, 0 uses all hardware threads
+ * \param f callable taking the index of the work item and the index of the worker
+ */
+template <typename index_t, typename function_t>
+void parallel_for_with_worker(index_t n, unsigned int num_threads, function_t f){
+
+	num_threads = effective_num_threads(num_threads, n);
+
+	if (num_threads == 1){
+		for (index_t i=0; i<n; ++i)
+			f(i, 0u);
+		return;
+	}
+
+	std::atomic<index_t> next(0);
+	std::atomic<bool> failed(false);
+	std::exception_ptr first_exception;
+	std::mutex exception_mutex;
+
+	// every worker counts all threads of this and the enclosing calls
+	unsigned int outer_threads = enclosing_num_threads();
+	auto worker = [&] (unsigned int w){
+		enclosing_num_threads() = outer_threads*num_threads;
+		while (!failed){
+			index_t i = next++;
+			if (i >= n) break;
+			try{
+				f(i, w);
+			}
+			catch (...){
+				std::lock_guard<std::mutex> lock(exception_mutex);
+				if (!failed.exchange(true))
+					first_exception = std::current_exception();
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(num_threads-1);
+	for (auto t=1u; t<num_threads; ++t)
+		threads.emplace_back(worker, t);
+	// the calling thread does its share of the work, too
+	worker(0);
+	enclosing_num_threads() = outer_threads;
+	for (auto &t: threads)
+		t.join();
+
+	if (first_exception)
+		std::rethrow_exception(first_exception);
+}
+
+
+/** \brief calls f(i) for every i in [0, n) using up to num_threads threads
+ *
+ * See parallel_for_with_worker; every call should only write into storage owned by its index.
+ *
+ * \param n number of work items
+ * \param num_threads maximum number of threads, 0 uses all hardware threads
+ * \param f callable taking the index of the work item
+ */
+template <typename index_t, typename function_t>
+void parallel_for(index_t n, unsigned int num_threads, function_t f){
+	parallel_for_with_worker<index_t>(n, num_threads, [&f] (index_t i, unsigned int){f(i);});
+}
+
+
+/** \brief a random number generator for one of several independent streams
+ *
+ * The seed is scrambled by a std::seed_seq first; seeding a linear congruential engine with
+ * consecutive outputs of the same engine would just shift one sequence by one for every stream.
+ */
+template <typename rng_t>
+inline rng_t make_rng(std::uint64_t seed){
+	std::seed_seq seed_sequence{std::uint32_t(seed), std::uint32_t(seed >> 32)};
+	return(rng_t(seed_sequence));
+}
+
+
+/** \brief hints the processor to load the cache line containing address
+ *
+ * Only a hint: it does nothing on compilers without a prefetch builtin.
+ */
+inline void prefetch(const void *address){
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address);
+#else
+	(void) address;
+#endif
+}
+
+
+/** \brief the number of zero bits below the lowest set bit of a non-zero word */
+inline unsigned int count_trailing_zeros(std::uint64_t word){
+#if defined(__GNUC__) || defined(__clang__)
+	return(__builtin_ctzll(word));
+#else
+	unsigned int n = 0;
+	for (; !(word & 1u); word >>= 1)
+		++n;
+	return(n);
+#endif
+}
+
+
+/** \brief calls f(i, row) for every row of a row-major matrix using up to num_threads threads
+ *
+ * The rows are handed out in blocks, and within a block every row is copied
+ * into the same vector, so there is no allocation per row. The same rules as
+ * for parallel_for apply to f.
+ *
+ * \param matrix pointer to num_rows*num_cols values stored row by row
+ * \param num_rows number of rows
+ * \param num_cols number of values per row
+ * \param num_threads maximum number of threads, 0 uses all hardware threads
+ * \param f callable taking the row index and a std::vector with the row's values
+ */
+template <typename num_t, typename index_t, typename function_t>
+void parallel_for_each_row(const num_t *matrix, index_t num_rows, index_t num_cols, unsigned int num_threads, function_t f){
+	const index_t block_size = 64;
+	index_t num_blocks = (num_rows + block_size - 1)/block_size;
+
+	parallel_for<index_t>(num_blocks, num_threads, [&] (index_t b){
+		std::vector<num_t> row(num_cols);
+		index_t end = std::min<index_t>(num_rows, (b+1)*block_size);
+		for (index_t i = b*block_size; i < end; ++i){
+			auto first = matrix + static_cast<size_t>(i)*num_cols;
+			std::copy(first, first + num_cols, row.begin());
+			f(i, row);
+		}
+	});
+}
+
+
 
 
 
@@ -18,7 +18,8 @@ class CustomInstall(install):
 
 
 include_dirs = ['./include']
-extra_compile_args = ['-O2', '-std=c++11']
+extra_compile_args = ['-O2', '-std=c++11', '-pthread']
+extra_link_args = ['-pthread']
 #extra_compile_args = ['-g', '-std=c++11', '-O0', '-Wall']
 
 
@@ -28,14 +29,16 @@ extensions = [	Extension(
 					sources=['pyrfr/regression.i'],
 					include_dirs = include_dirs,
 					swig_opts=['-c++', '-modern', '-features', 'nondynamic'] + ['-I{}'.format(s) for s in include_dirs],
-					extra_compile_args = extra_compile_args
+					extra_compile_args = extra_compile_args,
+					extra_link_args = extra_link_args
 				),
 				Extension(
 					name = 'pyrfr._util',
 					sources=['pyrfr/util.i'],
 					include_dirs = include_dirs,
 					swig_opts=['-c++', '-modern', '-features', 'nondynamic'] + ['-I{}'.format(s) for s in include_dirs],
-					extra_compile_args = extra_compile_args
+					extra_compile_args = extra_compile_args,
+					extra_link_args = extra_link_args
 				)
 			]
 
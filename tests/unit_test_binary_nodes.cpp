@@ -5,6 +5,7 @@
 #include <vector>
 #include <deque>
 #include <tuple>
+#include <algorithm>
 
 
 #include <cereal/cereal.hpp>
@@ -234,6 +235,22 @@ void test_make_internal_node_and_make_leaf_node_differing_values(){
 	nodes.emplace_back();
 	BOOST_REQUIRE_CLOSE(tmp_nodes.front().total_weight(), 60, 1e-4);
 	nodes[1].make_leaf_node(tmp_nodes[0], data);
+
+	// the statistics of the child's responses are computed when it is created
+	{
+		rfr::util::weighted_running_statistics<num_t> stat;
+		std::vector<response_t> responses;
+		for (auto it = tmp_nodes.front().begin; it != tmp_nodes.front().end; ++it){
+			stat.push(it->response, it->weight);
+			responses.push_back(it->response);
+		}
+		auto &child_stat = tmp_nodes.front().response_stat;
+		BOOST_REQUIRE_EQUAL(tmp_nodes.front().num_data_points(), 60);
+		BOOST_REQUIRE_CLOSE(child_stat.mean(), stat.mean(), 1e-8);
+		BOOST_REQUIRE_CLOSE(child_stat.squared_deviations_from_the_mean(), stat.squared_deviations_from_the_mean(), 1e-8);
+		BOOST_REQUIRE_EQUAL(tmp_nodes.front().min_response, *std::min_element(responses.begin(), responses.end()));
+		BOOST_REQUIRE_EQUAL(tmp_nodes.front().max_response, *std::max_element(responses.begin(), responses.end()));
+	}
 	tmp_nodes.pop_front();
 
 	// turn the second child into a leaf
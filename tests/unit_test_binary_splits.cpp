@@ -2,6 +2,8 @@
 #include <numeric>
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <cmath>
 #include <random>
 
 #include <boost/test/unit_test.hpp>
@@ -16,6 +18,9 @@
 
 #include "rfr/data_containers/default_data_container.hpp"
 #include "rfr/splits/binary_split_one_feature_rss_loss.hpp"
+#include "rfr/data_containers/binned_data_container.hpp"
+#include "rfr/splits/binary_split_histogram_rss_loss.hpp"
+#include "rfr/splits/binary_split_random_threshold_rss_loss.hpp"
 
 typedef double num_t;
 typedef unsigned int index_t;
@@ -25,6 +30,10 @@ typedef rfr::data_containers::default_container<num_t, num_t, index_t> data_cont
 typedef rfr::splits::binary_split_one_feature_rss_loss<num_t, num_t, index_t,rng_type,128> split_type;
 typedef rfr::splits::data_info_t<num_t, num_t, index_t> info_t;
 
+typedef rfr::data_containers::binned_container<num_t, num_t, index_t> binned_container_type;
+typedef rfr::splits::binary_split_histogram_rss_loss<num_t, num_t, index_t,rng_type,128> histogram_split_type;
+typedef rfr::splits::binary_split_random_threshold_rss_loss<num_t, num_t, index_t,rng_type> random_threshold_split_type;
+
 
 template <class T>
 void print_vector (T v){
@@ -126,6 +135,71 @@ BOOST_AUTO_TEST_CASE(binary_split_one_feature_rss_loss_continuous_split_test){
 }
 
 
+// (nearly) constant responses with a large offset used to make the scan over the data points quadratic
+BOOST_AUTO_TEST_CASE(binary_split_one_feature_rss_loss_pathological_responses_test){
+
+	data_container_type data(1);
+	for (auto i=0u; i<2000; ++i)
+		data.add_data_point(std::vector<num_t>(1, i), 1e8 + (i < 1000 ? 0 : 1e-2));
+
+	std::vector<info_t > data_info(data.num_data_points());
+	for (auto i=0u; i<data.num_data_points(); ++i){
+		data_info[i].index=i;
+		data_info[i].response = data.response(i);
+		data_info[i].weight = 1;
+	}
+
+	std::array<std::vector<info_t>::iterator, 3> infos_split_it;
+	rng_type rng;
+
+	// both children are pure
+	split_type split1;
+	num_t loss = split1.find_best_split(data, std::vector<index_t>(1,0), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+	BOOST_REQUIRE_EQUAL(loss, 0);
+	BOOST_REQUIRE(split1.get_num_split_value() >= 999);
+	BOOST_REQUIRE(split1.get_num_split_value() < 1000);
+	BOOST_REQUIRE_EQUAL(std::distance(infos_split_it[0], infos_split_it[1]), 1000);
+
+	// the loss of a constant response is zero for every split
+	for (auto &i: data_info)
+		i.response = 1e8;
+	split_type split2;
+	loss = split2.find_best_split(data, std::vector<index_t>(1,0), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+	BOOST_REQUIRE_EQUAL(loss, 0);
+}
+
+
+BOOST_AUTO_TEST_CASE(binary_split_one_feature_rss_loss_tie_test){
+
+	// a continuous and a categorical feature that both separate the responses perfectly
+	data_container_type data(2);
+	for (auto i=0u; i<40; ++i)
+		data.add_data_point({num_t(i), num_t(i < 10 ? 0 : 1)}, (i < 10 ? 1 : 2));
+	data.set_type_of_feature(1, 2);
+
+	std::array<std::vector<info_t>::iterator, 3> infos_split_it;
+	rng_type rng;
+
+	// equal losses go to the feature tried first
+	for (auto fi: {0u, 1u}){
+		std::vector<index_t> features_to_try({fi, 1-fi});
+
+		std::vector<info_t > data_info(data.num_data_points());
+		for (auto i=0u; i<data.num_data_points(); ++i){
+			data_info[i].index=i;
+			data_info[i].response = data.response(i);
+			data_info[i].weight = 1;
+		}
+
+		split_type split;
+		num_t loss = split.find_best_split(data, features_to_try, data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+		BOOST_REQUIRE_EQUAL(loss, 0);
+		BOOST_REQUIRE_EQUAL(split.get_feature_index(), fi);
+		BOOST_REQUIRE_EQUAL(std::distance(infos_split_it[0], infos_split_it[1]), 10);
+	}
+}
+
+
 BOOST_AUTO_TEST_CASE(binary_split_one_feature_rss_loss_categorical_split_test){
 	
 	auto data = load_toy_data();
@@ -207,6 +281,74 @@ BOOST_AUTO_TEST_CASE(binary_split_one_feature_rss_loss_categorical_split_test){
 
 
 // check if it finds the best split out of the two above
+// thousands of categories do not fit into the default split set
+BOOST_AUTO_TEST_CASE(binary_split_one_feature_rss_loss_many_categories_test){
+
+	index_t num_categories = 5000;
+	data_container_type data(1);
+	data.set_type_of_feature(0, num_categories);
+	// only every third category is present, and the odd ones have a larger response
+	for (auto c=0u; c<num_categories; c+=3)
+		for (auto j=0u; j<2; ++j)
+			data.add_data_point(std::vector<num_t>(1, c), (c%2) + 0.1*j);
+
+	std::vector<info_t > data_info(data.num_data_points());
+	for (auto i=0u; i<data.num_data_points(); ++i){
+		data_info[i].index=i;
+		data_info[i].response = data.response(i);
+		data_info[i].weight = 1;
+	}
+
+	std::array<std::vector<info_t>::iterator, 3> infos_split_it;
+	rng_type rng;
+
+	typedef rfr::splits::binary_split_one_feature_rss_loss<num_t, num_t, index_t,rng_type,0> dynamic_split_type;
+	dynamic_split_type split1;
+	num_t loss = split1.find_best_split(data, std::vector<index_t>(1,0), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+
+	// only the spread within each category remains
+	BOOST_REQUIRE_CLOSE(loss, data.num_data_points()*0.05*0.05, 1e-6);
+	// either the even or the odd categories go left
+	auto split_set = split1.get_cat_split_set();
+	bool even_left = split_set[0];
+	for (auto c=0u; c<num_categories; c+=3)
+		BOOST_REQUIRE_EQUAL(split_set[c], (c%2 == 0) == even_left);
+	// unobserved values go right, so the set is no larger than the observed categories in it
+	for (auto c=1u; c<num_categories; ++c)
+		if (c%3 != 0) BOOST_REQUIRE(!split_set[c]);
+	BOOST_REQUIRE(split_set.size() <= num_categories - 1);
+	BOOST_REQUIRE_EQUAL(split_set.count(), even_left ? (num_categories/3 + 2)/2 : (num_categories/3 + 1)/2);
+
+	for (auto it = infos_split_it[0]; it != infos_split_it[1]; ++it)
+		BOOST_REQUIRE_EQUAL(int(data.feature(0, it->index))%2 == 0, even_left);
+	BOOST_REQUIRE_EQUAL(std::distance(infos_split_it[0], infos_split_it[1]), 2*split_set.count());
+
+	// a single draw per search decides the side, so both occur
+	bool seen[2] = {false, false};
+	for (auto i=0u; i<20; ++i){
+		dynamic_split_type split;
+		split.find_best_split(data, std::vector<index_t>(1,0), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+		seen[split.get_cat_split_set()[0]] = true;
+	}
+	BOOST_REQUIRE(seen[0] && seen[1]);
+
+	// the set is saved and restored completely
+	std::stringstream ss;
+	{
+		cereal::PortableBinaryOutputArchive oarchive(ss);
+		oarchive(split1);
+	}
+	dynamic_split_type split2;
+	{
+		cereal::PortableBinaryInputArchive iarchive(ss);
+		iarchive(split2);
+	}
+	BOOST_REQUIRE(split_set == split2.get_cat_split_set());
+	for (auto c=0u; c<num_categories; ++c)
+		BOOST_REQUIRE_EQUAL(split1(num_t(c)), split2(num_t(c)));
+}
+
+
 BOOST_AUTO_TEST_CASE(binary_split_one_feature_rss_loss_find_best_split_test){
 
 	auto data = load_toy_data();
@@ -354,3 +496,102 @@ BOOST_AUTO_TEST_CASE(binary_split_one_feature_rss_loss_binary_serialization){
 	
 }
 
+
+
+BOOST_AUTO_TEST_CASE(binary_split_histogram_rss_loss_test){
+
+	binned_container_type data(2);
+	data.import_csv_files(	std::string(boost::unit_test::framework::master_test_suite().argv[1]) + "toy_data_set_features.csv",
+							std::string(boost::unit_test::framework::master_test_suite().argv[1]) + "toy_data_set_responses.csv");
+	data.set_type_of_feature(1,10);
+
+	std::vector<info_t > data_info(data.num_data_points());
+	for (auto i=0u; i<data.num_data_points(); ++i){
+		data_info[i].index=i;
+		data_info[i].response = data.response(i);
+		data_info[i].weight = 1;
+	}
+
+	std::array<std::vector<info_t>::iterator, 3> infos_split_it;
+	rng_type rng;
+
+	// every value has its own bin, so the split has to be the same as the exact one
+	histogram_split_type split1;
+	num_t loss = split1.find_best_split(data, std::vector<index_t>(1,0), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+	BOOST_REQUIRE_CLOSE(loss, 23.33333333, 1e-4);
+	BOOST_REQUIRE(split1.get_num_split_value() >=59);
+	BOOST_REQUIRE(split1.get_num_split_value() < 60);
+	BOOST_REQUIRE_EQUAL(std::distance(infos_split_it[0], infos_split_it[1]), 60);
+	BOOST_REQUIRE_EQUAL(std::distance(infos_split_it[1], infos_split_it[2]), 40);
+
+	// categorical features are handled by the exact split
+	histogram_split_type split2;
+	loss = split2.find_best_split(data, std::vector<index_t>({0,1}), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+	BOOST_REQUIRE_CLOSE(loss, 23.33333333, 1e-4);
+	loss = split2.find_best_split(data, std::vector<index_t>(1,1), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+	BOOST_REQUIRE_CLOSE(loss, 88.57142857, 1e-6);
+
+	// the split needs the bins
+	data_container_type data2(2);
+	data2.import_csv_files(	std::string(boost::unit_test::framework::master_test_suite().argv[1]) + "toy_data_set_features.csv",
+							std::string(boost::unit_test::framework::master_test_suite().argv[1]) + "toy_data_set_responses.csv");
+	BOOST_REQUIRE_THROW(split2.find_best_split(data2, std::vector<index_t>(1,0), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng), std::runtime_error);
+}
+
+
+BOOST_AUTO_TEST_CASE(binary_split_random_threshold_rss_loss_test){
+	auto data = load_toy_data();
+
+	std::vector<info_t > data_info(data.num_data_points());
+	for (auto i=0u; i<data.num_data_points(); ++i){
+		data_info[i].index=i;
+		data_info[i].response = data.response(i);
+		data_info[i].weight = 1;
+	}
+
+	std::array<std::vector<info_t>::iterator, 3> infos_split_it;
+	rng_type rng;
+
+	// the loss of the found split has to match the children, but cannot beat the best split
+	auto check_split = [&] (const split_type &split, num_t loss){
+		rfr::util::weighted_running_statistics<num_t> left, right;
+		for (auto it = infos_split_it[0]; it != infos_split_it[1]; ++it){
+			BOOST_REQUIRE_EQUAL(split(data.retrieve_data_point(it->index)), 0);
+			left.push(it->response, it->weight);
+		}
+		for (auto it = infos_split_it[1]; it != infos_split_it[2]; ++it){
+			BOOST_REQUIRE_EQUAL(split(data.retrieve_data_point(it->index)), 1);
+			right.push(it->response, it->weight);
+		}
+		BOOST_REQUIRE_CLOSE(loss, left.squared_deviations_from_the_mean() + right.squared_deviations_from_the_mean(), 1e-6);
+		BOOST_REQUIRE(loss >= 23.33333333*(1-1e-8));
+	};
+
+	for (auto i=0; i < 10; ++i){
+		random_threshold_split_type split1;
+		num_t loss = split1.find_best_split(data, std::vector<index_t>(1,0), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+		BOOST_REQUIRE(loss < std::numeric_limits<num_t>::infinity());
+		BOOST_REQUIRE(split1.get_num_split_value() >= 0);
+		BOOST_REQUIRE(split1.get_num_split_value() < 99);
+		check_split(split1, loss);
+	}
+
+	// with many thresholds, the best one is found most of the time
+	rfr::splits::binary_split_random_threshold_rss_loss<num_t, num_t, index_t, rng_type, 1024> split2;
+	num_t loss = split2.find_best_split(data, std::vector<index_t>(1,0), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+	check_split(split2, loss);
+	BOOST_REQUIRE_CLOSE(loss, 23.33333333, 1e-4);
+
+	// categorical features are handled by the exact split
+	random_threshold_split_type split3;
+	loss = split3.find_best_split(data, std::vector<index_t>(1,1), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+	BOOST_REQUIRE_CLOSE(loss, 88.57142857, 1e-6);
+
+	// a constant feature cannot be split
+	data_container_type data2(1);
+	for (auto i=0u; i<data.num_data_points(); ++i)
+		data2.add_data_point(std::vector<num_t>(1, 1.), data.response(i));
+	random_threshold_split_type split4;
+	loss = split4.find_best_split(data2, std::vector<index_t>(1,0), data_info.begin(), data_info.end(), infos_split_it, 1, 1, rng);
+	BOOST_REQUIRE(loss == std::numeric_limits<num_t>::infinity());
+}
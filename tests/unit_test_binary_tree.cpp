@@ -11,6 +11,7 @@
 #include <sstream>
 
 #include "rfr/data_containers/default_data_container.hpp"
+#include "rfr/data_containers/contiguous_data_container.hpp"
 #include "rfr/splits/binary_split_one_feature_rss_loss.hpp"
 #include "rfr/nodes/temporary_node.hpp"
 #include "rfr/nodes/k_ary_node.hpp"
@@ -19,6 +20,10 @@
 
 #include "rfr/trees/binary_fanova_tree.hpp"
 
+#include "rfr/data_containers/binned_data_container.hpp"
+#include "rfr/splits/binary_split_histogram_rss_loss.hpp"
+#include "rfr/splits/binary_split_random_threshold_rss_loss.hpp"
+
 typedef double num_t;
 typedef double response_t;
 typedef unsigned int index_t;
@@ -274,3 +279,391 @@ BOOST_AUTO_TEST_CASE(  second_binary_tree_constraints_test ){
 }
 
 
+
+
+BOOST_AUTO_TEST_CASE( binary_tree_presorted_features_test ){
+
+	// only the exact split sorts, so the tree does not presort the data for the others
+	BOOST_REQUIRE(node_t::split_t::uses_presorted_features);
+	BOOST_REQUIRE(!(rfr::splits::binary_split_histogram_rss_loss<num_t, response_t, index_t, rng_t>::uses_presorted_features));
+	BOOST_REQUIRE(!(rfr::splits::binary_split_random_threshold_rss_loss<num_t, response_t, index_t, rng_t>::uses_presorted_features));
+
+	auto data = load_toy_data();
+	auto diabetes = load_diabetes_data();
+
+	for (auto d : {&data, &diabetes}){
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = d->num_features()/2+1;
+		// in tiny nodes, different splits can have the same loss up to round off errors
+		tree_opts.min_samples_to_split = 10;
+
+		// some data points are left out or weighted differently
+		std::vector<num_t> sample_weights(d->num_data_points(), 1);
+		for (auto i=0u; i<sample_weights.size(); i+=3)
+			sample_weights[i] = i%2;
+
+		tree_t tree1, tree2;
+		rng_t rng1(1), rng2(1);
+
+		tree1.fit(*d, tree_opts, sample_weights, rng1);
+		tree_opts.presort_features = true;
+		tree2.fit(*d, tree_opts, sample_weights, rng2);
+
+		BOOST_REQUIRE_EQUAL(tree1.number_of_nodes(), tree2.number_of_nodes());
+		BOOST_REQUIRE(tree2.check_split_fractions(1e-6));
+
+		for (auto i=0u; i < d->num_data_points(); ++i){
+			auto fv = d->retrieve_data_point(i);
+			BOOST_REQUIRE_EQUAL(tree1.find_leaf_index(fv), tree2.find_leaf_index(fv));
+			BOOST_REQUIRE_CLOSE(tree1.predict(fv), tree2.predict(fv), 1e-8);
+		}
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( binary_tree_task_mode_test ){
+
+	auto data = load_toy_data();
+	auto diabetes = load_diabetes_data();
+
+	for (auto d : {&data, &diabetes}){
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = d->num_features()/2+1;
+		// in tiny nodes, different splits can have the same loss up to round off errors
+		tree_opts.min_samples_to_split = 10;
+
+		std::vector<num_t> sample_weights(d->num_data_points(), 1);
+		for (auto i=0u; i<sample_weights.size(); i+=3)
+			sample_weights[i] = i%2;
+
+		// the tree must not depend on the number of threads
+		std::vector<tree_t> trees(4);
+		std::vector<std::vector<index_t> > leaf_indices(trees.size());
+		for (auto t=0u; t < trees.size(); ++t){
+			tree_opts.num_threads = (t < 3) ? 2*t : 4;
+			tree_opts.presort_features = (t == 3);
+			rng_t rng(1);
+			trees[t].fit(*d, tree_opts, sample_weights, rng, &leaf_indices[t]);
+		}
+
+		for (auto &tree: trees){
+			BOOST_REQUIRE_EQUAL(tree.number_of_nodes(), trees[0].number_of_nodes());
+			BOOST_REQUIRE_EQUAL(tree.number_of_leafs(), trees[0].number_of_leafs());
+			BOOST_REQUIRE_EQUAL(tree.depth(), trees[0].depth());
+			BOOST_REQUIRE(tree.check_split_fractions(1e-6));
+
+			// the subtrees have to be linked correctly
+			index_t num_leafs = 0;
+			for (auto i=0u; i < tree.number_of_nodes(); ++i){
+				if (tree.get_node(i).is_a_leaf())
+					++num_leafs;
+				else{
+					for (auto c: tree.get_node(i).get_children())
+						BOOST_REQUIRE_EQUAL(tree.get_node(c).parent(), i);
+				}
+			}
+			BOOST_REQUIRE_EQUAL(num_leafs, tree.number_of_leafs());
+		}
+
+		for (auto i=0u; i < d->num_data_points(); ++i){
+			auto fv = d->retrieve_data_point(i);
+			for (auto t=0u; t < trees.size(); ++t){
+				// only the data points not used for training are reported
+				BOOST_REQUIRE_EQUAL(leaf_indices[t][i], (sample_weights[i] > 0) ? std::numeric_limits<index_t>::max() : trees[t].find_leaf_index(fv));
+				BOOST_REQUIRE_EQUAL(trees[t].find_leaf_index(fv), trees[0].find_leaf_index(fv));
+				BOOST_REQUIRE_CLOSE(trees[t].predict(fv), trees[0].predict(fv), 1e-8);
+			}
+		}
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( binary_tree_workspace_test ){
+
+	auto data = load_toy_data();
+	auto diabetes = load_diabetes_data();
+
+	// one workspace for all trees, whatever was fitted with it before must not change a tree
+	tree_t::workspace_t workspace;
+
+	for (auto mode = 0u; mode < 4; ++mode){
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = 2;
+		tree_opts.min_samples_to_split = 10;
+		tree_opts.num_threads = (mode == 1) ? 4 : 1;
+		tree_opts.growth_order = (mode == 2) ? rfr::trees::best_first : rfr::trees::breadth_first;
+		tree_opts.presort_features = (mode == 3);
+
+		for (auto d : {&data, &diabetes}){
+			auto other = (d == &data) ? &diabetes : &data;
+			std::vector<num_t> sample_weights(d->num_data_points(), 1);
+
+			tree_t tree1, tree2, other_tree;
+			rng_t rng1(5), rng2(5), rng3(7);
+			tree1.fit(*d, tree_opts, sample_weights, rng1);
+			other_tree.fit(*other, tree_opts, std::vector<num_t>(other->num_data_points(), 1), rng3, nullptr, workspace);
+			tree2.fit(*d, tree_opts, sample_weights, rng2, nullptr, workspace);
+
+			BOOST_REQUIRE_EQUAL(tree1.number_of_nodes(), tree2.number_of_nodes());
+			for (auto i=0u; i < d->num_data_points(); ++i){
+				auto fv = d->retrieve_data_point(i);
+				BOOST_REQUIRE_EQUAL(tree1.find_leaf_index(fv), tree2.find_leaf_index(fv));
+				BOOST_REQUIRE_EQUAL(tree1.predict(fv), tree2.predict(fv));
+			}
+
+			// the categorical search leaves its sums zeroed for the next node
+			for (auto &c: workspace.split.category_sums)
+				BOOST_REQUIRE_EQUAL(c.n, 0u);
+		}
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( binary_tree_depth_first_test ){
+
+	auto data = load_toy_data();
+	auto diabetes = load_diabetes_data();
+
+	for (auto d : {&data, &diabetes}){
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = d->num_features()/2+1;
+		tree_opts.min_samples_to_split = 10;
+		tree_opts.growth_order = rfr::trees::depth_first;
+
+		std::vector<num_t> sample_weights(d->num_data_points(), 1);
+		for (auto i=0u; i<sample_weights.size(); i+=3)
+			sample_weights[i] = i%2;
+
+		// sequentially and in tasks
+		for (auto num_threads : {1u, 2u}){
+			tree_opts.num_threads = num_threads;
+
+			tree_t tree;
+			rng_t rng(1);
+			std::vector<index_t> leaf_indices;
+			tree.fit(*d, tree_opts, sample_weights, rng, &leaf_indices);
+
+			BOOST_REQUIRE(tree.number_of_nodes() > 1);
+			BOOST_REQUIRE(tree.check_split_fractions(1e-6));
+
+			// in pre-order, the first child follows its parent, and the second one its sibling's subtree
+			std::vector<index_t> subtree_size(tree.number_of_nodes(), 1);
+			for (auto i = tree.number_of_nodes(); i-- > 0;){
+				auto &n = tree.get_node(i);
+				if (n.is_a_leaf()) continue;
+				BOOST_REQUIRE_EQUAL(n.get_child_index(0), i+1);
+				BOOST_REQUIRE_EQUAL(n.get_child_index(1), i+1+subtree_size[i+1]);
+				for (auto c: n.get_children()){
+					BOOST_REQUIRE_EQUAL(tree.get_node(c).parent(), i);
+					subtree_size[i] += subtree_size[c];
+				}
+			}
+			BOOST_REQUIRE_EQUAL(subtree_size[0], tree.number_of_nodes());
+
+			// the leaves of the out-of-bag points are looked up after the nodes are sorted
+			for (auto i=0u; i < d->num_data_points(); ++i){
+				if (sample_weights[i] == 0)
+					BOOST_REQUIRE_EQUAL(leaf_indices[i], tree.find_leaf_index(d->retrieve_data_point(i)));
+			}
+		}
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( binary_tree_best_first_test ){
+
+	auto data = load_diabetes_data();
+
+	rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+	tree_opts.max_features = data.num_features();
+
+	std::vector<num_t> sample_weights(data.num_data_points(), 1);
+
+	// sum of squared errors on the training data
+	auto sse = [&data] (const tree_t &tree){
+		num_t e = 0;
+		for (auto i=0u; i < data.num_data_points(); ++i){
+			num_t r = tree.predict(data.retrieve_data_point(i)) - data.response(i);
+			e += r*r;
+		}
+		return(e);
+	};
+
+	for (index_t max_leaves: {2u, 5u, 8u, 20u}){
+		tree_opts.max_num_leaves = max_leaves;
+
+		tree_t tree1, tree2;
+		rng_t rng1(1), rng2(1);
+
+		tree_opts.growth_order = rfr::trees::breadth_first;
+		tree1.fit(data, tree_opts, sample_weights, rng1);
+		tree_opts.growth_order = rfr::trees::best_first;
+		tree2.fit(data, tree_opts, sample_weights, rng2);
+
+		BOOST_REQUIRE_EQUAL(tree2.number_of_leafs(), max_leaves);
+		BOOST_REQUIRE_EQUAL(tree2.number_of_nodes(), 2*max_leaves-1);
+		BOOST_REQUIRE(tree2.check_split_fractions(1e-6));
+		for (auto i=0u; i < tree2.number_of_nodes(); ++i){
+			if (tree2.get_node(i).is_a_leaf()) continue;
+			for (auto c: tree2.get_node(i).get_children())
+				BOOST_REQUIRE_EQUAL(tree2.get_node(c).parent(), i);
+		}
+
+		BOOST_REQUIRE_EQUAL(tree1.number_of_leafs(), max_leaves);
+		// with the same number of leaves, the most valuable splits fit the training data better
+		BOOST_REQUIRE(sse(tree2) <= sse(tree1)*(1+1e-10));
+	}
+
+	// the number of nodes is limited, too
+	tree_opts.max_num_leaves = std::numeric_limits<index_t>::max();
+	tree_opts.max_num_nodes = 10;
+	tree_t tree;
+	rng_t rng(1);
+	tree.fit(data, tree_opts, sample_weights, rng);
+	BOOST_REQUIRE_EQUAL(tree.number_of_nodes(), 9);
+}
+
+
+// a container derived from the default one is not dispatched statically and has to go through its own feature function
+class counting_container: public data_container_t{
+  public:
+	mutable std::size_t num_feature_calls = 0;
+
+	counting_container(index_t num_f): data_container_t(num_f) {}
+
+	virtual num_t feature (index_t feature_index, index_t sample_index) const {
+		++num_feature_calls;
+		return(data_container_t::feature(feature_index, sample_index));
+	}
+};
+
+
+BOOST_AUTO_TEST_CASE( binary_tree_static_dispatch_test ){
+
+	auto data = load_toy_data();
+	auto diabetes = load_diabetes_data();
+
+	for (auto d : {&data, &diabetes}){
+		counting_container data2(d->num_features());
+		rfr::data_containers::contiguous_container<num_t, response_t, index_t> data3(d->num_features());
+		for (auto i=0u; i < d->num_features(); ++i){
+			data2.set_type_of_feature(i, d->get_type_of_feature(i));
+			data3.set_type_of_feature(i, d->get_type_of_feature(i));
+		}
+		for (auto i=0u; i < d->num_data_points(); ++i){
+			data2.add_data_point(d->retrieve_data_point(i), d->response(i), d->weight(i));
+			data3.add_data_point(d->retrieve_data_point(i), d->response(i), d->weight(i));
+		}
+
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = d->num_features()/2+1;
+
+		std::vector<num_t> sample_weights(d->num_data_points(), 1);
+
+		tree_t tree1, tree2, tree3;
+		rng_t rng1(1), rng2(1), rng3(1);
+
+		tree1.fit(*d, tree_opts, sample_weights, rng1);
+		tree2.fit(data2, tree_opts, sample_weights, rng2);
+		tree3.fit(data3, tree_opts, sample_weights, rng3);
+
+		BOOST_REQUIRE(data2.num_feature_calls > 0);
+		BOOST_REQUIRE_EQUAL(tree1.number_of_nodes(), tree2.number_of_nodes());
+		BOOST_REQUIRE_EQUAL(tree1.number_of_nodes(), tree3.number_of_nodes());
+
+		for (auto i=0u; i < d->num_data_points(); ++i){
+			auto fv = d->retrieve_data_point(i);
+			BOOST_REQUIRE_EQUAL(tree1.find_leaf_index(fv), tree2.find_leaf_index(fv));
+			BOOST_REQUIRE_EQUAL(tree1.find_leaf_index(fv), tree3.find_leaf_index(fv));
+			BOOST_REQUIRE_EQUAL(tree1.predict(fv), tree2.predict(fv));
+			BOOST_REQUIRE_EQUAL(tree1.predict(fv), tree3.predict(fv));
+		}
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( binary_tree_histogram_split_test ){
+
+	typedef rfr::splits::binary_split_histogram_rss_loss<num_t, response_t, index_t, rng_t> 	histogram_split_t;
+	typedef rfr::nodes::k_ary_node_full<2, histogram_split_t, num_t, response_t, index_t, rng_t> 	histogram_node_t;
+	typedef rfr::trees::k_ary_random_tree<2, histogram_node_t, num_t, response_t, index_t, rng_t>	histogram_tree_t;
+
+	rfr::data_containers::binned_container<num_t, response_t, index_t> data(10, 32);
+	data.import_csv_files(	std::string(boost::unit_test::framework::master_test_suite().argv[1]) + "diabetes_features.csv",
+							std::string(boost::unit_test::framework::master_test_suite().argv[1]) + "diabetes_responses.csv");
+
+	rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+	tree_opts.max_features = 5;
+
+	rng_t rng;
+	histogram_tree_t the_tree;
+	the_tree.fit(data, tree_opts, std::vector<num_t>(data.num_data_points(), 1), rng);
+
+	BOOST_REQUIRE(the_tree.check_split_fractions(1e-6));
+	BOOST_REQUIRE(the_tree.number_of_leafs() > 1);
+
+	// every training point has to end up in a leaf that contains its response
+	for (auto i=0u; i < data.num_data_points(); ++i){
+		auto &entries = the_tree.leaf_entries(data.retrieve_data_point(i));
+		BOOST_REQUIRE(std::find(entries.begin(), entries.end(), data.response(i)) != entries.end());
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( binary_tree_random_threshold_split_test ){
+
+	typedef rfr::splits::binary_split_random_threshold_rss_loss<num_t, response_t, index_t, rng_t> 	random_threshold_split_t;
+	typedef rfr::nodes::k_ary_node_full<2, random_threshold_split_t, num_t, response_t, index_t, rng_t> 	random_threshold_node_t;
+	typedef rfr::trees::k_ary_random_tree<2, random_threshold_node_t, num_t, response_t, index_t, rng_t>	random_threshold_tree_t;
+
+	auto data = load_toy_data();
+	auto diabetes = load_diabetes_data();
+
+	for (auto d : {&data, &diabetes}){
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = d->num_features();
+
+		rng_t rng;
+		random_threshold_tree_t the_tree;
+		the_tree.fit(*d, tree_opts, std::vector<num_t>(d->num_data_points(), 1), rng);
+
+		BOOST_REQUIRE(the_tree.check_split_fractions(1e-6));
+		BOOST_REQUIRE(the_tree.number_of_leafs() > 1);
+
+		// every training point has to end up in a leaf that contains its response
+		for (auto i=0u; i < d->num_data_points(); ++i){
+			auto &entries = the_tree.leaf_entries(d->retrieve_data_point(i));
+			BOOST_REQUIRE(std::find(entries.begin(), entries.end(), d->response(i)) != entries.end());
+		}
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( binary_tree_find_leaf_indices_test ){
+
+	// the toy data has a categorical feature
+	auto data = load_toy_data();
+	auto diabetes = load_diabetes_data();
+
+	for (auto d : {&data, &diabetes}){
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = d->num_features();
+
+		rng_t rng;
+		tree_t the_tree;
+		the_tree.fit(*d, tree_opts, std::vector<num_t>(d->num_data_points(), 1), rng);
+
+		index_t n = d->num_data_points(), nf = d->num_features();
+		std::vector<num_t> X;
+		for (auto i=0u; i < n; ++i){
+			auto x = d->retrieve_data_point(i);
+			X.insert(X.end(), x.begin(), x.end());
+		}
+
+		// more rows than fit into one tile, and a partial one at the end
+		std::vector<index_t> leaves(n);
+		the_tree.find_leaf_indices(X.data(), n, nf, leaves.data());
+		for (auto i=0u; i < n; ++i)
+			BOOST_REQUIRE_EQUAL(leaves[i], the_tree.find_leaf_index(d->retrieve_data_point(i)));
+	}
+}
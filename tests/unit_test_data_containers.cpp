@@ -3,9 +3,14 @@
 #include <numeric>
 #include <cstring>
 #include <random>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
 
 #include "rfr/data_containers/default_data_container.hpp"
 #include "rfr/data_containers/default_data_container_with_instances.hpp"
+#include "rfr/data_containers/binned_data_container.hpp"
+#include "rfr/data_containers/contiguous_data_container.hpp"
 
 typedef double num_t;
 typedef double response_t;
@@ -14,6 +19,8 @@ typedef std::default_random_engine rng_t;
 
 typedef rfr::data_containers::default_container<num_t, response_t, index_t> data_container_type;
 typedef rfr::data_containers::default_container_with_instances<num_t, response_t, index_t> data_container_type2;
+typedef rfr::data_containers::binned_container<num_t, response_t, index_t> binned_container_type;
+typedef rfr::data_containers::contiguous_container<num_t, response_t, index_t> contiguous_container_type;
 
 
 
@@ -87,6 +94,124 @@ BOOST_AUTO_TEST_CASE(data_container_corrupted_files_test){
 	
 }
 
+// the straightforward way to read a CSV file, to check the fast reader against
+std::vector< std::vector<num_t> > reference_read_csv_file(std::string filename){
+	std::vector< std::vector<num_t> > csv_values;
+	std::fstream file(filename, std::ios::in);
+	std::string line;
+	while (std::getline(file, line)){
+		std::istringstream s(line);
+		std::string field;
+		for (size_t i=0; std::getline(s, field, ','); ++i){
+			if (i == csv_values.size())
+				csv_values.emplace_back();
+			csv_values[i].push_back(strtod(field.c_str(), 0));
+		}
+	}
+	return(csv_values);
+}
+
+
+BOOST_AUTO_TEST_CASE(read_csv_file_test){
+
+	std::string dir(boost::unit_test::framework::master_test_suite().argv[1]);
+
+	std::vector<std::string> filenames = {	"diabetes_features.csv", "diabetes_responses.csv", "toy_data_set_weights.csv",
+											"online_lda_features.csv", "sat_saps_configurations.csv", "sinx_features.csv", "sinxy_responses.csv"};
+
+	// a file large enough to be read in several chunks, with numbers in all kinds of formats
+	std::default_random_engine rng(1);
+	std::uniform_real_distribution<num_t> dist(-1000, 1000);
+	{
+		std::ofstream file("large_csv_test_file.csv");
+		char buffer[64];
+		for (auto i=0u; i<60000; ++i){
+			num_t x = dist(rng);
+			std::snprintf(buffer, 64, "%.17g, %d,%.3f, %e,", x, int(x), x, x/1e25);
+			file << buffer << (i%7 == 0 ? "0.1e-30" : "1.25E+3") << (i%2 ? "\n" : "\r\n");
+		}
+	}
+
+	for (auto filename: filenames){
+		auto ref = reference_read_csv_file(dir + filename);
+		for (auto num_threads: {1u, 4u}){
+			auto values = rfr::read_csv_file<num_t>(dir + filename, num_threads);
+			BOOST_REQUIRE_EQUAL(values.size(), ref.size());
+			for (auto i=0u; i<ref.size(); ++i)
+				BOOST_CHECK_EQUAL_COLLECTIONS(values[i].begin(), values[i].end(), ref[i].begin(), ref[i].end());
+		}
+	}
+
+	auto ref = reference_read_csv_file("large_csv_test_file.csv");
+	auto values = rfr::read_csv_file<num_t>("large_csv_test_file.csv", 4);
+	BOOST_REQUIRE_EQUAL(values.size(), 5);
+	for (auto i=0u; i<ref.size(); ++i)
+		BOOST_CHECK_EQUAL_COLLECTIONS(values[i].begin(), values[i].end(), ref[i].begin(), ref[i].end());
+
+	// inconsistent lines are an error
+	{
+		std::ofstream file("corrupted_csv_test_file.csv");
+		file << "1,2,3\n\n4,5,6\n7,8\n";
+	}
+	BOOST_REQUIRE_THROW(rfr::read_csv_file<num_t>("corrupted_csv_test_file.csv"), std::runtime_error);
+	BOOST_REQUIRE_THROW(rfr::read_csv_file<num_t>("does_not_exist.csv"), std::runtime_error);
+
+	// the parser on its own
+	for (std::string field: {"0", "-0", "12", " +3.5", "1e5", "1.e-3", ".5", "nan", "-inf", "0x1p3", "abc", "", "7 \r", "1e400", "123456789012345678901234"}){
+		num_t x = rfr::parse_csv_field(field.data(), field.data()+field.size());
+		num_t y = strtod(field.c_str(), 0);
+		BOOST_REQUIRE((x == y) || (std::isnan(x) && std::isnan(y)));
+		BOOST_REQUIRE_EQUAL(std::signbit(x), std::signbit(y));
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(import_csv_files_with_types_test){
+
+	std::string dir(boost::unit_test::framework::master_test_suite().argv[1]);
+
+	data_container_type data(2);
+	data.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv", "", {0, 10});
+	BOOST_REQUIRE_EQUAL(data.get_type_of_feature(0), 0);
+	BOOST_REQUIRE_EQUAL(data.get_type_of_feature(1), 10);
+
+	BOOST_REQUIRE_THROW(data.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv", "", {0}), std::runtime_error);
+	// feature 0 has values that are too large for 10 categories
+	BOOST_REQUIRE_THROW(data.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv", "", {10, 10}), std::runtime_error);
+
+	// a failed import leaves the container as it was
+	data_container_type data3(2);
+	data3.add_data_point({1, 2}, 3);
+	data3.set_type_of_feature(1, 5);
+	BOOST_REQUIRE_THROW(data3.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv", "", {10, 10}), std::runtime_error);
+	BOOST_REQUIRE_EQUAL(data3.num_data_points(), 1);
+	BOOST_REQUIRE_EQUAL(data3.feature(1, 0), 2);
+	BOOST_REQUIRE_EQUAL(data3.get_type_of_feature(0), 0);
+	BOOST_REQUIRE_EQUAL(data3.get_type_of_feature(1), 5);
+
+	// the contiguous container parses into its own buffer, with the same result
+	contiguous_container_type data4(2);
+	data4.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv", "", {0, 10}, 2);
+	BOOST_REQUIRE_EQUAL(data4.num_data_points(), data.num_data_points());
+	BOOST_REQUIRE_EQUAL(data4.get_type_of_feature(1), 10);
+	for (auto i=0u; i<data.num_data_points(); ++i){
+		BOOST_REQUIRE_EQUAL(data4.feature(0, i), data.feature(0, i));
+		BOOST_REQUIRE_EQUAL(data4.feature(1, i), data.feature(1, i));
+		BOOST_REQUIRE_EQUAL(data4.response(i), data.response(i));
+	}
+	BOOST_REQUIRE_THROW(data4.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv", "", {10, 10}), std::runtime_error);
+	BOOST_REQUIRE_EQUAL(data4.num_data_points(), data.num_data_points());
+	BOOST_REQUIRE_EQUAL(data4.get_type_of_feature(0), 0);
+	BOOST_REQUIRE_EQUAL(data4.get_type_of_feature(1), 10);
+
+	binned_container_type data2(2);
+	data2.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv", "", {0, 10});
+	BOOST_REQUIRE(data2.is_quantized());
+	BOOST_REQUIRE_EQUAL(data2.num_bins(1), 1);
+	BOOST_REQUIRE(data2.num_bins(0) > 1);
+}
+
+
 BOOST_AUTO_TEST_CASE(data_container_internal_corruption){
 
 	auto data = load_diabetes_data<mess_with_internals>();
@@ -412,3 +537,129 @@ BOOST_AUTO_TEST_CASE( vector_input ) {
 	BOOST_REQUIRE_THROW(data.add_data_point(std::vector<num_t>(3, 1.), std::vector<response_t >(responses2,responses2+3)), std::runtime_error);
 }
 
+
+
+BOOST_AUTO_TEST_CASE( binned_container_tests ){
+
+	BOOST_REQUIRE_THROW(binned_container_type(2, 1), std::runtime_error);
+	BOOST_REQUIRE_THROW(binned_container_type(2, 257), std::runtime_error);
+
+	auto data = load_diabetes_data<binned_container_type>();
+	BOOST_REQUIRE(data.is_quantized());
+
+	// features with few distinct values get one bin per value, the others at most 256
+	for (auto f=0u; f<data.num_features(); ++f){
+		std::vector<num_t> values;
+		for (auto i=0u; i<data.num_data_points(); ++i)
+			values.push_back(data.feature(f,i));
+		std::sort(values.begin(), values.end());
+		auto num_unique = std::distance(values.begin(), std::unique(values.begin(), values.end()));
+		if (num_unique <= 256)
+			BOOST_REQUIRE_EQUAL(data.num_bins(f), num_unique);
+		else
+			BOOST_REQUIRE(data.num_bins(f) <= 256);
+	}
+
+	// coarser bins still have to be consistent with their thresholds
+	binned_container_type data2(10, 16);
+	for (auto i=0u; i<data.num_data_points(); ++i){
+		auto x = data.retrieve_data_point(i);
+		x[1] = i%3;
+		data2.add_data_point(x, data.response(i), data.weight(i));
+	}
+	BOOST_REQUIRE(!data2.is_quantized());
+	data2.set_type_of_feature(1, 3);
+	data2.quantize_features();
+
+	// points added later go into the existing bins
+	std::vector<num_t> x(10, -1000);
+	x[1] = 0;
+	data2.add_data_point(x, 1);
+	std::fill(x.begin(), x.end(), 1000);
+	x[1] = 2;
+	data2.add_data_point(x, 1);
+
+	BOOST_REQUIRE_EQUAL(data2.num_bins(1), 1);
+	for (auto f=0u; f<data2.num_features(); ++f){
+		if (data2.get_type_of_feature(f) > 0) continue;
+		BOOST_REQUIRE(data2.num_bins(f) <= 16);
+		BOOST_REQUIRE(data2.num_bins(f) > 1);
+
+		for (auto i=0u; i<data2.num_data_points(); ++i){
+			for (auto b=0u; b+1<data2.num_bins(f); ++b)
+				BOOST_REQUIRE_EQUAL(data2.bin(f,i) <= b, data2.feature(f,i) <= data2.bin_threshold(f,b));
+		}
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE( contiguous_container_tests ){
+
+	auto data = load_diabetes_data();
+	auto data2 = load_diabetes_data<contiguous_container_type>();
+
+	index_t n = data.num_data_points(), d = data.num_features();
+
+	// the same data in one block, added in chunks of different sizes
+	std::vector<num_t> X, y, w;
+	for (auto i=0u; i<n; ++i){
+		auto x = data.retrieve_data_point(i);
+		X.insert(X.end(), x.begin(), x.end());
+		y.push_back(data.response(i));
+		w.push_back(1 + i%3);
+	}
+	contiguous_container_type data3(d, 16);
+	BOOST_REQUIRE_EQUAL(data3.capacity(), 16);
+	index_t added = 0;
+	for (index_t chunk: {1u, 7u, 100u, 0u, 2000u}){
+		chunk = std::min(chunk, n-added);
+		data3.add_data_points(&X[added*d], chunk, &y[added], &w[added]);
+		added += chunk;
+		BOOST_REQUIRE_EQUAL(data3.num_data_points(), added);
+		BOOST_REQUIRE(data3.capacity() >= added);
+	}
+	BOOST_REQUIRE_EQUAL(added, n);
+
+	for (auto c: {&data2, &data3}){
+		BOOST_REQUIRE_EQUAL(c->num_data_points(), n);
+		BOOST_REQUIRE_EQUAL(c->num_features(), d);
+		for (auto f=0u; f<d; ++f){
+			BOOST_REQUIRE_EQUAL(c->get_min_max_of_feature(f).first, data.get_min_max_of_feature(f).first);
+			BOOST_REQUIRE_EQUAL(c->get_min_max_of_feature(f).second, data.get_min_max_of_feature(f).second);
+			for (auto i=0u; i<n; ++i){
+				BOOST_REQUIRE_EQUAL(c->feature(f,i), data.feature(f,i));
+				BOOST_REQUIRE_EQUAL(c->feature_column(f)[i], data.feature(f,i));
+			}
+		}
+		for (auto i=0u; i<n; ++i)
+			BOOST_REQUIRE_EQUAL(c->response(i), data.response(i));
+	}
+	for (auto f=0u; f<d; ++f)
+		BOOST_REQUIRE_EQUAL(data2.get_bounds_of_feature(f).first, data.get_bounds_of_feature(f).first);
+	for (auto i=0u; i<n; ++i){
+		BOOST_REQUIRE_EQUAL(data2.weight(i), 1);
+		BOOST_REQUIRE_EQUAL(data3.weight(i), 1 + i%3);
+	}
+	auto v1 = data.features(3, {1,5,7}), v2 = data3.features(3, {1,5,7});
+	BOOST_CHECK_EQUAL_COLLECTIONS(v1.begin(), v1.end(), v2.begin(), v2.end());
+	BOOST_REQUIRE_THROW(data3.retrieve_data_point(n), std::out_of_range);
+
+	// single data points
+	contiguous_container_type data4(2);
+	data4.add_data_point({1, 2}, 3);
+	data4.add_data_point({4, 1}, std::vector<response_t>({5, 6}), 2);
+	data4.set_type_of_feature(1, 3);
+	BOOST_REQUIRE_EQUAL(data4.predict_value(1), 6);
+	BOOST_REQUIRE_EQUAL(data4.get_type_of_feature(1), 3);
+
+	// an invalid data point in a block leaves the container unchanged
+	std::vector<num_t> block = {1, 0, 2, 5}, responses = {1, 1};
+	BOOST_REQUIRE_THROW(data4.add_data_points(block.data(), 2, responses.data()), std::runtime_error);
+	BOOST_REQUIRE_EQUAL(data4.num_data_points(), 2);
+	block[3] = 2;
+	data4.add_data_points(block.data(), 2, responses.data());
+	BOOST_REQUIRE_EQUAL(data4.num_data_points(), 4);
+	BOOST_REQUIRE_EQUAL(data4.feature(1, 3), 2);
+	BOOST_REQUIRE_EQUAL(data4.feature(0, 0), 1);
+}
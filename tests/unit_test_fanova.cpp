@@ -219,7 +219,17 @@ BOOST_AUTO_TEST_CASE (hooker_fanova_test) {
 
 
 BOOST_AUTO_TEST_CASE (legacy_fanova_test) {
-	auto data = load_toy_data();
+	// x in [0,100) and a categorical feature with three values; the response is
+	// 1 for x < 20, 2 for 20 <= x < 60 and for x >= 60 it only depends on the category:
+	// 3 for category 0, 4 for the categories 1 and 2. Below 60, the categories are
+	// spread over the responses, so the tree has to split on x at the root and in
+	// the left child, and on the category in the right child.
+	data_container_type data(2);
+	for (auto x=0; x<100; ++x){
+		num_type cat = (x < 60) ? x%3 : ((x%2 == 0) ? 0 : (x%4 == 1 ? 2 : 1));
+		response_t y = (x < 20) ? 1 : ((x < 60) ? 2 : (cat == 0 ? 3 : 4));
+		data.add_data_point({num_type(x), cat}, y);
+	}
 	data.set_type_of_feature(1, 3);
 
 	rfr::trees::tree_options<num_type, response_t, index_t> tree_opts;
@@ -243,10 +253,25 @@ BOOST_AUTO_TEST_CASE (legacy_fanova_test) {
 		the_tree.save_latex_representation("/tmp/rfr_test.tex");
 		the_tree.precompute_marginals(-inf, inf, pcs, types);
 
+		BOOST_REQUIRE_EQUAL(the_tree.number_of_nodes(), 7);
+
+		// the split values are drawn uniformly between the neighbouring data points
+		num_type t0 = the_tree.get_node(0).get_split().get_num_split_value();
+		num_type t1 = the_tree.get_node(1).get_split().get_num_split_value();
+		BOOST_REQUIRE(t0 > 59 && t0 < 60);
+		BOOST_REQUIRE(t1 > 19 && t1 < 20);
+
+		// the right child splits category 0 from the categories 1 and 2
+		BOOST_REQUIRE(std::isnan(the_tree.get_node(2).get_split().get_num_split_value()));
+		auto cat_set = the_tree.get_node(2).get_split().get_cat_split_set();
+		BOOST_REQUIRE( cat_set.test(0));
+		BOOST_REQUIRE(!cat_set.test(1));
+		BOOST_REQUIRE(!cat_set.test(2));
+
 
 		std::vector<num_type> feature_3({10., NAN});
 		std::vector<num_type> feature_4({50, NAN});
-		std::vector<num_type> feature_56({90., NAN});
+		std::vector<num_type> feature_56({70., NAN});
 
 		std::vector<num_type> feature_345({NAN, 0});
 		std::vector<num_type> feature_346({NAN, 1});
@@ -255,13 +280,13 @@ BOOST_AUTO_TEST_CASE (legacy_fanova_test) {
 
 
 		num_type s0 = 300;
-		num_type s1 = 178.61191331472548;
-		num_type s2 = 121.38808668527452;
-		num_type s3 =  59.86622661388443;
-		num_type s4 = 118.74568670084104;
-		num_type s5 =  40.46269556175817;
-		num_type s6 =  80.92539112351633;
-		
+		num_type s1 = 3*t0;
+		num_type s2 = 3*(100-t0);
+		num_type s3 = 3*t1;
+		num_type s4 = 3*(t0-t1);
+		num_type s5 = 100-t0;
+		num_type s6 = 2*(100-t0);
+
 
 
 		// check subspace sizes without cutoffs
@@ -274,13 +299,13 @@ BOOST_AUTO_TEST_CASE (legacy_fanova_test) {
 		BOOST_REQUIRE_CLOSE(the_tree.get_subspace_size(6), s6, 1e-6);
 
 		// the correpsonding marginal predictions
-		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(0), 2.4748241706496, 1e-6);
-		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(1), 1.6648251199885, 1e-6);
-		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(2), 3.6666666666666, 1e-6);
-		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(3),               1, 1e-6);
-		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(4),               2, 1e-6);
-		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(5),               3, 1e-6);
-		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(6),               4, 1e-6);
+		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(0), (s3*1 + s4*2 + s5*3 + s6*4)/s0, 1e-6);
+		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(1), (s3*1 + s4*2)/s1, 1e-6);
+		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(2),       11./3., 1e-6);
+		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(3),            1, 1e-6);
+		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(4),            2, 1e-6);
+		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(5),            3, 1e-6);
+		BOOST_REQUIRE_CLOSE(the_tree.get_marginal_prediction(6),            4, 1e-6);
 
 		// and the active variables
 		BOOST_REQUIRE( the_tree.get_active_variables(0)[0]);
@@ -290,19 +315,24 @@ BOOST_AUTO_TEST_CASE (legacy_fanova_test) {
 		BOOST_REQUIRE(!the_tree.get_active_variables(2)[0]);
 		BOOST_REQUIRE( the_tree.get_active_variables(2)[1]);
 
-		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_3  , pcs, types).mean(),              1,1e-6);
-		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_4  , pcs, types).mean(),              2,1e-6);
-		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_56 , pcs, types).mean(), 3.666666666666,1e-6);
-		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_345, pcs, types).mean(), 2.205072866904,1e-6);
-		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_346, pcs, types).mean(), 2.609699822522,1e-6);
-		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_6  , pcs, types).mean(),              4,1e-6);
-		
+		// fixing the category only keeps a third of the left subtree's volume and the matching leaf on the right
+		num_type cat0_mean = (s3*1./3.+s4*2./3.+s5*3)/(s3/3.+s4/3.+s5);
+		num_type cat1_mean = (s3*1./3.+s4*2./3.+s6*4./2.)/(s3/3.+s4/3.+s6/2.);
+		BOOST_REQUIRE(cat1_mean - cat0_mean > 0.1);
+
+		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_3  , pcs, types).mean(),         1,1e-6);
+		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_4  , pcs, types).mean(),         2,1e-6);
+		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_56 , pcs, types).mean(),   11./3.,1e-6);
+		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_345, pcs, types).mean(), cat0_mean,1e-6);
+		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_346, pcs, types).mean(), cat1_mean,1e-6);
+		BOOST_REQUIRE_CLOSE( the_tree.marginalized_prediction_stat(feature_6  , pcs, types).mean(),         4,1e-6);
+
 		{
 			double m = (1*s3 + 2*s4+ 3*s5 + 4*s6)/(s3+s4+s5+s6);
 			double v = ((1.-m)*(1.-m)*s3 + (2.-m)*(2.-m)*s4+ (3.-m)*(3.-m)*s5 + (4.-m)*(4.-m)*s6)/(s3+s4+s5+s6);
 			BOOST_REQUIRE_CLOSE( the_tree.get_total_variance(), v, 1e-6);
 		}
-		
+
 
 		// now let's exclude exactly one leaf
 		the_tree.precompute_marginals(-inf, 3.5, pcs, types);
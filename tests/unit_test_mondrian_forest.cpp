@@ -256,3 +256,47 @@ BOOST_AUTO_TEST_CASE( mondrian_forest_exceptions_tests ){
 	BOOST_REQUIRE_THROW(the_forest.fit(data, rng), std::runtime_error);
 
 }
+
+
+BOOST_AUTO_TEST_CASE( mondrian_forest_batch_prediction_test ){
+
+	auto data = load_diabetes_data();
+
+	rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+	tree_opts.min_samples_to_split = 4;
+	tree_opts.min_samples_in_leaf = 1;
+	tree_opts.hierarchical_smoothing = false;
+	tree_opts.max_features = data.num_data_points()*3/4;
+	tree_opts.life_time = 5;
+
+	rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+	forest_opts.num_data_points_per_tree = data.num_data_points();
+	forest_opts.num_trees = 4;
+	forest_opts.num_threads = 3;
+
+	forest_type the_forest(forest_opts);
+	rng_t rng;
+	the_forest.fit(data, rng);
+
+	index_t n = data.num_data_points(), d = data.num_features();
+	std::vector<num_t> X;
+	for (auto i=0u; i < n; ++i){
+		auto x = data.retrieve_data_point(i);
+		X.insert(X.end(), x.begin(), x.end());
+	}
+
+	std::vector<response_t> preds(n);
+	std::vector<num_t> means(n), vars(n);
+	the_forest.predict_batch(X.data(), n, d, preds.data());
+	the_forest.predict_mean_var_batch(X.data(), n, d, means.data(), vars.data());
+
+	for (auto i=0u; i < n; ++i){
+		auto x = data.retrieve_data_point(i);
+		BOOST_REQUIRE_EQUAL(preds[i], the_forest.predict(x));
+		auto mv = the_forest.predict_mean_var(x);
+		BOOST_REQUIRE_EQUAL(means[i], mv.first);
+		BOOST_REQUIRE_EQUAL(vars[i], mv.second);
+	}
+
+	BOOST_REQUIRE_THROW(the_forest.predict_batch(X.data(), n, d-1, preds.data()), std::runtime_error);
+}
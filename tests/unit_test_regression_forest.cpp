@@ -1,8 +1,16 @@
 #include <boost/test/unit_test.hpp>
 
 #include <random>
+#include <numeric>
 
 #include <memory>
+#include <cstdlib>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <dlfcn.h>
 
 #include "rfr/data_containers/default_data_container.hpp"
 #include "rfr/splits/binary_split_one_feature_rss_loss.hpp"
@@ -76,6 +84,7 @@ BOOST_AUTO_TEST_CASE( regression_forest_serialize_test ){
 	forest_opts.num_trees = 16;
 	forest_opts.do_bootstrapping = true;
 	forest_opts.compute_oob_error= true;
+	forest_opts.num_threads = 3;
 	
 	forest_type the_forest(forest_opts);
 	
@@ -119,6 +128,9 @@ BOOST_AUTO_TEST_CASE( regression_forest_serialize_test ){
 		BOOST_REQUIRE_EQUAL(v1,v3);
 	}
 
+	BOOST_REQUIRE_EQUAL(the_forest2.options.num_threads, 3);
+	BOOST_REQUIRE_EQUAL(the_forest3.options.num_threads, 3);
+
 
 	
 
@@ -183,6 +195,629 @@ BOOST_AUTO_TEST_CASE( regression_forest_update_downdate_tests ){
 }
 
 
+BOOST_AUTO_TEST_CASE( regression_forest_num_threads_test ){
+
+	auto data = load_diabetes_data();
+
+	rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+	tree_opts.max_features = data.num_features()/2;
+
+	rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+
+	forest_opts.num_data_points_per_tree = data.num_data_points();
+	forest_opts.num_trees = 12;
+	forest_opts.do_bootstrapping = true;
+	forest_opts.compute_oob_error = true;
+
+	// the same seed has to give the same forest, no matter how many threads grow it
+	std::vector<forest_type> forests;
+	for (index_t num_threads : {1u, 3u, 0u}){
+		forest_opts.num_threads = num_threads;
+		forests.emplace_back(forest_opts);
+		rng_t rng(42);
+		forests.back().fit(data, rng);
+	}
+
+	for (auto &f: forests)
+		BOOST_REQUIRE_EQUAL(f.out_of_bag_error(), forests[0].out_of_bag_error());
+
+	for (auto i=0u; i < data.num_data_points(); ++i){
+		auto v1 = forests[0].predict(data.retrieve_data_point(i));
+		for (auto &f: forests)
+			BOOST_REQUIRE_EQUAL(v1, f.predict(data.retrieve_data_point(i)));
+	}
+}
+
+
+// gives access to the trees to recompute the out-of-bag predictions
+class oob_forest_type: public forest_type{
+  public:
+	oob_forest_type(rfr::forests::forest_options<num_t, response_t, index_t> opts): forest_type(opts) {}
+
+	num_t reference_oob_prediction(const data_container_type &data, index_t i) const {
+		rfr::util::running_statistics<num_t> stat;
+		for (auto t=0u; t < the_trees.size(); ++t)
+			if (bootstrap_sample_counts(t)[i] == 0)
+				stat.push(the_trees[t].predict(data.retrieve_data_point(i)));
+		return(stat.number_of_points() > 0 ? stat.mean() : NAN);
+	}
+};
+
+
+BOOST_AUTO_TEST_CASE( regression_forest_oob_predictions_test ){
+
+	auto data = load_diabetes_data();
+
+	rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+	tree_opts.max_features = data.num_features()/2;
+
+	rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+	forest_opts.num_data_points_per_tree = data.num_data_points();
+	forest_opts.num_trees = 8;
+	forest_opts.do_bootstrapping = true;
+	forest_opts.compute_oob_error = true;
+	forest_opts.num_threads = 3;
+
+	oob_forest_type the_forest(forest_opts);
+	rng_t rng(3);
+	the_forest.fit(data, rng);
+
+	auto oob_predictions = the_forest.out_of_bag_predictions();
+	BOOST_REQUIRE_EQUAL(oob_predictions.size(), data.num_data_points());
+
+	rfr::util::running_statistics<num_t> error_stat;
+	index_t num_nan = 0;
+	for (auto i=0u; i < data.num_data_points(); ++i){
+		num_t ref = the_forest.reference_oob_prediction(data, i);
+		if (std::isnan(ref)){
+			BOOST_REQUIRE(std::isnan(oob_predictions[i]));
+			++num_nan;
+			continue;
+		}
+		BOOST_REQUIRE_EQUAL(oob_predictions[i], ref);
+		error_stat.push(std::pow(ref - data.response(i), 2));
+	}
+	BOOST_REQUIRE(num_nan < data.num_data_points()/10);
+	BOOST_REQUIRE_CLOSE(the_forest.out_of_bag_error(), std::sqrt(error_stat.mean()), 1e-10);
+
+	// the bootstrap samples are drawn again from the stored seeds, also after loading the forest
+	oob_forest_type the_forest3(forest_opts);
+	the_forest3.load_from_ascii_string(the_forest.ascii_string_representation());
+	for (auto t=0u; t < forest_opts.num_trees; ++t){
+		auto counts = the_forest.bootstrap_sample_counts(t);
+		BOOST_REQUIRE_EQUAL(std::accumulate(counts.begin(), counts.end(), 0u), forest_opts.num_data_points_per_tree);
+		auto counts3 = the_forest3.bootstrap_sample_counts(t);
+		BOOST_REQUIRE(counts == counts3);
+	}
+	BOOST_REQUIRE_THROW(the_forest.bootstrap_sample_counts(forest_opts.num_trees), std::runtime_error);
+	auto oob_predictions3 = the_forest3.out_of_bag_predictions();
+	for (auto i=0u; i < data.num_data_points(); ++i)
+		BOOST_REQUIRE((oob_predictions[i] == oob_predictions3[i]) || (std::isnan(oob_predictions[i]) && std::isnan(oob_predictions3[i])));
+
+	// without the option, there are no predictions
+	forest_opts.compute_oob_error = false;
+	forest_type the_forest2(forest_opts);
+	the_forest2.fit(data, rng);
+	BOOST_REQUIRE(the_forest2.out_of_bag_predictions().empty());
+	BOOST_REQUIRE(std::isnan(the_forest2.out_of_bag_error()));
+}
+
+
+BOOST_AUTO_TEST_CASE( regression_forest_add_trees_test ){
+
+	auto data = load_diabetes_data();
+
+	rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+	tree_opts.max_features = data.num_features()/2;
+
+	rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+	forest_opts.num_data_points_per_tree = data.num_data_points();
+	forest_opts.do_bootstrapping = true;
+	forest_opts.compute_oob_error = true;
+	forest_opts.num_threads = 2;
+
+	// an unfitted forest cannot be extended
+	forest_type the_forest1(forest_opts);
+	rng_t rng1(7);
+	BOOST_REQUIRE_THROW(the_forest1.add_trees(data, 3, rng1), std::runtime_error);
+
+	// 5 + 3 trees have to give the same forest as 8 trees right away
+	forest_opts.num_trees = 5;
+	the_forest1 = forest_type(forest_opts);
+	the_forest1.fit(data, rng1);
+	auto oob_error1 = the_forest1.out_of_bag_error();
+
+	// a saved forest can be extended, too
+	forest_type the_forest2;
+	the_forest2.load_from_ascii_string(the_forest1.ascii_string_representation());
+	rng_t rng2(rng1);
+
+	the_forest1.add_trees(data, 3, rng1);
+	the_forest2.add_trees(data, 3, rng2);
+
+	forest_opts.num_trees = 8;
+	forest_type the_forest3(forest_opts);
+	rng_t rng3(7);
+	the_forest3.fit(data, rng3);
+
+	BOOST_REQUIRE_EQUAL(the_forest1.num_trees(), 8);
+	BOOST_REQUIRE_EQUAL(the_forest1.options.num_trees, 8);
+	BOOST_REQUIRE(oob_error1 != the_forest1.out_of_bag_error());
+	BOOST_REQUIRE_EQUAL(the_forest1.out_of_bag_error(), the_forest3.out_of_bag_error());
+	BOOST_REQUIRE_EQUAL(the_forest2.out_of_bag_error(), the_forest3.out_of_bag_error());
+
+	for (auto i=0u; i < data.num_data_points(); ++i){
+		auto x = data.retrieve_data_point(i);
+		BOOST_REQUIRE_EQUAL(the_forest1.predict(x), the_forest3.predict(x));
+		BOOST_REQUIRE_EQUAL(the_forest2.predict(x), the_forest3.predict(x));
+	}
+
+	// the data has to match
+	data_container_type data2(data.num_features());
+	data2.add_data_point(data.retrieve_data_point(0), data.response(0));
+	BOOST_REQUIRE_THROW(the_forest1.add_trees(data2, 1, rng1), std::runtime_error);
+	data_container_type data3(data.num_features()+1);
+	for (auto i=0u; i < data.num_data_points(); ++i){
+		auto x = data.retrieve_data_point(i);
+		x.push_back(0);
+		data3.add_data_point(x, data.response(i));
+	}
+	BOOST_REQUIRE_THROW(the_forest1.add_trees(data3, 1, rng1), std::runtime_error);
+
+	// the trees added to a loaded forest have to be grown with the saved limits and growth order
+	tree_opts.max_num_leaves = 16;
+	tree_opts.growth_order = rfr::trees::best_first;
+	tree_opts.presort_features = true;
+	forest_opts.tree_opts = tree_opts;
+	forest_opts.num_trees = 5;
+	forest_type the_forest4(forest_opts);
+	rng_t rng4(11);
+	the_forest4.fit(data, rng4);
+
+	forest_type the_forest5;
+	the_forest5.load_from_ascii_string(the_forest4.ascii_string_representation());
+	BOOST_REQUIRE_EQUAL(the_forest5.options.tree_opts.max_num_leaves, 16);
+	BOOST_REQUIRE_EQUAL(the_forest5.options.tree_opts.growth_order, rfr::trees::best_first);
+	BOOST_REQUIRE(the_forest5.options.tree_opts.presort_features);
+	BOOST_REQUIRE_EQUAL(the_forest5.options.tree_opts.num_threads, tree_opts.num_threads);
+
+	rng_t rng5(rng4);
+	the_forest4.add_trees(data, 3, rng4);
+	the_forest5.add_trees(data, 3, rng5);
+
+	BOOST_REQUIRE_EQUAL(the_forest5.embedding_dimension(), 8*16);
+	BOOST_REQUIRE_EQUAL(the_forest4.out_of_bag_error(), the_forest5.out_of_bag_error());
+	for (auto i=0u; i < data.num_data_points(); ++i){
+		auto x = data.retrieve_data_point(i);
+		BOOST_REQUIRE_EQUAL(the_forest4.predict(x), the_forest5.predict(x));
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE( regression_forest_batch_prediction_test ){
+
+	auto data = load_diabetes_data();
+
+	rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+	tree_opts.max_features = data.num_features()/2;
+
+	rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+	forest_opts.num_data_points_per_tree = data.num_data_points();
+	forest_opts.num_trees = 10;
+
+	qrf_type the_forest(forest_opts);
+	rng_t rng(1);
+	the_forest.fit(data, rng);
+
+	// all data points in one row-major matrix
+	index_t n = data.num_data_points(), d = data.num_features();
+	std::vector<num_t> X;
+	for (auto i=0u; i < n; ++i){
+		auto x = data.retrieve_data_point(i);
+		X.insert(X.end(), x.begin(), x.end());
+	}
+	std::vector<num_t> quantiles = {0.1, 0.5, 0.9};
+
+	for (index_t num_threads : {1u, 3u}){
+		the_forest.options.num_threads = num_threads;
+
+		std::vector<response_t> preds(n);
+		std::vector<num_t> means(n), vars(n), qs(n*quantiles.size());
+		the_forest.predict_batch(X.data(), n, d, preds.data());
+		the_forest.predict_mean_var_batch(X.data(), n, d, means.data(), vars.data());
+		the_forest.predict_quantiles_batch(X.data(), n, d, quantiles, qs.data());
+
+		for (auto i=0u; i < n; ++i){
+			auto x = data.retrieve_data_point(i);
+			BOOST_REQUIRE_EQUAL(preds[i], the_forest.predict(x));
+			auto mv = the_forest.predict_mean_var(x);
+			BOOST_REQUIRE_EQUAL(means[i], mv.first);
+			BOOST_REQUIRE_EQUAL(vars[i], mv.second);
+			auto q = the_forest.predict_quantiles(x, quantiles);
+			BOOST_CHECK_EQUAL_COLLECTIONS(q.begin(), q.end(), qs.begin()+i*quantiles.size(), qs.begin()+(i+1)*quantiles.size());
+		}
+	}
+
+	std::vector<response_t> preds(n);
+	BOOST_REQUIRE_THROW(the_forest.predict_batch(X.data(), n/2, 2*d, preds.data()), std::runtime_error);
+}
+
+
+
+BOOST_AUTO_TEST_CASE( regression_forest_freeze_test ){
+
+	std::string dir(boost::unit_test::framework::master_test_suite().argv[1]);
+
+	// the toy data has a categorical feature, the diabetes data only continuous ones
+	data_container_type toy_data(2);
+	toy_data.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv");
+	toy_data.set_type_of_feature(1, 10);
+
+	for (auto data: {toy_data, load_diabetes_data()}){
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = data.num_features();
+
+		rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+		forest_opts.num_data_points_per_tree = data.num_data_points();
+		forest_opts.num_trees = 10;
+		forest_opts.compute_law_of_total_variance = true;
+
+		forest_type the_forest(forest_opts);
+		BOOST_REQUIRE_THROW(the_forest.freeze(), std::runtime_error);
+
+		rng_t rng(3);
+		the_forest.fit(data, rng);
+		auto frozen = the_forest.freeze();
+
+		BOOST_REQUIRE_EQUAL(frozen.num_trees(), the_forest.num_trees());
+
+		index_t n = data.num_data_points(), d = data.num_features();
+		std::vector<num_t> X;
+		for (auto i=0u; i < n; ++i){
+			auto x = data.retrieve_data_point(i);
+			X.insert(X.end(), x.begin(), x.end());
+
+			BOOST_REQUIRE_EQUAL(frozen.predict(x), the_forest.predict(x));
+			auto mv1 = frozen.predict_mean_var(x);
+			auto mv2 = the_forest.predict_mean_var(x);
+			BOOST_REQUIRE_EQUAL(mv1.first, mv2.first);
+			BOOST_REQUIRE_EQUAL(mv1.second, mv2.second);
+		}
+
+		std::vector<num_t> preds1(n), preds2(n), vars1(n), vars2(n);
+		the_forest.predict_mean_var_batch(X.data(), n, d, preds1.data(), vars1.data(), true);
+		frozen.predict_mean_var_batch(X.data(), n, d, preds2.data(), vars2.data(), true);
+		BOOST_CHECK_EQUAL_COLLECTIONS(preds1.begin(), preds1.end(), preds2.begin(), preds2.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(vars1.begin(), vars1.end(), vars2.begin(), vars2.end());
+
+		frozen.predict_batch(X.data(), n, d, preds2.data());
+		the_forest.predict_batch(X.data(), n, d, preds1.data());
+		BOOST_CHECK_EQUAL_COLLECTIONS(preds1.begin(), preds1.end(), preds2.begin(), preds2.end());
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE( regression_forest_quickscorer_test ){
+
+	std::string dir(boost::unit_test::framework::master_test_suite().argv[1]);
+
+	// the toy data has a categorical feature, the diabetes data only continuous ones
+	data_container_type toy_data(2);
+	toy_data.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv");
+	toy_data.set_type_of_feature(1, 10);
+
+	for (auto data: {toy_data, load_diabetes_data()}){
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = data.num_features();
+
+		rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+		forest_opts.num_data_points_per_tree = data.num_data_points();
+		forest_opts.num_trees = 10;
+
+		rng_t rng(3);
+		forest_type the_forest(forest_opts);
+		BOOST_REQUIRE_THROW(the_forest.make_quickscorer(), std::runtime_error);
+
+		// the fully grown trees on the larger data set have too many leaves
+		if (data.num_data_points() > 2*64){
+			the_forest.fit(data, rng);
+			BOOST_REQUIRE_THROW(the_forest.make_quickscorer(), std::runtime_error);
+		}
+
+		the_forest.options.tree_opts.max_num_leaves = 64;
+		the_forest.fit(data, rng);
+		auto qs = the_forest.make_quickscorer();
+		BOOST_REQUIRE_EQUAL(qs.num_trees(), the_forest.num_trees());
+
+		// a single tree finds the same leaves
+		tree_type the_tree;
+		the_tree.fit(data, the_forest.options.tree_opts, std::vector<num_t>(data.num_data_points(), 1), rng);
+		rfr::forests::quickscorer_forest<num_t, response_t, index_t> qs_tree(data.num_features(), 1);
+		qs_tree.add_tree(the_tree);
+
+		index_t n = data.num_data_points(), d = data.num_features();
+		std::vector<num_t> X;
+		for (auto i=0u; i < n; ++i){
+			auto x = data.retrieve_data_point(i);
+			X.insert(X.end(), x.begin(), x.end());
+
+			BOOST_REQUIRE_EQUAL(qs.predict(x), the_forest.predict(x));
+
+			index_t leaf;
+			qs_tree.find_leaves(x.data(), &leaf);
+			BOOST_REQUIRE_EQUAL(qs_tree.leaf_node_index(leaf), the_tree.find_leaf_index(x));
+		}
+
+		// every kernel the processor supports gives the same predictions
+		typedef rfr::forests::quickscorer_forest<num_t, response_t, index_t> quickscorer_type;
+		std::vector<num_t> preds1(n), preds2(n);
+		the_forest.predict_batch(X.data(), n, d, preds1.data());
+		for (int set = quickscorer_type::scalar; set <= quickscorer_type::best_instruction_set(); ++set){
+			std::fill(preds2.begin(), preds2.end(), NAN);
+			qs.predict_batch(X.data(), n, d, preds2.data(), quickscorer_type::instruction_set_t(set));
+			BOOST_CHECK_EQUAL_COLLECTIONS(preds1.begin(), preds1.end(), preds2.begin(), preds2.end());
+		}
+
+		// feature vectors exactly at the thresholds of the continuous splits go left, the next larger values right;
+		// NANs go left everywhere
+		std::vector<num_t> Q;
+		for (auto i=0u; i < the_tree.number_of_nodes(); ++i){
+			auto &node = the_tree.get_node(i);
+			if (node.is_a_leaf() || std::isnan(node.get_split().get_num_split_value())) continue;
+			auto x = data.retrieve_data_point(i % n);
+			index_t f = node.get_split().get_feature_index();
+			num_t t = node.get_split().get_num_split_value();
+			for (num_t v: {t, std::nextafter(t, num_t(INFINITY)), num_t(NAN)}){
+				x[f] = v;
+				Q.insert(Q.end(), x.begin(), x.end());
+			}
+		}
+		index_t m = Q.size()/d;
+		BOOST_REQUIRE(m > 0);
+		std::vector<num_t> tree_preds(m), qs_preds(m);
+		for (auto j=0u; j < m; ++j){
+			std::vector<num_t> q(Q.begin() + j*d, Q.begin() + (j+1)*d);
+			tree_preds[j] = the_tree.predict(q);
+
+			index_t leaf;
+			qs_tree.find_leaves(q.data(), &leaf);
+			BOOST_REQUIRE_EQUAL(qs_tree.leaf_node_index(leaf), the_tree.find_leaf_index(q));
+		}
+		for (int set = quickscorer_type::scalar; set <= quickscorer_type::best_instruction_set(); ++set){
+			std::fill(qs_preds.begin(), qs_preds.end(), NAN);
+			qs_tree.predict_batch(Q.data(), m, d, qs_preds.data(), quickscorer_type::instruction_set_t(set));
+			BOOST_CHECK_EQUAL_COLLECTIONS(tree_preds.begin(), tree_preds.end(), qs_preds.begin(), qs_preds.end());
+		}
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE( regression_forest_leaf_indices_test ){
+
+	std::string dir(boost::unit_test::framework::master_test_suite().argv[1]);
+
+	data_container_type data(2);
+	data.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv");
+	data.set_type_of_feature(1, 10);
+
+	rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+	tree_opts.max_features = 2;
+	tree_opts.min_samples_in_leaf = 5;
+
+	rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+	forest_opts.num_data_points_per_tree = data.num_data_points();
+	forest_opts.num_trees = 10;
+	forest_opts.num_threads = 3;
+
+	rng_t rng(11);
+	forest_type the_forest(forest_opts);
+	the_forest.fit(data, rng);
+
+	index_t n = data.num_data_points(), d = data.num_features(), T = the_forest.num_trees();
+	std::vector<num_t> X;
+	for (auto i=0u; i < n; ++i){
+		auto x = data.retrieve_data_point(i);
+		X.insert(X.end(), x.begin(), x.end());
+	}
+
+	std::vector<index_t> leaves(n*T), columns(n*T);
+	the_forest.predict_leaf_indices(X.data(), n, d, leaves.data());
+	the_forest.forest_embedding(X.data(), n, d, columns.data());
+	BOOST_REQUIRE_THROW(the_forest.predict_leaf_indices(X.data(), n, d+1, leaves.data()), std::runtime_error);
+
+	// every tree has its own range of columns, and points share a column iff they share the leaf
+	index_t dim = the_forest.embedding_dimension();
+	for (auto i=0u; i < n; ++i){
+		for (auto t=0u; t < T; ++t){
+			BOOST_REQUIRE_LT(columns[i*T + t], dim);
+			if (t > 0) BOOST_REQUIRE_LT(columns[i*T + t-1], columns[i*T + t]);
+			for (auto j=0u; j < i; ++j)
+				BOOST_REQUIRE_EQUAL(leaves[i*T + t] == leaves[j*T + t], columns[i*T + t] == columns[j*T + t]);
+		}
+	}
+
+	std::vector<num_t> K(n*n), C(n*n);
+	the_forest.kernel_matrix(X.data(), n, d, K.data());
+	the_forest.covariance_matrix(X.data(), n, d, C.data());
+	for (auto i=0u; i < n; ++i){
+		auto xi = data.retrieve_data_point(i);
+		for (auto j=0u; j < n; ++j){
+			auto xj = data.retrieve_data_point(j);
+			BOOST_REQUIRE_EQUAL(K[i*n + j], the_forest.kernel(xi, xj));
+			BOOST_REQUIRE_EQUAL(C[i*n + j], the_forest.covariance(xi, xj));
+		}
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE( regression_forest_cpp_source_test ){
+#ifndef RFR_TEST_CXX_COMPILER
+	BOOST_TEST_MESSAGE("No compiler given to build the generated code, skipping the test.");
+#else
+	std::string dir(boost::unit_test::framework::master_test_suite().argv[1]);
+
+	data_container_type toy_data(2);
+	toy_data.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv");
+	toy_data.set_type_of_feature(1, 10);
+
+	int run = 0;
+	for (auto data: {toy_data, load_diabetes_data()}){
+		rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+		tree_opts.max_features = data.num_features();
+
+		rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+		forest_opts.num_data_points_per_tree = data.num_data_points();
+		forest_opts.num_trees = 10;
+		forest_opts.compute_law_of_total_variance = (run == 0);
+
+		rng_t rng(7);
+		forest_type the_forest(forest_opts);
+		BOOST_REQUIRE_THROW(the_forest.save_cpp_source("generated_forest_test.cpp"), std::runtime_error);
+		the_forest.fit(data, rng);
+
+		// the code is generated from the saved forest
+		the_forest.save_to_binary_file("generated_forest_test.bin");
+		forest_type loaded_forest;
+		loaded_forest.load_from_binary_file("generated_forest_test.bin");
+		// the second forest's functions get a prefix
+		std::string prefix = (run == 0) ? "" : "diabetes_";
+		BOOST_REQUIRE_THROW(loaded_forest.save_cpp_source("generated_forest_test.cpp", "2forest"), std::runtime_error);
+		BOOST_REQUIRE_THROW(loaded_forest.save_cpp_source("generated_forest_test.cpp", "my-forest"), std::runtime_error);
+		loaded_forest.save_cpp_source("generated_forest_test.cpp", prefix);
+
+		std::string library = "./generated_forest_test_" + std::to_string(run++) + ".so";
+		std::string command = std::string(RFR_TEST_CXX_COMPILER) + " -std=c++11 -O2 -shared -fPIC -o " + library + " generated_forest_test.cpp";
+		BOOST_REQUIRE_EQUAL(std::system(command.c_str()), 0);
+
+		void *handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+		BOOST_REQUIRE(handle != nullptr);
+
+		auto num_trees = reinterpret_cast<unsigned int (*)()>(dlsym(handle, (prefix + "num_trees").c_str()));
+		auto predict = reinterpret_cast<response_t (*)(const num_t*)>(dlsym(handle, (prefix + "predict").c_str()));
+		auto predict_mean_var = reinterpret_cast<void (*)(const num_t*, int, num_t*, num_t*)>(dlsym(handle, (prefix + "predict_mean_var").c_str()));
+		BOOST_REQUIRE(num_trees && predict && predict_mean_var);
+		BOOST_REQUIRE(dlsym(handle, (prefix + "num_features").c_str()) != nullptr);
+		if (!prefix.empty())
+			BOOST_REQUIRE(dlsym(handle, "predict") == nullptr);
+		BOOST_REQUIRE_EQUAL(num_trees(), the_forest.num_trees());
+
+		for (auto i=0u; i < data.num_data_points(); ++i){
+			auto x = data.retrieve_data_point(i);
+			BOOST_REQUIRE_EQUAL(predict(x.data()), the_forest.predict(x));
+
+			for (int weighted: {0, 1}){
+				num_t mean, var;
+				predict_mean_var(x.data(), weighted, &mean, &var);
+				auto p = the_forest.predict_mean_var(x, weighted);
+				BOOST_REQUIRE_EQUAL(mean, p.first);
+				BOOST_REQUIRE_EQUAL(var, p.second);
+			}
+		}
+		dlclose(handle);
+	}
+#endif
+}
+
+
+
+BOOST_AUTO_TEST_CASE( frozen_forest_mmap_file_test ){
+
+	std::string dir(boost::unit_test::framework::master_test_suite().argv[1]);
+
+	data_container_type data(2);
+	data.import_csv_files(dir + "toy_data_set_features.csv", dir + "toy_data_set_responses.csv");
+	data.set_type_of_feature(1, 10);
+
+	rfr::trees::tree_options<num_t, response_t, index_t> tree_opts;
+	tree_opts.max_features = 2;
+
+	rfr::forests::forest_options<num_t, response_t, index_t> forest_opts(tree_opts);
+	forest_opts.num_data_points_per_tree = data.num_data_points();
+	forest_opts.num_trees = 10;
+
+	forest_type the_forest(forest_opts);
+	rng_t rng(5);
+	the_forest.fit(data, rng);
+
+	auto frozen = the_forest.freeze();
+	frozen.save_to_mmap_file("frozen_forest_test.bin");
+
+	typedef rfr::forests::frozen_forest<num_t, response_t, index_t> frozen_type;
+	frozen_type mapped;
+	mapped.load_from_mmap_file("frozen_forest_test.bin");
+	BOOST_REQUIRE(mapped.is_memory_mapped());
+	BOOST_REQUIRE(!frozen.is_memory_mapped());
+
+	// copies share the mapped file
+	auto mapped2 = mapped;
+
+	BOOST_REQUIRE_EQUAL(mapped2.num_trees(), frozen.num_trees());
+	BOOST_REQUIRE_EQUAL(mapped2.num_nodes(), frozen.num_nodes());
+	BOOST_REQUIRE_EQUAL(mapped2.num_leaves(), frozen.num_leaves());
+
+	auto t1 = frozen.get_types(), t2 = mapped2.get_types();
+	BOOST_CHECK_EQUAL_COLLECTIONS(t1.begin(), t1.end(), t2.begin(), t2.end());
+	auto b1 = frozen.get_bounds(), b2 = mapped2.get_bounds();
+	// the bounds of categorical features are NANs
+	BOOST_REQUIRE_EQUAL(b1.size(), b2.size());
+	for (auto i=0u; i < b1.size(); ++i){
+		for (auto j=0u; j < 2; ++j)
+			BOOST_REQUIRE((b1[i][j] == b2[i][j]) || (std::isnan(b1[i][j]) && std::isnan(b2[i][j])));
+	}
+
+	for (auto i=0u; i < data.num_data_points(); ++i){
+		auto x = data.retrieve_data_point(i);
+		BOOST_REQUIRE_EQUAL(mapped2.predict(x), the_forest.predict(x));
+		auto mv1 = mapped2.predict_mean_var(x);
+		auto mv2 = the_forest.predict_mean_var(x);
+		BOOST_REQUIRE_EQUAL(mv1.first, mv2.first);
+		BOOST_REQUIRE_EQUAL(mv1.second, mv2.second);
+	}
+
+	BOOST_REQUIRE_THROW(mapped.add_tree(tree_type()), std::runtime_error);
+	BOOST_REQUIRE_THROW(mapped.load_from_mmap_file("does_not_exist.bin"), std::runtime_error);
+
+	// a file of a different kind
+	the_forest.save_to_binary_file("regression_forest_test.bin");
+	BOOST_REQUIRE_THROW(mapped.load_from_mmap_file("regression_forest_test.bin"), std::runtime_error);
+
+	// corrupted files: the header starts with 8 magic bytes and 6 32 bit values, followed by the 64 bit
+	// numbers of features, trees, nodes, leaves, categorical splits, words per set, the lotv flag, and the offsets
+	std::string bytes;
+	{
+		std::ifstream ifs("frozen_forest_test.bin", std::ios::binary);
+		bytes.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+	}
+	auto load_modified = [&] (size_t position, std::uint64_t value, size_t size){
+		std::string modified(bytes);
+		std::memcpy(&modified[position], &value, size);
+		std::ofstream("frozen_forest_corrupted.bin", std::ios::binary).write(modified.data(), modified.size());
+		mapped.load_from_mmap_file("frozen_forest_corrupted.bin");
+	};
+	std::uint64_t nodes_offset;
+	std::memcpy(&nodes_offset, &bytes[88], 8);
+
+	// sizes that overflow when multiplied or added to the offsets
+	BOOST_REQUIRE_THROW(load_modified(48, std::uint64_t(1) << 62, 8), std::runtime_error);
+	BOOST_REQUIRE_THROW(load_modified(64, std::uint64_t(1) << 40, 8), std::runtime_error);
+	BOOST_REQUIRE_THROW(load_modified(72, std::uint64_t(1) << 60, 8), std::runtime_error);
+	BOOST_REQUIRE_THROW(load_modified(88, ~std::uint64_t(63), 8), std::runtime_error);
+	// a child pointing back to the root, and one beyond the last node
+	size_t child_position = nodes_offset + offsetof(frozen_type::node_t, child_index);
+	BOOST_REQUIRE_THROW(load_modified(child_position, 0, sizeof(index_t)), std::runtime_error);
+	BOOST_REQUIRE_THROW(load_modified(child_position, frozen.num_nodes(), sizeof(index_t)), std::runtime_error);
+
+	// the forest is unchanged by the failed loads
+	BOOST_REQUIRE_EQUAL(mapped.num_nodes(), frozen.num_nodes());
+	auto x = data.retrieve_data_point(0);
+	BOOST_REQUIRE_EQUAL(mapped.predict(x), the_forest.predict(x));
+}
+
+
+
 BOOST_AUTO_TEST_CASE( regression_forest_exceptions_tests ){
     
     auto data = load_diabetes_data();
@@ -198,6 +833,7 @@ BOOST_AUTO_TEST_CASE( regression_forest_exceptions_tests ){
 	forest_opts.num_trees = 8;
 	forest_opts.do_bootstrapping = false;
 	forest_opts.compute_oob_error= true;
+	forest_opts.num_threads = 3;
 	
 	forest_type the_forest(forest_opts);
 	
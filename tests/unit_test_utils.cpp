@@ -1,7 +1,14 @@
 #include <cmath>
+#include <fstream>
+#include <iterator>
+#include <string>
 #include <boost/test/unit_test.hpp>
 #include "rfr/util.hpp"
 
+// this file tests the portable fallback that reads the files instead of mapping them
+#define RFR_NO_MMAP
+#include "rfr/memory_mapped_file.hpp"
+
 BOOST_AUTO_TEST_CASE(merge_feature_vectors_test){
 	
 	double v1[4] = {1,2,3,nan("")};
@@ -365,3 +372,97 @@ BOOST_AUTO_TEST_CASE(test_boolean_vector_helper){
 
 
 
+
+
+BOOST_AUTO_TEST_CASE(test_nested_parallel_for){
+
+	unsigned int hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+	BOOST_REQUIRE_EQUAL(rfr::util::enclosing_num_threads(), 1);
+	BOOST_REQUIRE_EQUAL(rfr::util::effective_num_threads(0, 1000), std::min(hardware_threads, 1000u));
+
+	// the inner loops only get the hardware threads the outer loop does not use
+	unsigned int outer = std::max(2u, hardware_threads/2);
+	std::vector<unsigned int> inner(outer);
+	rfr::util::parallel_for<unsigned int>(outer, outer, [&] (unsigned int i){
+		inner[i] = rfr::util::effective_num_threads(0, 1000);
+	});
+	for (auto n: inner)
+		BOOST_REQUIRE_EQUAL(n, std::max(1u, hardware_threads/outer));
+
+	BOOST_REQUIRE_EQUAL(rfr::util::enclosing_num_threads(), 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_make_rng){
+
+	// sibling streams are seeded with consecutive outputs of the same engine
+	std::default_random_engine rng(0);
+	auto seed1 = rng(), seed2 = rng();
+
+	// seeded directly, the first stream is just the second one shifted by one value
+	std::default_random_engine raw1(seed1), raw2(seed2);
+	raw1.discard(1);
+	BOOST_REQUIRE(raw1 == raw2);
+
+	auto rng1 = rfr::util::make_rng<std::default_random_engine>(seed1);
+	auto rng2 = rfr::util::make_rng<std::default_random_engine>(seed2);
+	rng1.discard(1);
+	std::vector<std::default_random_engine::result_type> values1(100), values2(100);
+	for (auto i=0u; i<100; ++i){
+		values1[i] = rng1();
+		values2[i] = rng2();
+	}
+	BOOST_REQUIRE(values1 != values2);
+
+	// the same seed gives the same stream
+	BOOST_REQUIRE(rfr::util::make_rng<std::default_random_engine>(seed1) == rfr::util::make_rng<std::default_random_engine>(seed1));
+}
+
+
+BOOST_AUTO_TEST_CASE(test_rss_split_loss){
+
+	// two groups with a large common offset, shifted by their mean
+	std::vector<double> y({1e8+1, 1e8+1, 1e8+3, 1e8+3, 1e8+3});
+	std::vector<double> w({1, 2, 1, 1, 1});
+	double shift = 1e8 + 2;
+
+	rfr::util::shifted_response_sums<> left;
+	rfr::util::shifted_response_sums<rfr::util::compensated_sum> total;
+	for (auto i=0u; i<y.size(); ++i){
+		total.push(y[i] - shift, w[i]);
+		if (i < 2) left.push(y[i] - shift, w[i]);
+	}
+	BOOST_REQUIRE_EQUAL(total.n, 5);
+	BOOST_REQUIRE_EQUAL(total.sum_of_weights(), 6);
+
+	// both children are pure
+	rfr::util::rss_split_loss loss_of_split(total);
+	BOOST_REQUIRE_EQUAL(loss_of_split(left), 0);
+
+	// moving one point with response 1e8+3 to the left: 3 points at -1 and one at +1 (weights included)
+	left.push(y[2] - shift, w[2]);
+	BOOST_REQUIRE_CLOSE(loss_of_split(left), 3., 1e-10);
+
+	rfr::util::shifted_response_sums<> sum_of_parts;
+	sum_of_parts += left;
+	sum_of_parts.push(y[3] - shift, w[3]);
+	sum_of_parts.push(y[4] - shift, w[4]);
+	BOOST_REQUIRE_EQUAL(sum_of_parts.n, total.n);
+	BOOST_REQUIRE_EQUAL(sum_of_parts.wy2, total.wy2.value());
+}
+
+
+BOOST_AUTO_TEST_CASE(test_memory_mapped_file_fallback){
+
+	BOOST_REQUIRE(!rfr::util::memory_mapped_file::is_shared());
+
+	std::string filename = std::string(boost::unit_test::framework::master_test_suite().argv[1]) + "toy_data_set_features.csv";
+	std::ifstream ifs(filename, std::ios::binary);
+	std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+	rfr::util::memory_mapped_file file(filename);
+	BOOST_REQUIRE_EQUAL(file.size(), contents.size());
+	BOOST_REQUIRE(std::string(file.data(), file.size()) == contents);
+
+	BOOST_REQUIRE_THROW(rfr::util::memory_mapped_file("this_file_does_not_exist.csv"), std::runtime_error);
+}